@@ -0,0 +1,144 @@
+/*
+ * Copyright (C) 2016 Jared Boone, ShareBrained Technology, Inc.
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "agc_thread.hpp"
+
+#include "portapack_shared_memory.hpp"
+#include "radio.hpp"
+#include "max2837.hpp"
+
+#include <algorithm>
+
+namespace agc {
+
+Settings settings_for_mode(const int32_t mode) {
+	switch(mode) {
+	case 0:		return { -18, 4, 12, 2, 10, 150 };	/* AM */
+	case 2:		return { -12, 4, 12, 2,  5, 150 };	/* WFM */
+	case 3:		return { -15, 5, 16, 2, 20, 150 };	/* AIS */
+	case 5:		return { -15, 5, 16, 2, 30, 150 };	/* TPMS */
+	case 7:		return { -20, 6,  8, 2, 20, 150 };	/* Capture */
+	default:
+	case 1:		return { -12, 4, 12, 2,  5, 150 };	/* NFM */
+	}
+}
+
+} /* namespace agc */
+
+// AGCThread //////////////////////////////////////////////////////////////
+
+/* Reports arrive every 100ms while a processor is running. */
+constexpr systime_t report_timeout = MS2ST(500);
+
+Thread* AGCThread::thread = nullptr;
+
+AGCThread::AGCThread(
+	const agc::Settings& settings,
+	const int32_t lna_db,
+	const int32_t vga_db
+) : settings(settings),
+	lna_max_db { max2837::lna::gain_db_range.clip(lna_db) },
+	vga_max_db { max2837::vga::gain_db_range.clip(vga_db) }
+{
+	shared_memory.baseband_queue.push_and_wait(
+		AGCConfigMessage { &report }
+	);
+
+	thread = chThdCreateFromHeap(NULL, 512, NORMALPRIO + 10, AGCThread::static_fn, this);
+}
+
+AGCThread::~AGCThread() {
+	if( thread ) {
+		chThdTerminate(thread);
+		chEvtSignal(thread, EVT_MASK_AGC_THREAD);
+		chThdWait(thread);
+		thread = nullptr;
+	}
+
+	shared_memory.baseband_queue.push_and_wait(
+		AGCConfigMessage { nullptr }
+	);
+}
+
+void AGCThread::check_report_isr() {
+	if( thread ) {
+		chEvtSignalI(thread, EVT_MASK_AGC_THREAD);
+	}
+}
+
+msg_t AGCThread::run() {
+	uint32_t sequence = report.sequence;
+
+	while( !chThdShouldTerminate() ) {
+		chEvtWaitAnyTimeout(EVT_MASK_AGC_THREAD, report_timeout);
+
+		if( report.sequence != sequence ) {
+			sequence = report.sequence;
+			update(report.channel_max_db, report.saturation, report.rssi_max);
+		}
+	}
+
+	return true;
+}
+
+void AGCThread::update(const int32_t channel_max_db, const bool saturation, const uint32_t rssi_max) {
+	const int32_t error_db = channel_max_db - settings.target_db;
+	int32_t new_reduction_db = reduction_db;
+
+	if( saturation || (rssi_max >= settings.rssi_limit) ) {
+		// Clipped, so there's no telling how far over. Cut hard.
+		new_reduction_db += settings.attack_db;
+		below_count = 0;
+	} else if( error_db > settings.hysteresis_db ) {
+		new_reduction_db += std::min(error_db, settings.attack_db);
+		below_count = 0;
+	} else if( error_db < -settings.hysteresis_db ) {
+		if( below_count < settings.decay_hold ) {
+			below_count++;
+		} else {
+			new_reduction_db -= std::min(-error_db, settings.decay_db);
+		}
+	} else {
+		below_count = 0;
+	}
+
+	new_reduction_db = std::max(std::min(new_reduction_db, lna_max_db + vga_max_db), 0);
+	if( new_reduction_db != reduction_db ) {
+		reduction_db = new_reduction_db;
+		apply();
+	}
+}
+
+/* Whole LNA steps are taken off the LNA, which is where strong signals
+ * overload the front end. The VGA takes the rest, for fine steps.
+ */
+void AGCThread::apply() {
+	const int32_t lna_cut_db = std::min(
+		reduction_db - (reduction_db % max2837::lna::gain_db_step),
+		lna_max_db
+	);
+	const int32_t lna_db = lna_max_db - lna_cut_db;
+	const int32_t vga_db = std::max(vga_max_db - (reduction_db - lna_cut_db), 0);
+
+	radio::Transaction transaction;
+	radio::set_lna_gain(lna_db);
+	radio::set_vga_gain(vga_db);
+}
@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2016 Jared Boone, ShareBrained Technology, Inc.
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __AGC_THREAD_H__
+#define __AGC_THREAD_H__
+
+#include "ch.h"
+
+#include "event_m0.hpp"
+#include "message.hpp"
+
+#include <cstdint>
+#include <cstddef>
+
+namespace agc {
+
+struct Settings {
+	int32_t target_db;			/* Channel peak, dBFS, the loop aims for */
+	int32_t hysteresis_db;		/* No correction within this of the target */
+	int32_t attack_db;			/* Largest gain cut per report */
+	int32_t decay_db;			/* Largest gain restored per report */
+	size_t decay_hold;			/* Reports below target before restoring gain */
+	uint32_t rssi_limit;		/* Raw RSSI peak taken as front-end overload */
+};
+
+/* Presets by baseband mode. Packet modes hold gain longer between bursts. */
+Settings settings_for_mode(const int32_t mode);
+
+} /* namespace agc */
+
+/* Closed-loop gain control on the baseband's channel statistics. Gain is
+ * only ever cut below, and restored up to, the LNA and VGA gains it starts
+ * with. Runs on its own thread, so corrections don't wait behind the UI.
+ */
+class AGCThread {
+public:
+	AGCThread(
+		const agc::Settings& settings,
+		const int32_t lna_db,
+		const int32_t vga_db
+	);
+	~AGCThread();
+
+	static void check_report_isr();
+
+private:
+	AGCReport report;
+	const agc::Settings settings;
+	const int32_t lna_max_db;
+	const int32_t vga_max_db;
+	int32_t reduction_db { 0 };
+	size_t below_count { 0 };
+	static Thread* thread;
+
+	static msg_t static_fn(void* arg) {
+		auto obj = static_cast<AGCThread*>(arg);
+		return obj->run();
+	}
+
+	msg_t run();
+
+	void update(const int32_t channel_max_db, const bool saturation, const uint32_t rssi_max);
+	void apply();
+};
+
+#endif/*__AGC_THREAD_H__*/
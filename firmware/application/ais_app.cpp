@@ -134,20 +134,12 @@ AISLogger::AISLogger(
 {
 }
 
-void AISLogger::on_packet(const ais::Packet& packet) {
+void AISLogger::on_packet(const baseband::Packet& packet, const bool valid) {
 	// TODO: Unstuff here, not in baseband!
 	if( log_file.is_open() ) {
-		std::string entry;
-		entry.reserve((packet.length() + 3) / 4);
-
-		for(size_t i=0; i<packet.length(); i+=4) {
-			const auto nibble = packet.read(i, 4);
-			entry += (nibble >= 10) ? ('W' + nibble) : ('0' + nibble);
-		}
-
-		log_file.write_entry(packet.received_at(), entry);
+		log_file.write(packet_log::Protocol::AIS, 0, valid, packet);
 	}
-}	
+}
 
 void AISRecentEntry::update(const ais::Packet& packet) {
 	received_count++;
@@ -299,16 +291,16 @@ AISAppView::AISAppView(NavigationView&) {
 	add_children({ {
 		&label_channel,
 		&options_channel,
-		&recent_entries_view,
-		&recent_entry_detail_view,
 	} });
-
-	recent_entry_detail_view.hidden(true);
+	init_entries_views();
 
 	EventDispatcher::message_map().register_handler(Message::ID::AISPacket,
 		[this](Message* const p) {
 			const auto message = static_cast<const AISPacketMessage*>(p);
 			const ais::Packet packet { message->packet };
+			if( this->logger ) {
+				this->logger->on_packet(message->packet, packet.is_valid());
+			}
 			if( packet.is_valid() ) {
 				this->on_packet(packet);
 			}
@@ -322,7 +314,7 @@ AISAppView::AISAppView(NavigationView&) {
 		sampling_rate,
 		baseband_bandwidth,
 		rf::Direction::Receive,
-		false, 32, 32,
+		false, lna_gain_db, vga_gain_db,
 		1,
 	});
 
@@ -332,30 +324,44 @@ AISAppView::AISAppView(NavigationView&) {
 		.decimation_factor = 1,
 	});
 
+	// Strong signals nearby overload the front end at fixed gain.
+	agc_thread = std::make_unique<AGCThread>(agc::settings_for_mode(3), lna_gain_db, vga_gain_db);
+
 	options_channel.on_change = [this](size_t, OptionsField::value_t v) {
 		this->on_frequency_changed(v);
 	};
 	options_channel.set_by_value(target_frequency());
 
-	recent_entries_view.on_select = [this](const AISRecentEntry& entry) {
-		this->on_show_detail(entry);
-	};
-	recent_entry_detail_view.on_close = [this]() {
-		this->on_show_list();
-	};
+	logger = std::make_unique<AISLogger>(next_filename_stem_matching_pattern("AIS_????") + ".PKT");
+}
 
-	logger = std::make_unique<AISLogger>("ais.txt");
+/* No receiver and no log: a new, empty log would become the last one. */
+AISAppView::AISAppView(
+	NavigationView&,
+	const std::string& replay_file_path
+) : live { false }
+{
+	init_entries_views();
+	replay(replay_file_path);
 }
 
 AISAppView::~AISAppView() {
-	baseband::stop();
-	radio::disable();
+	if( live ) {
+		agc_thread.reset();
+
+		baseband::stop();
+		radio::disable();
 
-	EventDispatcher::message_map().unregister_handler(Message::ID::AISPacket);
+		EventDispatcher::message_map().unregister_handler(Message::ID::AISPacket);
+	}
 }
 
 void AISAppView::focus() {
-	options_channel.focus();
+	if( live ) {
+		options_channel.focus();
+	} else {
+		recent_entries_view.focus();
+	}
 }
 
 void AISAppView::set_parent_rect(const Rect new_parent_rect) {
@@ -365,11 +371,36 @@ void AISAppView::set_parent_rect(const Rect new_parent_rect) {
 	recent_entry_detail_view.set_parent_rect(content_rect);
 }
 
-void AISAppView::on_packet(const ais::Packet& packet) {
-	if( logger ) {
-		logger->on_packet(packet);
+void AISAppView::init_entries_views() {
+	add_children({ {
+		&recent_entries_view,
+		&recent_entry_detail_view,
+	} });
+
+	recent_entry_detail_view.hidden(true);
+
+	recent_entries_view.on_select = [this](const AISRecentEntry& entry) {
+		this->on_show_detail(entry);
+	};
+	recent_entry_detail_view.on_close = [this]() {
+		this->on_show_list();
+	};
+}
+
+void AISAppView::replay(const std::string& file_path) {
+	packet_log::Reader reader { file_path };
+	packet_log::Record record;
+	while( reader.read(record) ) {
+		if( record.protocol() == packet_log::Protocol::AIS ) {
+			const ais::Packet packet { record.packet() };
+			if( packet.is_valid() ) {
+				on_packet(packet);
+			}
+		}
 	}
+}
 
+void AISAppView::on_packet(const ais::Packet& packet) {
 	const auto updated_entry = recent.on_packet(packet.source_id(), packet);
 	recent_entries_view.set_dirty();
 
@@ -25,10 +25,12 @@
 #include "ui_widget.hpp"
 #include "ui_navigation.hpp"
 
-#include "log_file.hpp"
+#include "packet_log.hpp"
 
 #include "ais_packet.hpp"
 
+#include "agc_thread.hpp"
+
 #include "lpc43xx_cpp.hpp"
 using namespace lpc43xx;
 
@@ -92,10 +94,10 @@ class AISLogger {
 public:
 	AISLogger(const std::string& file_path);
 
-	void on_packet(const ais::Packet& packet);
+	void on_packet(const baseband::Packet& packet, const bool valid);
 
 private:
-	LogFile log_file;
+	packet_log::Writer log_file;
 };
 
 namespace ui {
@@ -134,6 +136,8 @@ private:
 class AISAppView : public View {
 public:
 	AISAppView(NavigationView& nav);
+	/* Shows the packets in a log instead of receiving. */
+	AISAppView(NavigationView& nav, const std::string& replay_file_path);
 	~AISAppView();
 
 	void set_parent_rect(const Rect new_parent_rect) override;
@@ -144,15 +148,19 @@ public:
 
 	void focus() override;
 
-	std::string title() const override { return "AIS"; };
+	std::string title() const override { return live ? "AIS" : "AIS Replay"; };
 
 private:
 	static constexpr uint32_t initial_target_frequency = 162025000;
 	static constexpr uint32_t sampling_rate = 2457600;
 	static constexpr uint32_t baseband_bandwidth = 1750000;
+	static constexpr int32_t lna_gain_db = 32;
+	static constexpr int32_t vga_gain_db = 32;
 
+	const bool live { true };
 	AISRecentEntries recent;
 	std::unique_ptr<AISLogger> logger;
+	std::unique_ptr<AGCThread> agc_thread;
 
 	AISRecentEntriesView recent_entries_view { recent };
 	AISRecentEntryDetailView recent_entry_detail_view;
@@ -175,6 +183,8 @@ private:
 
 	uint32_t target_frequency_ = initial_target_frequency;
 
+	void init_entries_views();
+	void replay(const std::string& file_path);
 	void on_packet(const ais::Packet& packet);
 	void on_show_list();
 	void on_show_detail(const AISRecentEntry& entry);
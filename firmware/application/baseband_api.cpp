@@ -41,7 +41,7 @@ void AMConfig::apply() const {
 	audio::set_rate(audio::Rate::Hz_12000);
 }
 
-void NBFMConfig::apply() const {
+void NBFMConfig::apply(const uint32_t ctcss_tone) const {
 	const NBFMConfigureMessage message {
 		decim_0,
 		decim_1,
@@ -49,7 +49,8 @@ void NBFMConfig::apply() const {
 		2,
 		deviation,
 		audio_24k_hpf_300hz_config,
-		audio_24k_deemph_300_6_config
+		audio_24k_deemph_300_6_config,
+		ctcss_tone
 	};
 	shared_memory.baseband_queue.push(message);
 	audio::set_rate(audio::Rate::Hz_24000);
@@ -43,7 +43,8 @@ struct NBFMConfig {
 	const fir_taps_real<32> channel;
 	const size_t deviation;
 
-	void apply() const;
+	/* ctcss_tone in tenths of a hertz, zero for none. */
+	void apply(const uint32_t ctcss_tone = 0) const;
 };
 
 struct WFMConfig {
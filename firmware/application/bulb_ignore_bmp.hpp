@@ -1,47 +1,41 @@
-const unsigned char bulb_ignore_bmp[] = {
-  0x42, 0x4d, 0xc6, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0x00,
-  0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00,
-  0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x70, 0x01,
-  0x00, 0x00, 0x13, 0x0b, 0x00, 0x00, 0x13, 0x0b, 0x00, 0x00, 0x08, 0x00,
-  0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x42, 0x47, 0x52, 0x73, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x19, 0x19, 0x19, 0x00, 0x29, 0x2e, 0x21, 0x00, 0x1b, 0x1b,
-  0x66, 0x00, 0x3f, 0x3f, 0x3f, 0x00, 0xff, 0x00, 0xff, 0x00, 0x55, 0x55,
-  0x55, 0x00, 0x6c, 0x6c, 0x6c, 0x00, 0x95, 0x95, 0x95, 0x00, 0x0a, 0x44,
-  0x02, 0x77, 0x02, 0x77, 0x0a, 0x44, 0x00, 0x00, 0x00, 0x18, 0x42, 0x24,
-  0x44, 0x44, 0x47, 0x30, 0x03, 0x74, 0x44, 0x44, 0x42, 0x24, 0x00, 0x00,
-  0x00, 0x18, 0x42, 0x22, 0x44, 0x44, 0x73, 0x66, 0x55, 0x37, 0x44, 0x44,
-  0x22, 0x24, 0x00, 0x00, 0x00, 0x18, 0x44, 0x22, 0x24, 0x44, 0x76, 0x33,
-  0x33, 0x57, 0x44, 0x42, 0x22, 0x44, 0x00, 0x00, 0x00, 0x18, 0x44, 0x42,
-  0x22, 0x44, 0x73, 0x66, 0x55, 0x37, 0x44, 0x22, 0x24, 0x44, 0x00, 0x00,
-  0x00, 0x18, 0x44, 0x44, 0x22, 0x24, 0x76, 0x33, 0x33, 0x57, 0x42, 0x22,
-  0x44, 0x44, 0x00, 0x00, 0x00, 0x18, 0x44, 0x44, 0x42, 0x22, 0x73, 0x66,
-  0x55, 0x37, 0x22, 0x24, 0x44, 0x44, 0x00, 0x00, 0x06, 0x44, 0x00, 0x0c,
-  0x22, 0x26, 0x53, 0x35, 0x52, 0x22, 0x06, 0x44, 0x00, 0x00, 0x06, 0x44,
-  0x00, 0x0c, 0x42, 0x22, 0x31, 0x13, 0x22, 0x24, 0x06, 0x44, 0x00, 0x00,
-  0x06, 0x44, 0x00, 0x0c, 0x47, 0x22, 0x21, 0x12, 0x22, 0x74, 0x06, 0x44,
-  0x00, 0x00, 0x06, 0x44, 0x00, 0x0c, 0x74, 0x42, 0x22, 0x22, 0x24, 0x47,
-  0x06, 0x44, 0x00, 0x00, 0x00, 0x18, 0x44, 0x44, 0x47, 0x44, 0x44, 0x22,
-  0x22, 0x44, 0x44, 0x74, 0x44, 0x44, 0x00, 0x00, 0x00, 0x18, 0x44, 0x44,
-  0x47, 0x44, 0x64, 0x22, 0x22, 0x44, 0x44, 0x74, 0x44, 0x44, 0x00, 0x00,
-  0x00, 0x18, 0x44, 0x44, 0x74, 0x44, 0x62, 0x22, 0x22, 0x24, 0x44, 0x47,
-  0x44, 0x44, 0x00, 0x00, 0x00, 0x18, 0x44, 0x44, 0x74, 0x46, 0x22, 0x24,
-  0x42, 0x22, 0x44, 0x47, 0x44, 0x44, 0x00, 0x00, 0x00, 0x18, 0x44, 0x44,
-  0x74, 0x42, 0x22, 0x44, 0x44, 0x22, 0x24, 0x47, 0x44, 0x44, 0x00, 0x00,
-  0x00, 0x18, 0x44, 0x44, 0x74, 0x22, 0x23, 0x44, 0x44, 0x32, 0x22, 0x47,
-  0x44, 0x44, 0x00, 0x00, 0x00, 0x18, 0x44, 0x44, 0x72, 0x22, 0x60, 0x44,
-  0x44, 0x00, 0x22, 0x27, 0x44, 0x44, 0x00, 0x00, 0x00, 0x18, 0x44, 0x44,
-  0x22, 0x24, 0x66, 0x00, 0x00, 0x44, 0x42, 0x22, 0x44, 0x44, 0x00, 0x00,
-  0x00, 0x0a, 0x44, 0x42, 0x22, 0x44, 0x46, 0x00, 0x08, 0x44, 0x00, 0x06,
-  0x22, 0x24, 0x44, 0x00, 0x00, 0x00, 0x00, 0x08, 0x44, 0x22, 0x24, 0x74,
-  0x08, 0x44, 0x00, 0x08, 0x47, 0x42, 0x22, 0x44, 0x00, 0x00, 0x00, 0x08,
-  0x42, 0x22, 0x44, 0x47, 0x08, 0x44, 0x00, 0x08, 0x74, 0x44, 0x22, 0x24,
-  0x00, 0x00, 0x00, 0x18, 0x42, 0x24, 0x44, 0x44, 0x74, 0x44, 0x44, 0x47,
-  0x44, 0x44, 0x42, 0x24, 0x00, 0x00, 0x08, 0x44, 0x00, 0x08, 0x47, 0x77,
-  0x77, 0x74, 0x08, 0x44, 0x00, 0x01
+/*
+ * Generated by tools/make_bitmap_runs.py from bulb_ignore.bmp, do not edit.
+ */
+
+#ifndef __BITMAP_BULB_IGNORE_H__
+#define __BITMAP_BULB_IGNORE_H__
+
+#include "ui.hpp"
+
+namespace ui {
+
+static constexpr Color bitmap_bulb_ignore_palette[] = {
+	0x18c3, 0x2165, 0x60c3, 0x39e7, 0xf81f, 0x52aa, 0x6b6d, 0x94b2,
 };
-const unsigned int bulb_ignore_bmp_len = 522;
+
+static constexpr uint8_t bitmap_bulb_ignore_runs[] = {
+	0x84, 0x57, 0x94, 0x12, 0x44, 0x07, 0x54, 0x07, 0x44, 0x12, 0x14, 0x22,
+	0x24, 0x07, 0x74, 0x07, 0x24, 0x22, 0x24, 0x22, 0x04, 0x07, 0x94, 0x07,
+	0x04, 0x22, 0x44, 0x22, 0x24, 0x06, 0x74, 0x22, 0x64, 0x22, 0x04, 0x16,
+	0x30, 0x24, 0x22, 0x74, 0x07, 0x22, 0x06, 0x00, 0x34, 0x10, 0x22, 0x07,
+	0x74, 0x07, 0x04, 0x22, 0x03, 0x34, 0x03, 0x22, 0x04, 0x07, 0x74, 0x07,
+	0x14, 0x22, 0x34, 0x22, 0x14, 0x07, 0x74, 0x07, 0x14, 0x06, 0x22, 0x14,
+	0x22, 0x24, 0x07, 0x74, 0x07, 0x24, 0x06, 0x52, 0x34, 0x07, 0x84, 0x07,
+	0x14, 0x06, 0x04, 0x32, 0x34, 0x07, 0x94, 0x07, 0x34, 0x32, 0x34, 0x07,
+	0xa4, 0x07, 0x14, 0x52, 0x14, 0x07, 0xc4, 0x07, 0x22, 0x11, 0x22, 0x07,
+	0xd4, 0x22, 0x03, 0x11, 0x03, 0x22, 0xc4, 0x22, 0x06, 0x05, 0x13, 0x15,
+	0x22, 0xa4, 0x22, 0x07, 0x03, 0x16, 0x15, 0x03, 0x07, 0x22, 0x84, 0x22,
+	0x04, 0x07, 0x06, 0x33, 0x05, 0x07, 0x04, 0x22, 0x64, 0x22, 0x14, 0x07,
+	0x03, 0x16, 0x15, 0x03, 0x07, 0x14, 0x22, 0x44, 0x22, 0x24, 0x07, 0x06,
+	0x33, 0x05, 0x07, 0x24, 0x22, 0x24, 0x22, 0x34, 0x07, 0x03, 0x16, 0x15,
+	0x03, 0x07, 0x34, 0x22, 0x14, 0x12, 0x54, 0x07, 0x03, 0x10, 0x03, 0x07,
+	0x54, 0x12, 0xa4, 0x37, 0x94,
+};
+
+static constexpr RunBitmap bitmap_bulb_ignore {
+	{ 24, 24 }, bitmap_bulb_ignore_palette, bitmap_bulb_ignore_runs, 4
+};
+
+} /* namespace ui */
+
+#endif/*__BITMAP_BULB_IGNORE_H__*/
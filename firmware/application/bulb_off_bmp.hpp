@@ -1,43 +1,40 @@
-const unsigned char bulb_off_bmp[] = {
-  0x42, 0x4d, 0x9a, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0x00,
-  0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00,
-  0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x48, 0x01,
-  0x00, 0x00, 0x13, 0x0b, 0x00, 0x00, 0x13, 0x0b, 0x00, 0x00, 0x07, 0x00,
-  0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x42, 0x47, 0x52, 0x73, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x39, 0x39, 0x39, 0x00, 0xff, 0x00, 0xff, 0x00, 0x55, 0x5f,
-  0x45, 0x00, 0x5b, 0x5b, 0x5b, 0x00, 0x7d, 0x7d, 0x7d, 0x00, 0x9d, 0x9d,
-  0x9d, 0x00, 0xff, 0xff, 0xff, 0x00, 0x0a, 0x11, 0x02, 0x66, 0x02, 0x66,
-  0x0a, 0x11, 0x00, 0x00, 0x08, 0x11, 0x00, 0x08, 0x16, 0x30, 0x03, 0x61,
-  0x08, 0x11, 0x00, 0x00, 0x08, 0x11, 0x00, 0x08, 0x63, 0x55, 0x44, 0x36,
-  0x08, 0x11, 0x00, 0x00, 0x08, 0x11, 0x00, 0x08, 0x65, 0x33, 0x33, 0x46,
-  0x08, 0x11, 0x00, 0x00, 0x08, 0x11, 0x00, 0x08, 0x63, 0x55, 0x44, 0x36,
-  0x08, 0x11, 0x00, 0x00, 0x08, 0x11, 0x00, 0x08, 0x65, 0x33, 0x33, 0x46,
-  0x08, 0x11, 0x00, 0x00, 0x08, 0x11, 0x00, 0x08, 0x63, 0x55, 0x44, 0x36,
-  0x08, 0x11, 0x00, 0x00, 0x08, 0x11, 0x00, 0x08, 0x65, 0x43, 0x34, 0x46,
-  0x08, 0x11, 0x00, 0x00, 0x08, 0x11, 0x00, 0x08, 0x63, 0x32, 0x23, 0x36,
-  0x08, 0x11, 0x00, 0x00, 0x06, 0x11, 0x00, 0x0c, 0x16, 0x11, 0x22, 0x22,
-  0x11, 0x61, 0x06, 0x11, 0x00, 0x00, 0x06, 0x11, 0x00, 0x0c, 0x61, 0x11,
-  0x24, 0x22, 0x11, 0x16, 0x06, 0x11, 0x00, 0x00, 0x00, 0x18, 0x11, 0x11,
-  0x16, 0x11, 0x11, 0x24, 0x22, 0x11, 0x11, 0x61, 0x11, 0x11, 0x00, 0x00,
-  0x00, 0x18, 0x11, 0x11, 0x16, 0x11, 0x51, 0x34, 0x43, 0x11, 0x11, 0x61,
-  0x11, 0x11, 0x00, 0x00, 0x00, 0x18, 0x11, 0x11, 0x61, 0x11, 0x51, 0x31,
-  0x13, 0x11, 0x11, 0x16, 0x11, 0x11, 0x00, 0x00, 0x00, 0x18, 0x11, 0x11,
-  0x61, 0x15, 0x51, 0x31, 0x13, 0x11, 0x11, 0x16, 0x11, 0x11, 0x00, 0x00,
-  0x00, 0x18, 0x11, 0x11, 0x61, 0x15, 0x53, 0x11, 0x11, 0x31, 0x11, 0x16,
-  0x11, 0x11, 0x00, 0x00, 0x00, 0x18, 0x11, 0x11, 0x61, 0x15, 0x53, 0x11,
-  0x11, 0x31, 0x11, 0x16, 0x11, 0x11, 0x00, 0x00, 0x00, 0x18, 0x11, 0x11,
-  0x61, 0x11, 0x50, 0x11, 0x11, 0x00, 0x11, 0x16, 0x11, 0x11, 0x00, 0x00,
-  0x00, 0x18, 0x11, 0x11, 0x16, 0x11, 0x55, 0x00, 0x00, 0x11, 0x11, 0x61,
-  0x11, 0x11, 0x00, 0x00, 0x00, 0x0a, 0x11, 0x11, 0x16, 0x11, 0x15, 0x00,
-  0x08, 0x11, 0x00, 0x06, 0x61, 0x11, 0x11, 0x00, 0x00, 0x00, 0x06, 0x11,
-  0x02, 0x61, 0x08, 0x11, 0x02, 0x16, 0x06, 0x11, 0x00, 0x00, 0x06, 0x11,
-  0x02, 0x16, 0x08, 0x11, 0x02, 0x61, 0x06, 0x11, 0x00, 0x00, 0x08, 0x11,
-  0x00, 0x08, 0x61, 0x11, 0x11, 0x16, 0x08, 0x11, 0x00, 0x00, 0x08, 0x11,
-  0x00, 0x08, 0x16, 0x66, 0x66, 0x61, 0x08, 0x11, 0x00, 0x01
+/*
+ * Generated by tools/make_bitmap_runs.py from bulb_off.bmp, do not edit.
+ */
+
+#ifndef __BITMAP_BULB_OFF_H__
+#define __BITMAP_BULB_OFF_H__
+
+#include "ui.hpp"
+
+namespace ui {
+
+static constexpr Color bitmap_bulb_off_palette[] = {
+	0x39c7, 0xf81f, 0x42ea, 0x5acb, 0x7bef, 0x9cf3, 0xffff,
 };
-const unsigned int bulb_off_bmp_len = 478;
+
+static constexpr uint8_t bitmap_bulb_off_runs[] = {
+	0x81, 0x56, 0xf1, 0x01, 0x06, 0x51, 0x06, 0xe1, 0x06, 0x71, 0x06, 0xc1,
+	0x06, 0x91, 0x06, 0xa1, 0x06, 0x21, 0x05, 0x71, 0x06, 0x91, 0x06, 0x11,
+	0x15, 0x30, 0x31, 0x06, 0x81, 0x06, 0x21, 0x05, 0x00, 0x31, 0x10, 0x21,
+	0x06, 0x71, 0x06, 0x11, 0x15, 0x03, 0x31, 0x03, 0x31, 0x06, 0x71, 0x06,
+	0x11, 0x15, 0x03, 0x31, 0x03, 0x31, 0x06, 0x71, 0x06, 0x11, 0x15, 0x01,
+	0x03, 0x11, 0x03, 0x41, 0x06, 0x71, 0x06, 0x21, 0x05, 0x01, 0x03, 0x11,
+	0x03, 0x41, 0x06, 0x81, 0x06, 0x11, 0x05, 0x01, 0x03, 0x14, 0x03, 0x31,
+	0x06, 0x91, 0x06, 0x31, 0x02, 0x04, 0x12, 0x31, 0x06, 0xa1, 0x06, 0x21,
+	0x02, 0x04, 0x12, 0x21, 0x06, 0xc1, 0x06, 0x11, 0x32, 0x11, 0x06, 0xe1,
+	0x06, 0x13, 0x12, 0x13, 0x06, 0xf1, 0x00, 0x06, 0x05, 0x04, 0x13, 0x14,
+	0x06, 0xf1, 0x00, 0x06, 0x03, 0x15, 0x14, 0x03, 0x06, 0xf1, 0x00, 0x06,
+	0x05, 0x33, 0x04, 0x06, 0xf1, 0x00, 0x06, 0x03, 0x15, 0x14, 0x03, 0x06,
+	0xf1, 0x00, 0x06, 0x05, 0x33, 0x04, 0x06, 0xf1, 0x00, 0x06, 0x03, 0x15,
+	0x14, 0x03, 0x06, 0xf1, 0x01, 0x06, 0x03, 0x10, 0x03, 0x06, 0xf1, 0x03,
+	0x36, 0x91,
+};
+
+static constexpr RunBitmap bitmap_bulb_off {
+	{ 24, 24 }, bitmap_bulb_off_palette, bitmap_bulb_off_runs, 1
+};
+
+} /* namespace ui */
+
+#endif/*__BITMAP_BULB_OFF_H__*/
@@ -1,46 +1,46 @@
-const unsigned char bulb_on_bmp[] = {
-  0x42, 0x4d, 0xba, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0x00,
-  0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00,
-  0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x60, 0x01,
-  0x00, 0x00, 0x13, 0x0b, 0x00, 0x00, 0x13, 0x0b, 0x00, 0x00, 0x09, 0x00,
-  0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x42, 0x47, 0x52, 0x73, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x39, 0x39, 0x39, 0x00, 0xff, 0x00, 0xff, 0x00, 0x5b, 0x5b,
-  0x5b, 0x00, 0x7d, 0x7d, 0x7d, 0x00, 0x90, 0xa0, 0x75, 0x00, 0x9d, 0x9d,
-  0x9d, 0x00, 0x44, 0xe5, 0xff, 0x00, 0x85, 0xfe, 0xff, 0x00, 0xff, 0xff,
-  0xff, 0x00, 0x0a, 0x11, 0x02, 0x88, 0x02, 0x88, 0x0a, 0x11, 0x00, 0x00,
-  0x08, 0x11, 0x00, 0x08, 0x18, 0x20, 0x02, 0x81, 0x08, 0x11, 0x00, 0x00,
-  0x08, 0x11, 0x00, 0x08, 0x82, 0x55, 0x33, 0x28, 0x08, 0x11, 0x00, 0x00,
-  0x08, 0x11, 0x00, 0x08, 0x85, 0x22, 0x22, 0x38, 0x08, 0x11, 0x00, 0x00,
-  0x08, 0x11, 0x00, 0x08, 0x82, 0x55, 0x33, 0x28, 0x08, 0x11, 0x00, 0x00,
-  0x08, 0x11, 0x00, 0x08, 0x85, 0x22, 0x22, 0x38, 0x08, 0x11, 0x00, 0x00,
-  0x08, 0x11, 0x00, 0x08, 0x82, 0x55, 0x32, 0x28, 0x08, 0x11, 0x00, 0x00,
-  0x00, 0x18, 0x11, 0x61, 0x11, 0x11, 0x85, 0x33, 0x33, 0x28, 0x11, 0x11,
-  0x16, 0x11, 0x00, 0x00, 0x00, 0x18, 0x11, 0x16, 0x11, 0x11, 0x83, 0x54,
-  0x45, 0x38, 0x11, 0x11, 0x61, 0x11, 0x00, 0x00, 0x00, 0x18, 0x11, 0x11,
-  0x61, 0x18, 0x77, 0x44, 0x44, 0x77, 0x81, 0x16, 0x11, 0x11, 0x00, 0x00,
-  0x06, 0x11, 0x00, 0x0c, 0x87, 0x66, 0x48, 0x44, 0x66, 0x78, 0x06, 0x11,
-  0x00, 0x00, 0x00, 0x18, 0x11, 0x11, 0x18, 0x76, 0x66, 0x48, 0x44, 0x66,
-  0x67, 0x81, 0x11, 0x11, 0x00, 0x00, 0x00, 0x18, 0x11, 0x11, 0x18, 0x66,
-  0x86, 0x38, 0x83, 0x66, 0x66, 0x81, 0x11, 0x11, 0x00, 0x00, 0x00, 0x18,
-  0x11, 0x11, 0x87, 0x67, 0x87, 0x37, 0x63, 0x76, 0x66, 0x78, 0x11, 0x11,
-  0x00, 0x00, 0x00, 0x18, 0x11, 0x11, 0x86, 0x78, 0x86, 0x36, 0x73, 0x67,
-  0x67, 0x68, 0x11, 0x11, 0x00, 0x00, 0x00, 0x18, 0x66, 0x61, 0x86, 0x68,
-  0x83, 0x67, 0x76, 0x36, 0x76, 0x68, 0x16, 0x66, 0x00, 0x00, 0x00, 0x18,
-  0x11, 0x11, 0x86, 0x78, 0x85, 0x77, 0x77, 0x57, 0x77, 0x68, 0x11, 0x11,
-  0x00, 0x00, 0x00, 0x18, 0x11, 0x11, 0x87, 0x67, 0x88, 0x78, 0x77, 0x88,
-  0x76, 0x78, 0x11, 0x11, 0x00, 0x00, 0x00, 0x08, 0x11, 0x11, 0x18, 0x66,
-  0x06, 0x88, 0x00, 0x0a, 0x77, 0x77, 0x81, 0x11, 0x11, 0x00, 0x00, 0x00,
-  0x00, 0x18, 0x11, 0x11, 0x18, 0x76, 0x78, 0x77, 0x77, 0x76, 0x76, 0x81,
-  0x11, 0x11, 0x00, 0x00, 0x06, 0x11, 0x02, 0x87, 0x08, 0x67, 0x02, 0x68,
-  0x06, 0x11, 0x00, 0x00, 0x00, 0x0a, 0x11, 0x11, 0x61, 0x18, 0x76, 0x00,
-  0x06, 0x66, 0x00, 0x08, 0x81, 0x16, 0x11, 0x11, 0x00, 0x00, 0x00, 0x18,
-  0x11, 0x16, 0x11, 0x11, 0x87, 0x77, 0x77, 0x78, 0x11, 0x11, 0x61, 0x11,
-  0x00, 0x00, 0x00, 0x18, 0x11, 0x61, 0x11, 0x11, 0x18, 0x88, 0x88, 0x81,
-  0x11, 0x11, 0x16, 0x11, 0x00, 0x01
+/*
+ * Generated by tools/make_bitmap_runs.py from bulb_on.bmp, do not edit.
+ */
+
+#ifndef __BITMAP_BULB_ON_H__
+#define __BITMAP_BULB_ON_H__
+
+#include "ui.hpp"
+
+namespace ui {
+
+static constexpr Color bitmap_bulb_on_palette[] = {
+	0x39c7, 0xf81f, 0x5acb, 0x7bef, 0x7512, 0x9cf3, 0xff28, 0xfff0,
+	0xffff,
 };
-const unsigned int bulb_on_bmp_len = 510;
+
+static constexpr uint8_t bitmap_bulb_on_runs[] = {
+	0x11, 0x06, 0x51, 0x58, 0x51, 0x06, 0x41, 0x06, 0x31, 0x08, 0x57, 0x08,
+	0x31, 0x06, 0x61, 0x06, 0x11, 0x08, 0x07, 0x66, 0x08, 0x11, 0x06, 0x91,
+	0x08, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x07, 0x06, 0x08,
+	0xa1, 0x08, 0x07, 0x06, 0x07, 0x08, 0x47, 0x06, 0x07, 0x06, 0x08, 0x91,
+	0x08, 0x16, 0x58, 0x37, 0x08, 0x81, 0x08, 0x07, 0x06, 0x07, 0x18, 0x07,
+	0x08, 0x17, 0x18, 0x07, 0x06, 0x07, 0x08, 0x71, 0x08, 0x06, 0x07, 0x18,
+	0x05, 0x37, 0x05, 0x27, 0x06, 0x08, 0x31, 0x26, 0x01, 0x08, 0x16, 0x18,
+	0x03, 0x06, 0x17, 0x06, 0x03, 0x06, 0x07, 0x16, 0x08, 0x01, 0x26, 0x31,
+	0x08, 0x06, 0x07, 0x18, 0x06, 0x03, 0x06, 0x07, 0x03, 0x06, 0x07, 0x06,
+	0x07, 0x06, 0x08, 0x71, 0x08, 0x07, 0x06, 0x07, 0x08, 0x07, 0x03, 0x07,
+	0x06, 0x03, 0x07, 0x26, 0x07, 0x08, 0x81, 0x08, 0x16, 0x08, 0x06, 0x03,
+	0x18, 0x03, 0x36, 0x08, 0x91, 0x08, 0x07, 0x26, 0x04, 0x08, 0x14, 0x26,
+	0x07, 0x08, 0xa1, 0x08, 0x07, 0x16, 0x04, 0x08, 0x14, 0x16, 0x07, 0x08,
+	0x91, 0x06, 0x11, 0x08, 0x17, 0x34, 0x17, 0x08, 0x11, 0x06, 0x61, 0x06,
+	0x31, 0x08, 0x03, 0x05, 0x14, 0x05, 0x03, 0x08, 0x31, 0x06, 0x41, 0x06,
+	0x41, 0x08, 0x05, 0x33, 0x02, 0x08, 0x41, 0x06, 0x91, 0x08, 0x02, 0x15,
+	0x03, 0x12, 0x08, 0xf1, 0x00, 0x08, 0x05, 0x32, 0x03, 0x08, 0xf1, 0x00,
+	0x08, 0x02, 0x15, 0x13, 0x02, 0x08, 0xf1, 0x00, 0x08, 0x05, 0x32, 0x03,
+	0x08, 0xf1, 0x00, 0x08, 0x02, 0x15, 0x13, 0x02, 0x08, 0xf1, 0x01, 0x08,
+	0x02, 0x10, 0x02, 0x08, 0xf1, 0x03, 0x38, 0x91,
+};
+
+static constexpr RunBitmap bitmap_bulb_on {
+	{ 24, 24 }, bitmap_bulb_on_palette, bitmap_bulb_on_runs, 1
+};
+
+} /* namespace ui */
+
+#endif/*__BITMAP_BULB_ON_H__*/
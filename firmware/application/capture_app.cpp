@@ -24,6 +24,8 @@
 #include "portapack.hpp"
 using namespace portapack;
 
+#include "string_format.hpp"
+
 namespace ui {
 
 CaptureAppView::CaptureAppView(NavigationView& nav) {
@@ -96,14 +98,17 @@ void CaptureAppView::focus() {
 
 void CaptureAppView::on_tuning_frequency_changed(rf::Frequency f) {
 	receiver_model.set_tuning_frequency(f);
+	record_view.annotate("center_frequency", to_string_dec_uint64(f));
 }
 
 void CaptureAppView::on_lna_changed(int32_t v_db) {
 	receiver_model.set_lna(v_db);
+	record_view.annotate("lna", to_string_dec_int(v_db));
 }
 
 void CaptureAppView::on_vga_changed(int32_t v_db) {
 	receiver_model.set_vga(v_db);
+	record_view.annotate("vga", to_string_dec_int(v_db));
 }
 
 } /* namespace ui */
@@ -70,8 +70,9 @@ Thread* CaptureThread::thread = nullptr;
 CaptureThread::CaptureThread(
 	std::unique_ptr<Writer> writer,
 	size_t write_size_log2,
-	size_t buffer_count_log2
-) : config { write_size_log2, buffer_count_log2 },
+	size_t buffer_count_log2,
+	CaptureConfig::Compression compression
+) : config { write_size_log2, buffer_count_log2, compression },
 	writer { std::move(writer) }
 {
 	// Need significant stack for FATFS
@@ -79,6 +80,10 @@ CaptureThread::CaptureThread(
 }
 
 CaptureThread::~CaptureThread() {
+	stop();
+}
+
+void CaptureThread::stop() {
 	if( thread ) {
 		chThdTerminate(thread);
 		chEvtSignal(thread, EVT_MASK_CAPTURE_THREAD);
@@ -113,6 +118,7 @@ msg_t CaptureThread::run() {
 			if( !writer->write(write_buffer.get(), write_size) ) {
 				return false;
 			}
+			bytes_written_ = bytes_written_ + write_size;
 		} else {
 			chEvtWaitAny(EVT_MASK_CAPTURE_THREAD);
 		}
@@ -41,19 +41,29 @@ public:
 	CaptureThread(
 		std::unique_ptr<Writer> writer,
 		size_t write_size_log2,
-		size_t buffer_count_log2
+		size_t buffer_count_log2,
+		CaptureConfig::Compression compression = CaptureConfig::Compression::None
 	);
 	~CaptureThread();
 
+	/* Waits for the thread to finish its current write and exit. */
+	void stop();
+
 	const CaptureConfig& state() const {
 		return config;
 	}
 
+	/* Bytes the writer has accepted. 32 bits, as FAT files end at 4GiB. */
+	uint32_t bytes_written() const {
+		return bytes_written_;
+	}
+
 	static void check_fifo_isr();
 
 private:
 	CaptureConfig config;
 	std::unique_ptr<Writer> writer;
+	volatile uint32_t bytes_written_ { 0 };
 	static Thread* thread;
 
 	static msg_t static_fn(void* arg) {
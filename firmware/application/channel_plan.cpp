@@ -0,0 +1,362 @@
+/*
+ * Copyright (C) 2016 Jared Boone, ShareBrained Technology, Inc.
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "channel_plan.hpp"
+
+#include "file.hpp"
+#include "max2837.hpp"
+
+#include <algorithm>
+
+namespace channel_plan {
+
+const std::array<uint16_t, ctcss_tone_count> ctcss_tones { {
+	 670,  693,  719,  744,  770,  797,  825,  854,  885,  915,
+	 948,  974, 1000, 1035, 1072, 1109, 1148, 1188, 1230, 1273,
+	1318, 1365, 1413, 1462, 1500, 1514, 1567, 1598, 1622, 1655,
+	1679, 1713, 1738, 1773, 1799, 1835, 1862, 1899, 1928, 1966,
+	1995, 2035, 2065, 2107, 2181, 2257, 2291, 2336, 2418, 2503,
+} };
+
+namespace {
+
+const std::string plan_directory { "PLANS" };
+constexpr size_t read_chunk_size = 512;
+constexpr size_t line_length_max = 96;
+
+struct ModeName {
+	const char* const name;
+	const Mode mode;
+};
+
+constexpr std::array<ModeName, 5> mode_names { {
+	{ "AM",  Mode::AM },
+	{ "USB", Mode::USB },
+	{ "LSB", Mode::LSB },
+	{ "NFM", Mode::NFM },
+	{ "WFM", Mode::WFM },
+} };
+
+std::string trim(const std::string& s) {
+	const auto first = s.find_first_not_of(" \t");
+	if( first == std::string::npos ) {
+		return { };
+	}
+	const auto last = s.find_last_not_of(" \t\r");
+	return s.substr(first, last - first + 1);
+}
+
+/* Parses "123" or "123.45" as a fixed-point number with the given number
+ * of fraction digits. Further fraction digits are dropped.
+ */
+bool parse_fixed(const std::string& s, const size_t fraction_digits, uint64_t& value) {
+	constexpr uint64_t value_max = 1ULL << 48;
+
+	if( s.empty() ) {
+		return false;
+	}
+
+	uint64_t result = 0;
+	size_t fraction = 0;
+	bool point = false;
+	for(const auto c : s) {
+		if( c == '.' ) {
+			if( point ) {
+				return false;
+			}
+			point = true;
+		} else if( (c >= '0') && (c <= '9') ) {
+			if( !point || (fraction < fraction_digits) ) {
+				result = result * 10 + (c - '0');
+				fraction += point ? 1 : 0;
+			}
+		} else {
+			return false;
+		}
+		if( result > value_max ) {
+			return false;
+		}
+	}
+	for(; fraction < fraction_digits; fraction++) {
+		result *= 10;
+	}
+
+	value = result;
+	return true;
+}
+
+bool parse_frequency(const std::string& s, Channel& channel) {
+	uint64_t f = 0;
+	const bool mhz = (s.find('.') != std::string::npos);
+	if( !parse_fixed(s, mhz ? 6 : 0, f) ) {
+		return false;
+	}
+	if( !rf::tuning_range.contains(f) ) {
+		return false;
+	}
+	channel.frequency_10hz = (f + 5) / 10;
+	return true;
+}
+
+bool parse_mode(const std::string& s, Channel& channel) {
+	for(const auto& mode_name : mode_names) {
+		if( s == mode_name.name ) {
+			channel.mode = mode_name.mode;
+			return true;
+		}
+	}
+	return false;
+}
+
+bool parse_bandwidth(const std::string& s, Channel& channel) {
+	uint64_t bandwidth = 0;
+	if( !parse_fixed(s, 0, bandwidth) || (bandwidth > 6500000) ) {
+		return false;
+	}
+	channel.bandwidth_100hz = (bandwidth + 50) / 100;
+	return true;
+}
+
+bool parse_ctcss(const std::string& s, Channel& channel) {
+	uint64_t tone = 0;
+	if( !parse_fixed(s, 1, tone) ) {
+		return false;
+	}
+	const auto it = std::find(ctcss_tones.begin(), ctcss_tones.end(), tone);
+	if( it == ctcss_tones.end() ) {
+		return false;
+	}
+	channel.ctcss = (it - ctcss_tones.begin()) + 1;
+	return true;
+}
+
+bool parse_gain(const std::string& s, const range_t<int8_t>& range, int8_t& gain_db) {
+	uint64_t value = 0;
+	if( !parse_fixed(s, 0, value) || (value > static_cast<uint64_t>(range.maximum)) ) {
+		return false;
+	}
+	gain_db = value;
+	return true;
+}
+
+bool parse_rf_amp(const std::string& s, Channel& channel) {
+	if( (s == "0") || (s == "1") ) {
+		channel.rf_amp = s[0] - '0';
+		return true;
+	}
+	return false;
+}
+
+} /* namespace */
+
+bool parse_channel(const std::string& line, Channel& channel) {
+	const auto content = trim(line.substr(0, line.find('#')));
+	if( content.empty() ) {
+		return false;
+	}
+
+	channel = { 0, 0, 0, Mode::NFM, 0, -1, -1, -1 };
+
+	size_t field = 0;
+	size_t start = 0;
+	while( start <= content.size() ) {
+		auto end = content.find(',', start);
+		if( end == std::string::npos ) {
+			end = content.size();
+		}
+		const auto value = trim(content.substr(start, end - start));
+		start = end + 1;
+
+		// Frequency and mode are required, the rest may be left empty.
+		if( value.empty() && (field >= 2) ) {
+			field++;
+			continue;
+		}
+
+		bool valid = false;
+		switch(field) {
+		case 0:	valid = parse_frequency(value, channel); break;
+		case 1:	valid = parse_mode(value, channel); break;
+		case 2:	valid = parse_bandwidth(value, channel); break;
+		case 3:	valid = parse_ctcss(value, channel); break;
+		case 4:	valid = parse_gain(value, max2837::lna::gain_db_range, channel.lna_db); break;
+		case 5:	valid = parse_gain(value, max2837::vga::gain_db_range, channel.vga_db); break;
+		case 6:	valid = parse_rf_amp(value, channel); break;
+		default: break;
+		}
+		if( !valid ) {
+			return false;
+		}
+		field++;
+	}
+
+	return (field >= 2);
+}
+
+size_t ChannelPlan::load_all() {
+	clear();
+
+	std::vector<std::string> names;
+	for(const auto& entry : std::filesystem::directory_iterator(plan_directory.c_str(), "*.TXT")) {
+		if( std::filesystem::is_regular_file(entry.status()) ) {
+			const auto filename = entry.path();
+			names.push_back(filename.substr(0, filename.find('.')));
+		}
+	}
+	std::sort(names.begin(), names.end());
+
+	for(const auto& name : names) {
+		if( !load_bank(name) && truncated_ ) {
+			break;
+		}
+	}
+	sort();
+
+	return channels.size();
+}
+
+bool ChannelPlan::load(const std::string& bank_name) {
+	const bool success = load_bank(bank_name);
+	sort();
+	return success;
+}
+
+void ChannelPlan::clear() {
+	// Hand the table back to the heap, without a second buffer.
+	std::vector<Channel>().swap(channels);
+	bank_names.clear();
+	truncated_ = false;
+}
+
+size_t ChannelPlan::lower_bound(const rf::Frequency f) const {
+	const auto it = std::lower_bound(channels.begin(), channels.end(), f,
+		[](const Channel& channel, const rf::Frequency f) {
+			return channel.frequency() < f;
+		}
+	);
+	return it - channels.begin();
+}
+
+size_t ChannelPlan::nearest(const rf::Frequency f) const {
+	if( channels.empty() ) {
+		return channels.size();
+	}
+
+	const auto index = lower_bound(f);
+	if( index == channels.size() ) {
+		return index - 1;
+	}
+	if( index > 0 ) {
+		const auto above = channels[index].frequency() - f;
+		const auto below = f - channels[index - 1].frequency();
+		if( below < above ) {
+			return index - 1;
+		}
+	}
+	return index;
+}
+
+/* The table is allocated once at its full size: growing it would briefly
+ * need the old and new buffers together.
+ */
+bool ChannelPlan::add(const Channel& channel) {
+	if( channels.size() >= channels_max ) {
+		truncated_ = true;
+		return false;
+	}
+	if( channels.capacity() < channels_max ) {
+		channels.reserve(channels_max);
+	}
+	channels.push_back(channel);
+	return true;
+}
+
+/* Reads the file in chunks, so a bank of thousands of lines never needs
+ * more than one line and one chunk of buffer.
+ */
+bool ChannelPlan::load_bank(const std::string& bank_name) {
+	if( bank_names.size() >= banks_max ) {
+		return false;
+	}
+
+	File file { plan_directory + "/" + bank_name + ".TXT", File::openmode::in };
+	if( !file.is_open() ) {
+		return false;
+	}
+
+	const uint8_t bank = bank_names.size();
+	bank_names.push_back(bank_name);
+
+	const uint64_t file_size = file.size();
+
+	std::array<char, read_chunk_size> chunk;
+	std::string line;
+	line.reserve(line_length_max);
+	bool overlong = false;
+	uint64_t remaining = file_size;
+	bool room = true;
+	Channel channel;
+
+	while( room && (remaining > 0) ) {
+		const size_t count = std::min<uint64_t>(remaining, chunk.size());
+		if( !file.read(chunk.data(), count) ) {
+			break;
+		}
+		remaining -= count;
+
+		for(size_t i=0; room && (i<count); i++) {
+			const char c = chunk[i];
+			if( c == '\n' ) {
+				if( !overlong && parse_channel(line, channel) ) {
+					channel.bank = bank;
+					room = add(channel);
+				}
+				line.clear();
+				overlong = false;
+			} else if( line.size() < line_length_max ) {
+				line += c;
+			} else {
+				overlong = true;
+			}
+		}
+	}
+
+	if( room && !overlong && parse_channel(line, channel) ) {
+		channel.bank = bank;
+		room = add(channel);
+	}
+
+	return room;
+}
+
+/* In place: a stable sort would want a temporary half the table's size.
+ * Channels on the same frequency end up in bank order.
+ */
+void ChannelPlan::sort() {
+	std::sort(channels.begin(), channels.end(),
+		[](const Channel& a, const Channel& b) {
+			return (a.frequency_10hz < b.frequency_10hz)
+				|| ((a.frequency_10hz == b.frequency_10hz) && (a.bank < b.bank));
+		}
+	);
+}
+
+} /* namespace channel_plan */
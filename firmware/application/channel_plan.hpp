@@ -0,0 +1,177 @@
+/*
+ * Copyright (C) 2016 Jared Boone, ShareBrained Technology, Inc.
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __CHANNEL_PLAN_H__
+#define __CHANNEL_PLAN_H__
+
+#include "rf_path.hpp"
+
+#include <cstdint>
+#include <cstddef>
+#include <array>
+#include <string>
+#include <vector>
+
+/* Channel plans kept on the SD card as text, one bank per file in PLANS/
+ * (bank name = file name stem, e.g. PLANS/MARINE.TXT). One channel per
+ * line, '#' starts a comment:
+ *
+ *   frequency,mode[,bandwidth[,ctcss[,lna[,vga[,amp]]]]]
+ *   156.800,NFM,12500,,24,20
+ *   162550000,NFM,,67.0
+ *
+ * Frequencies with a decimal point are in MHz, otherwise in Hz. Modes are
+ * AM, USB, LSB, NFM and WFM. Bandwidth is in Hz, CTCSS one of the standard
+ * tones in Hz, enabling tone squelch on NFM channels. Other empty or
+ * missing fields keep the receiver's current setting. Lines that don't
+ * parse are skipped.
+ */
+namespace channel_plan {
+
+enum class Mode : uint8_t {
+	AM = 0,
+	USB = 1,
+	LSB = 2,
+	NFM = 3,
+	WFM = 4,
+};
+
+/* Standard CTCSS tones, in tenths of a hertz. */
+constexpr size_t ctcss_tone_count = 50;
+extern const std::array<uint16_t, ctcss_tone_count> ctcss_tones;
+
+struct Channel {
+	uint32_t frequency_10hz;	/* 10Hz units, to reach past 4.3GHz in 32 bits */
+	uint16_t bandwidth_100hz;	/* Zero for the mode's default */
+	uint8_t bank;				/* Index into ChannelPlan::bank_name() */
+	Mode mode;
+	uint8_t ctcss;				/* Index into ctcss_tones plus one, zero for none */
+	int8_t lna_db;				/* Negative to keep the current setting */
+	int8_t vga_db;				/* Negative to keep the current setting */
+	int8_t rf_amp;				/* Negative to keep the current setting */
+
+	rf::Frequency frequency() const {
+		return static_cast<rf::Frequency>(frequency_10hz) * 10;
+	}
+
+	uint32_t bandwidth() const {
+		return static_cast<uint32_t>(bandwidth_100hz) * 100;
+	}
+
+	/* Tenths of a hertz, zero for none. */
+	uint16_t ctcss_tone() const {
+		return ctcss ? ctcss_tones[ctcss - 1] : 0;
+	}
+};
+
+static_assert(sizeof(Channel) == 12, "channel_plan::Channel size wrong");
+
+/* Channels from any number of banks in one table, sorted by frequency,
+ * so lookup by frequency is a binary search and stepping is an index
+ * increment.
+ */
+class ChannelPlan {
+public:
+	/* 24KiB of table, out of a 64KiB heap everything else shares. */
+	static constexpr size_t channels_max = 2048;
+
+	/* Loads every bank in PLANS/, replacing what was loaded before.
+	 * Returns the number of channels.
+	 */
+	size_t load_all();
+
+	/* Adds one bank by name. Returns false if it couldn't be read, there
+	 * are too many banks already, or the table filled up before its end.
+	 */
+	bool load(const std::string& bank_name);
+
+	void clear();
+
+	/* Channels were left out since load_all() or clear(), as the table
+	 * was full.
+	 */
+	bool truncated() const {
+		return truncated_;
+	}
+
+	size_t size() const {
+		return channels.size();
+	}
+
+	bool empty() const {
+		return channels.empty();
+	}
+
+	const Channel& operator[](const size_t index) const {
+		return channels[index];
+	}
+
+	size_t bank_count() const {
+		return bank_names.size();
+	}
+
+	const std::string& bank_name(const size_t bank) const {
+		return bank_names[bank];
+	}
+
+	/* Index of the first channel at or above f, or size() if none is. */
+	size_t lower_bound(const rf::Frequency f) const;
+
+	/* Index of the channel closest to f, or size() if the plan is empty. */
+	size_t nearest(const rf::Frequency f) const;
+
+	/* Neighbouring channels, wrapping around at either end. Both return
+	 * size() if the plan is empty.
+	 */
+	size_t next(const size_t index) const {
+		if( channels.empty() ) {
+			return channels.size();
+		}
+		return ((index + 1) < channels.size()) ? (index + 1) : 0;
+	}
+
+	size_t previous(const size_t index) const {
+		if( channels.empty() ) {
+			return channels.size();
+		}
+		return (index > 0) ? (index - 1) : (channels.size() - 1);
+	}
+
+private:
+	static constexpr size_t banks_max = 255;
+
+	std::vector<Channel> channels;
+	std::vector<std::string> bank_names;
+	bool truncated_ { false };
+
+	bool add(const Channel& channel);
+	bool load_bank(const std::string& bank_name);
+	void sort();
+};
+
+/* Parses one line of a bank file. Returns false for blank lines, comments
+ * and lines that don't parse.
+ */
+bool parse_channel(const std::string& line, Channel& channel);
+
+} /* namespace channel_plan */
+
+#endif/*__CHANNEL_PLAN_H__*/
@@ -29,8 +29,13 @@ using namespace lpc43xx;
 #include "message.hpp"
 #include "baseband_api.hpp"
 #include "portapack_shared_memory.hpp"
+#include "file_index.hpp"
+#include "module_store.hpp"
+#include "module_info.hpp"
+#include "crc.hpp"
 
 #include <cstring>
+#include <algorithm>
 
 char * modhash;
 
@@ -50,6 +55,9 @@ void m4_init(const portapack::spi_flash::region_t from, const portapack::memory:
 	 */
 	LPC_CREG->M4MEMMAP = to.base();
 
+	/* Processor overlays load from the same image */
+	shared_memory.baseband_image_base = reinterpret_cast<uint32_t>(from.base());
+
 	/* Reset M4 core */
 	LPC_RGU->RESET_CTRL[0] = (1 << 13);
 }
@@ -65,40 +73,86 @@ void m0_halt() {
 	}
 }
 
-int m4_load_image(void) {
-	uint32_t mod_size;
+/* Returns 1 once loaded, 0 if the file isn't the wanted module, and -1 if it
+ * is but carries processor overlays, which can only run from the module store.
+ */
+static int m4_load_module_file(const char* const filename) {
+	const char magic[6] = {'P', 'P', 'M', ' ', 0x03, 0x00};
 	UINT bw;
-	uint8_t i;
+	char header[6];
 	char md5sum[16];
-	FILINFO modinfo;
+	ModuleInfo info;
+	uint32_t crc;
 	FIL modfile;
+
+	if (f_open(&modfile, filename, FA_OPEN_EXISTING | FA_READ) != FR_OK) return 0;
+
+	// Magic bytes and version, MD5 fingerprint, then compatibility, all
+	// before touching M4 code RAM
+	bool match = (f_read(&modfile, header, 6, &bw) == FR_OK) && (bw == 6) && !memcmp(header, magic, 6);
+	match = match && (f_lseek(&modfile, 26) == FR_OK) && (f_read(&modfile, md5sum, 16, &bw) == FR_OK) && (bw == 16);
+	match = match && !memcmp(md5sum, modhash, 16);
+	match = match && (f_lseek(&modfile, module_file_info_offset) == FR_OK);
+	match = match && (f_read(&modfile, &info, sizeof(info), &bw) == FR_OK) && (bw == sizeof(info));
+	match = match && (f_read(&modfile, &crc, sizeof(crc), &bw) == FR_OK) && (bw == sizeof(crc));
+	match = match && info.is_compatible();
+
+	// Only the resident code fits, overlays can't be loaded from the SD card
+	const auto m4_code = portapack::memory::map::m4_code;
+	if (match && (f_size(&modfile) > module_file_image_offset + m4_code.size())) {
+		f_close(&modfile);
+		return -1;
+	}
+
+	if (match) {
+		match = (f_lseek(&modfile, module_file_image_offset) == FR_OK);
+		match = match && (f_read(&modfile, reinterpret_cast<void*>(m4_code.base()), m4_code.size(), &bw) == FR_OK);
+		match = match && (bw == m4_code.size());
+
+		CRC32 image_crc;
+		image_crc.process_bytes(reinterpret_cast<const void*>(m4_code.base()), m4_code.size());
+		match = match && (image_crc.checksum() == crc);
+	}
+	f_close(&modfile);
+
+	if (match) {
+		shared_memory.baseband_image_base = 0;
+		LPC_RGU->RESET_CTRL[0] = (1 << 13);
+	}
+	return match ? 1 : 0;
+}
+
+int m4_load_image(void) {
+	FILINFO modinfo;
 	DIR rootdir;
 	FRESULT res;
 	
+	// Modules in the SPI flash store load without touching the SD card
+	if (module_store::load(modhash, portapack::memory::map::m4_code)) return 1;
+
+	// Try the file the index remembers before scanning the whole directory
+	const auto indexed_filename = file_index::find_module(modhash);
+	if (!indexed_filename.empty()) {
+		const auto result = m4_load_module_file(indexed_filename.c_str());
+		if (result) return result;
+	}
+
 	// Scan SD card root directory for files with the right md5 fingerprint at the right location
 	f_opendir(&rootdir, "/");
 	for (;;) {
 		res = f_readdir(&rootdir, &modinfo);
 		if (res != FR_OK || modinfo.fname[0] == 0) break;
-		if (!(modinfo.fattrib & AM_DIR)) {
-			f_open(&modfile, modinfo.fname, FA_OPEN_EXISTING | FA_READ);
-			f_lseek(&modfile, 26);
-			f_read(&modfile, &md5sum, 16, &bw);
-			for (i = 0; i < 16; i++) {
-				if (md5sum[i] != modhash[i]) break;
-			}
-			if (i == 16) {
-				f_lseek(&modfile, 6);
-				f_read(&modfile, &mod_size, 4, &bw);
-				f_lseek(&modfile, 256);
-				f_read(&modfile, reinterpret_cast<void*>(portapack::memory::map::m4_code.base()), mod_size, &bw);
-				LPC_RGU->RESET_CTRL[0] = (1 << 13);
-				f_close(&modfile);
-				return 1;
+		// Only care about files with .bin extension
+		if ((!(modinfo.fattrib & AM_DIR)) && (modinfo.fname[9] == 'B') && (modinfo.fname[10] == 'I') && (modinfo.fname[11] == 'N')) {
+			const auto result = m4_load_module_file(modinfo.fname);
+			if (result) {
+				f_closedir(&rootdir);
+				file_index::record_module(modhash, modinfo.fname);
+				return result;
 			}
-			f_close(&modfile);
 		}
 	}
+	f_closedir(&rootdir);
 	
 	return 0;
 }
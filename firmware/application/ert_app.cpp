@@ -65,10 +65,9 @@ ERTLogger::ERTLogger(
 {
 }
 
-void ERTLogger::on_packet(const ert::Packet& packet) {
+void ERTLogger::on_packet(const ert::Packet::Type type, const baseband::Packet& packet, const bool valid) {
 	if( log_file.is_open() ) {
-		const auto formatted = packet.symbols_formatted();
-		log_file.write_entry(packet.received_at(), formatted.data + "/" + formatted.errors);
+		log_file.write(packet_log::Protocol::ERT, toUType(type), valid, packet, ui::ERTAppView::initial_target_frequency);
 	}
 }
 
@@ -139,6 +138,9 @@ ERTAppView::ERTAppView(NavigationView&) {
 		[this](Message* const p) {
 			const auto message = static_cast<const ERTPacketMessage*>(p);
 			const ert::Packet packet { message->type, message->packet };
+			if( this->logger ) {
+				this->logger->on_packet(message->type, message->packet, packet.crc_ok());
+			}
 			this->on_packet(packet);
 		}
 	);
@@ -158,14 +160,29 @@ ERTAppView::ERTAppView(NavigationView&) {
 		.decimation_factor = 1,
 	});
 
-	logger = std::make_unique<ERTLogger>("ert.txt");
+	logger = std::make_unique<ERTLogger>(next_filename_stem_matching_pattern("ERT_????") + ".PKT");
+}
+
+/* No receiver and no log: a new, empty log would become the last one. */
+ERTAppView::ERTAppView(
+	NavigationView&,
+	const std::string& replay_file_path
+) : live { false }
+{
+	add_children({ {
+		&recent_entries_view,
+	} });
+
+	replay(replay_file_path);
 }
 
 ERTAppView::~ERTAppView() {
-	baseband::stop();
-	radio::disable();
+	if( live ) {
+		baseband::stop();
+		radio::disable();
 
-	EventDispatcher::message_map().unregister_handler(Message::ID::ERTPacket);
+		EventDispatcher::message_map().unregister_handler(Message::ID::ERTPacket);
+	}
 }
 
 void ERTAppView::focus() {
@@ -177,11 +194,18 @@ void ERTAppView::set_parent_rect(const Rect new_parent_rect) {
 	recent_entries_view.set_parent_rect({ 0, 0, new_parent_rect.width(), new_parent_rect.height() });
 }
 
-void ERTAppView::on_packet(const ert::Packet& packet) {
-	if( logger ) {
-		logger->on_packet(packet);
+void ERTAppView::replay(const std::string& file_path) {
+	packet_log::Reader reader { file_path };
+	packet_log::Record record;
+	while( reader.read(record) ) {
+		if( record.protocol() == packet_log::Protocol::ERT ) {
+			const ert::Packet packet { static_cast<ert::Packet::Type>(record.subtype()), record.packet() };
+			on_packet(packet);
+		}
 	}
+}
 
+void ERTAppView::on_packet(const ert::Packet& packet) {
 	if( packet.crc_ok() ) {
 		recent.on_packet({ packet.id(), packet.commodity_type() }, packet);
 		recent_entries_view.set_dirty();
@@ -24,7 +24,7 @@
 
 #include "ui_navigation.hpp"
 
-#include "log_file.hpp"
+#include "packet_log.hpp"
 
 #include "ert_packet.hpp"
 
@@ -87,10 +87,10 @@ class ERTLogger {
 public:
 	ERTLogger(const std::string& file_path);
 
-	void on_packet(const ert::Packet& packet);
+	void on_packet(const ert::Packet::Type type, const baseband::Packet& packet, const bool valid);
 
 private:
-	LogFile log_file;
+	packet_log::Writer log_file;
 };
 
 using ERTRecentEntries = RecentEntries<ert::Packet, ERTRecentEntry>;
@@ -106,6 +106,8 @@ public:
 	static constexpr uint32_t baseband_bandwidth = 2500000;
 
 	ERTAppView(NavigationView& nav);
+	/* Shows the packets in a log instead of receiving. */
+	ERTAppView(NavigationView& nav, const std::string& replay_file_path);
 	~ERTAppView();
 
 	void set_parent_rect(const Rect new_parent_rect) override;
@@ -116,14 +118,16 @@ public:
 
 	void focus() override;
 
-	std::string title() const override { return "ERT"; };
+	std::string title() const override { return live ? "ERT" : "ERT Replay"; };
 
 private:
+	const bool live { true };
 	ERTRecentEntries recent;
 	std::unique_ptr<ERTLogger> logger;
 
 	ERTRecentEntriesView recent_entries_view { recent };
 
+	void replay(const std::string& file_path);
 	void on_packet(const ert::Packet& packet);
 	void on_show_list();
 };
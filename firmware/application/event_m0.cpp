@@ -34,6 +34,9 @@
 #include "irq_controls.hpp"
 
 #include "capture_thread.hpp"
+#include "sweep_thread.hpp"
+#include "agc_thread.hpp"
+#include "scan_thread.hpp"
 
 #include "ch.h"
 
@@ -49,6 +52,9 @@ CH_IRQ_HANDLER(M4Core_IRQHandler) {
 
 	chSysLockFromIsr();
 	CaptureThread::check_fifo_isr();
+	SweepThread::check_fifo_isr();
+	AGCThread::check_report_isr();
+	ScanThread::check_report_isr();
 	EventDispatcher::check_fifo_isr();
 	chSysUnlockFromIsr();
 
@@ -61,6 +67,7 @@ CH_IRQ_HANDLER(M4Core_IRQHandler) {
 
 MessageHandlerMap EventDispatcher::message_map_;
 Thread* EventDispatcher::thread_event_loop = nullptr;
+FrameStatistics EventDispatcher::frame_statistics_;
 
 EventDispatcher::EventDispatcher(
 	ui::Widget* const top_widget,
@@ -105,6 +112,9 @@ void EventDispatcher::set_display_sleep(const bool sleep) {
 		portapack::io.lcd_backlight(true);
 	}
 	display_sleep = sleep;
+
+	// Frames that go by while asleep weren't missed, don't count them.
+	frames_handled = 0;
 };
 
 eventmask_t EventDispatcher::wait() {
@@ -112,6 +122,14 @@ eventmask_t EventDispatcher::wait() {
 }
 
 void EventDispatcher::dispatch(const eventmask_t events) {
+	// Paint first, right at TE, so a burst of application messages
+	// can't push painting into the next scan-out and cause tearing.
+	if( !display_sleep ) {
+		if( events & EVT_MASK_LCD_FRAME_SYNC ) {
+			handle_lcd_frame_sync();
+		}
+	}
+
 	if( events & EVT_MASK_APPLICATION ) {
 		handle_application_queue();
 	}
@@ -129,10 +147,6 @@ void EventDispatcher::dispatch(const eventmask_t events) {
 	}
 
 	if( !display_sleep ) {
-		if( events & EVT_MASK_LCD_FRAME_SYNC ) {
-			handle_lcd_frame_sync();
-		}
-
 		if( events & EVT_MASK_TOUCH ) {
 			handle_touch();
 		}
@@ -208,9 +222,22 @@ void EventDispatcher::on_touch_event(ui::TouchEvent event) {
 }
 
 void EventDispatcher::handle_lcd_frame_sync() {
+	const systime_t deadline = chTimeNow() + frame_paint_budget;
+
+	// TE events coalesce while the event loop is busy; count the ones we slept through.
+	const auto frames = frame_statistics_.frames;
+	if( frames_handled && ((frames - frames_handled) > 1) ) {
+		frame_statistics_.missed += frames - frames_handled - 1;
+	}
+	frames_handled = frames;
+
 	DisplayFrameSyncMessage message;
 	message_map().send(&message);
-	painter.paint_widget_tree(top_widget);
+
+	frame_statistics_.painted++;
+	if( !painter.paint_widget_tree(top_widget, deadline) ) {
+		frame_statistics_.deferred++;
+	}
 }
 
 void EventDispatcher::handle_switches() {
@@ -45,6 +45,16 @@ constexpr auto EVT_MASK_ENCODER			= EVENT_MASK(4);
 constexpr auto EVT_MASK_TOUCH			= EVENT_MASK(5);
 constexpr auto EVT_MASK_APPLICATION		= EVENT_MASK(6);
 constexpr auto EVT_MASK_CAPTURE_THREAD	= EVENT_MASK(7);
+constexpr auto EVT_MASK_SWEEP_THREAD	= EVENT_MASK(8);
+constexpr auto EVT_MASK_AGC_THREAD		= EVENT_MASK(9);
+constexpr auto EVT_MASK_SCAN_THREAD		= EVENT_MASK(10);
+
+struct FrameStatistics {
+	uint32_t frames { 0 };		// LCD TE pulses seen
+	uint32_t painted { 0 };		// Paint passes run at TE
+	uint32_t missed { 0 };		// TE pulses that went by without a paint pass
+	uint32_t deferred { 0 };	// Paint passes that ran out of budget
+};
 
 class EventDispatcher {
 public:
@@ -77,13 +87,30 @@ public:
 		}
 	}
 
+	static inline void frame_sync_isr() {
+		frame_statistics_.frames++;
+		events_flag_isr(EVT_MASK_LCD_FRAME_SYNC);
+	}
+
+	static const FrameStatistics& frame_statistics() {
+		return frame_statistics_;
+	}
+
 	static MessageHandlerMap& message_map() {
 		return message_map_;
 	}
 
 private:
+	/* ILI9341 refreshes at ~70Hz (14.3ms). Leave part of each frame
+	 * for input and application queue handling.
+	 */
+	static constexpr systime_t frame_paint_budget = MS2ST(10);
+
 	static MessageHandlerMap message_map_;
 	static Thread* thread_event_loop;
+	static FrameStatistics frame_statistics_;
+
+	uint32_t frames_handled = 0;
 
 	touch::Manager touch_manager;
 	ui::Widget* const top_widget;
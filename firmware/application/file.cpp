@@ -21,9 +21,17 @@
 
 #include "file.hpp"
 
+#include "file_index.hpp"
+#include "utility.hpp"
+
 #include <algorithm>
 
-File::File(const std::string& filename, openmode mode) {
+File::File(
+	const std::string& filename,
+	openmode mode,
+	const sd_io::Priority priority
+) : priority { priority }
+{
 	BYTE fatfs_mode = 0;
 	if( mode & openmode::in ) {
 		fatfs_mode |= FA_READ;
@@ -38,53 +46,262 @@ File::File(const std::string& filename, openmode mode) {
 		fatfs_mode |= FA_OPEN_ALWAYS;
 	}
 
-	if( f_open(&f, filename.c_str(), fatfs_mode) == FR_OK ) {
-		if( mode & openmode::ate ) {
-			if( f_lseek(&f, f_size(&f)) != FR_OK ) {
-				f_close(&f);
+	sd_io::execute(priority, [this, &filename, fatfs_mode, mode]() {
+		if( f_open(&f, filename.c_str(), fatfs_mode) == FR_OK ) {
+			if( mode & openmode::ate ) {
+				if( f_lseek(&f, f_size(&f)) != FR_OK ) {
+					f_close(&f);
+				}
 			}
 		}
-	}
+		return true;
+	});
 }
 
 File::~File() {
-	f_close(&f);
+	wait_for_reserve();
+
+	bool written = false;
+	sd_io::execute(priority, [this, &written]() {
+		written = is_open() && (f.flag & FA_WRITE);
+		f_close(&f);
+		return true;
+	});
+	if( written ) {
+		file_index::on_file_written();
+	}
 }
 
 bool File::read(void* const data, const size_t bytes_to_read) {
-	UINT bytes_read = 0;
-	const auto result = f_read(&f, data, bytes_to_read, &bytes_read);
-	return (result == FR_OK) && (bytes_read == bytes_to_read);
+	auto p = reinterpret_cast<uint8_t*>(data);
+	size_t remaining = bytes_to_read;
+	bool success = true;
+	sd_io::execute(priority, [this, &p, &remaining, &success]() {
+		const size_t slice = std::min(remaining, sd_io::slice_size);
+		UINT bytes_read = 0;
+		const auto result = f_read(&f, p, slice, &bytes_read);
+		success = (result == FR_OK) && (bytes_read == slice);
+		p += slice;
+		remaining -= slice;
+		return !success || (remaining == 0);
+	});
+	return success;
 }
 
 bool File::write(const void* const data, const size_t bytes_to_write) {
-	UINT bytes_written = 0;
-	const auto result = f_write(&f, data, bytes_to_write, &bytes_written);
-	return (result == FR_OK) && (bytes_written == bytes_to_write);
+	auto p = reinterpret_cast<const uint8_t*>(data);
+	size_t remaining = bytes_to_write;
+	bool success = true;
+	sd_io::execute(priority, [this, &p, &remaining, &success]() {
+		const size_t slice = std::min(remaining, sd_io::slice_size);
+		UINT bytes_written = 0;
+		const auto result = f_write(&f, p, slice, &bytes_written);
+		success = (result == FR_OK) && (bytes_written == slice);
+		p += slice;
+		remaining -= slice;
+		return !success || (remaining == 0);
+	});
+	return success;
 }
 
 uint64_t File::seek(const uint64_t new_position) {
-	const auto old_position = f_tell(&f);
-	if( f_lseek(&f, new_position) != FR_OK ) {
-		f_close(&f);
+	uint64_t old_position = 0;
+	sd_io::execute(priority, [this, new_position, &old_position]() {
+		old_position = f_tell(&f);
+		if( f_lseek(&f, new_position) != FR_OK ) {
+			f_close(&f);
+		}
+		if( f_tell(&f) != new_position ) {
+			f_close(&f);
+		}
+		return true;
+	});
+	return old_position;
+}
+
+uint64_t File::size() const {
+	return f_size(&f);
+}
+
+bool File::reserve(const uint64_t new_size) {
+	bool success = true;
+	sd_io::execute(priority, [this, new_size, &success]() {
+		return reserve_step(new_size, success);
+	});
+	return success;
+}
+
+bool File::reserve_later(const uint64_t new_size) {
+	if( reserve_pending_ ) {
+		return false;
 	}
-	if( f_tell(&f) != new_position ) {
+
+	reserve_pending_ = true;
+	reserve_request.priority = sd_io::Priority::Logging;
+	reserve_request.step = [this, new_size]() {
+		bool success = true;
+		return reserve_step(new_size, success);
+	};
+	reserve_request.on_complete = [this]() {
+		reserve_pending_ = false;
+	};
+	sd_io::submit(reserve_request);
+	return true;
+}
+
+/* Runs on the I/O thread. Once the file is mapped, each call grows it by
+ * at most reserve_step_clusters and extends the map as it goes, so the
+ * cost follows the clusters added rather than the file size, and other
+ * requests get in between steps. Returns true when done.
+ */
+bool File::reserve_step(const uint64_t new_size, bool& success) {
+	if( new_size > UINT32_MAX ) {
+		success = false;
+		return true;
+	}
+	if( f.cltbl && (f_size(&f) >= new_size) ) {
+		return true;
+	}
+
+	const DWORD position = f_tell(&f);
+
+	if( !f.cltbl ) {
+		// Nothing mapped yet: allocate, then map the whole chain once.
+		if( new_size > f_size(&f) ) {
+			success = (f_lseek(&f, new_size) == FR_OK) && (f_tell(&f) == new_size);
+		}
+		if( f_lseek(&f, position) != FR_OK ) {
+			f_close(&f);
+			success = false;
+		}
+		if( f_sync(&f) != FR_OK ) {
+			success = false;
+		}
+
+		if( success ) {
+			if( !link_map ) {
+				link_map = std::make_unique<std::array<DWORD, link_map_size>>();
+			}
+			if( link_map ) {
+				(*link_map)[0] = link_map->size();
+				f.cltbl = link_map->data();
+				if( f_lseek(&f, CREATE_LINKMAP) != FR_OK ) {
+					// Too fragmented to map, keep writing the slow way.
+					f.cltbl = nullptr;
+				}
+			}
+		}
+		return true;
+	}
+
+	const auto& map = *link_map;
+	DWORD clusters = 0;
+	for(size_t i=1; (i + 1) < map[0]; i+=2) {
+		clusters += map[i];
+	}
+	const uint64_t cluster_bytes = static_cast<uint64_t>(f.fs->csize) * _MAX_SS;
+
+	// A mapped file can't grow, so jump to the end through the map, then
+	// drop it and seek on a cluster at a time, noting each new cluster.
+	bool grown = (f_lseek(&f, f_size(&f)) == FR_OK);
+	bool mapped = true;
+	f.cltbl = nullptr;
+	for(size_t n=0; grown && mapped && (n < reserve_step_clusters) && (f_size(&f) < new_size); n++) {
+		const uint64_t mapped_bytes = clusters * cluster_bytes;
+		const DWORD target = std::min(mapped_bytes + cluster_bytes, new_size);
+		grown = (f_lseek(&f, target) == FR_OK) && (f_tell(&f) == target);
+		if( grown && (target > mapped_bytes) ) {
+			mapped = map_cluster(f.clust);
+			clusters++;
+		}
+	}
+
+	if( !mapped ) {
+		// Too fragmented to map after all, finish the slow way.
+		if( f_lseek(&f, position) != FR_OK ) {
+			f_close(&f);
+			success = false;
+			return true;
+		}
+		return reserve_step(new_size, success);
+	}
+
+	f.cltbl = link_map->data();
+	if( f_lseek(&f, position) != FR_OK ) {
 		f_close(&f);
+		grown = false;
 	}
-	return old_position;
+	if( f_sync(&f) != FR_OK ) {
+		grown = false;
+	}
+	if( !grown ) {
+		success = false;
+		return true;
+	}
+	return (f_size(&f) >= new_size);
+}
+
+/* Append a cluster to the link map, false if the map is full. */
+bool File::map_cluster(const DWORD cluster) {
+	auto& map = *link_map;
+	const DWORD used = map[0];
+	if( (used > 2) && ((map[used - 2] + map[used - 3]) == cluster) ) {
+		map[used - 3]++;
+		return true;
+	}
+	if( (used + 2) > map.size() ) {
+		return false;
+	}
+	map[used - 1] = 1;
+	map[used] = cluster;
+	map[used + 1] = 0;
+	map[0] = used + 2;
+	return true;
+}
+
+/* Requests of one priority are served in order, and a reservation step
+ * that isn't done goes to the back of its queue, so wait behind it until
+ * it's finished.
+ */
+void File::wait_for_reserve() {
+	while( reserve_pending_ ) {
+		sd_io::execute(reserve_request.priority, []() {
+			return true;
+		});
+	}
+}
+
+bool File::truncate() {
+	wait_for_reserve();
+
+	FRESULT result = FR_OK;
+	sd_io::execute(priority, [this, &result]() {
+		f.cltbl = nullptr;
+		result = f_truncate(&f);
+		return true;
+	});
+	return (result == FR_OK);
 }
 
 bool File::puts(const std::string& string) {
-	const auto result = f_puts(string.c_str(), &f);
+	int result = 0;
+	sd_io::execute(priority, [this, &string, &result]() {
+		result = f_puts(string.c_str(), &f);
+		return true;
+	});
 	return (result >= 0);
 }
 
 bool File::sync() {
-	const auto result = f_sync(&f);
+	FRESULT result = FR_OK;
+	sd_io::execute(priority, [this, &result]() {
+		result = f_sync(&f);
+		return true;
+	});
 	return (result == FR_OK);
 }
 
-static std::string find_last_file_matching_pattern(const std::string& pattern) {
+std::string find_last_file_matching_pattern(const std::string& pattern) {
 	std::string last_match;
 	for(const auto& entry : std::filesystem::directory_iterator("", pattern.c_str())) {
 		if( std::filesystem::is_regular_file(entry.status()) ) {
@@ -126,14 +343,21 @@ static std::string increment_filename_stem_ordinal(const std::string& filename_s
 }
 
 std::string next_filename_stem_matching_pattern(const std::string& filename_stem_pattern) {
-	const auto filename = find_last_file_matching_pattern(filename_stem_pattern + ".*");
-	auto filename_stem = remove_filename_extension(filename);
+	std::string filename_stem;
+	if( !file_index::find_stem(filename_stem_pattern, filename_stem) ) {
+		const auto filename = find_last_file_matching_pattern(filename_stem_pattern + ".*");
+		filename_stem = remove_filename_extension(filename);
+	}
 	if( filename_stem.empty() ) {
 		filename_stem = filename_stem_pattern;
 		std::replace(std::begin(filename_stem), std::end(filename_stem), '?', '0');
 	} else {
 		filename_stem = increment_filename_stem_ordinal(filename_stem);
 	}
+	// Handed out now, so the next call moves on even if it isn't used.
+	if( !filename_stem.empty() ) {
+		file_index::record_stem(filename_stem_pattern, filename_stem);
+	}
 	return filename_stem;
 }
 
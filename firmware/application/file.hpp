@@ -24,6 +24,8 @@
 
 #include "ff.h"
 
+#include "sd_io.hpp"
+
 #include <cstddef>
 #include <string>
 #include <array>
@@ -41,7 +43,11 @@ public:
 		ate = FA_OPEN_ALWAYS,
 	};
 
-	File(const std::string& filename, openmode mode);
+	File(
+		const std::string& filename,
+		openmode mode,
+		const sd_io::Priority priority = sd_io::Priority::Interactive
+	);
 	~File();
 
 	bool is_open() const {
@@ -52,6 +58,29 @@ public:
 	bool write(const void* const data, const size_t bytes_to_write);
 
 	uint64_t seek(const uint64_t new_position);
+	uint64_t size() const;
+
+	/* Allocate clusters until the file is at least new_size bytes, without
+	 * moving the file position, and commit the allocation to the card. If
+	 * the clusters fit in a few fragments, they are mapped so seeks and
+	 * writes inside the file no longer walk the FAT. While mapped, writes
+	 * cannot go past the reserved size; call reserve() again to grow.
+	 */
+	bool reserve(const uint64_t new_size);
+
+	/* As reserve(), but queued behind real-time writes and returned from
+	 * at once. Returns false if one is still pending.
+	 */
+	bool reserve_later(const uint64_t new_size);
+
+	bool reserve_pending() const {
+		return reserve_pending_;
+	}
+
+	/* Discard everything after the file position, including clusters
+	 * left over from reserve().
+	 */
+	bool truncate();
 
 	template<size_t N>
 	bool write(const std::array<uint8_t, N>& data) {
@@ -63,13 +92,25 @@ public:
 	bool sync();
 
 private:
+	static constexpr size_t link_map_size = 32;
+	static constexpr size_t reserve_step_clusters = 64;
+
 	FIL f;
+	const sd_io::Priority priority;
+	std::unique_ptr<std::array<DWORD, link_map_size>> link_map;
+	sd_io::Request reserve_request;
+	volatile bool reserve_pending_ { false };
+
+	bool reserve_step(const uint64_t new_size, bool& success);
+	bool map_cluster(const DWORD cluster);
+	void wait_for_reserve();
 };
 
 inline constexpr File::openmode operator|(File::openmode a, File::openmode b) {
 	return File::openmode(static_cast<int>(a) | static_cast<int>(b));
 }
 
+std::string find_last_file_matching_pattern(const std::string& pattern);
 std::string next_filename_stem_matching_pattern(const std::string& filename_stem_pattern);
 
 namespace std {
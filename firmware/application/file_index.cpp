@@ -0,0 +1,309 @@
+/*
+ * Copyright (C) 2016 Jared Boone, ShareBrained Technology, Inc.
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "file_index.hpp"
+
+#include "sd_io.hpp"
+#include "utility.hpp"
+
+#include "ff.h"
+
+#include <array>
+#include <algorithm>
+#include <cstring>
+
+namespace file_index {
+
+namespace {
+
+constexpr char index_filename[] = "_PPINDEX.DAT";
+constexpr uint32_t index_magic = 0x58495050;	// "PPIX"
+constexpr uint16_t index_version = 1;
+
+constexpr size_t pattern_length = 8;
+constexpr size_t module_filename_length = 12;
+constexpr size_t hash_length = 16;
+
+struct Fingerprint {
+	uint32_t volume_base;
+	uint32_t cluster_count;
+	uint32_t free_clusters;
+
+	bool operator==(const Fingerprint& other) const {
+		return (volume_base == other.volume_base)
+			&& (cluster_count == other.cluster_count)
+			&& (free_clusters == other.free_clusters);
+	}
+};
+
+/* Names are stored without terminators, zero padded. */
+struct StemEntry {
+	char pattern[pattern_length];
+	char stem[pattern_length];
+};
+
+struct ModuleEntry {
+	uint8_t hash[hash_length];
+	char filename[module_filename_length];
+};
+
+/* Most recently used entries first. */
+struct Index {
+	uint32_t magic;
+	uint16_t version;
+	uint16_t reserved;
+	Fingerprint fingerprint;
+	std::array<StemEntry, 8> stems;
+	std::array<ModuleEntry, 8> modules;
+};
+
+/* A FIL is over half a kilobyte, so it lives with the index in the heap
+ * scratch rather than on the I/O thread's stack.
+ */
+struct Scratch {
+	Index index;
+	FIL file;
+};
+
+/* Whether the stems in the index file describe the mounted volume, as of
+ * the last time it was checked. Only touched on the I/O thread.
+ */
+bool stems_trusted = false;
+
+void copy_padded(char* const dst, const std::string& src, const size_t length) {
+	std::memset(dst, 0, length);
+	std::memcpy(dst, src.data(), std::min(src.size(), length));
+}
+
+std::string from_padded(const char* const src, const size_t length) {
+	return { src, static_cast<size_t>(std::find(src, src + length, 0) - src) };
+}
+
+bool current_fingerprint(Fingerprint& fingerprint) {
+	FATFS* fs = nullptr;
+	DWORD free_clusters = 0;
+	if( f_getfree("", &free_clusters, &fs) != FR_OK ) {
+		return false;
+	}
+	fingerprint.volume_base = fs->volbase;
+	fingerprint.cluster_count = fs->n_fatent;
+	fingerprint.free_clusters = free_clusters;
+	return true;
+}
+
+bool load(Scratch& scratch) {
+	auto& index = scratch.index;
+	auto& f = scratch.file;
+	if( f_open(&f, index_filename, FA_READ | FA_OPEN_EXISTING) != FR_OK ) {
+		return false;
+	}
+	UINT bytes_read = 0;
+	const auto result = f_read(&f, &index, sizeof(index), &bytes_read);
+	f_close(&f);
+	return (result == FR_OK)
+		&& (bytes_read == sizeof(index))
+		&& (index.magic == index_magic)
+		&& (index.version == index_version);
+}
+
+void clear(Index& index) {
+	std::memset(&index, 0, sizeof(index));
+	index.magic = index_magic;
+	index.version = index_version;
+}
+
+/* The file is always the same size, so rewriting it never allocates and
+ * the fingerprint taken after the first write still holds after the
+ * second.
+ */
+bool save(Scratch& scratch) {
+	auto& index = scratch.index;
+	auto& f = scratch.file;
+	if( f_open(&f, index_filename, FA_WRITE | FA_OPEN_ALWAYS) != FR_OK ) {
+		return false;
+	}
+	UINT bytes_written = 0;
+	bool success = (f_write(&f, &index, sizeof(index), &bytes_written) == FR_OK)
+		&& (bytes_written == sizeof(index))
+		&& (f_sync(&f) == FR_OK)
+		&& current_fingerprint(index.fingerprint)
+		&& (f_lseek(&f, 0) == FR_OK)
+		&& (f_write(&f, &index, sizeof(index), &bytes_written) == FR_OK);
+	success = (f_close(&f) == FR_OK) && success;
+	return success;
+}
+
+bool load_trusted(Scratch& scratch) {
+	Fingerprint fingerprint;
+	stems_trusted = load(scratch)
+		&& current_fingerprint(fingerprint)
+		&& (scratch.index.fingerprint == fingerprint);
+	return stems_trusted;
+}
+
+/* Load the index for modification. Saving refreshes the fingerprint, so
+ * stems that can't be trusted now must not survive the save.
+ */
+void load_for_update(Scratch& scratch) {
+	auto& index = scratch.index;
+	Fingerprint fingerprint;
+	const bool loaded = load(scratch);
+	stems_trusted = loaded
+		&& current_fingerprint(fingerprint)
+		&& (index.fingerprint == fingerprint);
+	if( !loaded ) {
+		clear(index);
+	} else if( !stems_trusted ) {
+		index.stems = { };
+	}
+}
+
+/* Move entry i to the front, shifting the ones before it down. */
+template<typename T>
+void move_to_front(std::array<T, 8>& entries, const size_t i) {
+	std::rotate(entries.begin(), entries.begin() + i, entries.begin() + i + 1);
+}
+
+/* Index scratch space comes from the heap, as callers include threads
+ * with small stacks.
+ */
+template<typename Fn>
+void with_index(Fn fn) {
+	const auto scratch = std::make_unique<Scratch>();
+	if( scratch ) {
+		sd_io::execute(sd_io::Priority::Interactive, [&scratch, &fn]() {
+			fn(*scratch);
+			return true;
+		});
+	}
+}
+
+} /* namespace */
+
+void on_mount() {
+	with_index([](Scratch& scratch) {
+		load_trusted(scratch);
+	});
+}
+
+void on_unmount() {
+	with_index([](Scratch&) {
+		stems_trusted = false;
+	});
+}
+
+void on_file_written() {
+	with_index([](Scratch& scratch) {
+		if( !stems_trusted ) {
+			return;
+		}
+		// Our own change; carry the trust over to the new free count.
+		Fingerprint fingerprint;
+		if( load(scratch) && current_fingerprint(fingerprint) ) {
+			if( !(scratch.index.fingerprint == fingerprint) ) {
+				stems_trusted = save(scratch);
+			}
+		} else {
+			stems_trusted = false;
+		}
+	});
+}
+
+bool find_stem(const std::string& pattern, std::string& stem) {
+	if( pattern.size() > pattern_length ) {
+		return false;
+	}
+
+	bool found = false;
+	with_index([&pattern, &stem, &found](Scratch& scratch) {
+		if( !load_trusted(scratch) ) {
+			return;
+		}
+		for(const auto& entry : scratch.index.stems) {
+			if( from_padded(entry.pattern, pattern_length) == pattern ) {
+				stem = from_padded(entry.stem, pattern_length);
+				found = true;
+				return;
+			}
+		}
+	});
+	return found;
+}
+
+void record_stem(const std::string& pattern, const std::string& stem) {
+	if( (pattern.size() > pattern_length) || (stem.size() > pattern_length) ) {
+		return;
+	}
+
+	with_index([&pattern, &stem](Scratch& scratch) {
+		auto& index = scratch.index;
+		load_for_update(scratch);
+
+		size_t i = 0;
+		while( (i < index.stems.size() - 1) && (from_padded(index.stems[i].pattern, pattern_length) != pattern) ) {
+			i++;
+		}
+		copy_padded(index.stems[i].pattern, pattern, pattern_length);
+		copy_padded(index.stems[i].stem, stem, pattern_length);
+		move_to_front(index.stems, i);
+
+		stems_trusted = save(scratch);
+	});
+}
+
+std::string find_module(const void* const hash) {
+	std::string filename;
+	with_index([hash, &filename](Scratch& scratch) {
+		if( !load(scratch) ) {
+			return;
+		}
+		for(const auto& entry : scratch.index.modules) {
+			if( std::memcmp(entry.hash, hash, hash_length) == 0 ) {
+				filename = from_padded(entry.filename, module_filename_length);
+				return;
+			}
+		}
+	});
+	return filename;
+}
+
+void record_module(const void* const hash, const std::string& filename) {
+	if( filename.size() > module_filename_length ) {
+		return;
+	}
+
+	with_index([hash, &filename](Scratch& scratch) {
+		auto& index = scratch.index;
+		load_for_update(scratch);
+
+		size_t i = 0;
+		while( (i < index.modules.size() - 1) && (std::memcmp(index.modules[i].hash, hash, hash_length) != 0) ) {
+			i++;
+		}
+		std::memcpy(index.modules[i].hash, hash, hash_length);
+		copy_padded(index.modules[i].filename, filename, module_filename_length);
+		move_to_front(index.modules, i);
+
+		stems_trusted = save(scratch);
+	});
+}
+
+} /* namespace file_index */
@@ -0,0 +1,59 @@
+/*
+ * Copyright (C) 2016 Jared Boone, ShareBrained Technology, Inc.
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __FILE_INDEX_H__
+#define __FILE_INDEX_H__
+
+#include <cstdint>
+#include <string>
+
+/* A small index kept in the root directory (_PPINDEX.DAT) that remembers
+ * answers which would otherwise need a full directory scan: the last
+ * filename stem handed out for each numbered pattern, and which file
+ * holds each baseband module.
+ *
+ * Stems are only trusted while the volume's free cluster count matches
+ * the one recorded after this firmware's last write; anything else
+ * touching the card invalidates them and the next lookup rescans. Module
+ * entries are hints, and callers verify the module header before use.
+ */
+namespace file_index {
+
+/* Call when a volume is mounted or removed. */
+void on_mount();
+void on_unmount();
+
+/* Call after a file this firmware wrote has been closed. */
+void on_file_written();
+
+/* Last stem recorded for a pattern such as "AUD_????". Returns false if
+ * the index can't answer, in which case the caller scans the directory.
+ */
+bool find_stem(const std::string& pattern, std::string& stem);
+void record_stem(const std::string& pattern, const std::string& stem);
+
+/* 16-byte module hash to filename, or empty if not known. */
+std::string find_module(const void* const hash);
+void record_module(const void* const hash, const std::string& filename);
+
+} /* namespace file_index */
+
+#endif/*__FILE_INDEX_H__*/
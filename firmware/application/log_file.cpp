@@ -22,11 +22,27 @@
 #include "log_file.hpp"
 
 #include "string_format.hpp"
+#include "time.hpp"
+
+#include <algorithm>
 
 LogFile::LogFile(
-	const std::string& file_path
-) : file { file_path, File::openmode::out | File::openmode::ate }
+	const std::string& file_path,
+	const Durability durability
+) : file { file_path, File::openmode::out | File::openmode::ate, sd_io::Priority::Logging },
+	durability { durability },
+	buffer { std::make_unique<char[]>(buffer_size) }
 {
+	signal_token_tick_second = time::signal_tick_second += [this]() {
+		this->on_tick_second();
+	};
+}
+
+LogFile::~LogFile() {
+	time::signal_tick_second -= signal_token_tick_second;
+
+	// Closing the file syncs it.
+	commit();
 }
 
 bool LogFile::is_open() const {
@@ -38,6 +54,55 @@ bool LogFile::write_entry(const rtc::RTC& datetime, const std::string& entry) {
 	return write(timestamp + " " + entry + "\r\n");
 }
 
+bool LogFile::commit() {
+	if( buffer_used == 0 ) {
+		return true;
+	}
+
+	const auto written = file.write(buffer.get(), buffer_used);
+	buffer_used = 0;
+	if( !written ) {
+		return false;
+	}
+
+	if( durability == Durability::Close ) {
+		return true;
+	}
+	return file.sync();
+}
+
 bool LogFile::write(const std::string& message) {
-	return file.puts(message) && file.sync();
+	return write(message.data(), message.size());
+}
+
+bool LogFile::write(const void* const data, const size_t length) {
+	if( length > (buffer_size - buffer_used) ) {
+		if( !commit() ) {
+			return false;
+		}
+	}
+
+	if( length > buffer_size ) {
+		// Too big to batch, write it straight through.
+		return file.write(data, length)
+			&& ((durability == Durability::Close) || file.sync());
+	}
+
+	if( buffer_used == 0 ) {
+		pending_since = chTimeNow();
+	}
+	const auto p = reinterpret_cast<const char*>(data);
+	std::copy(&p[0], &p[length], &buffer[buffer_used]);
+	buffer_used += length;
+
+	if( durability == Durability::Entry ) {
+		return commit();
+	}
+	return true;
+}
+
+void LogFile::on_tick_second() {
+	if( buffer_used && ((chTimeNow() - pending_since) >= commit_interval) ) {
+		commit();
+	}
 }
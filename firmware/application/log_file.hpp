@@ -23,24 +23,54 @@
 #define __LOG_FILE_H__
 
 #include <string>
+#include <memory>
+
+#include "ch.h"
 
 #include "file.hpp"
+#include "signal.hpp"
 
 #include "lpc43xx_cpp.hpp"
 using namespace lpc43xx;
 
+/* Entries are appended to a RAM buffer and committed to the card in
+ * batches: when the buffer fills, when the oldest pending entry is more
+ * than commit_interval old (checked on the RTC second tick), on commit(),
+ * and when the LogFile is destroyed.
+ */
 class LogFile {
 public:
-	LogFile(const std::string& file_path);
+	enum class Durability {
+		Entry,		// Commit and sync every entry.
+		Commit,		// Sync the file after each batch is committed.
+		Close,		// Sync only when the file is closed.
+	};
+
+	LogFile(const std::string& file_path, const Durability durability = Durability::Commit);
+	~LogFile();
 
 	bool is_open() const;
 
 	bool write_entry(const rtc::RTC& datetime, const std::string& entry);
+	bool write(const void* const data, const size_t length);
+
+	bool commit();
 
 private:
+	static constexpr size_t buffer_size = 2048;
+	static constexpr systime_t commit_interval = MS2ST(1000);
+
 	File file;
+	const Durability durability;
+	std::unique_ptr<char[]> buffer;
+	size_t buffer_used { 0 };
+	systime_t pending_since { 0 };
+
+	SignalToken signal_token_tick_second;
 
 	bool write(const std::string& message);
+
+	void on_tick_second();
 };
 
 #endif/*__LOG_FILE_H__*/
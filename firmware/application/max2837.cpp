@@ -134,13 +134,31 @@ void MAX2837::set_mode(const Mode mode) {
 	gpio_max2837_txenable.write(toUType(mode) & toUType(Mode::Mask_TxEnable));
 }
 
+void MAX2837::hold() {
+	_held = true;
+}
+
+void MAX2837::commit() {
+	_held = false;
+	flush();
+}
+
 void MAX2837::flush() {
+	if( _held ) {
+		return;
+	}
+
 	if( _dirty ) {
+		/* Low FRDIV commits a synthesizer change, so it goes last. */
+		constexpr auto commit_reg = toUType(Register::SYN_FR_DIV_1);
 		for(size_t n=0; n<reg_count; n++) {
-			if( _dirty[n] ) {
+			if( _dirty[n] && (n != commit_reg) ) {
 				write(n, _map.w[n]);
 			}
 		}
+		if( _dirty[commit_reg] ) {
+			write(commit_reg, _map.w[commit_reg]);
+		}
 		_dirty.clear();
 	}
 }
@@ -194,37 +212,75 @@ void MAX2837::set_lpf_rf_bandwidth(const uint32_t bandwidth_minimum) {
 	flush();
 }
 
-bool MAX2837::set_frequency(const rf::Frequency lo_frequency) {
+SynthConfig SynthConfig::calculate(const rf::Frequency lo_frequency) {
 	/* TODO: This is a sad implementation. Refactor. */
+	uint8_t logen_bsw = 0;
+	uint8_t lna_band = 0;
 	if( lo::band[0].contains(lo_frequency) ) {
-		_map.r.syn_int_div.LOGEN_BSW = 0b00;	/* 2300 - 2399.99MHz */
-		_map.r.rxrf_1.LNAband = 0;				/* 2.3 - 2.5GHz */
+		logen_bsw = 0b00;	/* 2300 - 2399.99MHz */
+		lna_band = 0;		/* 2.3 - 2.5GHz */
 	} else if( lo::band[1].contains(lo_frequency)  ) {
-		_map.r.syn_int_div.LOGEN_BSW = 0b01;	/* 2400 - 2499.99MHz */
-		_map.r.rxrf_1.LNAband = 0;				/* 2.3 - 2.5GHz */
+		logen_bsw = 0b01;	/* 2400 - 2499.99MHz */
+		lna_band = 0;		/* 2.3 - 2.5GHz */
 	} else if( lo::band[2].contains(lo_frequency) ) {
-		_map.r.syn_int_div.LOGEN_BSW = 0b10;	/* 2500 - 2599.99MHz */
-		_map.r.rxrf_1.LNAband = 1;				/* 2.5 - 2.7GHz */
+		logen_bsw = 0b10;	/* 2500 - 2599.99MHz */
+		lna_band = 1;		/* 2.5 - 2.7GHz */
 	} else if( lo::band[3].contains(lo_frequency) ) {
-		_map.r.syn_int_div.LOGEN_BSW = 0b11;	/* 2600 - 2700Hz */
-		_map.r.rxrf_1.LNAband = 1;				/* 2.5 - 2.7GHz */
+		logen_bsw = 0b11;	/* 2600 - 2700Hz */
+		lna_band = 1;		/* 2.5 - 2.7GHz */
 	} else {
-		return false;
+		return { 0, 0, 0 };
 	}
-	_dirty[Register::SYN_INT_DIV] = 1;
-	_dirty[Register::RXRF_1] = 1;
 
 	const uint64_t div_q20 = (lo_frequency * (1 << 20)) / pll_factor;
 
-	_map.r.syn_int_div.SYN_INTDIV = div_q20 >> 20;
-	_dirty[Register::SYN_INT_DIV] = 1;
-	_map.r.syn_fr_div_2.SYN_FRDIV_19_10 = (div_q20 >> 10) & 0x3ff;
-	_dirty[Register::SYN_FR_DIV_2] = 1;
-	/* flush to commit high FRDIV first, as low FRDIV commits the change */
-	flush();
+	return {
+		logen_bsw,
+		lna_band,
+		static_cast<uint32_t>(div_q20),
+	};
+}
+
+bool MAX2837::set_frequency(const rf::Frequency lo_frequency) {
+	return set_frequency(SynthConfig::calculate(lo_frequency));
+}
+
+/* Only registers whose contents change are written, so hopping between
+ * nearby frequencies costs as few SPI transfers as possible.
+ */
+bool MAX2837::set_frequency(const SynthConfig& synth_config) {
+	if( !synth_config.is_valid() ) {
+		return false;
+	}
+
+	const auto syn_int_div_prior = _map.w[toUType(Register::SYN_INT_DIV)];
+	const auto syn_fr_div_2_prior = _map.w[toUType(Register::SYN_FR_DIV_2)];
+	const auto syn_fr_div_1_prior = _map.w[toUType(Register::SYN_FR_DIV_1)];
+	const auto rxrf_1_prior = _map.w[toUType(Register::RXRF_1)];
 
-	_map.r.syn_fr_div_1.SYN_FRDIV_9_0 = (div_q20 & 0x3ff);
-	_dirty[Register::SYN_FR_DIV_1] = 1;
+	_map.r.syn_int_div.LOGEN_BSW = synth_config.logen_bsw;
+	_map.r.rxrf_1.LNAband = synth_config.lna_band;
+	_map.r.syn_int_div.SYN_INTDIV = synth_config.div_q20 >> 20;
+	_map.r.syn_fr_div_2.SYN_FRDIV_19_10 = (synth_config.div_q20 >> 10) & 0x3ff;
+	_map.r.syn_fr_div_1.SYN_FRDIV_9_0 = (synth_config.div_q20 & 0x3ff);
+
+	const bool int_div_changed = (_map.w[toUType(Register::SYN_INT_DIV)] != syn_int_div_prior);
+	const bool fr_div_2_changed = (_map.w[toUType(Register::SYN_FR_DIV_2)] != syn_fr_div_2_prior);
+	const bool high_changed = int_div_changed || fr_div_2_changed;
+
+	if( _map.w[toUType(Register::RXRF_1)] != rxrf_1_prior ) {
+		_dirty[Register::RXRF_1] = 1;
+	}
+	if( int_div_changed ) {
+		_dirty[Register::SYN_INT_DIV] = 1;
+	}
+	if( fr_div_2_changed ) {
+		_dirty[Register::SYN_FR_DIV_2] = 1;
+	}
+	/* flush() writes high FRDIV first, as low FRDIV commits the change */
+	if( high_changed || (_map.w[toUType(Register::SYN_FR_DIV_1)] != syn_fr_div_1_prior) ) {
+		_dirty[Register::SYN_FR_DIV_1] = 1;
+	}
 	flush();
 
 	return true;
@@ -818,6 +818,21 @@ constexpr RegisterMap initial_register_values { Register_Type {
 	},
 } };
 
+/* Synthesizer and LNA band settings for one LO frequency, so they can be
+ * worked out ahead of time and applied without any arithmetic.
+ */
+struct SynthConfig {
+	uint8_t logen_bsw;
+	uint8_t lna_band;
+	uint32_t div_q20;
+
+	bool is_valid() const {
+		return (div_q20 != 0);
+	}
+
+	static SynthConfig calculate(const rf::Frequency lo_frequency);
+};
+
 class MAX2837 {
 public:
 	constexpr MAX2837(
@@ -875,6 +890,13 @@ public:
 #endif
 
 	bool set_frequency(const rf::Frequency lo_frequency);
+	bool set_frequency(const SynthConfig& synth_config);
+
+	/* While held, setters only update the register map. commit() then
+	 * writes everything that changed in one pass.
+	 */
+	void hold();
+	void commit();
 
 	reg_t temp_sense();
 
@@ -885,6 +907,7 @@ private:
 
 	RegisterMap _map { initial_register_values };
 	DirtyRegisters<Register, reg_count> _dirty;
+	bool _held { false };
 
 	void flush_one(const Register reg);
 
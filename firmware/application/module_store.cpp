@@ -0,0 +1,213 @@
+/*
+ * Copyright (C) 2016 Jared Boone, ShareBrained Technology, Inc.
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "module_store.hpp"
+
+#include "ch.h"
+
+#include "spi_image.hpp"
+#include "portapack_dma.hpp"
+#include "portapack_shared_memory.hpp"
+#include "utility.hpp"
+#include "crc.hpp"
+
+#include <array>
+#include <algorithm>
+#include <cstring>
+
+namespace module_store {
+
+namespace {
+
+constexpr uint32_t gpdma_ahb_master_memory = 0;
+constexpr uint32_t gpdma_ahb_master_lli_fetch = 0;
+
+/* A GPDMA LLI moves at most 4095 transfers, so copy in 8KiB links. */
+constexpr size_t lli_transfer_bytes = 8_KiB;
+constexpr size_t lli_count = portapack::memory::map::m4_code.size() / lli_transfer_bytes;
+
+constexpr systime_t copy_timeout = 100;
+
+static constexpr auto& gpdma_channel = gpdma::channels[portapack::module_load_gpdma_channel_number];
+
+/* LLIs are fetched by the DMA controller, so they must outlive the call. */
+std::array<gpdma::channel::LLI, lli_count> lli_chain;
+
+const TableHeader& table_header() {
+	return *reinterpret_cast<const TableHeader*>(portapack::spi_flash::modules.base());
+}
+
+const Entry* table_entries() {
+	return reinterpret_cast<const Entry*>(
+		reinterpret_cast<const uint8_t*>(portapack::spi_flash::modules.base()) + sizeof(TableHeader)
+	);
+}
+
+bool is_valid(const Entry& entry) {
+	const size_t region_size = portapack::spi_flash::modules.size;
+	return
+		   ((entry.offset & 3) == 0)
+		&& ((entry.size & 3) == 0)
+		&& (entry.size >= portapack::memory::map::m4_code.size())
+		&& (entry.offset < region_size)
+		&& (entry.size <= (region_size - entry.offset))
+		&& ((entry.entry & ~1U) < portapack::memory::map::m4_code.size())
+		&& entry.info.is_compatible()
+		;
+}
+
+constexpr gpdma::channel::LLIPointer lli_pointer(const void* lli) {
+	return {
+		.lm = gpdma_ahb_master_lli_fetch,
+		.r = 0,
+		.lli = reinterpret_cast<uint32_t>(lli),
+	};
+}
+
+constexpr gpdma::channel::Control control(const size_t transfer_bytes) {
+	return {
+		.transfersize = gpdma::buffer_words(transfer_bytes, 4),
+		.sbsize = 2,	/* Burst size: 8 */
+		.dbsize = 2,	/* Burst size: 8 */
+		.swidth = 2,	/* Source transfer width: word (32 bits) */
+		.dwidth = 2,	/* Destination transfer width: word (32 bits) */
+		.s = gpdma_ahb_master_memory,
+		.d = gpdma_ahb_master_memory,
+		.si = 1,
+		.di = 1,
+		.prot1 = 0,
+		.prot2 = 0,
+		.prot3 = 0,
+		.i = 0,
+	};
+}
+
+constexpr gpdma::channel::Config config() {
+	return {
+		.e = 1,
+		.srcperipheral = 0,
+		.destperipheral = 0,
+		.flowcntrl = gpdma::FlowControl::MemoryToMemory_DMAControl,
+		.ie = 0,
+		.itc = 0,
+		.l = 0,
+		.a = 0,
+		.h = 0,
+	};
+}
+
+/* Copies on the lowest priority channel and polls for completion, which
+ * leaves the M4's peripheral DMA and its interrupt handler undisturbed.
+ */
+bool copy(const uint32_t source, const uint32_t destination, const size_t size) {
+	const size_t links = (size + lli_transfer_bytes - 1) / lli_transfer_bytes;
+	if( links > lli_chain.size() ) {
+		return false;
+	}
+
+	for(size_t i=0; i<links; i++) {
+		const size_t offset = i * lli_transfer_bytes;
+		const bool last = (i + 1) == links;
+		lli_chain[i].srcaddr = source + offset;
+		lli_chain[i].destaddr = destination + offset;
+		lli_chain[i].lli = last ? 0 : static_cast<uint32_t>(lli_pointer(&lli_chain[i + 1]));
+		lli_chain[i].control = control(std::min(lli_transfer_bytes, size - offset));
+	}
+
+	const uint32_t channel_mask = 1U << portapack::module_load_gpdma_channel_number;
+
+	gpdma::controller.enable();
+	gpdma_channel.disable();
+	gpdma_channel.clear_interrupts();
+
+	auto& channel = LPC_GPDMA->CH[portapack::module_load_gpdma_channel_number];
+	channel.SRCADDR = lli_chain[0].srcaddr;
+	channel.DESTADDR = lli_chain[0].destaddr;
+	channel.LLI = lli_chain[0].lli;
+	channel.CONTROL = lli_chain[0].control;
+	channel.CONFIG = config();
+
+	const auto start = chTimeNow();
+	while( gpdma_channel.is_enabled() ) {
+		if( (LPC_GPDMA->RAWINTERRSTAT & channel_mask) || ((chTimeNow() - start) > copy_timeout) ) {
+			break;
+		}
+	}
+
+	const bool success = !gpdma_channel.is_enabled() && !(LPC_GPDMA->RAWINTERRSTAT & channel_mask);
+	gpdma_channel.disable();
+	gpdma_channel.clear_interrupts();
+	return success;
+}
+
+} /* namespace */
+
+const Entry* find(const void* const hash) {
+	const auto& header = table_header();
+	if( (header.magic != table_magic) || (header.version != table_version) ) {
+		return nullptr;
+	}
+
+	const size_t count = std::min(static_cast<size_t>(header.count), entries_max);
+	const auto entries = table_entries();
+	for(size_t i=0; i<count; i++) {
+		const auto& entry = entries[i];
+		if( (std::memcmp(entry.hash, hash, sizeof(entry.hash)) == 0) && is_valid(entry) ) {
+			return &entry;
+		}
+	}
+
+	return nullptr;
+}
+
+bool load(const void* const hash, const portapack::memory::region_t to) {
+	const auto entry = find(hash);
+	if( !entry ) {
+		return false;
+	}
+
+	/* Only the resident code is copied, the M4 loads processor overlays
+	 * from the image itself.
+	 */
+	const uint32_t image_offset = portapack::spi_flash::modules.offset + entry->offset;
+	const size_t resident_size = std::min(static_cast<size_t>(entry->size), to.size());
+
+	/* DMA reads through the uncached alias; the SPIFI cache only serves the cores. */
+	const uint32_t source = portapack::memory::map::spifi_uncached.base() + image_offset;
+	if( !copy(source, to.base(), resident_size) ) {
+		return false;
+	}
+
+	CRC32 crc;
+	crc.process_bytes(reinterpret_cast<const void*>(to.base()), resident_size);
+	if( crc.checksum() != entry->crc ) {
+		return false;
+	}
+
+	shared_memory.baseband_image_base = portapack::memory::map::spifi_cached.base() + image_offset;
+
+	/* Reset M4 core */
+	LPC_RGU->RESET_CTRL[0] = (1 << 13);
+
+	return true;
+}
+
+} /* namespace module_store */
@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2016 Jared Boone, ShareBrained Technology, Inc.
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __MODULE_STORE_H__
+#define __MODULE_STORE_H__
+
+#include <cstdint>
+#include <cstddef>
+
+#include "memory_map.hpp"
+#include "module_info.hpp"
+
+/* Baseband modules programmed into the unused end of SPI flash
+ * (spi_flash::modules) by tools/make_spi_image.py, so switching between
+ * them needs neither the SD card nor a directory scan. Modules not found
+ * here are still loaded from the SD card.
+ *
+ * Layout: TableHeader, then TableHeader::count Entry records, then the
+ * module images at 4KiB-aligned offsets. Images are what the SD card
+ * module files carry after their header: 32KiB of resident code ending
+ * in the module MD5, followed by the processor overlays, if any.
+ */
+namespace module_store {
+
+struct TableHeader {
+	uint32_t magic;
+	uint16_t version;
+	uint16_t count;
+};
+
+struct Entry {
+	char hash[16];
+	char name[16];
+	uint32_t offset;	/* From the start of the module region */
+	uint32_t size;		/* Resident code and overlays */
+	uint32_t entry;		/* Reset vector, in M4 address space */
+	ModuleInfo info;
+	uint32_t crc;		/* CRC-32 of the 32KiB resident image */
+};
+
+static_assert(sizeof(TableHeader) == 8, "module_store::TableHeader size wrong");
+static_assert(sizeof(Entry) == 64, "module_store::Entry size wrong");
+
+constexpr uint32_t table_magic = 0x544d5050;	/* "PPMT" */
+constexpr uint16_t table_version = 2;
+constexpr size_t entries_max = 32;
+
+/* Returns nullptr if no valid module with this 16-byte hash is stored,
+ * or if it wasn't built for this application (see ModuleInfo).
+ */
+const Entry* find(const void* const hash);
+
+/* Copies the module's resident code into M4 code RAM by DMA, points the
+ * M4 at the image for overlays and resets the M4. Returns false without
+ * resetting the M4 if the module isn't stored, or the copy fails or
+ * doesn't match the stored CRC.
+ */
+bool load(const void* const hash, const portapack::memory::region_t to);
+
+} /* namespace module_store */
+
+#endif/*__MODULE_STORE_H__*/
@@ -0,0 +1,198 @@
+/*
+ * Copyright (C) 2016 Jared Boone, ShareBrained Technology, Inc.
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "packet_log.hpp"
+
+#include <algorithm>
+
+namespace packet_log {
+
+namespace {
+
+bool is_before(const uint32_t date_a, const uint32_t time_a, const Timestamp& b) {
+	return (date_a < b.tv_date) || ((date_a == b.tv_date) && (time_a < b.tv_time));
+}
+
+} /* namespace */
+
+baseband::Packet Record::packet() const {
+	baseband::Packet result;
+	result.set_timestamp(timestamp());
+	for(size_t i=0; i<bit_length; i++) {
+		result.add((bits[i >> 3] >> (7 - (i & 7))) & 1);
+	}
+	return result;
+}
+
+/* Writer ****************************************************************/
+
+Writer::Writer(
+	const std::string& file_path
+) : log_file { file_path, LogFile::Durability::Commit }
+{
+	Header header { };
+	header.magic = magic;
+	header.version = version;
+	header.slot_size = slot_size;
+	header.slots_per_group = slots_per_group;
+	log_file.write(&header, sizeof(header));
+}
+
+bool Writer::is_open() const {
+	return log_file.is_open();
+}
+
+bool Writer::write(
+	const Protocol protocol,
+	const uint32_t subtype,
+	const bool valid,
+	const baseband::Packet& packet,
+	const uint32_t frequency
+) {
+	const auto timestamp = packet.timestamp();
+
+	Record record { };
+	record.date = timestamp.tv_date;
+	record.time = timestamp.tv_time;
+	record.frequency = frequency;
+	record.bit_length = std::min(packet.size(), record.bits.size() * 8);
+	record.type = (static_cast<uint8_t>(protocol) << 4) | (subtype & 0x0f);
+	record.status = valid ? Status::Valid : 0;
+	for(size_t i=0; i<record.bit_length; i++) {
+		record.bits[i >> 3] |= packet[i] << (7 - (i & 7));
+	}
+
+	const auto slots = Record::slots_for(record.bit_length);
+	const auto group_slot = slot % slots_per_group;
+	if( (group_slot + slots) > slots_per_group ) {
+		if( !write_padding(slots_per_group - group_slot) ) {
+			return false;
+		}
+	}
+	if( (slot % slots_per_group) == 0 ) {
+		if( !write_index() ) {
+			return false;
+		}
+	}
+
+	if( !log_file.write(&record, slots * slot_size) ) {
+		return false;
+	}
+	slot += slots;
+
+	last_date = record.date;
+	last_time = record.time;
+	return true;
+}
+
+bool Writer::write_padding(const size_t slots) {
+	// Never more than a record's worth, records don't fit otherwise.
+	const std::array<uint8_t, sizeof(Record)> padding { };
+	if( !log_file.write(padding.data(), slots * slot_size) ) {
+		return false;
+	}
+	slot += slots;
+	return true;
+}
+
+bool Writer::write_index() {
+	Index index { };
+	index.last_date = last_date;
+	index.last_time = last_time;
+	index.type = static_cast<uint8_t>(Protocol::Index);
+	if( !log_file.write(&index, sizeof(index)) ) {
+		return false;
+	}
+	slot++;
+	return true;
+}
+
+/* Reader ****************************************************************/
+
+Reader::Reader(
+	const std::string& file_path
+) : file { file_path, File::openmode::in | File::openmode::binary }
+{
+	Header header;
+	valid = file.is_open()
+		&& read_slots(0, 1, &header)
+		&& (header.magic == magic)
+		&& (header.version == version)
+		&& (header.slot_size == slot_size)
+		&& (header.slots_per_group == slots_per_group);
+}
+
+bool Reader::is_open() const {
+	return valid;
+}
+
+void Reader::seek(const Timestamp& from) {
+	if( !valid ) {
+		return;
+	}
+
+	// Binary search the index records for the last group whose preceding
+	// records are all before the requested time. Group 0 trivially is.
+	const size_t group_count = (file.size() / slot_size + slots_per_group - 1) / slots_per_group;
+	size_t low = 0;
+	size_t high = group_count;
+	while( (high - low) > 1 ) {
+		const size_t middle = (low + high) / 2;
+		Index group_index;
+		if( read_slots(middle * slots_per_group, 1, &group_index)
+		 && (group_index.type == static_cast<uint8_t>(Protocol::Index))
+		 && is_before(group_index.last_date, group_index.last_time, from) ) {
+			low = middle;
+		} else {
+			high = middle;
+		}
+	}
+	slot = std::max<size_t>(low * slots_per_group, 1);
+}
+
+bool Reader::read(Record& record) {
+	if( !valid ) {
+		return false;
+	}
+
+	while( read_slots(slot, 1, &record) ) {
+		if( record.protocol() == Protocol::Index ) {
+			slot++;
+			continue;
+		}
+
+		const auto slots = Record::slots_for(record.bit_length);
+		if( (slots > Record::slots_for(record.bits.size() * 8))
+		 || !read_slots(slot + 1, slots - 1, record.bits.data()) ) {
+			return false;
+		}
+		slot += slots;
+		return true;
+	}
+	return false;
+}
+
+bool Reader::read_slots(const size_t n, const size_t count, void* const data) {
+	file.seek(n * slot_size);
+	return file.read(data, count * slot_size);
+}
+
+} /* namespace packet_log */
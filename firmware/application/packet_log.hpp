@@ -0,0 +1,170 @@
+/*
+ * Copyright (C) 2016 Jared Boone, ShareBrained Technology, Inc.
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __PACKET_LOG_H__
+#define __PACKET_LOG_H__
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <array>
+
+#include "baseband_packet.hpp"
+#include "log_file.hpp"
+#include "file.hpp"
+
+/* Binary packet log, little-endian, in 16-byte slots:
+ *
+ * Slot 0 is the file header. A record takes one slot for its fixed fields,
+ * then as many slots as its bits need, so short packets stay short. The
+ * file is divided into groups of slots_per_group slots; records don't
+ * straddle groups (the writer pads with empty slots), and the first slot of
+ * every later group is an index record holding the time of the last record
+ * before it, so a reader can binary search a log one slot per group.
+ * Empty and index slots both read as Protocol::Index.
+ *
+ * tools/packet_log.py converts logs to text or CSV on the host.
+ */
+namespace packet_log {
+
+constexpr uint32_t magic = 0x4c505050;		// "PPPL"
+constexpr uint16_t version = 2;
+constexpr size_t slot_size = 16;
+constexpr size_t slots_per_group = 256;
+
+enum class Protocol : uint8_t {
+	Index = 0,
+	AIS = 1,
+	TPMS = 2,
+	ERT = 3,
+};
+
+enum Status : uint8_t {
+	Valid = 0x01,		// Decoded and passed CRC/checksum
+};
+
+/* Only the first slots_for(bit_length) slots of a record are stored. */
+struct Record {
+	uint32_t date;				// lpc43xx::rtc::RTC tv_date
+	uint32_t time;				// lpc43xx::rtc::RTC tv_time
+	uint32_t frequency;			// Target frequency, Hz, 0 if not known
+	uint16_t bit_length;
+	uint8_t type;				// [7:4] Protocol, [3:0] protocol-specific packet type
+	uint8_t status;
+	std::array<uint8_t, 176> bits;	// MSB first, in order received
+
+	Protocol protocol() const {
+		return static_cast<Protocol>(type >> 4);
+	}
+
+	uint32_t subtype() const {
+		return type & 0x0f;
+	}
+
+	Timestamp timestamp() const {
+		Timestamp result;
+		result.tv_date = date;
+		result.tv_time = time;
+		return result;
+	}
+
+	baseband::Packet packet() const;
+
+	static constexpr size_t slots_for(const size_t bit_length) {
+		return 1 + (bit_length + slot_size * 8 - 1) / (slot_size * 8);
+	}
+};
+
+struct Index {
+	uint32_t last_date;			// Last record before this group, 0 if none
+	uint32_t last_time;
+	uint32_t reserved_0;
+	uint16_t reserved_1;
+	uint8_t type;				// Protocol::Index, shares its offset with Record::type
+	uint8_t reserved_2;
+};
+
+struct Header {
+	uint32_t magic;
+	uint16_t version;
+	uint16_t slot_size;
+	uint16_t slots_per_group;
+	std::array<uint8_t, 6> reserved;
+};
+
+static_assert(sizeof(Record) == 192, "packet_log::Record size changed, bump version");
+static_assert(offsetof(Record, bits) == slot_size, "packet_log::Record fields must fill a slot");
+static_assert((sizeof(Record::bits) % slot_size) == 0, "packet_log::Record bits must fill whole slots");
+static_assert(sizeof(Index) == slot_size, "packet_log::Index must fill a slot");
+static_assert(sizeof(Header) == slot_size, "packet_log::Header must fill a slot");
+static_assert(offsetof(Index, type) == offsetof(Record, type), "packet_log::Index type field misplaced");
+
+class Writer {
+public:
+	Writer(const std::string& file_path);
+
+	bool is_open() const;
+
+	bool write(
+		const Protocol protocol,
+		const uint32_t subtype,
+		const bool valid,
+		const baseband::Packet& packet,
+		const uint32_t frequency = 0
+	);
+
+private:
+	LogFile log_file;
+	size_t slot { 1 };
+	uint32_t last_date { 0 };
+	uint32_t last_time { 0 };
+
+	bool write_padding(const size_t slots);
+	bool write_index();
+};
+
+class Reader {
+public:
+	Reader(const std::string& file_path);
+
+	bool is_open() const;
+
+	/* Positions the reader at the first group that may contain records
+	 * at or after the given time.
+	 */
+	void seek(const Timestamp& from);
+
+	/* Reads the next packet record, skipping index and empty slots.
+	 * Returns false at end of file.
+	 */
+	bool read(Record& record);
+
+private:
+	File file;
+	bool valid { false };
+	size_t slot { 1 };
+
+	bool read_slots(const size_t n, const size_t count, void* const data);
+};
+
+} /* namespace packet_log */
+
+#endif/*__PACKET_LOG_H__*/
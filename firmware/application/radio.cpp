@@ -94,7 +94,106 @@ static baseband::CPLD baseband_cpld;
 
 static rf::Direction direction { rf::Direction::Receive };
 
+/* First LO the RFFC507x is running at, 0 while it's disabled. */
+static rf::Frequency first_lo_frequency { 0 };
+
+/* SweepThread retunes while the UI thread changes gains, and both share
+ * SSP1 and the register maps. A thread already holding the mutex (inside
+ * a Transaction, or a function calling another) doesn't take it again.
+ */
+static Mutex mutex;
+
+class Lock {
+public:
+	Lock(
+	) : owner { mutex.m_owner != chThdSelf() }
+	{
+		if( owner ) {
+			chMtxLock(&mutex);
+		}
+	}
+
+	~Lock() {
+		if( owner ) {
+			chMtxUnlock();
+		}
+	}
+
+private:
+	const bool owner;
+};
+
+/* Changes deferred by an open Transaction. Last one of each kind wins. */
+static struct {
+	bool active { false };
+	bool tuning { false };
+	TuningPlan tuning_plan { };
+	bool baseband_rate { false };
+	uint32_t baseband_rate_value { 0 };
+	bool codec_mode { false };
+	max5864::Mode codec_mode_value { max5864::Mode::Shutdown };
+} pending;
+
+static void apply_tuning(const TuningPlan& plan);
+static void apply_baseband_rate(const uint32_t rate);
+
+Transaction::Transaction(
+) : outermost { mutex.m_owner != chThdSelf() }
+{
+	if( outermost ) {
+		chMtxLock(&mutex);
+		pending.active = true;
+		second_if.hold();
+	}
+}
+
+/* Everything goes out in dependency order: sampling clock, first LO,
+ * then all MAX2837 registers in one burst before the MAX5864, so SSP1 is
+ * reconfigured between the two chips at most once.
+ */
+Transaction::~Transaction() {
+	if( outermost ) {
+		if( pending.baseband_rate ) {
+			apply_baseband_rate(pending.baseband_rate_value);
+		}
+		if( pending.tuning ) {
+			apply_tuning(pending.tuning_plan);
+		}
+
+		second_if.commit();
+
+		if( pending.codec_mode ) {
+			baseband_codec.set_mode(pending.codec_mode_value);
+		}
+
+		pending.active = false;
+		pending.tuning = false;
+		pending.baseband_rate = false;
+		pending.codec_mode = false;
+		chMtxUnlock();
+	}
+}
+
+TuningPlan plan_tuning(const rf::Frequency frequency) {
+	TuningPlan plan;
+
+	const auto tuning_config = tuning::config::create(frequency);
+	if( tuning_config.is_valid() ) {
+		plan.frequency = frequency;
+		plan.first_lo_frequency = tuning_config.first_lo_frequency;
+		if( tuning_config.first_lo_frequency ) {
+			plan.first_lo = rffc507x::SynthConfig::calculate(tuning_config.first_lo_frequency);
+		}
+		plan.second_lo = max2837::SynthConfig::calculate(tuning_config.second_lo_frequency);
+		plan.rf_path_band = tuning_config.rf_path_band;
+		plan.baseband_q_invert = tuning_config.baseband_q_invert;
+	}
+
+	return plan;
+}
+
 void init() {
+	chMtxInit(&mutex);
 	rf_path.init();
 	first_if.init();
 	second_if.init();
@@ -103,6 +202,8 @@ void init() {
 }
 
 void set_direction(const rf::Direction new_direction) {
+	Lock lock;
+
 	/* TODO: Refactor all the various "Direction" enumerations into one. */
 	/* TODO: Only make changes if direction changes, but beware of clock enabling. */
 	direction = new_direction;
@@ -110,47 +211,89 @@ void set_direction(const rf::Direction new_direction) {
 	second_if.set_mode((direction == rf::Direction::Transmit) ? max2837::Mode::Transmit : max2837::Mode::Receive);
 	rf_path.set_direction(direction);
 
-	baseband_codec.set_mode((direction == rf::Direction::Transmit) ? max5864::Mode::Transmit : max5864::Mode::Receive);
+	const auto codec_mode = (direction == rf::Direction::Transmit) ? max5864::Mode::Transmit : max5864::Mode::Receive;
+	if( pending.active ) {
+		pending.codec_mode = true;
+		pending.codec_mode_value = codec_mode;
+	} else {
+		baseband_codec.set_mode(codec_mode);
+	}
 }
 
 bool set_tuning_frequency(const rf::Frequency frequency) {
-	const auto tuning_config = tuning::config::create(frequency);
-	if( tuning_config.is_valid() ) {
+	return set_tuning(plan_tuning(frequency));
+}
+
+bool set_tuning(const TuningPlan& plan) {
+	Lock lock;
+
+	if( !plan.is_valid() ) {
+		return false;
+	}
+
+	if( pending.active ) {
+		pending.tuning = true;
+		pending.tuning_plan = plan;
+	} else {
+		apply_tuning(plan);
+	}
+
+	return true;
+}
+
+static void apply_tuning(const TuningPlan& plan) {
+	/* The first LO is left alone across hops that share it, which includes
+	 * staying in the mid band where it is off.
+	 */
+	if( plan.first_lo_frequency != first_lo_frequency ) {
 		first_if.disable();
 
-		if( tuning_config.first_lo_frequency ) {
-			first_if.set_frequency(tuning_config.first_lo_frequency);
+		if( plan.first_lo_frequency ) {
+			first_if.set_frequency(plan.first_lo);
 			first_if.enable();
 		}
 
-		const auto result_second_if = second_if.set_frequency(tuning_config.second_lo_frequency);
+		first_lo_frequency = plan.first_lo_frequency;
+	}
 
-		rf_path.set_band(tuning_config.rf_path_band);
-		baseband_cpld.set_q_invert(tuning_config.baseband_q_invert);
+	second_if.set_frequency(plan.second_lo);
 
-		return result_second_if;
-	} else {
-		return false;
-	}
+	rf_path.set_band(plan.rf_path_band);
+	baseband_cpld.set_q_invert(plan.baseband_q_invert);
 }
 
 void set_rf_amp(const bool rf_amp) {
+	Lock lock;
 	rf_path.set_rf_amp(rf_amp);
 }
 
 void set_lna_gain(const int_fast8_t db) {
+	Lock lock;
 	second_if.set_lna_gain(db);
 }
 
 void set_vga_gain(const int_fast8_t db) {
+	Lock lock;
 	second_if.set_vga_gain(db);
 }
 
 void set_baseband_filter_bandwidth(const uint32_t bandwidth_minimum) {
+	Lock lock;
 	second_if.set_lpf_rf_bandwidth(bandwidth_minimum);
 }
 
 void set_baseband_rate(const uint32_t rate) {
+	Lock lock;
+
+	if( pending.active ) {
+		pending.baseband_rate = true;
+		pending.baseband_rate_value = rate;
+	} else {
+		apply_baseband_rate(rate);
+	}
+}
+
+static void apply_baseband_rate(const uint32_t rate) {
 	portapack::clock_manager.set_sampling_frequency(rate);
 }
 
@@ -159,15 +302,19 @@ void set_baseband_decimation_by(const size_t n) {
 }
 
 void set_antenna_bias(const bool on) {
+	Lock lock;
 	/* Pull MOSFET gate low to turn on antenna bias. */
 	first_if.set_gpo1(on ? 0 : 1);
 }
 
 void disable() {
+	Lock lock;
+
 	set_antenna_bias(false);
 	baseband_codec.set_mode(max5864::Mode::Shutdown);
 	second_if.set_mode(max2837::Mode::Standby);
 	first_if.disable();
+	first_lo_frequency = 0;
 	set_rf_amp(false);
 }
 
@@ -176,6 +323,8 @@ void enable(Configuration configuration) {
 }
 
 void configure(Configuration configuration) {
+	Transaction transaction;
+
 	set_tuning_frequency(configuration.tuning_frequency);
 	set_rf_amp(configuration.rf_amp);
 	set_lna_gain(configuration.lna_gain);
@@ -23,6 +23,8 @@
 #define __RADIO_H__
 
 #include "rf_path.hpp"
+#include "rffc507x.hpp"
+#include "max2837.hpp"
 
 #include <cstdint>
 #include <cstddef>
@@ -40,10 +42,46 @@ struct Configuration {
 	uint8_t baseband_decimation;
 };
 
+/* Everything a retune writes to the hardware, worked out ahead of time.
+ * Build plans once for a list of frequencies, then hop with set_tuning(),
+ * which only writes what differs from the current tuning.
+ */
+struct TuningPlan {
+	rf::Frequency frequency { 0 };
+	rf::Frequency first_lo_frequency { 0 };
+	rffc507x::SynthConfig first_lo { };
+	max2837::SynthConfig second_lo { };
+	rf::path::Band rf_path_band { rf::path::Band::Mid };
+	bool baseband_q_invert { false };
+
+	bool is_valid() const {
+		return second_lo.is_valid();
+	}
+};
+
+TuningPlan plan_tuning(const rf::Frequency frequency);
+
+/* While a Transaction is alive, the setters below only collect changes.
+ * The outermost one writes them to the chips in one ordered pass when it
+ * goes out of scope, and keeps other threads off the radio meanwhile.
+ */
+class Transaction {
+public:
+	Transaction();
+	~Transaction();
+
+	Transaction(const Transaction&) = delete;
+	Transaction& operator=(const Transaction&) = delete;
+
+private:
+	const bool outermost;
+};
+
 void init();
 
 void set_direction(const rf::Direction new_direction);
 bool set_tuning_frequency(const rf::Frequency frequency);
+bool set_tuning(const TuningPlan& plan);
 void set_rf_amp(const bool rf_amp);
 void set_lna_gain(const int_fast8_t db);
 void set_vga_gain(const int_fast8_t db);
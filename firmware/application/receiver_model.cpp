@@ -33,6 +33,8 @@ using namespace portapack;
 #include "dsp_iir.hpp"
 #include "dsp_iir_config.hpp"
 
+#include <algorithm>
+
 namespace {
 
 static constexpr std::array<baseband::AMConfig, 3> am_configs { {
@@ -47,6 +49,11 @@ static constexpr std::array<baseband::NBFMConfig, 3> nbfm_configs { {
 	{ taps_16k0_decim_0, taps_16k0_decim_1, taps_16k0_channel, 5000 },
 } };
 
+/* Channel bandwidth each of nbfm_configs suits. */
+static constexpr std::array<uint32_t, 3> nbfm_bandwidths { {
+	8500, 11000, 16000,
+} };
+
 static constexpr std::array<baseband::WFMConfig, 1> wfm_configs { {
 	{ },
 } };
@@ -62,6 +69,66 @@ void ReceiverModel::set_tuning_frequency(rf::Frequency f) {
 	update_tuning_frequency();
 }
 
+radio::TuningPlan ReceiverModel::plan_tuning(rf::Frequency f) {
+	return radio::plan_tuning(f + tuning_offset());
+}
+
+void ReceiverModel::set_tuning(const radio::TuningPlan& plan) {
+	if( plan.is_valid() ) {
+		persistent_memory::set_tuned_frequency(plan.frequency - tuning_offset());
+		radio::set_tuning(plan);
+	}
+}
+
+void ReceiverModel::set_channel(const channel_plan::Channel& channel) {
+	{
+		radio::Transaction transaction;
+		if( channel.rf_amp >= 0 ) {
+			set_rf_amp(channel.rf_amp);
+		}
+		if( channel.lna_db >= 0 ) {
+			set_lna(channel.lna_db);
+		}
+		if( channel.vga_db >= 0 ) {
+			set_vga(channel.vga_db);
+		}
+		set_tuning_frequency(channel.frequency());
+	}
+
+	if( modulation() != static_cast<uint32_t>(receiver_mode(channel.mode)) ) {
+		return;
+	}
+
+	switch(channel.mode) {
+	case channel_plan::Mode::AM:	set_am_configuration(0); break;
+	case channel_plan::Mode::USB:	set_am_configuration(1); break;
+	case channel_plan::Mode::LSB:	set_am_configuration(2); break;
+
+	case channel_plan::Mode::NFM:
+		if( channel.bandwidth() ) {
+			const auto it = std::lower_bound(nbfm_bandwidths.begin(), nbfm_bandwidths.end(), channel.bandwidth());
+			nbfm_config_index = std::min<size_t>(it - nbfm_bandwidths.begin(), nbfm_bandwidths.size() - 1);
+		}
+		ctcss_tone_ = channel.ctcss_tone();
+		update_nbfm_configuration();
+		break;
+
+	default:
+		break;
+	}
+}
+
+ReceiverModel::Mode ReceiverModel::receiver_mode(const channel_plan::Mode mode) {
+	switch(mode) {
+	case channel_plan::Mode::AM:
+	case channel_plan::Mode::USB:
+	case channel_plan::Mode::LSB:	return Mode::AMAudio;
+	case channel_plan::Mode::WFM:	return Mode::WidebandFMAudio;
+	default:
+	case channel_plan::Mode::NFM:	return Mode::NarrowbandFMAudio;
+	}
+}
+
 rf::Frequency ReceiverModel::frequency_step() const {
 	return frequency_step_;
 }
@@ -139,13 +206,16 @@ uint32_t ReceiverModel::baseband_oversampling() const {
 
 void ReceiverModel::enable() {
 	enabled_ = true;
-	radio::set_direction(rf::Direction::Receive);
-	update_tuning_frequency();
-	update_antenna_bias();
-	update_rf_amp();
-	update_lna();
-	update_vga();
-	update_baseband_bandwidth();
+	{
+		radio::Transaction transaction;
+		radio::set_direction(rf::Direction::Receive);
+		update_tuning_frequency();
+		update_antenna_bias();
+		update_rf_amp();
+		update_lna();
+		update_vga();
+		update_baseband_bandwidth();
+	}
 	update_baseband_configuration();
 	update_modulation_configuration();
 	update_headphone_volume();
@@ -227,9 +297,12 @@ void ReceiverModel::update_baseband_configuration() {
 	// Disabling baseband while changing sampling rates seems like a good idea...
 	baseband::stop();
 
-	radio::set_baseband_rate(sampling_rate() * baseband_oversampling());
-	update_tuning_frequency();
-	radio::set_baseband_decimation_by(baseband_oversampling());
+	{
+		radio::Transaction transaction;
+		radio::set_baseband_rate(sampling_rate() * baseband_oversampling());
+		update_tuning_frequency();
+		radio::set_baseband_decimation_by(baseband_oversampling());
+	}
 
 	baseband::start(baseband_configuration);
 }
@@ -273,8 +346,17 @@ size_t ReceiverModel::nbfm_configuration() const {
 	return nbfm_config_index;
 }
 
+uint32_t ReceiverModel::ctcss_tone() const {
+	return ctcss_tone_;
+}
+
+void ReceiverModel::set_ctcss_tone(const uint32_t tone) {
+	ctcss_tone_ = tone;
+	update_modulation_configuration();
+}
+
 void ReceiverModel::update_nbfm_configuration() {
-	nbfm_configs[nbfm_config_index].apply();
+	nbfm_configs[nbfm_config_index].apply(ctcss_tone_);
 }
 
 size_t ReceiverModel::wfm_configuration() const {
@@ -28,6 +28,8 @@
 #include "message.hpp"
 #include "rf_path.hpp"
 #include "max2837.hpp"
+#include "radio.hpp"
+#include "channel_plan.hpp"
 #include "volume.hpp"
 
 class ReceiverModel {
@@ -44,6 +46,20 @@ public:
 	rf::Frequency tuning_frequency() const;
 	void set_tuning_frequency(rf::Frequency f);
 
+	/* Plans include the tuning offset of the current mode, so they must be
+	 * rebuilt when the mode changes.
+	 */
+	radio::TuningPlan plan_tuning(rf::Frequency f);
+	void set_tuning(const radio::TuningPlan& plan);
+
+	/* Tunes to a planned channel and applies the settings it carries. The
+	 * baseband mode is left alone, as the app owns the sampling rate and
+	 * audio path: switch to receiver_mode() first for the channel's
+	 * demodulator settings to be applied.
+	 */
+	void set_channel(const channel_plan::Channel& channel);
+	static Mode receiver_mode(const channel_plan::Mode mode);
+
 	rf::Frequency frequency_step() const;
 	void set_frequency_step(rf::Frequency f);
 
@@ -82,6 +98,10 @@ public:
 	size_t nbfm_configuration() const;
 	void set_nbfm_configuration(const size_t n);
 
+	/* NFM tone squelch, in tenths of a hertz, zero for none. */
+	uint32_t ctcss_tone() const;
+	void set_ctcss_tone(const uint32_t tone);
+
 	size_t wfm_configuration() const;
 	void set_wfm_configuration(const size_t n);
 
@@ -100,6 +120,7 @@ private:
 	};
 	size_t am_config_index = 0;
 	size_t nbfm_config_index = 0;
+	uint32_t ctcss_tone_ = 0;
 	size_t wfm_config_index = 0;
 	volume_t headphone_volume_ { -43.0_dB };
 
@@ -104,35 +104,29 @@ constexpr size_t divider_log2(const rf::Frequency vco_frequency) {
 
 } /* namespace prescaler */
 
-struct SynthConfig {
-	const size_t lo_divider_log2;
-	const size_t prescaler_divider_log2;
-	const uint64_t n_divider_q24;
-
-	static SynthConfig calculate(
-		const rf::Frequency lo_frequency
-	) {
-		/* RFFC507x frequency synthesizer is is accurate to about 2ppb (two parts
-		 * per BILLION). There's not much point to worrying about rounding and
-		 * tuning error, when it amounts to 8Hz at 5GHz!
-		 */
-		const size_t lo_divider_log2 = lo::divider_log2(lo_frequency);
-		const size_t lo_divider = 1U << lo_divider_log2;
-
-		const rf::Frequency vco_frequency = lo_frequency * lo_divider;
-
-		const size_t prescaler_divider_log2 = prescaler::divider_log2(vco_frequency);
-
-		const uint64_t prescaled_lo_q24 = vco_frequency << (24 - prescaler_divider_log2);
-		const uint64_t n_divider_q24 = prescaled_lo_q24 / reference_frequency;
-
-		return {
-			lo_divider_log2,
-			prescaler_divider_log2,
-			n_divider_q24,
-		};
-	}
-};
+SynthConfig SynthConfig::calculate(
+	const rf::Frequency lo_frequency
+) {
+	/* RFFC507x frequency synthesizer is is accurate to about 2ppb (two parts
+	 * per BILLION). There's not much point to worrying about rounding and
+	 * tuning error, when it amounts to 8Hz at 5GHz!
+	 */
+	const size_t lo_divider_log2 = lo::divider_log2(lo_frequency);
+	const size_t lo_divider = 1U << lo_divider_log2;
+
+	const rf::Frequency vco_frequency = lo_frequency * lo_divider;
+
+	const size_t prescaler_divider_log2 = prescaler::divider_log2(vco_frequency);
+
+	const uint64_t prescaled_lo_q24 = vco_frequency << (24 - prescaler_divider_log2);
+	const uint64_t n_divider_q24 = prescaled_lo_q24 / reference_frequency;
+
+	return {
+		lo_divider_log2,
+		prescaler_divider_log2,
+		n_divider_q24,
+	};
+}
 
 /* Readback values, RFFC5072 rev A:
  * 0000: 0x8a01 => dev_id=1000101000000 mrev_id=001
@@ -233,7 +227,17 @@ void RFFC507x::set_mixer_current(const uint8_t value) {
 }
 
 void RFFC507x::set_frequency(const rf::Frequency lo_frequency) {
-	const SynthConfig synth_config = SynthConfig::calculate(lo_frequency);
+	set_frequency(SynthConfig::calculate(lo_frequency));
+}
+
+/* Only registers whose contents change are written. The bit-banged bus is
+ * slow, and a hop within one LO divider range usually only moves N.
+ */
+void RFFC507x::set_frequency(const SynthConfig& synth_config) {
+	const auto lf_prior = _map.w[toUType(Register::LF)];
+	const auto p2_freq1_prior = _map.w[toUType(Register::P2_FREQ1)];
+	const auto p2_freq2_prior = _map.w[toUType(Register::P2_FREQ2)];
+	const auto p2_freq3_prior = _map.w[toUType(Register::P2_FREQ3)];
 
 	/* Boost charge pump leakage if VCO frequency > 3.2GHz, indicated by
 	 * prescaler divider set to 4 (log2=2) instead of 2 (log2=1).
@@ -243,16 +247,24 @@ void RFFC507x::set_frequency(const rf::Frequency lo_frequency) {
 	} else {
 		_map.r.lf.pllcpl = 2;
 	}
-	flush_one(Register::LF);
+	if( _map.w[toUType(Register::LF)] != lf_prior ) {
+		flush_one(Register::LF);
+	}
 
 	_map.r.p2_freq1.p2n = synth_config.n_divider_q24 >> 24;
 	_map.r.p2_freq1.p2lodiv = synth_config.lo_divider_log2;
 	_map.r.p2_freq1.p2presc = synth_config.prescaler_divider_log2;
 	_map.r.p2_freq2.p2nmsb = (synth_config.n_divider_q24 >> 8) & 0xffff;
 	_map.r.p2_freq3.p2nlsb = synth_config.n_divider_q24 & 0xff;
-	_dirty[Register::P2_FREQ1] = 1;
-	_dirty[Register::P2_FREQ2] = 1;
-	_dirty[Register::P2_FREQ3] = 1;
+	if( _map.w[toUType(Register::P2_FREQ1)] != p2_freq1_prior ) {
+		_dirty[Register::P2_FREQ1] = 1;
+	}
+	if( _map.w[toUType(Register::P2_FREQ2)] != p2_freq2_prior ) {
+		_dirty[Register::P2_FREQ2] = 1;
+	}
+	if( _map.w[toUType(Register::P2_FREQ3)] != p2_freq3_prior ) {
+		_dirty[Register::P2_FREQ3] = 1;
+	}
 	flush();
 }
 
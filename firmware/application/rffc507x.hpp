@@ -796,6 +796,17 @@ constexpr RegisterMap default_hackrf_one { Register_Type {
 	},
 } };
 
+/* Synthesizer settings for one LO frequency, so they can be worked out
+ * ahead of time and applied without any arithmetic.
+ */
+struct SynthConfig {
+	size_t lo_divider_log2;
+	size_t prescaler_divider_log2;
+	uint64_t n_divider_q24;
+
+	static SynthConfig calculate(const rf::Frequency lo_frequency);
+};
+
 class RFFC507x {
 public:
 	void init();
@@ -808,6 +819,7 @@ public:
 
 	void set_mixer_current(const uint8_t value);
 	void set_frequency(const rf::Frequency lo_frequency);
+	void set_frequency(const SynthConfig& synth_config);
 	void set_gpo1(const bool new_value);
 	
 	reg_t read(const address_t reg_num);
@@ -0,0 +1,190 @@
+/*
+ * Copyright (C) 2016 Jared Boone, ShareBrained Technology, Inc.
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "scan_thread.hpp"
+
+#include "portapack_shared_memory.hpp"
+
+#include <utility>
+#include <algorithm>
+
+// ScanThread /////////////////////////////////////////////////////////////
+
+/* How long to wait for a decision before taking the channel as idle. */
+constexpr systime_t report_timeout = MS2ST(100);
+
+constexpr systime_t scan_rate_interval = S2ST(1);
+
+Thread* ScanThread::thread = nullptr;
+
+ScanThread::ScanThread(
+	std::vector<radio::TuningPlan> plans,
+	const int32_t gain_db,
+	const systime_t hang_time,
+	const int32_t carrier_margin_db,
+	const size_t settle_blocks,
+	const size_t detect_blocks
+) : config { settle_blocks, std::max<size_t>(detect_blocks, 1) },
+	plans { std::move(plans) },
+	hang_time { hang_time },
+	carrier_margin_db { carrier_margin_db },
+	activity_(this->plans.size(), 0),
+	floor_db(this->plans.size(), floor_unknown),
+	gain_db_ { gain_db }
+{
+	shared_memory.baseband_queue.push_and_wait(
+		ScanConfigMessage { &config }
+	);
+
+	// Retunes must not wait behind the UI thread
+	thread = chThdCreateFromHeap(NULL, 512, NORMALPRIO + 10, ScanThread::static_fn, this);
+}
+
+ScanThread::~ScanThread() {
+	if( thread ) {
+		chThdTerminate(thread);
+		chEvtSignal(thread, EVT_MASK_SCAN_THREAD);
+		chThdWait(thread);
+		thread = nullptr;
+	}
+
+	shared_memory.baseband_queue.push_and_wait(
+		ScanConfigMessage { nullptr }
+	);
+}
+
+void ScanThread::request_done() {
+	request_ = Request::None;
+	if( thread ) {
+		chEvtSignal(thread, EVT_MASK_SCAN_THREAD);
+	}
+}
+
+void ScanThread::check_report_isr() {
+	if( thread ) {
+		chEvtSignalI(thread, EVT_MASK_SCAN_THREAD);
+	}
+}
+
+msg_t ScanThread::run() {
+	if( plans.empty() ) {
+		return false;
+	}
+
+	size_t index = 0;
+	uint32_t sequence = config.tuned_sequence;
+	uint32_t report_count = config.report_count;
+	bool dwelling = false;
+	systime_t last_active = 0;
+	uint32_t hops = 0;
+	systime_t rate_start = chTimeNow();
+
+	while( !chThdShouldTerminate() ) {
+		if( !dwelling ) {
+			radio::set_tuning(plans[index]);
+			channel_ = index;
+			config.tuned_sequence = ++sequence;
+			hops++;
+		}
+
+		const bool active = wait_for_report(sequence, report_count) && is_active(index, dwelling);
+		const bool skip = skip_requested;
+		skip_requested = false;
+
+		const auto now = chTimeNow();
+		if( active && !skip ) {
+			if( !dwelling ) {
+				activity_[index]++;
+				dwelling = true;
+				dwelling_ = true;
+				wait_for_request(Request::Dwell);
+				// Reports from before the channel's own settings don't count.
+				config.tuned_sequence = ++sequence;
+			}
+			last_active = now;
+		} else if( dwelling && !skip && ((now - last_active) < hang_time) ) {
+			// Quiet, but give the other side a chance to answer.
+		} else {
+			if( dwelling ) {
+				dwelling = false;
+				wait_for_request(Request::Resume);
+			}
+			index = (index + 1) % plans.size();
+		}
+		dwelling_ = dwelling;
+
+		if( (now - rate_start) >= scan_rate_interval ) {
+			scan_rate_ = hops * scan_rate_interval / (now - rate_start);
+			hops = 0;
+			rate_start = now;
+		}
+	}
+
+	return true;
+}
+
+/* Decisions on earlier tunings are stale and skipped. Returns false if
+ * none came for this one in time.
+ */
+bool ScanThread::wait_for_report(const uint32_t sequence, uint32_t& report_count) {
+	while( !chThdShouldTerminate() ) {
+		if( config.report_count != report_count ) {
+			report_count = config.report_count;
+			if( config.report_sequence == sequence ) {
+				return true;
+			}
+		} else if( chEvtWaitAnyTimeout(EVT_MASK_SCAN_THREAD, report_timeout) == 0 ) {
+			return false;
+		}
+	}
+	return false;
+}
+
+/* Compares the last report against the channel's floor. While scanning,
+ * idle reports pull the floor down at once and up by a dB at a time, so a
+ * transmission heard on the first pass is soon forgotten. The floor is
+ * left alone while dwelling, under the channel's own settings.
+ */
+bool ScanThread::is_active(const size_t index, const bool dwelling) {
+	const int32_t level_db = config.channel_db - gain_db_;
+	auto& floor = floor_db[index];
+
+	const bool carrier = (floor != floor_unknown) && ((level_db - floor) >= carrier_margin_db);
+	const bool active = carrier && config.squelch_open;
+
+	if( !dwelling && !active ) {
+		if( (floor == floor_unknown) || (level_db < floor) ) {
+			floor = level_db;
+		} else if( level_db > floor ) {
+			floor++;
+		}
+	}
+
+	return active;
+}
+
+/* The UI thread acts on it at its next frame. */
+void ScanThread::wait_for_request(const Request request) {
+	request_ = request;
+	while( (request_ != Request::None) && !chThdShouldTerminate() ) {
+		chEvtWaitAnyTimeout(EVT_MASK_SCAN_THREAD, report_timeout);
+	}
+}
@@ -0,0 +1,136 @@
+/*
+ * Copyright (C) 2016 Jared Boone, ShareBrained Technology, Inc.
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __SCAN_THREAD_H__
+#define __SCAN_THREAD_H__
+
+#include "ch.h"
+
+#include "event_m0.hpp"
+#include "message.hpp"
+#include "radio.hpp"
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+/* Steps the radio through a list of tuning plans while the NFM or AM
+ * processor keeps running, listening to each channel for a few audio
+ * blocks. A channel is active when the squelch is open and its power is
+ * carrier_margin_db over the noise floor learned for it while idle, so
+ * the first pass only learns floors. Stops on an active channel, and
+ * moves on once it has been quiet for the hang time.
+ *
+ * The owner applies a channel's own settings when a dwell starts and
+ * puts the scan settings back when it ends, see request().
+ */
+class ScanThread {
+public:
+	enum class Request {
+		None,
+		Dwell,		/* Apply the settings of channel() */
+		Resume,		/* Put the scan settings back */
+	};
+
+	ScanThread(
+		std::vector<radio::TuningPlan> plans,
+		const int32_t gain_db,
+		const systime_t hang_time = MS2ST(2000),
+		const int32_t carrier_margin_db = 10,
+		const size_t settle_blocks = 2,
+		const size_t detect_blocks = 8
+	);
+	~ScanThread();
+
+	/* Index of the plan being listened to. */
+	size_t channel() const {
+		return channel_;
+	}
+
+	bool dwelling() const {
+		return dwelling_;
+	}
+
+	/* Channels visited over the last second. */
+	uint32_t scan_rate() const {
+		return scan_rate_;
+	}
+
+	/* How many times a channel was found active. */
+	uint32_t activity(const size_t index) const {
+		return activity_[index];
+	}
+
+	/* Leaves the channel being dwelled on. */
+	void skip() {
+		skip_requested = true;
+	}
+
+	/* Total receive gain, so levels measured at different gains compare.
+	 * Call whenever it changes.
+	 */
+	void set_gain_db(const int32_t gain_db) {
+		gain_db_ = gain_db;
+	}
+
+	/* Scanning waits until the owner has acted on this and called
+	 * request_done().
+	 */
+	Request request() const {
+		return request_;
+	}
+
+	void request_done();
+
+	static void check_report_isr();
+
+private:
+	/* Marks a channel not visited yet. */
+	static constexpr int16_t floor_unknown = INT16_MAX;
+
+	ScanConfig config;
+	const std::vector<radio::TuningPlan> plans;
+	const systime_t hang_time;
+	const int32_t carrier_margin_db;
+	std::vector<uint32_t> activity_;
+	/* Idle level of each channel, referred to the antenna: dBFS minus gain. */
+	std::vector<int16_t> floor_db;
+	volatile int32_t gain_db_;
+	volatile Request request_ { Request::None };
+	volatile size_t channel_ { 0 };
+	volatile bool dwelling_ { false };
+	volatile uint32_t scan_rate_ { 0 };
+	volatile bool skip_requested { false };
+	static Thread* thread;
+
+	static msg_t static_fn(void* arg) {
+		auto obj = static_cast<ScanThread*>(arg);
+		return obj->run();
+	}
+
+	msg_t run();
+
+	bool wait_for_report(const uint32_t sequence, uint32_t& report_count);
+	bool is_active(const size_t index, const bool dwelling);
+	void wait_for_request(const Request request);
+};
+
+#endif/*__SCAN_THREAD_H__*/
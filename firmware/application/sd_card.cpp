@@ -24,6 +24,10 @@
 #include <hal.h>
 
 #include "ff.h"
+#include "fatfs_cache.h"
+
+#include "file_index.hpp"
+#include "sd_io.hpp"
 
 namespace sd_card {
 
@@ -50,19 +54,29 @@ void poll_inserted() {
 
 		Status new_status { card_present ? Status::Present : Status::NotPresent };
 
-		if( card_present ) {
-			if( sdcConnect(&SDCD1) == CH_SUCCESS ) {
-				if( mount() == FR_OK ) {
-					new_status = Status::Mounted;
+		// The I/O thread may be inside FatFS, so swap cards there, between
+		// its requests.
+		sd_io::execute(sd_io::Priority::Interactive, [&new_status]() {
+			// Whatever is cached belonged to the card that was (or wasn't) there.
+			fatfs_cache_invalidate();
+
+			if( card_present ) {
+				if( sdcConnect(&SDCD1) == CH_SUCCESS ) {
+					if( mount() == FR_OK ) {
+						new_status = Status::Mounted;
+						file_index::on_mount();
+					} else {
+						new_status = Status::MountError;
+					}
 				} else {
-					new_status = Status::MountError;
+					new_status = Status::ConnectError;
 				}
 			} else {
-				new_status = Status::ConnectError;
+				file_index::on_unmount();
+				sdcDisconnect(&SDCD1);
 			}
-		} else {
-			sdcDisconnect(&SDCD1);
-		}
+			return true;
+		});
 
 		status_ = new_status;
 		status_signal.emit(status_);
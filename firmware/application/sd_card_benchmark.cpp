@@ -0,0 +1,315 @@
+/*
+ * Copyright (C) 2016 Jared Boone, ShareBrained Technology, Inc.
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "sd_card_benchmark.hpp"
+
+#include "file.hpp"
+#include "lfsr_random.hpp"
+#include "string_format.hpp"
+#include "utility.hpp"
+
+#include "hal.h"
+
+#include <algorithm>
+
+namespace sd_card_benchmark {
+
+/* LatencyHistogram ******************************************************/
+
+size_t LatencyHistogram::bucket_index(const uint32_t us) {
+	if( us < 4 ) {
+		return us;
+	}
+	const size_t octave = 31 - __builtin_clz(us);
+	const size_t quarter = (us >> (octave - 2)) & 3;
+	return std::min((octave - 1) * 4 + quarter, bucket_count - 1);
+}
+
+uint32_t LatencyHistogram::bucket_upper(const size_t index) {
+	if( index < 4 ) {
+		return index;
+	}
+	const size_t octave = index / 4 + 1;
+	const size_t quarter = index & 3;
+	const uint32_t lower = uint32_t(4 + quarter) << (octave - 2);
+	return lower + (1U << (octave - 2)) - 1;
+}
+
+void LatencyHistogram::add(const uint32_t us) {
+	auto& bucket = buckets[bucket_index(us)];
+	if( bucket < UINT16_MAX ) {
+		bucket++;
+	}
+	_count++;
+	_max = std::max(_max, us);
+}
+
+uint32_t LatencyHistogram::percentile(const uint32_t per_mille) const {
+	if( _count == 0 ) {
+		return 0;
+	}
+
+	const uint32_t rank = (uint64_t(_count) * per_mille + 999) / 1000;
+	uint32_t seen = 0;
+	for(size_t i=0; i<buckets.size(); i++) {
+		seen += buckets[i];
+		if( seen >= rank ) {
+			return std::min(bucket_upper(i), _max);
+		}
+	}
+	return _max;
+}
+
+/* Profiles **************************************************************/
+
+/* Random reads use the file the last sequential write profile left behind,
+ * so the write profiles must come first. Writes larger than the 16K buffer
+ * are issued as consecutive buffer-sized writes and timed as one operation.
+ */
+static constexpr std::array<Profile, profile_count> profiles { {
+	{ "W512",  Kind::SequentialWrite,   512, 512,       0 },
+	{ "W4K",   Kind::SequentialWrite,  4096, 256,       0 },
+	{ "W16K",  Kind::SequentialWrite, 16384, 128,       0 },
+	{ "W64K",  Kind::SequentialWrite, 65536,  32,       0 },
+	{ "R512",  Kind::RandomRead,        512, 256,       0 },
+	{ "R4K",   Kind::RandomRead,       4096, 256,       0 },
+	{ "A64S",  Kind::AppendSync,         64, 200,       0 },
+	{ "S500K", Kind::Stream,           4096, 610,  500000 },
+	{ "S1M",   Kind::Stream,           8192, 610, 1000000 },
+} };
+
+const Profile& profile(const size_t index) {
+	return profiles[index];
+}
+
+/* Benchmark *************************************************************/
+
+static const std::string filename { "_PPBENCH.DAT" };
+
+static uint32_t ticks_to_us(const halrtcnt_t ticks) {
+	return uint64_t(ticks) * 1000000U / halGetCounterFrequency();
+}
+
+/* Sleep for whole milliseconds while the deadline is far away, then yield
+ * until it passes, so pacing is accurate to well under a system tick.
+ */
+static void wait_until(const halrtcnt_t deadline) {
+	const halrtcnt_t ticks_per_ms = halGetCounterFrequency() / 1000U;
+	while(true) {
+		const int32_t remaining = deadline - halGetCounterValue();
+		if( remaining <= 0 ) {
+			return;
+		}
+		const uint32_t remaining_ms = remaining / ticks_per_ms;
+		if( remaining_ms > 1 ) {
+			chThdSleepMilliseconds(remaining_ms - 1);
+		} else {
+			chThdYield();
+		}
+	}
+}
+
+Benchmark::Benchmark() {
+	thread = chThdCreateFromHeap(NULL, 2048, NORMALPRIO + 10, Benchmark::static_fn, this);
+	if( thread == nullptr ) {
+		_result = Result::FailThread;
+	}
+}
+
+Benchmark::~Benchmark() {
+	if( thread ) {
+		chThdTerminate(thread);
+		chThdWait(thread);
+	}
+}
+
+msg_t Benchmark::static_fn(void* arg) {
+	auto obj = static_cast<Benchmark*>(arg);
+	obj->_result = obj->run();
+	return 0;
+}
+
+Benchmark::Result Benchmark::run() {
+	Result result = Result::OK;
+
+	{
+		const auto buffer = std::make_unique<std::array<uint8_t, buffer_size>>();
+		if( !buffer ) {
+			return Result::FailHeap;
+		}
+
+		lfsr_word_t v = 1;
+		lfsr_fill(v,
+			reinterpret_cast<lfsr_word_t*>(buffer->data()),
+			sizeof(*buffer.get()) / sizeof(lfsr_word_t)
+		);
+
+		for(size_t i=0; i<profiles.size(); i++) {
+			if( chThdShouldTerminate() ) {
+				result = Result::FailAbort;
+				break;
+			}
+
+			result = run_profile(profiles[i], results[i], buffer->data());
+			if( result != Result::OK ) {
+				break;
+			}
+			_completed = i + 1;
+		}
+	}
+
+	f_unlink(filename.c_str());
+
+	if( result != Result::OK ) {
+		return result;
+	}
+
+	return write_report();
+}
+
+Benchmark::Result Benchmark::run_profile(
+	const Profile& profile,
+	ProfileResult& result,
+	uint8_t* const buffer
+) {
+	const bool is_read = (profile.kind == Kind::RandomRead);
+	const auto mode = is_read
+		? (File::openmode::in | File::openmode::binary)
+		: (File::openmode::out | File::openmode::binary | File::openmode::trunc);
+
+	File file { filename, mode, sd_io::Priority::Capture };
+	if( !file.is_open() ) {
+		return Result::FailFileOpen;
+	}
+
+	const size_t block_count = is_read ? (file.size() / profile.op_bytes) : 0;
+	if( is_read && (block_count == 0) ) {
+		return Result::FailIncomplete;
+	}
+
+	const halrtcnt_t interval = (profile.kind == Kind::Stream)
+		? uint64_t(profile.op_bytes) * halGetCounterFrequency() / profile.bytes_per_second
+		: 0;
+
+	lfsr_word_t v = 1;
+	halrtcnt_t deadline = halGetCounterValue();
+	const systime_t start = chTimeNow();
+
+	while( (result.ops < profile.op_count) && !chThdShouldTerminate() ) {
+		if( profile.kind == Kind::Stream ) {
+			wait_until(deadline);
+			deadline += interval;
+		}
+
+		const halrtcnt_t op_start = halGetCounterValue();
+
+		bool success = true;
+		if( is_read ) {
+			v = lfsr_iterate(v);
+			file.seek(uint64_t(v % block_count) * profile.op_bytes);
+			success = file.read(buffer, profile.op_bytes);
+		} else {
+			for(size_t offset=0; success && (offset<profile.op_bytes); offset+=buffer_size) {
+				success = file.write(buffer, std::min(profile.op_bytes - offset, buffer_size));
+			}
+			if( success && (profile.kind == Kind::AppendSync) ) {
+				success = file.sync();
+			}
+		}
+
+		const halrtcnt_t op_end = halGetCounterValue();
+		if( !success ) {
+			return Result::FailIncomplete;
+		}
+
+		result.histogram.add(ticks_to_us(op_end - op_start));
+		result.ops++;
+		result.bytes += profile.op_bytes;
+
+		if( (profile.kind == Kind::Stream) && (int32_t(op_end - deadline) > 0) ) {
+			result.late++;
+		}
+	}
+
+	if( !is_read ) {
+		file.sync();
+	}
+	result.duration_ms = chTimeNow() - start;
+
+	if( result.ops < profile.op_count ) {
+		return chThdShouldTerminate() ? Result::FailAbort : Result::FailIncomplete;
+	}
+
+	return Result::OK;
+}
+
+Benchmark::Result Benchmark::write_report() {
+	const auto stem = next_filename_stem_matching_pattern("SDB_????");
+	if( stem.empty() ) {
+		return Result::FailReport;
+	}
+
+	File file { stem + ".CSV", File::openmode::out | File::openmode::trunc };
+	if( !file.is_open() ) {
+		return Result::FailReport;
+	}
+
+	bool success = file.puts("profile,op_bytes,ops,bytes,duration_ms,kB_per_s,p50_us,p99_us,max_us,late\n");
+	for(size_t i=0; success && (i<profiles.size()); i++) {
+		const auto& p = profiles[i];
+		const auto& r = results[i];
+		success = file.puts(
+			std::string(p.name) + "," +
+			to_string_dec_uint(p.op_bytes) + "," +
+			to_string_dec_uint(r.ops) + "," +
+			to_string_dec_uint(r.bytes) + "," +
+			to_string_dec_uint(r.duration_ms) + "," +
+			to_string_dec_uint(r.kilobytes_per_second()) + "," +
+			to_string_dec_uint(r.histogram.percentile(500)) + "," +
+			to_string_dec_uint(r.histogram.percentile(990)) + "," +
+			to_string_dec_uint(r.histogram.max()) + "," +
+			to_string_dec_uint(r.late) + "\n"
+		);
+	}
+
+	success = success && file.puts("\nhist,profile,bucket_upper_us,count\n");
+	for(size_t i=0; success && (i<profiles.size()); i++) {
+		const auto& histogram = results[i].histogram;
+		for(size_t b=0; success && (b<LatencyHistogram::bucket_count); b++) {
+			if( histogram.bucket(b) ) {
+				success = file.puts(
+					"hist," + std::string(profiles[i].name) + "," +
+					to_string_dec_uint(LatencyHistogram::bucket_upper(b)) + "," +
+					to_string_dec_uint(histogram.bucket(b)) + "\n"
+				);
+			}
+		}
+	}
+
+	if( !success ) {
+		return Result::FailReport;
+	}
+
+	_report_filename = stem + ".CSV";
+	return Result::OK;
+}
+
+} /* namespace sd_card_benchmark */
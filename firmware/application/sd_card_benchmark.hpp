@@ -0,0 +1,160 @@
+/*
+ * Copyright (C) 2016 Jared Boone, ShareBrained Technology, Inc.
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __SD_CARD_BENCHMARK_H__
+#define __SD_CARD_BENCHMARK_H__
+
+#include "ch.h"
+
+#include <cstdint>
+#include <cstddef>
+#include <array>
+#include <string>
+
+namespace sd_card_benchmark {
+
+/* Per-operation latency histogram with quarter-octave buckets. Latencies
+ * below 4us get a bucket each, above that every power of two is split in
+ * four, so percentiles are within 25% of the true value. The maximum is
+ * tracked exactly.
+ */
+class LatencyHistogram {
+public:
+	static constexpr size_t bucket_count = 80;
+
+	void add(const uint32_t us);
+
+	uint32_t count() const {
+		return _count;
+	}
+
+	uint32_t max() const {
+		return _max;
+	}
+
+	uint16_t bucket(const size_t index) const {
+		return buckets[index];
+	}
+
+	/* Upper bound of the bucket holding the given fraction (in thousandths)
+	 * of samples, clamped to the maximum.
+	 */
+	uint32_t percentile(const uint32_t per_mille) const;
+
+	static uint32_t bucket_upper(const size_t index);
+
+private:
+	std::array<uint16_t, bucket_count> buckets { };
+	uint32_t _count { 0 };
+	uint32_t _max { 0 };
+
+	static size_t bucket_index(const uint32_t us);
+};
+
+enum class Kind {
+	SequentialWrite,
+	RandomRead,
+	AppendSync,
+	Stream,
+};
+
+struct Profile {
+	const char* const name;
+	const Kind kind;
+	const size_t op_bytes;
+	const size_t op_count;
+	/* Stream profiles only: the rate the writes are paced at. */
+	const uint32_t bytes_per_second;
+};
+
+struct ProfileResult {
+	uint32_t ops { 0 };
+	uint32_t bytes { 0 };
+	uint32_t duration_ms { 0 };
+	/* Stream profiles only: writes that finished after their slot ended. */
+	uint32_t late { 0 };
+	LatencyHistogram histogram;
+
+	uint32_t kilobytes_per_second() const {
+		return duration_ms ? (uint64_t(bytes) / duration_ms) : 0;
+	}
+};
+
+constexpr size_t profile_count = 9;
+
+const Profile& profile(const size_t index);
+
+/* Runs every profile in turn on its own thread, then writes SDB_nnnn.CSV
+ * with a summary row per profile followed by the non-empty histogram
+ * buckets. Destroying the object aborts a run in progress.
+ */
+class Benchmark {
+public:
+	enum Result {
+		FailReport = -6,
+		FailIncomplete = -5,
+		FailAbort = -4,
+		FailFileOpen = -3,
+		FailHeap = -2,
+		FailThread = -1,
+		Incomplete = 0,
+		OK = 1,
+	};
+
+	Benchmark();
+	~Benchmark();
+
+	Result result() const {
+		return _result;
+	}
+
+	/* Number of profiles whose results are final. */
+	size_t completed() const {
+		return _completed;
+	}
+
+	const ProfileResult& profile_result(const size_t index) const {
+		return results[index];
+	}
+
+	const std::string& report_filename() const {
+		return _report_filename;
+	}
+
+private:
+	static constexpr size_t buffer_size = 16384;
+
+	Thread* thread { nullptr };
+	volatile Result _result { Result::Incomplete };
+	volatile size_t _completed { 0 };
+	std::array<ProfileResult, profile_count> results;
+	std::string _report_filename;
+
+	static msg_t static_fn(void* arg);
+
+	Result run();
+	Result run_profile(const Profile& profile, ProfileResult& result, uint8_t* const buffer);
+	Result write_report();
+};
+
+} /* namespace sd_card_benchmark */
+
+#endif/*__SD_CARD_BENCHMARK_H__*/
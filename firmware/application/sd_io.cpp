@@ -0,0 +1,141 @@
+/*
+ * Copyright (C) 2016 Jared Boone, ShareBrained Technology, Inc.
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "sd_io.hpp"
+
+#include "ch.h"
+
+#include <array>
+
+namespace sd_io {
+
+namespace {
+
+struct Queue {
+	Request* head { nullptr };
+	Request* tail { nullptr };
+
+	void push(Request* const request) {
+		request->next = nullptr;
+		if( tail ) {
+			tail->next = request;
+		} else {
+			head = request;
+		}
+		tail = request;
+	}
+
+	Request* pop() {
+		const auto request = head;
+		if( request ) {
+			head = request->next;
+			if( head == nullptr ) {
+				tail = nullptr;
+			}
+		}
+		return request;
+	}
+};
+
+std::array<Queue, priority_count> queues;
+Semaphore pending;
+Thread* thread = nullptr;
+
+// Need significant stack for FATFS
+WORKING_AREA(thread_wa, 1024);
+
+void enqueue(Request* const request) {
+	chSysLock();
+	queues[static_cast<size_t>(request->priority)].push(request);
+	chSemSignalI(&pending);
+	chSchRescheduleS();
+	chSysUnlock();
+}
+
+Request* dequeue() {
+	chSysLock();
+	Request* request = nullptr;
+	for(auto& queue : queues) {
+		request = queue.pop();
+		if( request ) {
+			break;
+		}
+	}
+	chSysUnlock();
+	return request;
+}
+
+msg_t run(void*) {
+	while( true ) {
+		chSemWait(&pending);
+		const auto request = dequeue();
+		if( request == nullptr ) {
+			continue;
+		}
+
+		if( request->step() ) {
+			if( request->on_complete ) {
+				request->on_complete();
+			}
+		} else {
+			// More to do, go to the back of the line and let others in.
+			enqueue(request);
+		}
+	}
+
+	return 0;
+}
+
+void start() {
+	if( thread == nullptr ) {
+		chSemInit(&pending, 0);
+		thread = chThdCreateStatic(thread_wa, sizeof(thread_wa), NORMALPRIO + 10, run, nullptr);
+	}
+}
+
+} /* namespace */
+
+void submit(Request& request) {
+	start();
+	enqueue(&request);
+}
+
+void execute(const Priority priority, const Request::Step& step) {
+	if( chThdSelf() == thread ) {
+		while( !step() );
+		return;
+	}
+
+	BinarySemaphore done;
+	chBSemInit(&done, TRUE);
+
+	Request request;
+	request.priority = priority;
+	request.step = step;
+	request.on_complete = [&done]() {
+		chBSemSignal(&done);
+	};
+	submit(request);
+
+	chBSemWait(&done);
+}
+
+} /* namespace sd_io */
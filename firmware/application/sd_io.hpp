@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2016 Jared Boone, ShareBrained Technology, Inc.
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __SD_IO_H__
+#define __SD_IO_H__
+
+#include <cstdint>
+#include <cstddef>
+#include <functional>
+
+/* All SD card file access is funneled through one I/O thread, which
+ * services queued requests in priority order. Long transfers are done in
+ * slices so a real-time stream never waits behind more than one slice of
+ * lower priority work.
+ */
+namespace sd_io {
+
+enum class Priority : uint8_t {
+	Capture = 0,		// Real-time streams that drop data if starved.
+	Logging = 1,		// Decoder logs.
+	Interactive = 2,	// UI-initiated access: screenshots, settings, tests.
+};
+
+constexpr size_t priority_count = 3;
+
+/* Largest transfer performed in one step before the queue is re-examined. */
+constexpr size_t slice_size = 4096;
+
+struct Request {
+	/* Called on the I/O thread until it returns true (finished). */
+	using Step = std::function<bool(void)>;
+	/* Called on the I/O thread once step() has finished. */
+	using Completion = std::function<void(void)>;
+
+	Priority priority { Priority::Interactive };
+	Step step;
+	Completion on_complete;
+
+	Request* next { nullptr };
+};
+
+/* Queues a request and returns immediately. The request must stay alive
+ * until its completion has been called.
+ */
+void submit(Request& request);
+
+/* Queues a request and waits for it to finish. Runs the step in place
+ * when called from the I/O thread itself (e.g. from a completion).
+ */
+void execute(const Priority priority, const Request::Step& step);
+
+} /* namespace sd_io */
+
+#endif/*__SD_IO_H__*/
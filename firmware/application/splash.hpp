@@ -1,1073 +1,917 @@
-const unsigned char splash_bmp[] = {
-	0x42, 0x4d, 0x28, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x00,
-	0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0xb9, 0x00, 0x00, 0x00, 0x1b, 0x01,
-	0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0xb2, 0x31,
-	0x00, 0x00, 0x12, 0x0b, 0x00, 0x00, 0x12, 0x0b, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x1c, 0x80, 0x00, 0x26, 0x2f,
-	0xaa, 0x00, 0x03, 0x04, 0x26, 0x00, 0x06, 0x09, 0x49, 0x00, 0x00, 0x00,
-	0xc8, 0x00, 0x00, 0x00, 0x73, 0x00, 0x81, 0x81, 0x87, 0x00, 0x1d, 0x1d,
-	0x1e, 0x00, 0xcb, 0xcb, 0xce, 0x00, 0x99, 0x99, 0x9b, 0x00, 0x6b, 0x6b,
-	0x6c, 0x00, 0xfd, 0xfd, 0xfd, 0x00, 0xb0, 0xb0, 0xb0, 0x00, 0x52, 0x52,
-	0x52, 0x00, 0x36, 0x36, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xff,
-	0x00, 0x0c, 0xfe, 0xed, 0xaa, 0xaa, 0xdd, 0xe7, 0x38, 0xff, 0x00, 0x00,
-	0x76, 0xff, 0x00, 0x0e, 0xda, 0x6c, 0x88, 0xc8, 0xcc, 0x9a, 0xef, 0x00,
-	0x34, 0xff, 0x02, 0xf0, 0x00, 0x00, 0x74, 0xff, 0x00, 0x10, 0xfd, 0xad,
-	0xac, 0x88, 0x88, 0x8c, 0xc6, 0xde, 0x36, 0xff, 0x00, 0x00, 0x74, 0xff,
-	0x00, 0x12, 0x7a, 0xd9, 0x98, 0x88, 0x88, 0x8c, 0xcc, 0x6a, 0xdf, 0x00,
-	0x32, 0xff, 0x02, 0xf0, 0x00, 0x00, 0x74, 0xff, 0x00, 0x12, 0xda, 0xc8,
-	0xac, 0x88, 0x8c, 0xcc, 0xc6, 0xc9, 0xaf, 0x00, 0x34, 0xff, 0x00, 0x00,
-	0x74, 0xff, 0x00, 0x12, 0x69, 0x88, 0xcc, 0xcc, 0xc8, 0x8c, 0x88, 0xcc,
-	0xcf, 0x00, 0x32, 0xff, 0x02, 0xf0, 0x00, 0x00, 0x74, 0xff, 0x00, 0x12,
-	0x9c, 0x98, 0xcc, 0x66, 0xc8, 0x89, 0xc8, 0xc9, 0xcf, 0x00, 0x34, 0xff,
-	0x00, 0x00, 0x74, 0xff, 0x00, 0x12, 0x68, 0xa6, 0xc8, 0x9e, 0x88, 0x98,
-	0x8c, 0x6c, 0x6f, 0x00, 0x32, 0xff, 0x02, 0xf0, 0x00, 0x00, 0x74, 0xff,
-	0x00, 0x12, 0xe8, 0x96, 0xc8, 0x89, 0xe8, 0xa9, 0x8a, 0xd9, 0xdf, 0x00,
-	0x34, 0xff, 0x00, 0x00, 0x74, 0xff, 0x00, 0x12, 0x78, 0xca, 0x6c, 0xc8,
-	0x69, 0x9c, 0xc9, 0xa8, 0x7f, 0x00, 0x32, 0xff, 0x02, 0xf0, 0x00, 0x00,
-	0x74, 0xff, 0x00, 0x10, 0xec, 0x88, 0xd6, 0x9a, 0xca, 0x9e, 0xea, 0xc9,
-	0x36, 0xff, 0x00, 0x00, 0x74, 0xff, 0x00, 0x10, 0xe9, 0xc8, 0x86, 0xd9,
-	0xaf, 0xda, 0xa6, 0x8c, 0x34, 0xff, 0x02, 0xfe, 0x00, 0x00, 0x74, 0xff,
-	0x00, 0x10, 0xfc, 0x88, 0x86, 0xcc, 0x6e, 0xcc, 0x66, 0x8c, 0x36, 0xff,
-	0x00, 0x00, 0x74, 0xff, 0x00, 0x10, 0xf6, 0xcc, 0x88, 0x88, 0x8d, 0xc8,
-	0xc8, 0x8a, 0x34, 0xff, 0x02, 0xf0, 0x00, 0x00, 0x74, 0xff, 0x00, 0x10,
-	0xf6, 0xcc, 0xc8, 0xc8, 0x86, 0x88, 0xc8, 0x8d, 0x36, 0xff, 0x00, 0x00,
-	0x74, 0xff, 0x00, 0x10, 0xf9, 0x88, 0x99, 0x88, 0x99, 0x88, 0xcc, 0x8f,
-	0x34, 0xff, 0x02, 0xf0, 0x00, 0x00, 0x74, 0xff, 0x00, 0x10, 0xac, 0x88,
-	0x9c, 0xcc, 0xcc, 0xc9, 0xa6, 0x6f, 0x36, 0xff, 0x00, 0x00, 0x74, 0xff,
-	0x00, 0x10, 0xec, 0x88, 0x89, 0xcc, 0x6a, 0x99, 0xcc, 0xdf, 0x34, 0xff,
-	0x02, 0xf0, 0x00, 0x00, 0x74, 0xff, 0x00, 0x10, 0xfc, 0x88, 0x8c, 0x89,
-	0xad, 0x8c, 0x68, 0xef, 0x36, 0xff, 0x00, 0x00, 0x74, 0xff, 0x00, 0x10,
-	0xfc, 0x88, 0x8c, 0x88, 0xaa, 0xc8, 0x68, 0xef, 0x34, 0xff, 0x02, 0xf0,
-	0x00, 0x00, 0x72, 0xff, 0x00, 0x10, 0xfc, 0x88, 0x88, 0xcc, 0x88, 0xaa,
-	0xc6, 0x68, 0x38, 0xff, 0x00, 0x00, 0x72, 0xff, 0x00, 0x10, 0xf6, 0xb8,
-	0xc8, 0x9c, 0x88, 0xd6, 0x8c, 0x9c, 0x36, 0xff, 0x02, 0xf0, 0x00, 0x00,
-	0x72, 0xff, 0x00, 0x10, 0xfd, 0x8c, 0xcc, 0x68, 0xc6, 0xdc, 0x88, 0x98,
-	0x38, 0xff, 0x00, 0x00, 0x72, 0xff, 0x00, 0x12, 0xfd, 0x88, 0xcc, 0xa9,
-	0x69, 0xdc, 0x8c, 0x9c, 0x7f, 0x00, 0x34, 0xff, 0x02, 0xf0, 0x00, 0x00,
-	0x72, 0xff, 0x00, 0x10, 0xf6, 0x88, 0x8c, 0xda, 0x96, 0x69, 0x8c, 0x69,
-	0x38, 0xff, 0x00, 0x00, 0x72, 0xff, 0x00, 0x10, 0xfc, 0x9c, 0x88, 0x99,
-	0x9e, 0x76, 0x6a, 0xa9, 0x36, 0xff, 0x02, 0xf0, 0x00, 0x00, 0x2a, 0xff,
-	0x00, 0x0a, 0xfe, 0xed, 0xed, 0xee, 0x7f, 0x00, 0x3e, 0xff, 0x00, 0x10,
-	0xfc, 0xc9, 0x68, 0x88, 0xcc, 0xc8, 0x88, 0x8d, 0x38, 0xff, 0x00, 0x00,
-	0x28, 0xff, 0x00, 0x0e, 0xf7, 0xa9, 0xc8, 0xcc, 0xcc, 0xc6, 0xef, 0x00,
-	0x3c, 0xff, 0x00, 0x10, 0xdc, 0x9c, 0x99, 0x9c, 0x88, 0x8b, 0x8c, 0x6f,
-	0x36, 0xff, 0x02, 0xf0, 0x00, 0x00, 0x28, 0xff, 0x00, 0x10, 0xe6, 0x6a,
-	0x6c, 0x98, 0x89, 0x88, 0xca, 0xa7, 0x3a, 0xff, 0x00, 0x10, 0x7c, 0x99,
-	0x69, 0xcc, 0x6d, 0x9c, 0xc9, 0x7f, 0x38, 0xff, 0x00, 0x00, 0x26, 0xff,
-	0x02, 0xfe, 0x02, 0x9c, 0x08, 0x88, 0x00, 0x08, 0xcc, 0x88, 0x8c, 0x67,
-	0x38, 0xff, 0x00, 0x0e, 0xfc, 0xc9, 0x99, 0x9c, 0x8d, 0xc8, 0xc9, 0x00,
-	0x38, 0xff, 0x02, 0xf0, 0x00, 0x00, 0x28, 0xff, 0x00, 0x14, 0x99, 0x88,
-	0x88, 0x88, 0x8c, 0x88, 0xc8, 0x8c, 0xc8, 0x67, 0x36, 0xff, 0x00, 0x0e,
-	0x79, 0xc9, 0x9c, 0x69, 0x66, 0x8c, 0xce, 0x00, 0x3a, 0xff, 0x00, 0x00,
-	0x28, 0xff, 0x00, 0x16, 0xf6, 0xc8, 0x88, 0x9c, 0x8c, 0x88, 0xcc, 0xcc,
-	0x88, 0xc8, 0xa7, 0x00, 0x34, 0xff, 0x00, 0x0e, 0xa9, 0xc9, 0x9c, 0xd6,
-	0xdc, 0xcc, 0xcf, 0x00, 0x38, 0xff, 0x02, 0xf0, 0x00, 0x00, 0x2a, 0xff,
-	0x00, 0x16, 0x6c, 0xc8, 0xc9, 0xcc, 0xcc, 0x89, 0xc8, 0xcb, 0x98, 0xc9,
-	0xef, 0x00, 0x32, 0xff, 0x00, 0x0e, 0x99, 0xc6, 0x99, 0xda, 0xd8, 0xcc,
-	0xaf, 0x00, 0x3a, 0xff, 0x00, 0x00, 0x2a, 0xff, 0x00, 0x18, 0x76, 0x98,
-	0x9c, 0x8c, 0x6c, 0x89, 0xc8, 0x88, 0xcc, 0xc8, 0x8a, 0xef, 0x2e, 0xff,
-	0x00, 0x10, 0xfd, 0x9c, 0xcc, 0xc6, 0xad, 0x6c, 0x8c, 0x7f, 0x38, 0xff,
-	0x02, 0xfe, 0x00, 0x00, 0x2a, 0xff, 0x00, 0x1a, 0xfe, 0xac, 0xcc, 0xcc,
-	0x88, 0xcc, 0x88, 0xcb, 0x9c, 0xc8, 0x88, 0x89, 0xef, 0x00, 0x2c, 0xff,
-	0x00, 0x0e, 0xf6, 0x99, 0x96, 0x9a, 0xd6, 0xc8, 0xcc, 0x00, 0x3c, 0xff,
-	0x00, 0x00, 0x2c, 0xff, 0x00, 0x1a, 0xfa, 0x9c, 0xc8, 0xcc, 0x98, 0x88,
-	0x88, 0x9c, 0x98, 0x88, 0x8c, 0x8c, 0xef, 0x00, 0x2a, 0xff, 0x00, 0x0e,
-	0xfd, 0xcc, 0x69, 0x6e, 0xee, 0xcc, 0xc9, 0x00, 0x3a, 0xff, 0x02, 0xf0,
-	0x00, 0x00, 0x2c, 0xff, 0x00, 0x1c, 0xfe, 0xc9, 0xc8, 0x86, 0x98, 0x8c,
-	0x88, 0xcc, 0xcc, 0x88, 0x88, 0xcc, 0x8c, 0xdf, 0x28, 0xff, 0x00, 0x0e,
-	0xf6, 0xc9, 0xcc, 0x9d, 0x6d, 0x8c, 0xca, 0x00, 0x3c, 0xff, 0x00, 0x00,
-	0x2e, 0xff, 0x00, 0x1a, 0xe8, 0xcc, 0xc8, 0xc8, 0x88, 0x86, 0xa9, 0x8c,
-	0xc8, 0x88, 0xc8, 0xc8, 0x8c, 0x00, 0x28, 0xff, 0x00, 0x0e, 0xf9, 0xcc,
-	0x9c, 0x66, 0x9d, 0xcc, 0xca, 0x00, 0x3a, 0xff, 0x02, 0xf0, 0x00, 0x00,
-	0x2e, 0xff, 0x00, 0x1c, 0xfd, 0x66, 0x88, 0x88, 0xcc, 0x8a, 0xc9, 0xcc,
-	0xc9, 0xcc, 0x88, 0xcc, 0xc8, 0xcf, 0x26, 0xff, 0x00, 0x0e, 0xdc, 0xc9,
-	0x9c, 0x96, 0x6d, 0xcc, 0xca, 0x00, 0x3c, 0xff, 0x00, 0x00, 0x30, 0xff,
-	0x00, 0x1a, 0xfa, 0x98, 0xc8, 0x6c, 0x9c, 0xcc, 0x88, 0x8c, 0x98, 0xcc,
-	0x8c, 0x8c, 0x87, 0x00, 0x24, 0xff, 0x00, 0x10, 0xfe, 0x9c, 0x66, 0x96,
-	0xda, 0x66, 0xcc, 0x9a, 0x3a, 0xff, 0x02, 0xf0, 0x00, 0x00, 0x32, 0xff,
-	0x00, 0x18, 0xa9, 0x68, 0xcd, 0xa6, 0xc8, 0xcc, 0x88, 0xcc, 0xcc, 0x88,
-	0xc8, 0xce, 0x24, 0xff, 0x00, 0x10, 0xe6, 0xcc, 0x69, 0xd6, 0xda, 0xd6,
-	0xc9, 0xca, 0x3c, 0xff, 0x00, 0x00, 0x32, 0xff, 0x00, 0x18, 0xfc, 0xc8,
-	0xc9, 0x9a, 0xcc, 0xcc, 0xc8, 0xc9, 0xc8, 0x88, 0x8c, 0x8f, 0x24, 0xff,
-	0x00, 0x10, 0x99, 0xc9, 0x69, 0x69, 0xa9, 0xd6, 0xcc, 0x9d, 0x3a, 0xff,
-	0x02, 0xf0, 0x00, 0x00, 0x32, 0xff, 0x00, 0x18, 0xf6, 0x9d, 0x98, 0x89,
-	0xc8, 0xc8, 0x6c, 0xc9, 0x88, 0x88, 0x8c, 0x9f, 0x24, 0xff, 0x00, 0x10,
-	0x69, 0xc6, 0x66, 0x6a, 0xa6, 0x6c, 0x99, 0x9a, 0x3c, 0xff, 0x00, 0x00,
-	0x34, 0xff, 0x00, 0x16, 0x69, 0x69, 0x88, 0xac, 0xc8, 0xc9, 0xc8, 0x8c,
-	0xb8, 0x88, 0x6f, 0x00, 0x22, 0xff, 0x00, 0x12, 0xf7, 0xa9, 0x9a, 0x6a,
-	0xa6, 0x69, 0xa9, 0xc9, 0x6d, 0x00, 0x3a, 0xff, 0x02, 0xf0, 0x00, 0x00,
-	0x34, 0xff, 0x00, 0x16, 0xf9, 0x69, 0xcc, 0x8d, 0xc8, 0xcc, 0x88, 0x98,
-	0x88, 0x88, 0xaf, 0x00, 0x22, 0xff, 0x00, 0x12, 0xfa, 0x6c, 0x9a, 0xa6,
-	0xaa, 0xa6, 0x69, 0x99, 0x6a, 0x00, 0x3c, 0xff, 0x00, 0x00, 0x36, 0xff,
-	0x00, 0x14, 0x98, 0xa8, 0xcc, 0xd8, 0x88, 0x88, 0xc8, 0x8c, 0x88, 0x9f,
-	0x22, 0xff, 0x00, 0x12, 0x7a, 0x99, 0x99, 0xa6, 0x6a, 0x6a, 0xd9, 0x99,
-	0x6a, 0x00, 0x3a, 0xff, 0x02, 0xf0, 0x00, 0x00, 0x36, 0xff, 0x00, 0x14,
-	0xfc, 0xca, 0xcc, 0x99, 0xcc, 0x9c, 0xc8, 0x88, 0xcc, 0x6f, 0x22, 0xff,
-	0x00, 0x12, 0xaa, 0x99, 0x69, 0x69, 0x66, 0x6a, 0xd9, 0x69, 0x6a, 0x00,
-	0x3c, 0xff, 0x00, 0x00, 0x36, 0xff, 0x00, 0x14, 0xf7, 0xca, 0xc8, 0xca,
-	0xad, 0x69, 0xc8, 0x88, 0x89, 0xaf, 0x22, 0xff, 0x00, 0x12, 0xca, 0x99,
-	0x96, 0xa6, 0xaa, 0xad, 0xd9, 0x66, 0x6a, 0x00, 0x3a, 0xff, 0x02, 0xf0,
-	0x00, 0x00, 0x38, 0xff, 0x00, 0x12, 0x9c, 0x99, 0xae, 0xda, 0xa9, 0xc8,
-	0x88, 0x8c, 0xdf, 0x00, 0x20, 0xff, 0x00, 0x14, 0xfd, 0x9d, 0x96, 0x66,
-	0x96, 0x6d, 0x6a, 0xa6, 0x66, 0x6a, 0x3c, 0xff, 0x00, 0x00, 0x38, 0xff,
-	0x00, 0x10, 0xd9, 0x69, 0x96, 0xaa, 0xa6, 0xc8, 0x8c, 0x8c, 0x1e, 0xff,
-	0x00, 0x18, 0xfe, 0xa6, 0xf6, 0x9a, 0x96, 0x9a, 0x66, 0xaa, 0xaa, 0x66,
-	0x66, 0xaa, 0x3a, 0xff, 0x02, 0xf0, 0x00, 0x00, 0x38, 0xff, 0x00, 0x10,
-	0xa8, 0xc9, 0x6a, 0xa6, 0xa6, 0xc8, 0x88, 0xca, 0x1e, 0xff, 0x00, 0x18,
-	0xf7, 0xed, 0xd6, 0x9a, 0x66, 0x6a, 0x6a, 0x66, 0x6a, 0xaa, 0x6a, 0xad,
-	0x3c, 0xff, 0x00, 0x00, 0x38, 0xff, 0x00, 0x10, 0xec, 0x99, 0x9a, 0xa6,
-	0xaa, 0x88, 0xc8, 0x97, 0x1e, 0xff, 0x00, 0x18, 0xfe, 0xda, 0x99, 0x9d,
-	0xa6, 0x6a, 0x6a, 0xd6, 0xaa, 0x6a, 0xaa, 0xad, 0x3a, 0xff, 0x02, 0xf0,
-	0x00, 0x00, 0x38, 0xff, 0x00, 0x10, 0xf6, 0x9c, 0xcc, 0x66, 0x66, 0x88,
-	0x9c, 0xcf, 0x1e, 0xff, 0x00, 0x18, 0xfe, 0xda, 0x96, 0x9a, 0x66, 0xaa,
-	0xaa, 0xad, 0xdd, 0x6a, 0xaa, 0xae, 0x3c, 0xff, 0x00, 0x00, 0x38, 0xff,
-	0x00, 0x10, 0xf6, 0xc8, 0xcc, 0x99, 0x99, 0x88, 0x8c, 0x9f, 0x1e, 0xff,
-	0x02, 0xfd, 0x02, 0xda, 0x08, 0x66, 0x00, 0x0c, 0xae, 0xea, 0xae, 0xaa,
-	0xaa, 0xa7, 0x3a, 0xff, 0x02, 0xf0, 0x00, 0x00, 0x38, 0xff, 0x00, 0x10,
-	0xf9, 0xcc, 0xc9, 0x66, 0x69, 0x8c, 0xcc, 0xaf, 0x1e, 0xff, 0x00, 0x1c,
-	0xfd, 0xda, 0x66, 0x66, 0x66, 0xad, 0xdd, 0xdd, 0xd7, 0xaa, 0xad, 0xa7,
-	0xff, 0x77, 0x38, 0xff, 0x00, 0x00, 0x38, 0xff, 0x00, 0x10, 0xdc, 0xcc,
-	0x99, 0x69, 0x69, 0x89, 0xcc, 0x7f, 0x1e, 0xff, 0x00, 0x1c, 0x7d, 0xda,
-	0x66, 0x6a, 0xaa, 0xdd, 0xdd, 0xaa, 0x7d, 0xea, 0xda, 0xde, 0xff, 0xef,
-	0x36, 0xff, 0x02, 0xf0, 0x00, 0x00, 0x38, 0xff, 0x00, 0x0e, 0x69, 0x99,
-	0x96, 0x99, 0x96, 0x8c, 0xc9, 0x00, 0x20, 0xff, 0x00, 0x1c, 0xea, 0xd6,
-	0xa6, 0x6a, 0xaa, 0xdd, 0xad, 0xdd, 0xed, 0xda, 0xdd, 0xdd, 0xe7, 0xef,
-	0x38, 0xff, 0x00, 0x00, 0x36, 0xff, 0x00, 0x10, 0xfd, 0x66, 0x96, 0x66,
-	0x99, 0x99, 0xcc, 0xcc, 0x20, 0xff, 0x00, 0x1c, 0xad, 0xd6, 0xaa, 0x6a,
-	0xad, 0xaa, 0xdd, 0xde, 0xed, 0xdd, 0xdd, 0xdd, 0xe7, 0x7f, 0x36, 0xff,
-	0x02, 0xf0, 0x00, 0x00, 0x36, 0xff, 0x00, 0x10, 0xf6, 0xd9, 0x66, 0xa6,
-	0x9c, 0xa8, 0xc6, 0xc9, 0x1e, 0xff, 0x00, 0x1c, 0xf7, 0xad, 0xaa, 0xde,
-	0xaa, 0xaa, 0xad, 0xad, 0xee, 0xed, 0xdd, 0xdd, 0xde, 0xd7, 0x3a, 0xff,
-	0x00, 0x00, 0x36, 0xff, 0x00, 0x10, 0xda, 0xa9, 0x66, 0x66, 0xc6, 0x68,
-	0x96, 0x96, 0x1e, 0xff, 0x00, 0x1c, 0xfe, 0xad, 0xdd, 0xdd, 0xda, 0xaa,
-	0xdd, 0xee, 0xed, 0xee, 0xde, 0xdd, 0xdd, 0xe7, 0x38, 0xff, 0x02, 0xf0,
-	0x00, 0x00, 0x36, 0xff, 0x00, 0x10, 0xd6, 0x66, 0x96, 0x99, 0x9a, 0xc8,
-	0x69, 0x9d, 0x1e, 0xff, 0x00, 0x1c, 0x7a, 0xad, 0xda, 0xde, 0xda, 0xaa,
-	0xde, 0xee, 0xee, 0xee, 0xde, 0xdd, 0xde, 0x7f, 0x3a, 0xff, 0x00, 0x00,
-	0x34, 0xff, 0x00, 0x12, 0xfa, 0x6a, 0x69, 0x99, 0xc9, 0xac, 0x89, 0x66,
-	0x9d, 0x00, 0x1e, 0xff, 0x00, 0x1c, 0xda, 0xad, 0xad, 0xde, 0xda, 0xd7,
-	0xee, 0xee, 0xee, 0x7e, 0xee, 0xee, 0xed, 0x7f, 0x38, 0xff, 0x02, 0xf0,
-	0x00, 0x00, 0x32, 0xff, 0x00, 0x14, 0xfe, 0xd6, 0x66, 0xa9, 0x99, 0x99,
-	0xcc, 0x96, 0xaa, 0x9e, 0x1c, 0xff, 0x00, 0x20, 0xfe, 0xed, 0xdd, 0xdd,
-	0xde, 0xed, 0xde, 0xee, 0xee, 0xee, 0x7e, 0x7e, 0xee, 0xee, 0x77, 0x7f,
-	0x38, 0xff, 0x00, 0x00, 0x2e, 0xff, 0x00, 0x18, 0xf7, 0xdd, 0xaa, 0x66,
-	0x6a, 0xaa, 0x69, 0x9c, 0xc9, 0x9a, 0xaa, 0x9d, 0x1c, 0xff, 0x00, 0x20,
-	0xda, 0xdd, 0xdd, 0xdd, 0xde, 0xed, 0xde, 0xe7, 0xe7, 0xe7, 0xee, 0xe7,
-	0xee, 0xee, 0xee, 0x7f, 0x36, 0xff, 0x02, 0xf0, 0x00, 0x00, 0x2e, 0xff,
-	0x00, 0x18, 0xed, 0xa6, 0xaa, 0xaa, 0x66, 0xaa, 0xaa, 0x99, 0x6a, 0x66,
-	0xaa, 0x6a, 0x1c, 0xff, 0x00, 0x20, 0xdd, 0xed, 0xdd, 0xed, 0xde, 0xed,
-	0xee, 0xee, 0x77, 0xee, 0xee, 0xe7, 0x7e, 0xee, 0xe7, 0x7f, 0x38, 0xff,
-	0x00, 0x00, 0x2c, 0xff, 0x00, 0x1a, 0xf7, 0xdd, 0xaa, 0xdd, 0xde, 0xd6,
-	0xad, 0xaa, 0xaa, 0xad, 0x69, 0x6a, 0x6a, 0x00, 0x1c, 0xff, 0x00, 0x20,
-	0xdd, 0xdd, 0xde, 0xed, 0xee, 0xed, 0xee, 0x77, 0x7e, 0xee, 0xe7, 0xe7,
-	0xee, 0xee, 0xe7, 0x7f, 0x36, 0xff, 0x02, 0xf0, 0x00, 0x00, 0x2c, 0xff,
-	0x00, 0x1a, 0xdd, 0xad, 0xdd, 0xad, 0xdd, 0xda, 0xaa, 0xaa, 0x66, 0x66,
-	0x66, 0xaa, 0x9a, 0x00, 0x1c, 0xff, 0x00, 0x20, 0xdd, 0xde, 0xee, 0xee,
-	0xde, 0x7e, 0xe7, 0x7e, 0xee, 0xe7, 0x77, 0xee, 0xe7, 0xe7, 0xe7, 0x77,
-	0x38, 0xff, 0x00, 0x00, 0x28, 0xff, 0x00, 0x20, 0xf7, 0xed, 0xda, 0xaa,
-	0xdd, 0xda, 0xda, 0xad, 0xaa, 0xaa, 0xaa, 0xa6, 0x6a, 0xaa, 0x6a, 0x7f,
-	0x1a, 0xff, 0x00, 0x20, 0xee, 0xdd, 0xed, 0xed, 0xe7, 0xee, 0xde, 0xee,
-	0xee, 0x77, 0x77, 0x7e, 0x7e, 0xee, 0xe7, 0x77, 0x36, 0xff, 0x02, 0xf0,
-	0x00, 0x00, 0x28, 0xff, 0x02, 0x7e, 0x02, 0xee, 0x08, 0xdd, 0x02, 0xad,
-	0x08, 0xda, 0x00, 0x0a, 0xaa, 0xaa, 0xaa, 0x6a, 0x7f, 0x00, 0x1a, 0xff,
-	0x00, 0x20, 0xed, 0xde, 0xed, 0xee, 0xee, 0x7e, 0xe7, 0x77, 0xff, 0x77,
-	0x77, 0x77, 0xe7, 0xee, 0x77, 0x77, 0x38, 0xff, 0x00, 0x00, 0x00, 0x18,
-	0xf5, 0x35, 0x55, 0x25, 0x55, 0x5f, 0x55, 0x55, 0x50, 0x55, 0x35, 0xf2,
-	0x08, 0x55, 0x02, 0x5f, 0x02, 0xf3, 0x08, 0x55, 0x00, 0x14, 0x53, 0x55,
-	0x53, 0x5d, 0x05, 0x55, 0x33, 0x55, 0x55, 0x05, 0x0c, 0x55, 0x02, 0x35,
-	0x0a, 0xff, 0x00, 0x18, 0x35, 0x55, 0x35, 0xff, 0xff, 0x75, 0x55, 0x35,
-	0x35, 0x55, 0x53, 0x73, 0x0a, 0x55, 0x00, 0x24, 0x35, 0x55, 0x35, 0x55,
-	0x55, 0x3f, 0x55, 0x55, 0x53, 0x53, 0x55, 0x55, 0x55, 0x2f, 0x55, 0x53,
-	0x5f, 0x35, 0x08, 0x55, 0x00, 0x08, 0xff, 0x55, 0x55, 0x53, 0x08, 0x55,
-	0x02, 0x53, 0x02, 0xf0, 0x00, 0x00, 0x00, 0x40, 0xf5, 0xbb, 0xb8, 0x55,
-	0x8b, 0x65, 0xdb, 0xbb, 0x61, 0xbb, 0xb1, 0x35, 0x9b, 0xbb, 0xbb, 0xbb,
-	0x65, 0x50, 0x8b, 0xbb, 0xbb, 0xb8, 0x65, 0x8b, 0xbb, 0x5d, 0x38, 0xbb,
-	0xb1, 0xbb, 0xb6, 0x58, 0x08, 0xbb, 0x00, 0x06, 0x68, 0xbb, 0xb5, 0x00,
-	0x0a, 0xff, 0x00, 0x56, 0x58, 0xbb, 0xb5, 0xff, 0xff, 0x56, 0xbb, 0xb1,
-	0x5b, 0xbb, 0x85, 0x75, 0x8b, 0xbb, 0x58, 0xbb, 0xb5, 0x3c, 0xbc, 0x53,
-	0xbb, 0xb8, 0x52, 0x1b, 0xbb, 0xbb, 0x15, 0xbb, 0xbb, 0xb8, 0x53, 0x6b,
-	0xbb, 0x13, 0x58, 0xbb, 0x89, 0xbb, 0xba, 0x35, 0xab, 0xbb, 0x61, 0x00,
-	0x08, 0xbb, 0x02, 0xb5, 0x02, 0xff, 0x00, 0x00, 0x00, 0x18, 0xf5, 0xbb,
-	0xb8, 0x56, 0xbb, 0xb0, 0x1b, 0xbb, 0x66, 0xbb, 0xbd, 0x58, 0x08, 0xbb,
-	0x02, 0xb6, 0x02, 0x5b, 0x08, 0xbb, 0x00, 0x14, 0xb1, 0x8b, 0xbb, 0x5e,
-	0x58, 0xbb, 0xb1, 0xbb, 0xb6, 0x58, 0x08, 0xbb, 0x00, 0x06, 0x68, 0xbb,
-	0xb5, 0x00, 0x0a, 0xff, 0x00, 0x56, 0x58, 0xbb, 0xb5, 0xff, 0xff, 0x56,
-	0xbb, 0xba, 0x3b, 0xbb, 0x85, 0x56, 0xbb, 0xb6, 0x58, 0xbb, 0xb3, 0x1b,
-	0xbb, 0x15, 0xbb, 0xb8, 0x55, 0x9b, 0xbb, 0xbb, 0x91, 0xbb, 0xbb, 0xbb,
-	0x52, 0x0b, 0xbb, 0x9a, 0x1b, 0xbb, 0x96, 0xbb, 0xb1, 0x25, 0xbb, 0xb8,
-	0x01, 0x00, 0x08, 0xbb, 0x02, 0xb3, 0x02, 0xf0, 0x00, 0x00, 0x00, 0x4e,
-	0xf5, 0xbb, 0xb8, 0x5b, 0xbb, 0xb9, 0x1b, 0xbb, 0x99, 0xbb, 0xb1, 0x5b,
-	0xbb, 0xb6, 0x16, 0xbb, 0xb8, 0xab, 0xbb, 0x8a, 0x19, 0xbb, 0xb6, 0x8b,
-	0xbb, 0x3e, 0x58, 0xbb, 0xba, 0xbb, 0xb6, 0x58, 0xbb, 0xb1, 0xd1, 0xa1,
-	0x08, 0xbb, 0xb3, 0x00, 0x0a, 0xff, 0x00, 0x40, 0x58, 0xbb, 0xb3, 0xff,
-	0xff, 0x56, 0xbb, 0xb1, 0x5b, 0xbb, 0x85, 0x0b, 0xbb, 0x85, 0x58, 0xbb,
-	0xb5, 0x8b, 0xbb, 0x85, 0xbb, 0xbc, 0x55, 0x8b, 0xbb, 0xbb, 0x86, 0xbb,
-	0xbb, 0xbb, 0x12, 0x5b, 0x08, 0xbb, 0x00, 0x1a, 0x66, 0xbb, 0xb1, 0x59,
-	0xbb, 0xba, 0x3a, 0xbb, 0xbc, 0x1d, 0x1a, 0x15, 0xff, 0x00, 0x00, 0x00,
-	0x00, 0x98, 0xf3, 0xbb, 0xb8, 0x9b, 0xbb, 0xbb, 0x6b, 0xbb, 0x61, 0xbb,
-	0xba, 0x56, 0x69, 0x65, 0x16, 0xbb, 0xb8, 0x1b, 0xbb, 0x65, 0x3a, 0xbb,
-	0xb6, 0x8b, 0xbb, 0x55, 0x58, 0xbb, 0xb1, 0xbb, 0xb6, 0x58, 0xbb, 0xb5,
-	0x55, 0x53, 0x58, 0xbb, 0xb5, 0x55, 0x55, 0x5f, 0xff, 0xff, 0x58, 0xbb,
-	0xb5, 0x55, 0x53, 0x56, 0xbb, 0xb1, 0x3b, 0xbb, 0xbc, 0x8b, 0xbb, 0xc5,
-	0x5c, 0xbb, 0xb6, 0xbb, 0xbb, 0xb6, 0xbb, 0xb8, 0x53, 0xbb, 0xb8, 0xbb,
-	0xbb, 0xbb, 0x8b, 0xbb, 0x65, 0x5c, 0x08, 0xbb, 0x00, 0x1a, 0x16, 0xbb,
-	0xb8, 0x8b, 0xbb, 0xb0, 0x51, 0xbb, 0xb6, 0x55, 0x55, 0x5f, 0xf0, 0x00,
-	0x00, 0x00, 0x02, 0xf5, 0x0e, 0xbb, 0x00, 0x20, 0x69, 0xbb, 0xb1, 0x35,
-	0x6c, 0x8b, 0xbb, 0xbb, 0xb6, 0x1b, 0xbb, 0x65, 0xe0, 0x1a, 0x10, 0x8b,
-	0x08, 0xbb, 0x00, 0x08, 0xba, 0xbb, 0xb6, 0x58, 0x08, 0xbb, 0x02, 0x5c,
-	0x08, 0xbb, 0x00, 0x08, 0x3f, 0xff, 0xff, 0x5c, 0x08, 0xbb, 0x00, 0x08,
-	0x56, 0xbb, 0xba, 0x5b, 0x08, 0xbb, 0x02, 0xb9, 0x02, 0x58, 0x0c, 0xbb,
-	0x00, 0x20, 0xb8, 0x51, 0xbb, 0xb6, 0xbb, 0xbb, 0xbb, 0x6b, 0xbb, 0xc5,
-	0x56, 0xbb, 0xb6, 0x8b, 0xbb, 0x56, 0x0a, 0xbb, 0x02, 0x0a, 0x08, 0xbb,
-	0x02, 0x65, 0x02, 0xff, 0x00, 0x00, 0x00, 0x30, 0xf5, 0xbb, 0xbb, 0xbb,
-	0x86, 0xbb, 0xbb, 0xbb, 0x66, 0xbb, 0xbd, 0x58, 0xbb, 0xbb, 0xbb, 0x8c,
-	0x65, 0x1b, 0xbb, 0x65, 0x75, 0x35, 0x55, 0x8b, 0x08, 0xbb, 0x00, 0x08,
-	0xb1, 0xbb, 0xb6, 0x58, 0x08, 0xbb, 0x02, 0x58, 0x08, 0xbb, 0x00, 0x08,
-	0x5f, 0xff, 0xff, 0x58, 0x08, 0xbb, 0x00, 0x4c, 0x56, 0xbb, 0xb1, 0x3b,
-	0xbb, 0xb8, 0x88, 0x8b, 0xb8, 0x58, 0xbb, 0xbb, 0xbb, 0x1b, 0xbb, 0xbb,
-	0xb8, 0x56, 0xbb, 0xb0, 0x8b, 0xbb, 0xbb, 0x08, 0xbb, 0xb3, 0x20, 0xbb,
-	0xb6, 0xbb, 0xbc, 0x56, 0xbb, 0xb8, 0x88, 0x8b, 0xbb, 0xd1, 0x08, 0xbb,
-	0x02, 0x63, 0x02, 0xf0, 0x00, 0x00, 0x00, 0xba, 0xf5, 0xbb, 0xbb, 0xbb,
-	0x65, 0x8b, 0xbb, 0xbb, 0x66, 0xbb, 0xb1, 0x5b, 0xbb, 0x81, 0x10, 0x66,
-	0x6a, 0x1b, 0xbb, 0x65, 0x51, 0xbb, 0xb6, 0x8b, 0xbb, 0x1a, 0x18, 0xbb,
-	0xb1, 0xbb, 0xb6, 0x58, 0xbb, 0xb1, 0x11, 0x11, 0x58, 0xbb, 0xb1, 0x11,
-	0x11, 0x5f, 0xff, 0xff, 0x58, 0xbb, 0xb1, 0x11, 0x11, 0x56, 0xbb, 0xb1,
-	0x5b, 0xbb, 0xc5, 0x55, 0x1b, 0xb8, 0x58, 0xbb, 0xbb, 0xbc, 0x59, 0xbb,
-	0xbb, 0xb8, 0x58, 0xbb, 0xb5, 0x6b, 0xbb, 0xbb, 0x59, 0xbb, 0xb1, 0x25,
-	0xbb, 0xb8, 0xbb, 0xb6, 0x56, 0xbb, 0xb1, 0x55, 0x58, 0xbb, 0x1a, 0xbb,
-	0xbc, 0x11, 0x11, 0x02, 0xff, 0x00, 0x00, 0x00, 0x00, 0xba, 0xf5, 0xbb,
-	0xbb, 0xb8, 0x53, 0x1b, 0xbb, 0xbb, 0x69, 0xbb, 0xba, 0x5b, 0xbb, 0xb6,
-	0x6c, 0xbb, 0xb6, 0x0b, 0xbb, 0x86, 0x6c, 0xbb, 0xb6, 0x8b, 0xbb, 0x33,
-	0x5c, 0xbb, 0xba, 0xbb, 0xb6, 0x58, 0xbb, 0xb6, 0x66, 0x66, 0x18, 0xbb,
-	0xb6, 0x66, 0x66, 0x12, 0xff, 0xff, 0x58, 0xbb, 0xb6, 0x66, 0x66, 0x16,
-	0xbb, 0xba, 0x5b, 0xbb, 0xb8, 0xc8, 0x8b, 0xb8, 0x58, 0xbb, 0xbb, 0xb5,
-	0x25, 0xbb, 0xbb, 0xbc, 0x5b, 0xbb, 0x85, 0x1b, 0xbb, 0xbc, 0x5a, 0xbb,
-	0xb6, 0x55, 0x8b, 0xbb, 0xbb, 0xb0, 0x56, 0xbb, 0xb8, 0x88, 0x8b, 0xbb,
-	0x11, 0xbb, 0xb8, 0x66, 0x66, 0x65, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x18,
-	0xf5, 0xbb, 0xbb, 0xb1, 0x2f, 0x5c, 0xbb, 0xbb, 0x61, 0xbb, 0xb1, 0x36,
-	0x08, 0xbb, 0x02, 0x85, 0x02, 0x58, 0x08, 0xbb, 0x00, 0x14, 0xb5, 0x8b,
-	0xbb, 0x57, 0x58, 0xbb, 0xb1, 0xbb, 0xb6, 0x58, 0x08, 0xbb, 0x02, 0x68,
-	0x08, 0xbb, 0x00, 0x08, 0x65, 0xff, 0xff, 0x58, 0x08, 0xbb, 0x00, 0x08,
-	0x96, 0xbb, 0xb1, 0x3b, 0x08, 0xbb, 0x00, 0x30, 0xb9, 0x58, 0xbb, 0xbb,
-	0x65, 0x75, 0x6b, 0xbb, 0xb8, 0x1b, 0xbb, 0x65, 0x3b, 0xbb, 0xb6, 0x50,
-	0xbb, 0xbc, 0x53, 0x6b, 0xbb, 0xbb, 0xb5, 0x36, 0x0a, 0xbb, 0x02, 0x0a,
-	0x08, 0xbb, 0x02, 0xb5, 0x02, 0xff, 0x00, 0x00, 0x00, 0xba, 0xf5, 0x8c,
-	0x88, 0x65, 0xff, 0x20, 0xc8, 0xc8, 0x66, 0xc8, 0x80, 0x23, 0x1c, 0xc8,
-	0x8c, 0x86, 0x03, 0x35, 0x6c, 0x8c, 0x88, 0x89, 0x05, 0x98, 0x88, 0x57,
-	0x59, 0x88, 0x80, 0x88, 0x86, 0x59, 0x88, 0x8c, 0x88, 0xc8, 0x69, 0xc8,
-	0x8c, 0x88, 0xc8, 0x63, 0xff, 0xff, 0x56, 0x88, 0xc8, 0x8c, 0x88, 0x16,
-	0x88, 0x80, 0x58, 0x8c, 0x88, 0x88, 0x88, 0x60, 0x59, 0x88, 0x8c, 0x57,
-	0x7e, 0x5c, 0x88, 0x89, 0x68, 0x88, 0x03, 0x59, 0x88, 0x80, 0x25, 0x98,
-	0x89, 0x52, 0x1c, 0x88, 0xc8, 0x95, 0x36, 0x88, 0xc8, 0x8c, 0x88, 0xc1,
-	0x50, 0x8c, 0x88, 0xc8, 0x8c, 0x85, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x40,
-	0xf3, 0x55, 0x55, 0x5f, 0xff, 0xf3, 0x55, 0x55, 0x33, 0x55, 0x53, 0xff,
-	0x35, 0x55, 0x55, 0x55, 0xff, 0xff, 0x35, 0x55, 0x53, 0x55, 0x7e, 0x55,
-	0x55, 0x3f, 0x25, 0x53, 0x53, 0x55, 0x53, 0x73, 0x08, 0x55, 0x02, 0x35,
-	0x08, 0x55, 0x00, 0x08, 0x3f, 0xff, 0xff, 0x25, 0x08, 0x55, 0x00, 0x40,
-	0x33, 0x53, 0x53, 0x33, 0x55, 0x55, 0x53, 0x55, 0x57, 0x23, 0x55, 0x55,
-	0x37, 0x77, 0x25, 0x55, 0x35, 0x35, 0x35, 0x3e, 0x75, 0x53, 0x53, 0xf2,
-	0x55, 0x55, 0x2f, 0x35, 0x55, 0x55, 0x52, 0xf3, 0x08, 0x55, 0x02, 0x52,
-	0x02, 0xf3, 0x08, 0x55, 0x02, 0x53, 0x02, 0xff, 0x00, 0x00, 0x26, 0xff,
-	0x00, 0x1c, 0xf7, 0xf7, 0x77, 0x77, 0xff, 0xff, 0xf7, 0x77, 0xee, 0xee,
-	0xe7, 0x77, 0x77, 0x7f, 0x1e, 0xff, 0x00, 0x30, 0xf7, 0x77, 0x77, 0x77,
-	0xee, 0x7e, 0x77, 0x77, 0x7f, 0xff, 0x7e, 0x7f, 0xf7, 0x77, 0x77, 0x77,
-	0xf7, 0x77, 0x77, 0x7f, 0x77, 0x77, 0x7e, 0xef, 0x28, 0xff, 0x02, 0xf0,
-	0x00, 0x00, 0x34, 0xff, 0x00, 0x08, 0x7e, 0xee, 0xee, 0x77, 0x2a, 0xff,
-	0x00, 0x10, 0xf7, 0x77, 0x7e, 0x7e, 0x77, 0x77, 0xf7, 0x7f, 0x18, 0xff,
-	0x02, 0x7f, 0x2a, 0xff, 0x00, 0x00, 0x02, 0xff, 0x0a, 0x55, 0x02, 0x52,
-	0x0a, 0xff, 0x02, 0x25, 0x0a, 0x55, 0x02, 0xff, 0x02, 0xf3, 0x0a, 0x55,
-	0x00, 0x0c, 0x3f, 0x77, 0xe7, 0xee, 0x7f, 0x35, 0x0a, 0x55, 0x0a, 0xff,
-	0x02, 0x25, 0x12, 0x55, 0x02, 0x2f, 0x0a, 0x77, 0x00, 0x08, 0x7f, 0xff,
-	0x22, 0x35, 0x10, 0x55, 0x02, 0x53, 0x02, 0x22, 0x0c, 0xff, 0x02, 0xf2,
-	0x02, 0x23, 0x12, 0x55, 0x00, 0x0a, 0x32, 0x2f, 0xff, 0xff, 0xf0, 0x00,
-	0x00, 0x00, 0x02, 0xff, 0x0a, 0x55, 0x02, 0x53, 0x0a, 0xff, 0x02, 0x35,
-	0x0a, 0x55, 0x02, 0xff, 0x02, 0xf5, 0x0a, 0x55, 0x00, 0x0c, 0x5f, 0x77,
-	0xee, 0x77, 0xff, 0x35, 0x0a, 0x55, 0x0a, 0xff, 0x02, 0x35, 0x12, 0x55,
-	0x02, 0x3f, 0x0a, 0x77, 0x02, 0x7f, 0x02, 0xf3, 0x18, 0x55, 0x02, 0x3f,
-	0x0a, 0xff, 0x02, 0x35, 0x16, 0x55, 0x00, 0x08, 0x53, 0xff, 0xff, 0xff,
-	0x00, 0x00, 0x02, 0xff, 0x0a, 0x55, 0x02, 0x53, 0x0a, 0xff, 0x02, 0x35,
-	0x0a, 0x55, 0x02, 0xff, 0x02, 0xf3, 0x0a, 0x55, 0x00, 0x0a, 0x5f, 0x27,
-	0x77, 0x77, 0x7f, 0x00, 0x0c, 0x55, 0x0a, 0xff, 0x14, 0x55, 0x00, 0x0e,
-	0x5f, 0x77, 0x77, 0x77, 0xe7, 0x7f, 0xf2, 0x00, 0x1c, 0x55, 0x00, 0x0a,
-	0x2f, 0xff, 0xff, 0xff, 0x25, 0x00, 0x1a, 0x55, 0x00, 0x06, 0x52, 0xff,
-	0xf0, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xff, 0x55, 0x44, 0x44, 0x44, 0x45,
-	0x53, 0x00, 0x0a, 0xff, 0x00, 0x10, 0x35, 0x54, 0x44, 0x44, 0x45, 0x54,
-	0xff, 0xf2, 0x08, 0x44, 0x00, 0x18, 0x55, 0x52, 0xf7, 0xf7, 0x77, 0xff,
-	0x55, 0x54, 0x44, 0x44, 0x45, 0x42, 0x08, 0xff, 0x00, 0x06, 0xf2, 0x55,
-	0x54, 0x00, 0x0e, 0x44, 0x00, 0x16, 0x55, 0x5f, 0xf7, 0x77, 0x77, 0xe7,
-	0x7f, 0x25, 0x55, 0x55, 0x54, 0x00, 0x10, 0x44, 0x00, 0x14, 0x45, 0x55,
-	0x55, 0x52, 0xff, 0xff, 0xf2, 0x55, 0x55, 0x55, 0x12, 0x44, 0x00, 0x0a,
-	0x55, 0x55, 0x55, 0x2f, 0xff, 0x00, 0x00, 0x00, 0x02, 0xff, 0x02, 0x55,
-	0x08, 0x44, 0x02, 0x53, 0x0a, 0xff, 0x00, 0x26, 0x24, 0x54, 0x44, 0x44,
-	0x44, 0x55, 0xff, 0xff, 0x45, 0x44, 0x44, 0x44, 0x45, 0x52, 0xff, 0xff,
-	0xff, 0xf2, 0x55, 0x00, 0x08, 0x44, 0x02, 0x42, 0x08, 0xff, 0x00, 0x06,
-	0xf2, 0x55, 0x54, 0x00, 0x0e, 0x44, 0x00, 0x12, 0x55, 0x52, 0xf7, 0x77,
-	0x77, 0x77, 0xff, 0x55, 0x53, 0x00, 0x16, 0x44, 0x00, 0x10, 0x45, 0x55,
-	0x55, 0xff, 0xff, 0xf5, 0x55, 0x34, 0x16, 0x44, 0x00, 0x08, 0x55, 0x55,
-	0x5f, 0xf0, 0x00, 0x00, 0x00, 0x0e, 0xff, 0x45, 0x54, 0x44, 0x44, 0x45,
-	0x53, 0x00, 0x0a, 0xff, 0x00, 0x30, 0x35, 0x54, 0x44, 0x44, 0x44, 0x55,
-	0xff, 0xff, 0x54, 0x44, 0x44, 0x44, 0x55, 0x53, 0x22, 0x22, 0x22, 0x23,
-	0x55, 0x54, 0x44, 0x44, 0x44, 0x5f, 0x08, 0xff, 0x02, 0xf3, 0x02, 0x55,
-	0x10, 0x44, 0x00, 0x12, 0x55, 0x53, 0xff, 0xf7, 0x77, 0x7f, 0xf2, 0x55,
-	0x54, 0x00, 0x18, 0x44, 0x00, 0x0c, 0x45, 0x55, 0x2f, 0xff, 0x25, 0x55,
-	0x1a, 0x44, 0x00, 0x06, 0x55, 0x52, 0xff, 0x00, 0x00, 0x00, 0x00, 0x0e,
-	0xff, 0x55, 0x44, 0x44, 0x44, 0x45, 0x42, 0x00, 0x0a, 0xff, 0x00, 0x1a,
-	0x35, 0x54, 0x44, 0x44, 0x44, 0x55, 0xff, 0xff, 0x34, 0x44, 0x44, 0x44,
-	0x45, 0x00, 0x0c, 0x55, 0x00, 0x16, 0x44, 0x44, 0x44, 0x45, 0x5f, 0x77,
-	0xff, 0xff, 0xff, 0xf5, 0x55, 0x00, 0x10, 0x44, 0x00, 0x12, 0x45, 0x53,
-	0xff, 0x77, 0x77, 0xf7, 0xf3, 0x55, 0x54, 0x00, 0x18, 0x44, 0x00, 0x0c,
-	0x45, 0x55, 0x5f, 0xff, 0x35, 0x55, 0x1a, 0x44, 0x00, 0x06, 0x55, 0x55,
-	0xf0, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xff, 0x55, 0x44, 0x44, 0x44, 0x45,
-	0x53, 0x00, 0x0a, 0xff, 0x00, 0x1a, 0x35, 0x44, 0x44, 0x44, 0x45, 0x54,
-	0xff, 0xff, 0x24, 0x54, 0x44, 0x44, 0x45, 0x00, 0x0c, 0x55, 0x08, 0x44,
-	0x00, 0x0e, 0x3f, 0x77, 0x7f, 0xff, 0xff, 0x25, 0x55, 0x00, 0x10, 0x44,
-	0x00, 0x10, 0x45, 0x55, 0xf7, 0xe7, 0xff, 0x77, 0xf5, 0x55, 0x0a, 0x44,
-	0x00, 0x08, 0x55, 0x35, 0x53, 0x55, 0x0a, 0x44, 0x00, 0x0a, 0x55, 0x5f,
-	0xff, 0x55, 0x54, 0x00, 0x08, 0x44, 0x00, 0x0a, 0x45, 0x35, 0x53, 0x55,
-	0x34, 0x00, 0x08, 0x44, 0x00, 0x06, 0x45, 0x55, 0xff, 0x00, 0x00, 0x00,
-	0x00, 0x0e, 0xff, 0x55, 0x44, 0x44, 0x44, 0x45, 0x53, 0x00, 0x0a, 0xff,
-	0x00, 0x12, 0x35, 0x54, 0x44, 0x44, 0x44, 0x55, 0xff, 0xff, 0xf4, 0x00,
-	0x08, 0x44, 0x02, 0x45, 0x08, 0x55, 0x08, 0x44, 0x00, 0x10, 0x54, 0x2f,
-	0x77, 0x77, 0xff, 0xff, 0x25, 0x55, 0x12, 0x44, 0x00, 0x0e, 0x55, 0x2f,
-	0x77, 0x77, 0xe7, 0xf5, 0x54, 0x00, 0x08, 0x44, 0x02, 0x42, 0x08, 0xff,
-	0x02, 0x24, 0x08, 0x44, 0x00, 0x08, 0x45, 0x5f, 0xff, 0x55, 0x0a, 0x44,
-	0x00, 0x0a, 0x2f, 0xff, 0xff, 0xff, 0xf2, 0x00, 0x0a, 0x44, 0x02, 0x55,
-	0x02, 0xf0, 0x00, 0x00, 0x00, 0x0e, 0xff, 0x45, 0x54, 0x44, 0x44, 0x44,
-	0x53, 0x00, 0x0a, 0xff, 0x00, 0x12, 0x34, 0x54, 0x44, 0x44, 0x44, 0x55,
-	0xff, 0xff, 0xf5, 0x00, 0x1c, 0x44, 0x00, 0x0e, 0xf7, 0x77, 0x77, 0xff,
-	0xff, 0x35, 0x54, 0x00, 0x10, 0x44, 0x00, 0x3e, 0x45, 0x55, 0x3f, 0xf7,
-	0x7e, 0xe7, 0xf4, 0x55, 0x44, 0x44, 0x44, 0x45, 0x4f, 0x7e, 0xee, 0xdd,
-	0xd7, 0xf4, 0x54, 0x44, 0x44, 0x44, 0x45, 0x5f, 0xff, 0x45, 0x54, 0x44,
-	0x44, 0x44, 0x54, 0x00, 0x0a, 0xff, 0x02, 0x45, 0x08, 0x44, 0x02, 0x55,
-	0x02, 0xff, 0x00, 0x00, 0x00, 0x0e, 0xff, 0x55, 0x44, 0x44, 0x44, 0x45,
-	0x53, 0x00, 0x0a, 0xff, 0x00, 0x12, 0x35, 0x54, 0x44, 0x44, 0x44, 0x55,
-	0xff, 0xff, 0xf3, 0x00, 0x1a, 0x44, 0x00, 0x10, 0x55, 0xf7, 0xe7, 0x7e,
-	0x77, 0xff, 0x55, 0x54, 0x12, 0x44, 0x00, 0x32, 0x55, 0x5f, 0xf7, 0xee,
-	0xe7, 0xf5, 0x54, 0x44, 0x44, 0x44, 0x45, 0x5f, 0x7d, 0xda, 0xaa, 0xae,
-	0xf5, 0x54, 0x44, 0x44, 0x44, 0x45, 0x5f, 0xff, 0x55, 0x00, 0x08, 0x44,
-	0x02, 0x55, 0x0a, 0xff, 0x02, 0x54, 0x08, 0x44, 0x02, 0x54, 0x02, 0xf0,
-	0x00, 0x00, 0x00, 0x0e, 0xff, 0x55, 0x44, 0x44, 0x44, 0x45, 0x52, 0x00,
-	0x0a, 0xff, 0x00, 0x14, 0x25, 0x54, 0x44, 0x44, 0x45, 0x54, 0xff, 0xff,
-	0xf3, 0x45, 0x18, 0x44, 0x00, 0x10, 0x43, 0xf7, 0x77, 0xe7, 0x77, 0xf2,
-	0x55, 0x54, 0x08, 0x44, 0x02, 0x54, 0x08, 0x44, 0x00, 0x3c, 0x55, 0x5f,
-	0x7e, 0xee, 0xe7, 0xf5, 0x54, 0x44, 0x44, 0x44, 0x55, 0x4f, 0x7d, 0xaa,
-	0xaa, 0xae, 0xf5, 0x54, 0x44, 0x44, 0x44, 0x55, 0x4f, 0xff, 0x55, 0x44,
-	0x44, 0x44, 0x45, 0x54, 0x0a, 0xff, 0x02, 0x54, 0x08, 0x44, 0x02, 0x45,
-	0x02, 0xff, 0x00, 0x00, 0x00, 0x0e, 0xff, 0x55, 0x44, 0x44, 0x44, 0x55,
-	0x53, 0x00, 0x0a, 0x22, 0x00, 0x12, 0x35, 0x55, 0x44, 0x44, 0x44, 0x55,
-	0xff, 0xff, 0xff, 0x00, 0x18, 0x44, 0x00, 0x1c, 0x45, 0x42, 0xf7, 0x7e,
-	0x77, 0x77, 0xf2, 0x55, 0x54, 0x44, 0x44, 0x44, 0x45, 0xf4, 0x08, 0x44,
-	0x00, 0x32, 0x55, 0x52, 0xfe, 0x7e, 0xe7, 0xf5, 0x54, 0x44, 0x44, 0x44,
-	0x45, 0x5f, 0xed, 0xaa, 0x6a, 0xae, 0xf5, 0x54, 0x44, 0x44, 0x44, 0x45,
-	0x5f, 0xff, 0x55, 0x00, 0x08, 0x44, 0x02, 0x55, 0x0a, 0xff, 0x0c, 0x44,
-	0x02, 0xf0, 0x00, 0x00, 0x00, 0x0c, 0xff, 0x45, 0x54, 0x44, 0x44, 0x45,
-	0x0e, 0x55, 0x00, 0x22, 0x54, 0x44, 0x44, 0x44, 0x55, 0xff, 0xff, 0xff,
-	0x55, 0x44, 0x44, 0x44, 0x45, 0x45, 0xff, 0xf5, 0x45, 0x00, 0x08, 0x44,
-	0x00, 0x0e, 0x4f, 0x77, 0x77, 0x77, 0xe7, 0xf3, 0x55, 0x00, 0x08, 0x44,
-	0x02, 0x45, 0x02, 0xf5, 0x08, 0x44, 0x00, 0x3c, 0x55, 0x53, 0xf7, 0xee,
-	0xe7, 0xf4, 0x55, 0x44, 0x44, 0x44, 0x45, 0x5f, 0xea, 0x66, 0x66, 0xae,
-	0xf4, 0x55, 0x44, 0x44, 0x44, 0x45, 0x5f, 0xff, 0x45, 0x54, 0x44, 0x44,
-	0x44, 0x55, 0x0a, 0xff, 0x0c, 0x45, 0x02, 0xf0, 0x00, 0x00, 0x00, 0x0c,
-	0xff, 0x55, 0x44, 0x44, 0x44, 0x45, 0x0e, 0x55, 0x00, 0x22, 0x54, 0x44,
-	0x44, 0x44, 0x55, 0xff, 0xff, 0xff, 0x54, 0x44, 0x44, 0x44, 0x45, 0x55,
-	0xff, 0xf3, 0x55, 0x00, 0x08, 0x44, 0x00, 0x1a, 0x5f, 0x77, 0x7e, 0x7e,
-	0x77, 0xf5, 0x55, 0x44, 0x44, 0x44, 0x45, 0x43, 0xf3, 0x00, 0x08, 0x44,
-	0x00, 0x3c, 0x45, 0x53, 0xf7, 0xee, 0xe7, 0xf5, 0x54, 0x44, 0x44, 0x44,
-	0x54, 0x5f, 0xea, 0xaa, 0x69, 0xad, 0xf5, 0x54, 0x44, 0x44, 0x44, 0x45,
-	0x5f, 0xff, 0x55, 0x44, 0x44, 0x44, 0x45, 0x45, 0x16, 0xff, 0x02, 0xf0,
-	0x00, 0x00, 0x02, 0xff, 0x02, 0x55, 0x08, 0x44, 0x02, 0x45, 0x0a, 0x55,
-	0x00, 0x24, 0x54, 0x44, 0x44, 0x44, 0x45, 0x54, 0xff, 0xff, 0xff, 0x34,
-	0x54, 0x44, 0x44, 0x45, 0x55, 0xff, 0xf5, 0x55, 0x08, 0x44, 0x00, 0x0e,
-	0x3f, 0x7e, 0x77, 0xee, 0x7f, 0x25, 0x55, 0x00, 0x08, 0x44, 0x00, 0x3e,
-	0x42, 0xf2, 0x45, 0x44, 0x44, 0x44, 0x45, 0x55, 0xf7, 0xee, 0xd7, 0xf5,
-	0x54, 0x44, 0x44, 0x44, 0x45, 0x52, 0xe6, 0x66, 0x69, 0x6e, 0xf5, 0x54,
-	0x44, 0x44, 0x44, 0x55, 0x4f, 0xff, 0x55, 0x00, 0x08, 0x44, 0x02, 0x55,
-	0x16, 0xff, 0x02, 0xf0, 0x00, 0x00, 0x02, 0xff, 0x02, 0x55, 0x1e, 0x44,
-	0x00, 0x0a, 0x55, 0xff, 0xff, 0xff, 0x24, 0x00, 0x08, 0x44, 0x00, 0x1e,
-	0x55, 0x2f, 0x25, 0x55, 0x44, 0x44, 0x44, 0x54, 0x2f, 0x77, 0xee, 0x77,
-	0xff, 0x25, 0x55, 0x00, 0x08, 0x44, 0x02, 0x5f, 0x02, 0xff, 0x0a, 0x44,
-	0x00, 0x30, 0x55, 0x2f, 0xee, 0xd7, 0xf5, 0x54, 0x44, 0x44, 0x44, 0x45,
-	0x5f, 0xe9, 0x69, 0x99, 0x6d, 0xf5, 0x45, 0x44, 0x44, 0x44, 0x45, 0x5f,
-	0xff, 0x55, 0x08, 0x44, 0x02, 0x55, 0x16, 0xff, 0x02, 0xf0, 0x00, 0x00,
-	0x00, 0x06, 0xff, 0x45, 0x54, 0x00, 0x1c, 0x44, 0x00, 0x1a, 0x55, 0xff,
-	0xff, 0xff, 0xf5, 0x44, 0x44, 0x44, 0x45, 0x55, 0x2f, 0x25, 0x54, 0x00,
-	0x08, 0x44, 0x00, 0x0e, 0xf7, 0x7e, 0x7e, 0xe7, 0xff, 0x35, 0x54, 0x00,
-	0x08, 0x44, 0x00, 0x48, 0x5f, 0xff, 0x54, 0x44, 0x44, 0x44, 0x45, 0x55,
-	0x3f, 0xed, 0xde, 0xf4, 0x55, 0x44, 0x44, 0x44, 0x54, 0x5f, 0xe6, 0x96,
-	0x69, 0x9e, 0xf5, 0x54, 0x44, 0x44, 0x44, 0x45, 0x5f, 0xff, 0x45, 0x54,
-	0x44, 0x44, 0x45, 0x45, 0x16, 0xff, 0x02, 0xf0, 0x00, 0x00, 0x02, 0xff,
-	0x02, 0x55, 0x1c, 0x44, 0x00, 0x40, 0x45, 0x45, 0xff, 0xff, 0xff, 0xf5,
-	0x45, 0x44, 0x44, 0x44, 0x55, 0x3f, 0x35, 0x55, 0x44, 0x44, 0x44, 0x55,
-	0xf7, 0xe7, 0xee, 0x7f, 0xff, 0x55, 0x54, 0x44, 0x44, 0x44, 0x54, 0x3f,
-	0xff, 0x34, 0x08, 0x44, 0x00, 0x30, 0x55, 0x5f, 0x7d, 0xd7, 0xf5, 0x54,
-	0x44, 0x44, 0x44, 0x45, 0x5f, 0xd9, 0x99, 0x99, 0x6e, 0xf5, 0x54, 0x44,
-	0x44, 0x44, 0x45, 0x5f, 0xff, 0x55, 0x08, 0x44, 0x02, 0x55, 0x0a, 0xff,
-	0x00, 0x0e, 0xf2, 0x2f, 0x22, 0x2f, 0x2f, 0x2f, 0xf0, 0x00, 0x00, 0x00,
-	0x02, 0xff, 0x02, 0x55, 0x1e, 0x44, 0x00, 0x30, 0x55, 0xff, 0xff, 0xff,
-	0xf3, 0x54, 0x44, 0x44, 0x44, 0x55, 0x5f, 0x35, 0x54, 0x44, 0x44, 0x44,
-	0x43, 0xf7, 0x7e, 0xee, 0x7f, 0xf2, 0x55, 0x54, 0x08, 0x44, 0x00, 0x48,
-	0x2f, 0xff, 0x24, 0x54, 0x44, 0x44, 0x44, 0x55, 0x5f, 0x7d, 0xde, 0xf5,
-	0x54, 0x44, 0x44, 0x44, 0x55, 0x5f, 0xd9, 0x99, 0x96, 0xce, 0xf5, 0x45,
-	0x44, 0x44, 0x44, 0x45, 0x4f, 0xff, 0x55, 0x44, 0x44, 0x44, 0x45, 0x55,
-	0x0a, 0xff, 0x0c, 0x55, 0x02, 0xfb, 0x00, 0x00, 0x00, 0x0e, 0xff, 0x54,
-	0x54, 0x44, 0x44, 0x44, 0x45, 0x00, 0x0a, 0xff, 0x02, 0x54, 0x08, 0x44,
-	0x00, 0x0a, 0x55, 0xff, 0xff, 0xff, 0xf2, 0x00, 0x08, 0x44, 0x00, 0x1c,
-	0x55, 0x52, 0x55, 0x54, 0x44, 0x44, 0x45, 0x43, 0xf7, 0x77, 0xe7, 0xff,
-	0xf2, 0x55, 0x08, 0x44, 0x00, 0x08, 0x45, 0xff, 0xff, 0xf4, 0x08, 0x44,
-	0x00, 0x0c, 0x55, 0x52, 0xfd, 0xde, 0xf5, 0x45, 0x08, 0x44, 0x00, 0x26,
-	0x5f, 0xd9, 0x99, 0x99, 0x6d, 0xf5, 0x54, 0x44, 0x44, 0x44, 0x55, 0x5f,
-	0xff, 0x54, 0x54, 0x44, 0x44, 0x44, 0x45, 0x00, 0x0a, 0xff, 0x0c, 0x55,
-	0x02, 0xf0, 0x00, 0x00, 0x00, 0x0e, 0xff, 0x55, 0x44, 0x44, 0x44, 0x45,
-	0x53, 0x00, 0x0a, 0xff, 0x00, 0x0c, 0x35, 0x54, 0x44, 0x44, 0x45, 0x45,
-	0x08, 0xff, 0x08, 0x44, 0x00, 0x2c, 0x55, 0x52, 0x55, 0x54, 0x44, 0x44,
-	0x44, 0x4f, 0xf7, 0x77, 0x77, 0x7f, 0xf3, 0x55, 0x54, 0x44, 0x44, 0x44,
-	0x45, 0xff, 0xff, 0xf5, 0x08, 0x44, 0x00, 0x3a, 0x55, 0x53, 0xfe, 0xde,
-	0x25, 0x54, 0x44, 0x44, 0x44, 0x55, 0x5f, 0xd9, 0xc9, 0xc9, 0x9e, 0xf5,
-	0x55, 0x44, 0x44, 0x44, 0x45, 0x5f, 0xf2, 0x55, 0x44, 0x44, 0x44, 0x45,
-	0x55, 0x00, 0x0a, 0xff, 0x0c, 0x55, 0x02, 0xf0, 0x00, 0x00, 0x00, 0x0e,
-	0xff, 0x55, 0x44, 0x44, 0x44, 0x45, 0x42, 0x00, 0x0a, 0xff, 0x02, 0x35,
-	0x08, 0x44, 0x02, 0x55, 0x08, 0xff, 0x00, 0x18, 0x55, 0x44, 0x44, 0x44,
-	0x45, 0x55, 0x55, 0x54, 0x44, 0x44, 0x44, 0x5f, 0x08, 0x77, 0x00, 0x14,
-	0xf5, 0x55, 0x44, 0x44, 0x44, 0x45, 0x43, 0xfe, 0x77, 0xf3, 0x08, 0x44,
-	0x00, 0x30, 0x45, 0x53, 0xfe, 0xae, 0xf5, 0x54, 0x44, 0x44, 0x44, 0x45,
-	0x5f, 0xfd, 0xdd, 0xdd, 0xdf, 0xf5, 0x54, 0x44, 0x44, 0x44, 0x45, 0x4f,
-	0xff, 0x55, 0x08, 0x44, 0x02, 0x55, 0x0a, 0xff, 0x02, 0x55, 0x08, 0x44,
-	0x02, 0x54, 0x02, 0xf0, 0x00, 0x00, 0x00, 0x0e, 0xff, 0x54, 0x54, 0x44,
-	0x44, 0x45, 0x53, 0x00, 0x0a, 0xff, 0x00, 0x0c, 0x35, 0x54, 0x44, 0x44,
-	0x44, 0x55, 0x08, 0xff, 0x00, 0x0e, 0x34, 0x44, 0x44, 0x44, 0x45, 0x55,
-	0x55, 0x00, 0x08, 0x44, 0x00, 0x0e, 0x3f, 0x77, 0x77, 0x7e, 0x7f, 0x25,
-	0x55, 0x00, 0x08, 0x44, 0x00, 0x1a, 0x42, 0xf7, 0xe7, 0xf2, 0x45, 0x44,
-	0x44, 0x44, 0x45, 0x55, 0xf7, 0xae, 0xf5, 0x00, 0x08, 0x44, 0x02, 0x55,
-	0x02, 0x53, 0x08, 0xff, 0x02, 0x35, 0x02, 0x55, 0x08, 0x44, 0x00, 0x28,
-	0x5f, 0xff, 0x54, 0x44, 0x44, 0x44, 0x45, 0x55, 0x3f, 0xff, 0xff, 0xff,
-	0xf3, 0x55, 0x54, 0x44, 0x44, 0x44, 0x45, 0xf0, 0x00, 0x00, 0x00, 0x0e,
-	0xff, 0x55, 0x44, 0x44, 0x44, 0x45, 0x53, 0x00, 0x0a, 0xff, 0x00, 0x0c,
-	0x35, 0x44, 0x44, 0x44, 0x45, 0x54, 0x08, 0xff, 0x00, 0x24, 0x24, 0x54,
-	0x44, 0x44, 0x45, 0x55, 0x54, 0x44, 0x44, 0x44, 0x54, 0x2f, 0xe7, 0x77,
-	0x77, 0x7f, 0x25, 0x54, 0x08, 0x44, 0x00, 0x08, 0x5f, 0x77, 0xe7, 0xff,
-	0x0a, 0x44, 0x00, 0x08, 0x55, 0x2f, 0xde, 0xf5, 0x08, 0x44, 0x10, 0x55,
-	0x08, 0x44, 0x00, 0x0e, 0x5f, 0xff, 0x54, 0x44, 0x44, 0x44, 0x45, 0x00,
-	0x0e, 0x55, 0x00, 0x0c, 0x54, 0x44, 0x44, 0x44, 0x45, 0xf0, 0x00, 0x00,
-	0x00, 0x0e, 0xff, 0x55, 0x54, 0x44, 0x44, 0x44, 0x53, 0x00, 0x0a, 0xff,
-	0x00, 0x0c, 0x35, 0x54, 0x44, 0x44, 0x44, 0x55, 0x08, 0xff, 0x02, 0xf4,
-	0x14, 0x44, 0x00, 0x0e, 0x2f, 0x7e, 0xe7, 0x77, 0x7f, 0x35, 0x55, 0x00,
-	0x08, 0x44, 0x00, 0x1a, 0x5f, 0x77, 0x7f, 0x7f, 0x54, 0x44, 0x44, 0x44,
-	0x45, 0x55, 0x3f, 0xdd, 0x75, 0x00, 0x08, 0x44, 0x02, 0x45, 0x0c, 0x55,
-	0x02, 0x54, 0x08, 0x44, 0x00, 0x06, 0x2f, 0xff, 0x54, 0x00, 0x08, 0x44,
-	0x0e, 0x55, 0x08, 0x44, 0x02, 0x42, 0x02, 0xf0, 0x00, 0x00, 0x00, 0x0e,
-	0xff, 0x54, 0x44, 0x44, 0x44, 0x45, 0x53, 0x00, 0x0a, 0xff, 0x00, 0x0c,
-	0x35, 0x54, 0x44, 0x44, 0x44, 0x55, 0x08, 0xff, 0x02, 0xf5, 0x12, 0x44,
-	0x00, 0x22, 0x45, 0xf7, 0xee, 0xee, 0x7e, 0x7f, 0x55, 0x54, 0x44, 0x44,
-	0x44, 0x45, 0x3f, 0xee, 0x77, 0xef, 0x34, 0x00, 0x08, 0x44, 0x00, 0x0a,
-	0x55, 0x5f, 0xea, 0xdf, 0x54, 0x00, 0x08, 0x44, 0x0c, 0x55, 0x0a, 0x44,
-	0x00, 0x06, 0xff, 0xff, 0xf5, 0x00, 0x08, 0x44, 0x02, 0x45, 0x0a, 0x55,
-	0x02, 0x54, 0x08, 0x44, 0x02, 0x4f, 0x02, 0xf0, 0x00, 0x00, 0x02, 0xff,
-	0x02, 0x55, 0x08, 0x44, 0x02, 0x53, 0x0a, 0xff, 0x02, 0x35, 0x08, 0x44,
-	0x02, 0x45, 0x08, 0xff, 0x02, 0xf3, 0x12, 0x44, 0x00, 0x0e, 0x45, 0xf7,
-	0xed, 0xed, 0xe7, 0xf2, 0x55, 0x00, 0x0a, 0x44, 0x00, 0x0a, 0xf7, 0x77,
-	0xfe, 0xd7, 0x24, 0x00, 0x08, 0x44, 0x00, 0x0a, 0x45, 0x52, 0xea, 0xa7,
-	0xf4, 0x00, 0x1c, 0x44, 0x00, 0x08, 0x4f, 0xff, 0xff, 0xff, 0x1e, 0x44,
-	0x02, 0xff, 0x02, 0xf0, 0x00, 0x00, 0x02, 0xff, 0x0a, 0x44, 0x02, 0x43,
-	0x0a, 0xff, 0x02, 0x34, 0x08, 0x44, 0x02, 0x45, 0x08, 0xff, 0x02, 0xf2,
-	0x12, 0x44, 0x00, 0x0e, 0x43, 0xfe, 0xee, 0xdd, 0xe7, 0xf3, 0x54, 0x00,
-	0x0a, 0x44, 0x00, 0x0a, 0xfe, 0xe7, 0x7d, 0xde, 0xf4, 0x00, 0x0a, 0x44,
-	0x00, 0x0a, 0x52, 0x76, 0x9a, 0xff, 0x54, 0x00, 0x18, 0x44, 0x00, 0x0c,
-	0x45, 0xf7, 0xef, 0xff, 0xff, 0x25, 0x1a, 0x44, 0x00, 0x06, 0x5f, 0xff,
-	0xfb, 0x00, 0x00, 0x00, 0x02, 0xff, 0x0a, 0x44, 0x02, 0x43, 0x0a, 0xff,
-	0x02, 0x34, 0x0a, 0x44, 0x0a, 0xff, 0x12, 0x44, 0x00, 0x0c, 0x42, 0x7e,
-	0xdd, 0xdd, 0xde, 0xf5, 0x0a, 0x44, 0x00, 0x0c, 0x45, 0xfe, 0x7f, 0xea,
-	0xae, 0xf5, 0x0a, 0x44, 0x00, 0x0a, 0x45, 0xf6, 0xcc, 0x6e, 0xf3, 0x00,
-	0x18, 0x44, 0x00, 0x0e, 0x3f, 0x76, 0x9f, 0xff, 0xff, 0xff, 0x34, 0x00,
-	0x16, 0x44, 0x00, 0x08, 0x43, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x0e,
-	0xff, 0x53, 0x55, 0x35, 0x53, 0x55, 0x33, 0x00, 0x0a, 0xff, 0x00, 0x0c,
-	0x25, 0x53, 0x55, 0x35, 0x53, 0x55, 0x0a, 0xff, 0x00, 0x66, 0x35, 0x53,
-	0x55, 0x35, 0x55, 0x53, 0x55, 0x35, 0x53, 0x5f, 0xf7, 0xed, 0xad, 0xde,
-	0x73, 0x55, 0x35, 0x55, 0x53, 0x55, 0x52, 0x7e, 0x7e, 0xaa, 0xad, 0xf2,
-	0x53, 0x55, 0x35, 0x53, 0x55, 0x33, 0x7a, 0xcc, 0xc6, 0xd7, 0xf2, 0x53,
-	0x55, 0x35, 0x53, 0x55, 0x53, 0x55, 0x35, 0x53, 0x53, 0x2f, 0x7d, 0x98,
-	0xcf, 0x00, 0x08, 0xff, 0x00, 0x1e, 0x25, 0x35, 0x53, 0x55, 0x35, 0x53,
-	0x55, 0x35, 0x53, 0x55, 0x33, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00,
-	0x40, 0xff, 0x00, 0x0c, 0xf7, 0xee, 0xee, 0x7e, 0xdd, 0xe7, 0x0a, 0xff,
-	0x00, 0x0c, 0xf7, 0xd7, 0xfd, 0xaa, 0xad, 0xe7, 0x0a, 0xff, 0x00, 0x0c,
-	0xf7, 0xd6, 0x9c, 0x9c, 0xc9, 0xae, 0x14, 0xff, 0x00, 0x08, 0xea, 0xcc,
-	0x98, 0x8d, 0x24, 0xff, 0x02, 0xf0, 0x00, 0x00, 0x36, 0xff, 0x00, 0x5e,
-	0x7d, 0xed, 0xee, 0xed, 0xdd, 0xed, 0xaa, 0xad, 0xad, 0xea, 0xde, 0xed,
-	0xdd, 0xde, 0xef, 0xee, 0xaa, 0xe7, 0xfa, 0x6a, 0x6e, 0xde, 0xdd, 0xdd,
-	0xdd, 0xaa, 0xaa, 0xa6, 0x69, 0x99, 0x99, 0x99, 0xc9, 0x66, 0xaa, 0x6a,
-	0x66, 0x69, 0x96, 0x66, 0x69, 0x96, 0x69, 0xc8, 0x88, 0xc8, 0x89, 0x00,
-	0x24, 0xff, 0x02, 0xf0, 0x00, 0x00, 0x36, 0xff, 0x00, 0x3a, 0x7a, 0xd6,
-	0xea, 0xad, 0xad, 0xdd, 0xaa, 0x6d, 0xda, 0xaa, 0xad, 0xae, 0xad, 0xad,
-	0xd7, 0xdd, 0x6e, 0x7f, 0xda, 0x66, 0xdd, 0xd6, 0xa6, 0xa6, 0x6a, 0x66,
-	0x66, 0x99, 0x96, 0x00, 0x08, 0x66, 0x00, 0x1c, 0x69, 0x99, 0x99, 0xc9,
-	0x69, 0x8c, 0x9c, 0x8c, 0xcc, 0xcc, 0x88, 0xcc, 0x88, 0x8c, 0x24, 0xff,
-	0x02, 0xf0, 0x00, 0x00, 0x36, 0xff, 0x00, 0x3e, 0xfd, 0xda, 0xd6, 0x66,
-	0xaa, 0xaa, 0xa6, 0xad, 0xda, 0xad, 0xdd, 0xaa, 0xd7, 0x6d, 0xdf, 0xda,
-	0xae, 0x77, 0xa6, 0x66, 0xed, 0xaa, 0xad, 0xaa, 0x96, 0x69, 0x99, 0xc9,
-	0x6a, 0x66, 0x69, 0x00, 0x0a, 0x99, 0x00, 0x16, 0xcc, 0x88, 0xcc, 0xcc,
-	0x8c, 0x9c, 0x88, 0x88, 0x9c, 0xc8, 0x9d, 0x00, 0x24, 0xff, 0x02, 0xf0,
-	0x00, 0x00, 0x38, 0xff, 0x00, 0x3a, 0xea, 0xaa, 0x66, 0x66, 0x66, 0x6a,
-	0xda, 0x6a, 0xaa, 0xaa, 0xae, 0xed, 0xaa, 0xdf, 0xda, 0xa7, 0x7a, 0x66,
-	0x9d, 0x66, 0xc9, 0x66, 0x6a, 0x66, 0x69, 0x9c, 0x6a, 0x66, 0x66, 0x00,
-	0x0c, 0x99, 0x00, 0x16, 0xa6, 0x8c, 0xcc, 0xc8, 0x8c, 0xc8, 0xc8, 0x88,
-	0xcc, 0xc6, 0x97, 0x00, 0x24, 0xff, 0x02, 0xf0, 0x00, 0x00, 0x38, 0xff,
-	0x00, 0x5c, 0xea, 0xda, 0xa6, 0x69, 0x9a, 0xa6, 0x66, 0x6a, 0xad, 0x9a,
-	0xde, 0xaa, 0xa6, 0xdf, 0xda, 0xe7, 0xd6, 0x66, 0x66, 0x99, 0x6a, 0xa9,
-	0x96, 0x99, 0x66, 0x96, 0xa6, 0x66, 0x99, 0x99, 0x99, 0x69, 0x66, 0x69,
-	0x6c, 0x88, 0x8c, 0xcc, 0x88, 0xc9, 0x98, 0x8b, 0xc9, 0xad, 0x69, 0xcf,
-	0x24, 0xff, 0x02, 0xf0, 0x00, 0x00, 0x38, 0xff, 0x00, 0x5c, 0xfd, 0x66,
-	0x6d, 0xda, 0xa6, 0xe7, 0xea, 0xad, 0xe7, 0xda, 0x66, 0x6a, 0x66, 0xd7,
-	0xdd, 0x77, 0x66, 0x66, 0xee, 0xda, 0xaa, 0xd9, 0x96, 0xa6, 0x99, 0x6a,
-	0xa6, 0x69, 0x99, 0x99, 0x66, 0x6a, 0x99, 0xdc, 0x66, 0xb8, 0x8c, 0xcc,
-	0x8c, 0x99, 0xc8, 0xb8, 0x89, 0xa6, 0xc8, 0xaf, 0x24, 0xff, 0x02, 0xf0,
-	0x00, 0x00, 0x38, 0xff, 0x00, 0x5c, 0xf7, 0xa6, 0x96, 0x96, 0x6e, 0xee,
-	0xdd, 0xef, 0xf7, 0x7d, 0xee, 0xdd, 0xda, 0xad, 0x6e, 0x7d, 0x96, 0x6a,
-	0xea, 0x69, 0x96, 0xd6, 0x89, 0x69, 0x66, 0xa6, 0xa6, 0x99, 0x99, 0x66,
-	0x69, 0x96, 0x6c, 0xc9, 0x88, 0x88, 0x88, 0xc8, 0x88, 0x99, 0xc8, 0x8c,
-	0x88, 0x88, 0x88, 0x7f, 0x24, 0xff, 0x02, 0xf0, 0x00, 0x00, 0x3a, 0xff,
-	0x00, 0x58, 0x76, 0x69, 0x99, 0x6e, 0xfd, 0xdd, 0x7f, 0xff, 0x7f, 0xf7,
-	0xf7, 0x7e, 0xdd, 0xe7, 0xf6, 0x96, 0xae, 0x66, 0x69, 0xaa, 0x9a, 0xc8,
-	0xc9, 0x6a, 0xda, 0x69, 0x99, 0x99, 0x99, 0xca, 0xac, 0x68, 0x88, 0x8c,
-	0xcc, 0xb8, 0xb8, 0x8c, 0x69, 0x88, 0x8b, 0x88, 0x9c, 0x8c, 0x26, 0xff,
-	0x02, 0xf0, 0x00, 0x00, 0x3a, 0xff, 0x00, 0x0e, 0xfa, 0x96, 0x9c, 0xad,
-	0xed, 0xdd, 0xef, 0x00, 0x08, 0xff, 0x00, 0x42, 0x7a, 0xd7, 0x77, 0xe9,
-	0x9a, 0xad, 0x66, 0x99, 0xad, 0xca, 0x6c, 0x8c, 0x6d, 0xad, 0xa9, 0x99,
-	0x99, 0x9a, 0x9c, 0x9c, 0x88, 0x8c, 0xc9, 0x96, 0xc8, 0xbb, 0x8c, 0x6c,
-	0x8b, 0x88, 0x88, 0xd8, 0x86, 0x00, 0x26, 0xff, 0x02, 0xf0, 0x00, 0x00,
-	0x3a, 0xff, 0x00, 0x0e, 0xfa, 0x96, 0x99, 0xdd, 0xde, 0xdd, 0xef, 0x00,
-	0x08, 0xff, 0x00, 0x42, 0xe6, 0xd7, 0xef, 0xa9, 0x96, 0x7d, 0x66, 0x69,
-	0xae, 0x69, 0x99, 0x88, 0xce, 0xed, 0x69, 0x9c, 0x99, 0xc8, 0x98, 0x88,
-	0x8b, 0x89, 0x6c, 0xc6, 0x9c, 0x88, 0x89, 0x9c, 0x88, 0xc8, 0x88, 0xac,
-	0x8e, 0x00, 0x26, 0xff, 0x02, 0xf0, 0x00, 0x00, 0x3a, 0xff, 0x00, 0x58,
-	0xf7, 0xc6, 0xc6, 0xda, 0xdd, 0xdd, 0xdf, 0xff, 0xff, 0xff, 0xfe, 0xdf,
-	0xf7, 0x7e, 0x99, 0x96, 0xa6, 0xa6, 0x66, 0x66, 0xa9, 0xaa, 0x88, 0xcd,
-	0xea, 0x99, 0x9c, 0x99, 0x9c, 0x88, 0x88, 0xb8, 0x89, 0xc9, 0xc8, 0xcc,
-	0x88, 0xc9, 0x98, 0x88, 0xcc, 0x88, 0xa8, 0x8f, 0x26, 0xff, 0x02, 0xf0,
-	0x00, 0x00, 0x3c, 0xff, 0x00, 0x56, 0xea, 0xca, 0xad, 0xdd, 0xdd, 0xd7,
-	0xff, 0xe6, 0xda, 0x6a, 0xed, 0xe7, 0xfa, 0x99, 0x9e, 0xa6, 0xca, 0x66,
-	0x9a, 0x69, 0x96, 0xc9, 0xca, 0xea, 0x69, 0xcc, 0x99, 0xc9, 0xcc, 0x88,
-	0x8b, 0x8c, 0x88, 0xc8, 0x8b, 0x8c, 0x69, 0xc8, 0x8c, 0xc9, 0x8c, 0xa8,
-	0x6f, 0x00, 0x26, 0xff, 0x02, 0xf0, 0x00, 0x00, 0x3c, 0xff, 0x00, 0x56,
-	0xfa, 0x6a, 0xae, 0xdd, 0xa6, 0x6e, 0xe9, 0x66, 0xda, 0x99, 0xaa, 0xe7,
-	0xe6, 0x9c, 0x6a, 0x66, 0xca, 0x66, 0xc6, 0xa9, 0x69, 0xc8, 0xc6, 0xda,
-	0x99, 0x9c, 0x99, 0x88, 0x8c, 0xb8, 0x88, 0x89, 0x88, 0x88, 0x88, 0x89,
-	0x99, 0xc8, 0x8a, 0x98, 0x89, 0x9c, 0xdf, 0x00, 0x26, 0xff, 0x02, 0xf0,
-	0x00, 0x00, 0x3c, 0xff, 0x00, 0x54, 0xf7, 0x99, 0xed, 0xd6, 0xcc, 0x9e,
-	0xdc, 0x96, 0xa6, 0xad, 0xad, 0xef, 0xa9, 0x99, 0xd6, 0x6a, 0xc6, 0xa6,
-	0x96, 0x99, 0x69, 0xcc, 0x89, 0xda, 0x9c, 0xcc, 0x99, 0x9c, 0x8c, 0x8b,
-	0x8c, 0x9c, 0x88, 0x88, 0xb8, 0xcc, 0x9c, 0x88, 0x8c, 0x98, 0x8a, 0xc8,
-	0x28, 0xff, 0x02, 0xf0, 0x00, 0x00, 0x3e, 0xff, 0x00, 0x52, 0x6e, 0xee,
-	0xdc, 0x99, 0xc6, 0x99, 0x6a, 0xa9, 0x9a, 0xae, 0xef, 0x69, 0x6a, 0xea,
-	0xa6, 0x9c, 0xa6, 0x99, 0x66, 0x6c, 0xcc, 0x89, 0xda, 0x99, 0xcc, 0x99,
-	0xc8, 0x88, 0x88, 0xc9, 0x98, 0x88, 0x88, 0x8c, 0xcc, 0xcc, 0xc8, 0x88,
-	0xc8, 0xca, 0x89, 0x00, 0x28, 0xff, 0x02, 0xf0, 0x00, 0x00, 0x3e, 0xff,
-	0x00, 0x52, 0xfd, 0xdd, 0x9c, 0x99, 0x99, 0x66, 0x6e, 0x6a, 0xda, 0xae,
-	0xf7, 0x9c, 0x6d, 0xd6, 0xaa, 0x6c, 0x69, 0x99, 0xc9, 0x6c, 0xc8, 0x89,
-	0xdd, 0x9c, 0xcc, 0x9c, 0x88, 0x88, 0x8c, 0x99, 0x98, 0x88, 0x88, 0x9c,
-	0xc9, 0xcc, 0x8c, 0x8c, 0xc8, 0x9e, 0x8d, 0x00, 0x28, 0xff, 0x02, 0xf0,
-	0x00, 0x00, 0x3e, 0xff, 0x00, 0x52, 0xaa, 0xda, 0x8c, 0x99, 0x99, 0xa9,
-	0xa6, 0x6a, 0xaa, 0xde, 0xfd, 0xca, 0xaa, 0xdd, 0x6a, 0xa8, 0x9c, 0x9c,
-	0x99, 0x98, 0x88, 0x89, 0xed, 0x9c, 0xcc, 0x9c, 0x88, 0x88, 0xcc, 0x99,
-	0xcc, 0x88, 0xcc, 0x99, 0xc9, 0xcc, 0x88, 0xc9, 0x8c, 0xdd, 0x87, 0x00,
-	0x28, 0xff, 0x02, 0xf7, 0x00, 0x00, 0x3c, 0xff, 0x00, 0x54, 0xf7, 0x66,
-	0xa9, 0xc9, 0xc9, 0xcc, 0xcc, 0x66, 0x9a, 0xde, 0xe7, 0x76, 0xca, 0x6a,
-	0x9a, 0x69, 0xcb, 0xc8, 0x89, 0x9c, 0x88, 0x88, 0x8c, 0x7a, 0x9c, 0xcc,
-	0x99, 0xc8, 0x8c, 0x99, 0x99, 0x9c, 0xcc, 0x9c, 0x99, 0xc9, 0xcc, 0x8c,
-	0xcc, 0x88, 0xec, 0xcf, 0x28, 0xff, 0x02, 0xf1, 0x00, 0x00, 0x3c, 0xff,
-	0x00, 0x54, 0xf7, 0xa6, 0x9c, 0xc9, 0xcc, 0xc8, 0xc8, 0xc9, 0x9d, 0x6d,
-	0xdf, 0xdc, 0xcc, 0xa9, 0x69, 0x98, 0x8c, 0xa8, 0x89, 0x9c, 0x88, 0x88,
-	0xc9, 0xe6, 0xcc, 0xcc, 0xcc, 0x9c, 0xc9, 0x9c, 0x99, 0xcc, 0xcc, 0xcc,
-	0x99, 0xcc, 0xc8, 0xc9, 0xc8, 0x88, 0xe8, 0xaf, 0x28, 0xff, 0x02, 0xf0,
-	0x00, 0x00, 0x3e, 0xff, 0x00, 0x52, 0x6c, 0xcc, 0x99, 0xcc, 0x89, 0x6c,
-	0x8c, 0xdd, 0xda, 0xef, 0xac, 0xcc, 0x69, 0xc8, 0x89, 0x69, 0x96, 0x88,
-	0x99, 0x98, 0x88, 0x96, 0xe9, 0xcc, 0xcc, 0x99, 0xc9, 0x99, 0x99, 0x99,
-	0xc9, 0x99, 0xc9, 0xc9, 0xc9, 0xc8, 0xc9, 0xcc, 0x89, 0xec, 0xef, 0x00,
-	0x28, 0xff, 0x02, 0xf0, 0x00, 0x00, 0x3e, 0xff, 0x00, 0x50, 0x98, 0x9c,
-	0x99, 0x99, 0x9a, 0x66, 0xcc, 0xed, 0xde, 0x77, 0xac, 0x88, 0x88, 0xc6,
-	0xd6, 0xa9, 0xc6, 0x9c, 0x99, 0x98, 0xb8, 0x9a, 0x69, 0xcc, 0x9c, 0xcc,
-	0xcc, 0x9c, 0x99, 0x9c, 0xcc, 0xc9, 0x99, 0x99, 0x9c, 0xcc, 0x99, 0xc8,
-	0x8e, 0x9c, 0x2a, 0xff, 0x02, 0xf0, 0x00, 0x00, 0x3e, 0xff, 0x00, 0x50,
-	0x9c, 0xcc, 0x69, 0x9c, 0xa6, 0x66, 0x96, 0xea, 0x9e, 0x7e, 0xa9, 0xc9,
-	0xc8, 0x9e, 0x69, 0xd9, 0xc9, 0x96, 0x99, 0xc9, 0x88, 0x6a, 0xc9, 0xcc,
-	0xc9, 0xc9, 0xcc, 0x9c, 0x99, 0x9c, 0xc9, 0x9c, 0x99, 0x9c, 0x99, 0x9b,
-	0x88, 0xc8, 0xce, 0xc9, 0x2a, 0xff, 0x02, 0xf0, 0x00, 0x00, 0x3e, 0xff,
-	0x00, 0x50, 0xdc, 0xc9, 0xa9, 0xa8, 0xa6, 0x6a, 0x96, 0x9c, 0xd7, 0xfa,
-	0xa6, 0x69, 0xac, 0x6d, 0x66, 0xa6, 0x6c, 0x88, 0x99, 0x9c, 0xc9, 0x69,
-	0xc9, 0xcc, 0xc9, 0xcc, 0xcc, 0xc9, 0x99, 0xcc, 0x9c, 0x99, 0x99, 0x99,
-	0x98, 0xb8, 0x88, 0x88, 0xcd, 0xc7, 0x2a, 0xff, 0x02, 0xf0, 0x00, 0x00,
-	0x3e, 0xff, 0x00, 0x50, 0x79, 0x96, 0x69, 0x68, 0x66, 0xa6, 0x96, 0xcc,
-	0xaf, 0xfa, 0xe9, 0x9c, 0xc8, 0xa6, 0xa9, 0x69, 0x9c, 0x98, 0xc9, 0x99,
-	0x9c, 0x99, 0x99, 0xc9, 0x99, 0xc9, 0xcc, 0x99, 0x9c, 0xc9, 0xcc, 0x9c,
-	0x9c, 0x99, 0xc8, 0x89, 0xc8, 0x88, 0xad, 0x8f, 0x2a, 0xff, 0x02, 0xf0,
-	0x00, 0x00, 0x3e, 0xff, 0x00, 0x50, 0xf9, 0x9a, 0x96, 0xac, 0x9a, 0x66,
-	0x99, 0x88, 0x6f, 0xfd, 0xec, 0xc9, 0x9c, 0x99, 0x9a, 0x96, 0x68, 0x9c,
-	0xc9, 0x99, 0x99, 0x96, 0x69, 0xcc, 0x99, 0x9c, 0x9c, 0xc9, 0x9c, 0xcc,
-	0xc9, 0xc9, 0x99, 0x9c, 0x96, 0xc8, 0xc8, 0x88, 0x79, 0x6f, 0x2a, 0xff,
-	0x02, 0xf0, 0x00, 0x00, 0x3e, 0xff, 0x00, 0x50, 0xf9, 0x99, 0xd9, 0x9c,
-	0x6a, 0x66, 0x69, 0x8c, 0x6f, 0xfa, 0x99, 0x96, 0x9a, 0x69, 0x99, 0x66,
-	0x9c, 0x99, 0x89, 0xc9, 0x99, 0x99, 0x98, 0x88, 0x88, 0x99, 0xcc, 0x99,
-	0xcc, 0xc9, 0xcc, 0x99, 0xc9, 0x9c, 0x9c, 0x69, 0xc9, 0x88, 0x7c, 0xef,
-	0x2a, 0xff, 0x02, 0xfb, 0x00, 0x00, 0x3e, 0xff, 0x00, 0x4e, 0xfd, 0x96,
-	0x99, 0x99, 0xa6, 0x66, 0x69, 0x88, 0x6f, 0xd9, 0x9c, 0x99, 0xac, 0x96,
-	0x66, 0x96, 0x69, 0xc9, 0x89, 0x98, 0x99, 0x99, 0x6c, 0x88, 0x8b, 0x8c,
-	0x99, 0xc9, 0xcc, 0xcc, 0x9c, 0x9c, 0x99, 0x9c, 0x96, 0x6d, 0xcc, 0x89,
-	0xac, 0x00, 0x2c, 0xff, 0x02, 0xf0, 0x00, 0x00, 0x3e, 0xff, 0x00, 0x4e,
-	0xfa, 0x99, 0x99, 0xca, 0xd6, 0xaa, 0x99, 0x8c, 0x69, 0x69, 0x99, 0xc8,
-	0x6c, 0x96, 0xc9, 0x96, 0x66, 0xc9, 0xcc, 0x9c, 0x99, 0xcc, 0x88, 0xb8,
-	0x88, 0x88, 0x69, 0x9c, 0xcc, 0xc9, 0xc9, 0x99, 0x9c, 0xcc, 0xcc, 0xc6,
-	0x89, 0x8e, 0x9a, 0x00, 0x2c, 0xff, 0x02, 0xf0, 0x00, 0x00, 0x3e, 0xff,
-	0x00, 0x4e, 0xfd, 0x99, 0x9c, 0x6a, 0xda, 0x66, 0x69, 0x8c, 0x99, 0x96,
-	0xa9, 0xc8, 0x96, 0x99, 0x69, 0x69, 0x99, 0x8a, 0xc8, 0x99, 0x99, 0x9c,
-	0xb8, 0x88, 0x88, 0xb8, 0x96, 0x9c, 0xcc, 0xcc, 0x9c, 0x99, 0xc9, 0xc8,
-	0xcc, 0x88, 0x88, 0x9e, 0xce, 0x00, 0x2c, 0xff, 0x02, 0xf4, 0x00, 0x00,
-	0x3e, 0xff, 0x00, 0x4e, 0xfa, 0x99, 0xc9, 0xdd, 0xa6, 0xaa, 0x69, 0x88,
-	0xc9, 0xc9, 0xd6, 0x88, 0x69, 0x66, 0x99, 0x96, 0x66, 0xc9, 0x68, 0x89,
-	0x9c, 0x9c, 0xb8, 0x88, 0x88, 0x88, 0x69, 0xcc, 0xcc, 0xc9, 0x99, 0x9c,
-	0xc8, 0xcc, 0xcc, 0xcc, 0x88, 0xe6, 0xcf, 0x00, 0x2c, 0xff, 0x02, 0xf0,
-	0x00, 0x00, 0x3e, 0xff, 0x00, 0x4e, 0xfd, 0x99, 0x99, 0xdd, 0xa6, 0x66,
-	0x69, 0x88, 0x8c, 0x9c, 0xaa, 0x88, 0x99, 0xa9, 0xc9, 0x9d, 0xaa, 0x99,
-	0x9c, 0x8c, 0x99, 0xc8, 0x88, 0x88, 0x88, 0xb8, 0x6c, 0x9c, 0xc9, 0x9c,
-	0x99, 0xcc, 0x96, 0x66, 0x99, 0x88, 0xc8, 0xec, 0x6f, 0x00, 0x2c, 0xff,
-	0x02, 0xf0, 0x00, 0x00, 0x3e, 0xff, 0x00, 0x4e, 0xfd, 0x69, 0x96, 0xdd,
-	0xaa, 0x6a, 0x69, 0x88, 0x88, 0xc9, 0x9d, 0xc8, 0x86, 0x69, 0x9c, 0x69,
-	0xaa, 0xa9, 0x6c, 0x88, 0xc9, 0xc8, 0x88, 0x88, 0x8b, 0x88, 0x9c, 0xcc,
-	0x9c, 0xc9, 0x9c, 0x99, 0x96, 0x96, 0xcc, 0x8c, 0x89, 0x68, 0xef, 0x00,
-	0x2c, 0xff, 0x02, 0xf0, 0x00, 0x00, 0x3e, 0xff, 0x00, 0x4c, 0xfd, 0xa9,
-	0x9d, 0xda, 0xa6, 0xa6, 0x69, 0x98, 0x88, 0xc9, 0xad, 0x68, 0x8a, 0xad,
-	0x88, 0x88, 0x8c, 0x99, 0x96, 0xa8, 0x99, 0x68, 0x88, 0x8c, 0x8b, 0x89,
-	0xcc, 0xc9, 0xc9, 0x99, 0x9c, 0x88, 0x8c, 0x66, 0xcc, 0x8c, 0x8a, 0x9c,
-	0x2e, 0xff, 0x02, 0xf0, 0x00, 0x00, 0x3e, 0xff, 0x00, 0x4c, 0xfe, 0xa9,
-	0x9e, 0xda, 0xaa, 0x6a, 0x69, 0x66, 0x99, 0xcc, 0x6a, 0xd8, 0x88, 0x9b,
-	0x88, 0x8c, 0x6c, 0x9d, 0x99, 0x98, 0x9c, 0x96, 0x98, 0xc8, 0x88, 0x8c,
-	0x9c, 0x9c, 0x96, 0x9c, 0xc8, 0x8b, 0x8c, 0xc9, 0x98, 0xc8, 0x8a, 0xc6,
-	0x2e, 0xff, 0x02, 0xf0, 0x00, 0x00, 0x36, 0xff, 0x08, 0x22, 0x00, 0x4c,
-	0x2e, 0xa9, 0x6d, 0xda, 0xa6, 0x6a, 0x66, 0x96, 0x99, 0x69, 0x6d, 0xdc,
-	0x88, 0xa6, 0xaa, 0x66, 0x9c, 0xbd, 0xdc, 0x9c, 0xc6, 0xaa, 0x99, 0xc8,
-	0xb8, 0x99, 0xc9, 0xc6, 0x99, 0xc9, 0x88, 0x8c, 0xcc, 0xcc, 0x9c, 0xc8,
-	0x6c, 0x8e, 0x2e, 0xff, 0x02, 0xf4, 0x00, 0x00, 0x30, 0xff, 0x00, 0x5a,
-	0x22, 0x22, 0x23, 0x32, 0x32, 0x22, 0xf2, 0xfd, 0xa9, 0xdd, 0xaa, 0x66,
-	0xa6, 0x6a, 0xee, 0x77, 0x69, 0x96, 0x66, 0x8c, 0xcd, 0xa6, 0x9d, 0x96,
-	0x8c, 0xdd, 0xac, 0xc9, 0x8c, 0x8c, 0x88, 0xc6, 0xc9, 0x99, 0x69, 0x9c,
-	0x69, 0x99, 0x9c, 0xc9, 0xc9, 0x9c, 0x8c, 0xac, 0xcf, 0x00, 0x2e, 0xff,
-	0x02, 0xf0, 0x00, 0x00, 0x2e, 0xff, 0x00, 0x14, 0x22, 0x22, 0x33, 0x22,
-	0xf2, 0xff, 0xff, 0xff, 0xfa, 0x66, 0x08, 0xaa, 0x00, 0x40, 0x6d, 0xdd,
-	0xdd, 0xa6, 0x6a, 0xaa, 0x88, 0x86, 0x69, 0xc6, 0x99, 0x98, 0x88, 0x9c,
-	0xc8, 0x88, 0x88, 0x99, 0x69, 0x6a, 0xa6, 0x9c, 0xc8, 0xc9, 0xc9, 0xcc,
-	0x86, 0x99, 0x9c, 0xba, 0x98, 0x9f, 0x2e, 0xff, 0x02, 0xf0, 0x00, 0x00,
-	0x2a, 0xff, 0x00, 0x0a, 0xf2, 0x22, 0x22, 0x22, 0x2f, 0x00, 0x0a, 0xff,
-	0x00, 0x4c, 0x7a, 0xce, 0xdd, 0xa6, 0x6a, 0xaa, 0xad, 0xea, 0xdd, 0xd6,
-	0xda, 0xa6, 0xcc, 0x89, 0xa9, 0x99, 0x99, 0xac, 0x88, 0xb8, 0xbb, 0x88,
-	0x86, 0x9a, 0x99, 0x99, 0xc8, 0xcc, 0xcc, 0x99, 0xcc, 0x9d, 0xc9, 0xc6,
-	0x9c, 0xce, 0x9c, 0xdf, 0x2e, 0xff, 0x02, 0xf0, 0x00, 0x00, 0x28, 0xff,
-	0x00, 0x08, 0xf2, 0x22, 0x22, 0x2f, 0x0e, 0xff, 0x00, 0x4a, 0xe9, 0xda,
-	0xa6, 0xaa, 0xd6, 0xda, 0xa6, 0xda, 0xad, 0xea, 0x7a, 0xa6, 0xa8, 0xc8,
-	0xac, 0x66, 0x99, 0x9a, 0xd6, 0x9c, 0xc6, 0x6d, 0xa6, 0x9c, 0x9c, 0x88,
-	0xc9, 0x9c, 0x9c, 0x99, 0xcc, 0xcc, 0xc6, 0xc9, 0xc8, 0x7a, 0xcc, 0x00,
-	0x30, 0xff, 0x02, 0xf0, 0x00, 0x00, 0x26, 0xff, 0x00, 0x06, 0xf2, 0x23,
-	0x22, 0x00, 0x12, 0xff, 0x00, 0x4a, 0x6d, 0xaa, 0x66, 0x6d, 0xdd, 0xaa,
-	0x66, 0x6a, 0xda, 0xaa, 0xea, 0x6a, 0xa9, 0xc8, 0x69, 0x6c, 0x66, 0x66,
-	0x66, 0x6a, 0x66, 0x6a, 0xaa, 0x6c, 0xe9, 0xcc, 0xc9, 0x96, 0x99, 0x96,
-	0xcc, 0xc8, 0xc9, 0xc9, 0x8a, 0xf6, 0xc9, 0x00, 0x30, 0xff, 0x02, 0xf7,
-	0x00, 0x00, 0x26, 0xff, 0x02, 0x23, 0x02, 0x32, 0x14, 0xff, 0x00, 0x4a,
-	0x9a, 0xa6, 0x66, 0x6a, 0xdd, 0x9c, 0x88, 0xc8, 0xca, 0xa6, 0xa6, 0x9a,
-	0x66, 0xc8, 0x96, 0x9c, 0x99, 0xc9, 0x99, 0x9c, 0x99, 0x69, 0x6a, 0xa8,
-	0x6a, 0xac, 0xcc, 0x96, 0x98, 0x99, 0xcc, 0xcc, 0x89, 0xc8, 0xcf, 0xec,
-	0xcd, 0x00, 0x30, 0xff, 0x02, 0xf0, 0x00, 0x00, 0x24, 0xff, 0x02, 0x22,
-	0x02, 0x32, 0x16, 0xff, 0x00, 0x4a, 0x6a, 0xaa, 0x69, 0x6a, 0x66, 0xc6,
-	0x77, 0xfe, 0xa8, 0x96, 0xc8, 0x89, 0xdd, 0x8c, 0x8a, 0xcc, 0xcc, 0xc9,
-	0x9c, 0x9c, 0xcc, 0x6e, 0xa6, 0xa6, 0x8a, 0xde, 0x6a, 0x66, 0x8c, 0xa9,
-	0xcc, 0xcc, 0xcc, 0x98, 0x9f, 0xec, 0xcf, 0x00, 0x30, 0xff, 0x02, 0xf0,
-	0x00, 0x00, 0x22, 0xff, 0x00, 0x06, 0xf2, 0x33, 0x2f, 0x00, 0x14, 0xff,
-	0x00, 0x4c, 0xf7, 0x6a, 0x66, 0xcc, 0x9a, 0xa8, 0x6f, 0xff, 0xff, 0xfa,
-	0x88, 0x86, 0x69, 0xdd, 0x98, 0xc6, 0x99, 0xc9, 0xcc, 0x9c, 0x9c, 0xcc,
-	0x6d, 0xa6, 0x6d, 0x8c, 0xcc, 0xc8, 0x88, 0x8d, 0x66, 0x9c, 0x9c, 0xc8,
-	0x68, 0xdf, 0x68, 0x9f, 0x30, 0xff, 0x02, 0xf0, 0x00, 0x00, 0x22, 0xff,
-	0x02, 0x33, 0x02, 0x22, 0x18, 0xff, 0x00, 0x4a, 0xd6, 0xa6, 0x99, 0xc6,
-	0xd9, 0xff, 0xff, 0xff, 0xfe, 0xd9, 0xae, 0x99, 0xa7, 0xa8, 0xcc, 0x9c,
-	0x99, 0x96, 0x6c, 0xcc, 0xcc, 0xae, 0xdd, 0xaa, 0xac, 0x9c, 0x66, 0xc9,
-	0xda, 0x9a, 0x69, 0xcc, 0xc8, 0x98, 0xef, 0xcc, 0xef, 0x00, 0x30, 0xff,
-	0x02, 0xfb, 0x00, 0x00, 0x20, 0xff, 0x02, 0xf3, 0x02, 0x33, 0x1a, 0xff,
-	0x00, 0x48, 0xaa, 0x66, 0x9c, 0x99, 0x6d, 0xef, 0xf7, 0xff, 0xf7, 0xed,
-	0xda, 0x96, 0xce, 0xe8, 0x8c, 0x99, 0xc9, 0xaa, 0x66, 0xcc, 0xcc, 0xde,
-	0xaa, 0x6a, 0xae, 0x6c, 0xc9, 0x6a, 0xcc, 0x9c, 0xcc, 0x9c, 0xcc, 0x88,
-	0xee, 0xcc, 0x32, 0xff, 0x02, 0xf0, 0x00, 0x00, 0x1e, 0xff, 0x00, 0x06,
-	0xf2, 0x25, 0x3f, 0x00, 0x1a, 0xff, 0x00, 0x48, 0xaa, 0x69, 0x99, 0xc6,
-	0x9a, 0x6f, 0xff, 0xff, 0x77, 0xea, 0x6a, 0xa6, 0x6a, 0xdc, 0x8c, 0xd6,
-	0x69, 0xd6, 0xd9, 0xcc, 0xcc, 0x7d, 0xaa, 0xa6, 0x9e, 0xe7, 0xa6, 0x69,
-	0x6c, 0xc8, 0x9c, 0xcc, 0x9c, 0x8c, 0xea, 0x86, 0x32, 0xff, 0x02, 0xf0,
-	0x00, 0x00, 0x1e, 0xff, 0x02, 0xf2, 0x02, 0x53, 0x1c, 0xff, 0x00, 0x48,
-	0xa6, 0x6c, 0xcc, 0x9c, 0x96, 0xd6, 0xff, 0xfe, 0x77, 0xd9, 0xaa, 0xa8,
-	0x9a, 0xaa, 0x88, 0x9a, 0xc9, 0xa6, 0x9a, 0xa9, 0x9c, 0xea, 0x99, 0x96,
-	0x9d, 0xae, 0xd6, 0x69, 0xd6, 0x88, 0x9c, 0xc9, 0x6c, 0x89, 0xdc, 0xc7,
-	0x32, 0xff, 0x02, 0xf0, 0x00, 0x00, 0x1e, 0xff, 0x02, 0x25, 0x02, 0x2f,
-	0x1c, 0xff, 0x00, 0x48, 0x68, 0x88, 0xcc, 0xcc, 0x9d, 0x6a, 0x6f, 0xff,
-	0xfd, 0xc8, 0x99, 0xac, 0x89, 0x66, 0x8c, 0x86, 0xc9, 0xd6, 0x6c, 0x99,
-	0x69, 0xa6, 0xc6, 0x66, 0x6a, 0x9a, 0xa6, 0x6a, 0xac, 0x68, 0xcc, 0x88,
-	0x8b, 0x89, 0x9c, 0xcf, 0x32, 0xff, 0x02, 0xf0, 0x00, 0x00, 0x1c, 0xff,
-	0x00, 0x06, 0xf2, 0x33, 0x2f, 0x00, 0x1c, 0xff, 0x00, 0x48, 0x99, 0x9c,
-	0xc8, 0xcc, 0x9d, 0xda, 0x66, 0xde, 0xdc, 0x88, 0x6d, 0x9c, 0x96, 0xa9,
-	0xcc, 0xcc, 0xc6, 0x66, 0x99, 0x99, 0x6a, 0xa9, 0x99, 0x99, 0x66, 0x96,
-	0x66, 0xa6, 0x66, 0x6c, 0x88, 0xc9, 0x88, 0x9a, 0x9c, 0xaf, 0x32, 0xff,
-	0x02, 0xf1, 0x00, 0x00, 0x1c, 0xff, 0x02, 0xf3, 0x02, 0x52, 0x16, 0xff,
-	0x00, 0x50, 0xfe, 0xa7, 0xff, 0xff, 0x9c, 0xcc, 0xcc, 0xcc, 0x9c, 0xaa,
-	0x6a, 0x96, 0xc8, 0x88, 0x9a, 0xcc, 0xc9, 0x6c, 0x9c, 0xcc, 0xcc, 0xc9,
-	0xc9, 0x9c, 0x9a, 0xa9, 0xc6, 0x6c, 0x69, 0x9c, 0x96, 0x6a, 0xa9, 0x66,
-	0x88, 0xee, 0xda, 0x68, 0x89, 0x7f, 0x32, 0xff, 0x02, 0xf0, 0x00, 0x00,
-	0x1c, 0xff, 0x02, 0x25, 0x02, 0x2f, 0x16, 0xff, 0x00, 0x4e, 0xf7, 0x69,
-	0xaf, 0xff, 0x98, 0xc9, 0xc8, 0x8c, 0x9c, 0xad, 0xd6, 0x69, 0x8c, 0x98,
-	0x86, 0x69, 0xc9, 0x66, 0x98, 0x88, 0x9c, 0xc9, 0x66, 0x69, 0x6d, 0xa9,
-	0xc6, 0x9c, 0x69, 0x66, 0x99, 0x66, 0x96, 0x99, 0xcb, 0xef, 0x6c, 0x9c,
-	0xcc, 0x00, 0x34, 0xff, 0x02, 0xf0, 0x00, 0x00, 0x1c, 0xff, 0x02, 0x33,
-	0x02, 0x2f, 0x18, 0xff, 0x00, 0x4c, 0xd9, 0x96, 0xef, 0xa8, 0x8c, 0xcc,
-	0x88, 0x99, 0xdd, 0xde, 0xa9, 0x6d, 0x6c, 0x8c, 0xd6, 0x9c, 0xc6, 0x98,
-	0x88, 0xdc, 0xc6, 0xaa, 0x9c, 0x6d, 0x99, 0xcc, 0x99, 0x96, 0x96, 0x6a,
-	0xa6, 0xa6, 0x9c, 0x88, 0x6e, 0x6d, 0xac, 0xcd, 0x34, 0xff, 0x02, 0xf0,
-	0x00, 0x00, 0x1a, 0xff, 0x02, 0xf2, 0x02, 0x52, 0x1a, 0xff, 0x00, 0x4c,
-	0xfc, 0x99, 0xcf, 0xd8, 0xb8, 0xcc, 0x88, 0xca, 0xa9, 0xde, 0x77, 0x7d,
-	0xd6, 0x88, 0xad, 0x99, 0xca, 0x9c, 0x88, 0xaa, 0xc6, 0xa6, 0x69, 0x9a,
-	0x99, 0x96, 0x99, 0x96, 0xca, 0xaa, 0xaa, 0xa6, 0x9c, 0x8c, 0x66, 0xdf,
-	0xfe, 0xcf, 0x34, 0xff, 0x02, 0xf9, 0x00, 0x00, 0x1a, 0xff, 0x02, 0xf3,
-	0x02, 0x32, 0x1a, 0xff, 0x00, 0x4c, 0xfa, 0xcc, 0x98, 0x68, 0x88, 0x8c,
-	0x88, 0xca, 0xdd, 0xdf, 0xff, 0xff, 0xfa, 0x98, 0xca, 0xe9, 0x96, 0x69,
-	0x88, 0x9d, 0xc9, 0xc9, 0x99, 0x9a, 0xca, 0xc6, 0x99, 0x99, 0x66, 0xc9,
-	0x99, 0x99, 0x98, 0xc6, 0xc9, 0xde, 0xff, 0xdf, 0x34, 0xff, 0x02, 0xf0,
-	0x00, 0x00, 0x1a, 0xff, 0x02, 0x23, 0x02, 0x3f, 0x1a, 0xff, 0x00, 0x30,
-	0xfa, 0xcc, 0x98, 0x88, 0x88, 0x88, 0x8c, 0xca, 0xae, 0xdf, 0xff, 0xff,
-	0xf7, 0xd9, 0x8c, 0xda, 0x66, 0x96, 0x88, 0xce, 0xcc, 0x99, 0x66, 0x66,
-	0x0a, 0xcc, 0x00, 0x0e, 0x9c, 0xc9, 0x98, 0x89, 0x98, 0x9c, 0x96, 0x00,
-	0x38, 0xff, 0x02, 0xf9, 0x00, 0x00, 0x1a, 0xff, 0x02, 0x25, 0x02, 0x2f,
-	0x1a, 0xff, 0x00, 0x48, 0xda, 0xc9, 0x99, 0xb8, 0x8b, 0x88, 0xc6, 0x9d,
-	0xdd, 0xae, 0xed, 0x7f, 0x77, 0xee, 0xc8, 0x9a, 0xa6, 0x66, 0xc8, 0x86,
-	0x6c, 0xc9, 0x66, 0x99, 0xcc, 0xcc, 0xcc, 0x8c, 0xcc, 0xcc, 0x9c, 0xb8,
-	0x6c, 0xc9, 0x66, 0x9e, 0x38, 0xff, 0x02, 0xf0, 0x00, 0x00, 0x1a, 0xff,
-	0x02, 0x35, 0x02, 0x2f, 0x18, 0xff, 0x00, 0x48, 0xfd, 0xda, 0xcc, 0x66,
-	0x88, 0x88, 0x88, 0x8a, 0xa9, 0x6e, 0xed, 0xad, 0xaf, 0xf7, 0xef, 0xd6,
-	0x8c, 0x9a, 0x6a, 0x68, 0x89, 0xec, 0x9c, 0xc6, 0x9c, 0x9c, 0xcc, 0x8c,
-	0xcc, 0xc8, 0x98, 0x88, 0x9a, 0x99, 0xa6, 0x6d, 0x3a, 0xff, 0x02, 0xf0,
-	0x00, 0x00, 0x18, 0xff, 0x02, 0xf2, 0x02, 0x53, 0x1a, 0xff, 0x00, 0x32,
-	0xfc, 0xa6, 0x68, 0x99, 0x9b, 0x88, 0xb8, 0xca, 0x69, 0xae, 0xee, 0xed,
-	0xe7, 0xff, 0x77, 0xfe, 0xdc, 0xc6, 0xa6, 0x9c, 0x88, 0xdc, 0xc8, 0x99,
-	0x69, 0x00, 0x08, 0xcc, 0x00, 0x0c, 0x8c, 0x88, 0x8a, 0x9c, 0x6a, 0xd7,
-	0x3c, 0xff, 0x02, 0xf2, 0x00, 0x00, 0x18, 0xff, 0x02, 0xf2, 0x02, 0x53,
-	0x1a, 0xff, 0x00, 0x34, 0x66, 0x96, 0x98, 0x96, 0x9b, 0x8b, 0x88, 0xca,
-	0x66, 0x9d, 0xdd, 0xff, 0xff, 0xee, 0xaa, 0xae, 0xed, 0xa9, 0x66, 0x99,
-	0x8c, 0x69, 0x8c, 0xc9, 0x66, 0xcc, 0x08, 0xc8, 0x00, 0x08, 0x89, 0xac,
-	0xc6, 0xe2, 0x3e, 0xff, 0x02, 0xf0, 0x00, 0x00, 0x18, 0xff, 0x02, 0xf2,
-	0x02, 0x53, 0x1a, 0xff, 0x00, 0x46, 0x96, 0x69, 0x98, 0x99, 0x68, 0xb8,
-	0xb8, 0xca, 0xaa, 0x9a, 0xdf, 0x7e, 0xa9, 0x88, 0x88, 0x89, 0xef, 0xea,
-	0x6d, 0xed, 0xa6, 0x66, 0x88, 0x8c, 0xc6, 0x98, 0x88, 0x88, 0x88, 0x8c,
-	0xa9, 0xc9, 0xae, 0x22, 0x2f, 0x00, 0x3c, 0xff, 0x02, 0xf0, 0x00, 0x00,
-	0x18, 0xff, 0x02, 0xf3, 0x02, 0x52, 0x1a, 0xff, 0x00, 0x46, 0xc9, 0xd6,
-	0xac, 0x9c, 0x68, 0xb8, 0x88, 0xcd, 0x6c, 0x9a, 0xea, 0xc8, 0xb8, 0x8b,
-	0x8b, 0x88, 0xb9, 0xaa, 0x69, 0x6d, 0xd6, 0x9c, 0x8c, 0x88, 0x8c, 0x88,
-	0x88, 0x88, 0xc9, 0x99, 0x9a, 0x9d, 0xdf, 0xf2, 0x2f, 0x00, 0x3c, 0xff,
-	0x02, 0xf0, 0x00, 0x00, 0x18, 0xff, 0x02, 0xf3, 0x02, 0x52, 0x18, 0xff,
-	0x00, 0x48, 0xf6, 0xa9, 0xd6, 0xa9, 0x9c, 0x9b, 0x8b, 0x88, 0x9a, 0x6c,
-	0xcd, 0xc8, 0x8b, 0x8b, 0xb8, 0xb8, 0x8b, 0x8b, 0x88, 0xc6, 0xc9, 0x6c,
-	0x88, 0x88, 0x88, 0x69, 0x8b, 0x8b, 0xbc, 0xa9, 0x8c, 0x9d, 0x7a, 0x7f,
-	0xf2, 0x22, 0x3c, 0xff, 0x02, 0xf9, 0x00, 0x00, 0x18, 0xff, 0x02, 0xf3,
-	0x02, 0x52, 0x14, 0xff, 0x00, 0x4c, 0xf7, 0x9c, 0xcc, 0xa6, 0x66, 0x69,
-	0xc9, 0x98, 0xb8, 0x88, 0x6d, 0x98, 0x88, 0x88, 0xb8, 0x88, 0x8c, 0x96,
-	0x69, 0xc8, 0x8b, 0x8c, 0x6c, 0x69, 0xcc, 0xc1, 0x8a, 0xa8, 0x8b, 0x8c,
-	0xa9, 0xcc, 0xcc, 0xad, 0xad, 0xff, 0xff, 0x22, 0x3c, 0xff, 0x02, 0xf0,
-	0x00, 0x00, 0x18, 0xff, 0x02, 0xf3, 0x02, 0x52, 0x14, 0xff, 0x00, 0x18,
-	0xf6, 0xc8, 0x8c, 0xca, 0xca, 0x9c, 0xc6, 0x98, 0x88, 0x88, 0xad, 0x8b,
-	0x08, 0x88, 0x00, 0x2c, 0xc6, 0x6a, 0xa9, 0xcc, 0x88, 0x88, 0xc9, 0x96,
-	0xcc, 0xc1, 0x9c, 0xc8, 0xcc, 0x8c, 0x88, 0x89, 0xaa, 0x96, 0xaf, 0xff,
-	0xff, 0x22, 0x3c, 0xff, 0x02, 0xfc, 0x00, 0x00, 0x18, 0xff, 0x02, 0xf3,
-	0x02, 0x52, 0x14, 0xff, 0x00, 0x4e, 0xfc, 0x8c, 0xc8, 0xc6, 0xca, 0x6c,
-	0x96, 0xa8, 0xb8, 0x8c, 0x66, 0x88, 0xb8, 0x88, 0xcc, 0xc9, 0xa6, 0xa6,
-	0xa6, 0x69, 0x8c, 0x9b, 0x89, 0xc6, 0xcc, 0xc6, 0x16, 0x98, 0xc8, 0xcc,
-	0xc9, 0x9d, 0xec, 0x96, 0x7f, 0xff, 0xff, 0x23, 0x2f, 0x00, 0x3a, 0xff,
-	0x02, 0xf0, 0x00, 0x00, 0x18, 0xff, 0x02, 0xf3, 0x02, 0x52, 0x14, 0xff,
-	0x00, 0x4e, 0xfc, 0xc8, 0xc9, 0x9c, 0x8a, 0x9c, 0x96, 0xa8, 0x8b, 0x8c,
-	0xa8, 0x8b, 0x88, 0x8c, 0xc9, 0x9a, 0x66, 0x6a, 0xaa, 0x69, 0x98, 0x98,
-	0xb8, 0x99, 0xd9, 0x91, 0x1a, 0x6c, 0x9c, 0x96, 0x96, 0xde, 0x69, 0x67,
-	0xff, 0xff, 0xff, 0xf3, 0x2f, 0x00, 0x3a, 0xff, 0x02, 0xf0, 0x00, 0x00,
-	0x18, 0xff, 0x02, 0xf3, 0x02, 0x52, 0x14, 0xff, 0x00, 0x4e, 0xec, 0x8c,
-	0xc9, 0x89, 0xca, 0x99, 0xc6, 0xec, 0x88, 0x89, 0x68, 0xb8, 0x88, 0x8c,
-	0x99, 0xaa, 0xaa, 0xa6, 0x69, 0xcc, 0xcc, 0xc9, 0x8b, 0xcc, 0xa6, 0x96,
-	0x16, 0x99, 0xc6, 0x99, 0x97, 0xde, 0x96, 0xef, 0xff, 0xff, 0xff, 0xf2,
-	0x3f, 0x00, 0x3a, 0xff, 0x02, 0xf4, 0x00, 0x00, 0x18, 0xff, 0x02, 0xf3,
-	0x02, 0x52, 0x14, 0xff, 0x00, 0x42, 0xa8, 0x88, 0x86, 0x9c, 0x89, 0x99,
-	0xc9, 0xec, 0x8b, 0x88, 0x98, 0x8b, 0x88, 0xcc, 0x6a, 0x6a, 0x66, 0x69,
-	0x96, 0x9c, 0x8c, 0xcc, 0x8b, 0x8c, 0x9d, 0x6a, 0x11, 0x9c, 0xc9, 0x6a,
-	0xee, 0xed, 0x9e, 0x00, 0x08, 0xff, 0x02, 0xf2, 0x02, 0x3f, 0x3a, 0xff,
-	0x02, 0xfb, 0x00, 0x00, 0x18, 0xff, 0x02, 0xf2, 0x02, 0x52, 0x12, 0xff,
-	0x00, 0x42, 0xfd, 0xc8, 0x98, 0x8c, 0x99, 0x8c, 0x69, 0x99, 0xe9, 0x88,
-	0xb8, 0x88, 0xb8, 0x88, 0xc9, 0x6a, 0x66, 0x66, 0x9a, 0xa6, 0x6c, 0x8c,
-	0x8c, 0xc8, 0x88, 0x9a, 0xaa, 0x11, 0x6c, 0xc9, 0x9d, 0xee, 0xee, 0x00,
-	0x0a, 0xff, 0x02, 0xf2, 0x02, 0x32, 0x3a, 0xff, 0x02, 0xf4, 0x00, 0x00,
-	0x18, 0xff, 0x02, 0xf2, 0x02, 0x53, 0x12, 0xff, 0x00, 0x42, 0xec, 0x99,
-	0xc6, 0x88, 0x69, 0x98, 0x69, 0x99, 0xaa, 0xc8, 0x88, 0x88, 0x88, 0x8c,
-	0xc9, 0x6a, 0x69, 0x6a, 0xaa, 0xa6, 0xc9, 0xcc, 0xcc, 0xc8, 0xb8, 0xc6,
-	0xdd, 0xa1, 0x6c, 0x89, 0xee, 0xee, 0x7f, 0x00, 0x0c, 0xff, 0x02, 0x32,
-	0x3a, 0xff, 0x02, 0xfd, 0x00, 0x00, 0x18, 0xff, 0x02, 0xf2, 0x02, 0x53,
-	0x12, 0xff, 0x00, 0x40, 0x9c, 0xcc, 0x6c, 0x98, 0x8c, 0x9c, 0x69, 0x99,
-	0x6d, 0x9b, 0xb8, 0x8b, 0x88, 0x8c, 0x6a, 0xa6, 0x66, 0x66, 0x66, 0x69,
-	0xcc, 0x8c, 0x88, 0x98, 0xb8, 0x89, 0xde, 0xd0, 0x19, 0x9a, 0xed, 0xe7,
-	0x0e, 0xff, 0x02, 0x22, 0x3a, 0xff, 0x02, 0xf0, 0x00, 0x00, 0x18, 0xff,
-	0x02, 0xf2, 0x02, 0x55, 0x12, 0xff, 0x00, 0x40, 0xcc, 0xc8, 0x96, 0x96,
-	0xc8, 0xcc, 0x99, 0x96, 0x9e, 0xd8, 0x88, 0xc8, 0x88, 0xc6, 0xa6, 0x66,
-	0x69, 0x99, 0x99, 0x96, 0x9c, 0x88, 0xcc, 0xcc, 0x88, 0x8a, 0x6e, 0xe0,
-	0x49, 0x9e, 0x77, 0x7f, 0x0e, 0xff, 0x02, 0x33, 0x3a, 0xff, 0x02, 0xf9,
-	0x00, 0x00, 0x1a, 0xff, 0x02, 0x35, 0x02, 0x2f, 0x0e, 0xff, 0x00, 0x3e,
-	0xf7, 0xc8, 0xcc, 0xc9, 0xaa, 0xd8, 0x89, 0x69, 0x99, 0x9c, 0x68, 0xbb,
-	0x9c, 0x88, 0xa6, 0x66, 0x66, 0x69, 0xc9, 0x9a, 0xa6, 0x69, 0xc8, 0x88,
-	0x8c, 0x88, 0xaf, 0x96, 0x7e, 0x01, 0xef, 0x00, 0x12, 0xff, 0x02, 0x23,
-	0x3a, 0xff, 0x02, 0xfd, 0x00, 0x00, 0x1a, 0xff, 0x02, 0x35, 0x02, 0x2f,
-	0x0e, 0xff, 0x00, 0x3e, 0xfa, 0xc8, 0x89, 0xcc, 0xa7, 0x6c, 0x88, 0x96,
-	0xcc, 0xc9, 0xac, 0x88, 0xb8, 0x99, 0x66, 0x66, 0x99, 0x66, 0x66, 0xaa,
-	0x6c, 0xc9, 0xcc, 0x88, 0x8c, 0x88, 0x87, 0x9c, 0xae, 0x01, 0x3f, 0x00,
-	0x12, 0xff, 0x02, 0x33, 0x3a, 0xff, 0x02, 0xfd, 0x00, 0x00, 0x1a, 0xff,
-	0x02, 0x25, 0x02, 0x3f, 0x0e, 0xff, 0x00, 0x3e, 0xf9, 0x88, 0x8c, 0x9c,
-	0x6a, 0xcc, 0x9c, 0x8c, 0xcc, 0xcc, 0x6a, 0xc9, 0x6c, 0x99, 0x96, 0x66,
-	0x96, 0x96, 0xaa, 0x69, 0xc8, 0xcc, 0xcc, 0x88, 0x88, 0xc8, 0x88, 0xca,
-	0x77, 0x75, 0x52, 0x00, 0x10, 0xff, 0x02, 0xf2, 0x02, 0x33, 0x3a, 0xff,
-	0x02, 0xfb, 0x00, 0x00, 0x1a, 0xff, 0x02, 0x25, 0x02, 0x5f, 0x0e, 0xff,
-	0x00, 0x3e, 0x7c, 0xcc, 0xc8, 0xc9, 0xa8, 0xcc, 0xa6, 0x8b, 0x98, 0x9c,
-	0xaa, 0xcc, 0x89, 0x99, 0x99, 0x69, 0x99, 0x66, 0x99, 0x99, 0x9c, 0x8c,
-	0xcc, 0x88, 0xcc, 0xc8, 0x88, 0x86, 0xff, 0xf3, 0x55, 0x00, 0x12, 0xff,
-	0x02, 0x32, 0x3a, 0xff, 0x02, 0xfd, 0x00, 0x00, 0x1a, 0xff, 0x02, 0xf3,
-	0x02, 0x52, 0x0e, 0xff, 0x00, 0x1e, 0xd8, 0xcc, 0x6a, 0x89, 0x88, 0x9d,
-	0xc8, 0x88, 0x99, 0xc8, 0x96, 0x88, 0x8c, 0x99, 0x96, 0x00, 0x08, 0x99,
-	0x02, 0x98, 0x02, 0xcc, 0x08, 0x88, 0x00, 0x0e, 0xc8, 0x88, 0x88, 0x7f,
-	0xff, 0x35, 0x3f, 0x00, 0x0e, 0xff, 0x02, 0xf2, 0x02, 0x32, 0x3a, 0xff,
-	0x02, 0xfd, 0x00, 0x00, 0x1a, 0xff, 0x02, 0xf2, 0x02, 0x53, 0x0e, 0xff,
-	0x00, 0x1c, 0x99, 0xcc, 0xc6, 0xea, 0xcc, 0xe9, 0x8b, 0x8c, 0x6f, 0xcc,
-	0xc6, 0x88, 0x88, 0xc9, 0x08, 0x99, 0x00, 0x06, 0xc8, 0xca, 0xea, 0x00,
-	0x08, 0x88, 0x00, 0x0e, 0x8c, 0x8c, 0x8c, 0xdf, 0xff, 0x25, 0x53, 0x00,
-	0x0e, 0xff, 0x02, 0xf2, 0x02, 0x32, 0x3a, 0xff, 0x02, 0xf5, 0x00, 0x00,
-	0x1a, 0xff, 0x02, 0xf2, 0x02, 0x55, 0x0c, 0xff, 0x00, 0x2e, 0xfd, 0xc9,
-	0x8a, 0x96, 0xc9, 0x6c, 0x9c, 0x88, 0x8c, 0xef, 0xf9, 0xc9, 0x68, 0xb8,
-	0xc9, 0x99, 0x99, 0x9c, 0x88, 0xc6, 0xd7, 0xdd, 0xa9, 0x00, 0x0a, 0x88,
-	0x00, 0x0c, 0x96, 0xef, 0xff, 0xf2, 0x55, 0x2f, 0x0c, 0xff, 0x02, 0x23,
-	0x02, 0x3f, 0x3a, 0xff, 0x02, 0xfd, 0x00, 0x00, 0x1c, 0xff, 0x02, 0x34,
-	0x02, 0x2f, 0x0a, 0xff, 0x00, 0x44, 0xfc, 0xcc, 0xcc, 0x6a, 0xcc, 0xcd,
-	0xac, 0x88, 0xcd, 0xff, 0xff, 0x6c, 0x9a, 0x88, 0x86, 0x99, 0x9c, 0xc8,
-	0x8e, 0xde, 0x77, 0xea, 0xdd, 0xd9, 0x88, 0x88, 0x88, 0x8c, 0x97, 0xff,
-	0xff, 0xff, 0x25, 0x53, 0x0c, 0xff, 0x02, 0x33, 0x02, 0x2f, 0x3a, 0xff,
-	0x02, 0xf1, 0x00, 0x00, 0x1c, 0xff, 0x02, 0x25, 0x02, 0x5f, 0x0a, 0xff,
-	0x00, 0x46, 0xd6, 0xc9, 0xc9, 0xa8, 0xcc, 0x88, 0x68, 0x88, 0x9f, 0xff,
-	0xff, 0xf6, 0x9a, 0xc8, 0x89, 0x69, 0x9c, 0x86, 0xdd, 0xdd, 0x77, 0xda,
-	0xae, 0xed, 0xdc, 0x88, 0x88, 0xcc, 0xdf, 0xff, 0xff, 0xff, 0xf2, 0x55,
-	0x32, 0x00, 0x08, 0xff, 0x02, 0xf3, 0x02, 0x53, 0x3c, 0xff, 0x02, 0xfd,
-	0x00, 0x00, 0x1c, 0xff, 0x02, 0xf3, 0x02, 0x52, 0x0a, 0xff, 0x00, 0x10,
-	0x68, 0xc9, 0x99, 0x8c, 0x98, 0x88, 0x8c, 0x8a, 0x08, 0xff, 0x00, 0x22,
-	0x6c, 0x99, 0xc6, 0x69, 0x88, 0xde, 0xdd, 0xee, 0xe6, 0xc8, 0x6d, 0xdd,
-	0xdd, 0x68, 0x88, 0x89, 0x7f, 0x00, 0x08, 0xff, 0x00, 0x10, 0x25, 0x55,
-	0x32, 0xff, 0xff, 0x22, 0x35, 0x3f, 0x3c, 0xff, 0x02, 0xfb, 0x00, 0x00,
-	0x1c, 0xff, 0x00, 0x1e, 0xf2, 0x55, 0x2f, 0xff, 0xff, 0xff, 0xf6, 0xcc,
-	0x6a, 0xed, 0x99, 0x88, 0xc8, 0x88, 0x6f, 0x00, 0x08, 0xff, 0x00, 0x20,
-	0xf9, 0x96, 0xe9, 0x69, 0x6e, 0xaa, 0xde, 0xee, 0x66, 0xc8, 0xc6, 0xad,
-	0xdd, 0xe6, 0x88, 0x89, 0x0c, 0xff, 0x00, 0x0c, 0x25, 0x55, 0x53, 0x33,
-	0x35, 0x52, 0x3e, 0xff, 0x02, 0xfb, 0x00, 0x00, 0x1e, 0xff, 0x00, 0x1a,
-	0x35, 0x2f, 0xff, 0xff, 0xff, 0xd8, 0x89, 0x9c, 0xda, 0x9c, 0x88, 0x88,
-	0x89, 0x00, 0x0c, 0xff, 0x00, 0x1e, 0x77, 0xd9, 0x69, 0xd7, 0xdd, 0x77,
-	0x76, 0x6a, 0xcc, 0xc9, 0x6a, 0xdd, 0xd6, 0xc8, 0x89, 0x00, 0x0c, 0xff,
-	0x00, 0x0c, 0xf2, 0x23, 0x33, 0x53, 0x32, 0x2f, 0x3e, 0xff, 0x02, 0xf0,
-	0x00, 0x00, 0x1e, 0xff, 0x00, 0x1a, 0x25, 0x5f, 0xff, 0xff, 0xff, 0x9c,
-	0xca, 0xda, 0x99, 0xc8, 0xc8, 0x88, 0xc7, 0x00, 0x0e, 0xff, 0x00, 0x1c,
-	0xf6, 0x69, 0xe7, 0x77, 0x7e, 0x66, 0x6a, 0xcc, 0xcc, 0x9a, 0xad, 0xd6,
-	0xc8, 0xc6, 0x10, 0xff, 0x02, 0xf2, 0x02, 0xf2, 0x42, 0xff, 0x02, 0xf0,
-	0x00, 0x00, 0x1e, 0xff, 0x00, 0x1a, 0xf3, 0x53, 0xff, 0xff, 0xfa, 0xa6,
-	0xa7, 0xe9, 0xcc, 0x88, 0x8c, 0x8c, 0xaf, 0x00, 0x0e, 0xff, 0x00, 0x1c,
-	0xf6, 0x69, 0xd7, 0x77, 0xd6, 0x66, 0x6a, 0xc9, 0xcc, 0xc9, 0x6a, 0xd6,
-	0xc8, 0xca, 0x56, 0xff, 0x02, 0xf0, 0x00, 0x00, 0x1e, 0xff, 0x00, 0x18,
-	0xf2, 0x55, 0x2f, 0xff, 0x66, 0x98, 0x8c, 0xcc, 0xd9, 0xc8, 0xb8, 0x86,
-	0x10, 0xff, 0x00, 0x1c, 0xf6, 0x69, 0xae, 0xd6, 0x66, 0x6a, 0x6a, 0x9c,
-	0xc9, 0xc9, 0x99, 0xa9, 0xcc, 0xcd, 0x56, 0xff, 0x02, 0xfb, 0x00, 0x00,
-	0x20, 0xff, 0x00, 0x16, 0x25, 0x5f, 0xee, 0x69, 0x9c, 0x8c, 0xcc, 0xc6,
-	0xc8, 0x88, 0x9f, 0x00, 0x10, 0xff, 0x00, 0x1c, 0x76, 0x66, 0x66, 0x66,
-	0x6a, 0x66, 0x6a, 0xcc, 0x9c, 0xcc, 0xcc, 0xc8, 0x8c, 0xcd, 0x56, 0xff,
-	0x02, 0xfb, 0x00, 0x00, 0x20, 0xff, 0x00, 0x16, 0xf3, 0x50, 0x66, 0xc8,
-	0xcc, 0xc8, 0xc9, 0x8c, 0x98, 0x8c, 0x7f, 0x00, 0x10, 0xff, 0x02, 0xe6,
-	0x02, 0xa6, 0x0a, 0x66, 0x00, 0x0e, 0xc9, 0xcc, 0x99, 0x99, 0xcc, 0xcc,
-	0xce, 0x00, 0x56, 0xff, 0x02, 0xfb, 0x00, 0x00, 0x22, 0xff, 0x00, 0x12,
-	0x11, 0xc9, 0x98, 0xcc, 0xc9, 0x6c, 0x8c, 0xcc, 0xcd, 0x00, 0x12, 0xff,
-	0x00, 0x1c, 0xe6, 0xaa, 0x66, 0x66, 0x6c, 0xc6, 0x66, 0xcc, 0x99, 0xcc,
-	0x99, 0x9c, 0x89, 0x9e, 0x56, 0xff, 0x02, 0xf0, 0x00, 0x00, 0x1e, 0xff,
-	0x00, 0x16, 0x22, 0xff, 0x11, 0x18, 0x88, 0x99, 0x8c, 0xc9, 0x98, 0xbc,
-	0x9f, 0x00, 0x12, 0xff, 0x00, 0x1c, 0xe6, 0x66, 0x66, 0x66, 0x88, 0x86,
-	0xa9, 0xc8, 0x89, 0x69, 0x99, 0x99, 0xcc, 0xc7, 0x56, 0xff, 0x02, 0xfc,
-	0x00, 0x00, 0x1c, 0xff, 0x00, 0x18, 0xf2, 0x00, 0x02, 0x66, 0x11, 0x8c,
-	0x9c, 0x9c, 0xc8, 0xb8, 0x88, 0xdf, 0x12, 0xff, 0x00, 0x1c, 0xd9, 0x6a,
-	0x66, 0x68, 0x88, 0x96, 0x69, 0xc8, 0xc8, 0x96, 0x96, 0x99, 0x9c, 0x67,
-	0x56, 0xff, 0x02, 0xf0, 0x00, 0x00, 0x1c, 0xff, 0x00, 0x1e, 0xf0, 0x00,
-	0x00, 0x68, 0xc1, 0x18, 0xcc, 0x66, 0x98, 0x88, 0x88, 0xdf, 0xff, 0x23,
-	0x2f, 0x00, 0x0c, 0xff, 0x00, 0x1c, 0x66, 0x66, 0x69, 0x98, 0x99, 0x66,
-	0x69, 0xcc, 0xc9, 0x8a, 0x96, 0x99, 0xcc, 0xce, 0x56, 0xff, 0x02, 0xfc,
-	0x00, 0x00, 0x1c, 0xff, 0x00, 0x1e, 0x20, 0x00, 0x00, 0x98, 0x8c, 0x11,
-	0x86, 0x6a, 0xd9, 0xc8, 0x8c, 0xff, 0xf2, 0x32, 0x3f, 0x00, 0x0c, 0xff,
-	0x00, 0x1c, 0xa6, 0x66, 0x99, 0xc9, 0x69, 0x69, 0x99, 0xc9, 0xc6, 0xc9,
-	0x66, 0x99, 0xcc, 0xce, 0x56, 0xff, 0x02, 0xf0, 0x00, 0x00, 0x1c, 0xff,
-	0x00, 0x1e, 0x23, 0x00, 0x00, 0xc8, 0x8c, 0x91, 0x98, 0xcc, 0x6d, 0x98,
-	0x89, 0xff, 0xf3, 0x32, 0x3f, 0x00, 0x0c, 0xff, 0x00, 0x1c, 0x66, 0x69,
-	0xcc, 0x96, 0x99, 0x99, 0x6c, 0xc9, 0xc6, 0x6c, 0x96, 0xa6, 0x9c, 0x8e,
-	0x56, 0xff, 0x02, 0xfc, 0x00, 0x00, 0x1e, 0xff, 0x00, 0x1c, 0x23, 0x01,
-	0xc8, 0xc9, 0x9c, 0x11, 0x8b, 0x86, 0xac, 0x88, 0xaf, 0x23, 0x37, 0x2f,
-	0x0c, 0xff, 0x00, 0x1c, 0x66, 0x69, 0x89, 0x99, 0x69, 0x69, 0xcc, 0xc9,
-	0xc6, 0xd6, 0x88, 0x9a, 0x9c, 0xcf, 0x56, 0xff, 0x02, 0xfb, 0x00, 0x00,
-	0x20, 0xff, 0x00, 0x1a, 0xac, 0xc8, 0xc9, 0x8c, 0x61, 0x18, 0x88, 0x8c,
-	0xc8, 0x8e, 0x33, 0x23, 0x2f, 0x00, 0x0c, 0xff, 0x00, 0x1c, 0xa6, 0x68,
-	0x9c, 0xc6, 0x69, 0x99, 0x6c, 0x9c, 0xca, 0x66, 0xd9, 0x86, 0xa9, 0xcf,
-	0x56, 0xff, 0x02, 0xfc, 0x00, 0x00, 0x1e, 0xff, 0x00, 0x1a, 0xf7, 0x8a,
-	0x6d, 0xe9, 0x89, 0xcc, 0x11, 0x69, 0x88, 0xcc, 0xcd, 0x32, 0x33, 0x00,
-	0x0e, 0xff, 0x00, 0x1c, 0xa6, 0xc9, 0x69, 0xc9, 0xa9, 0x99, 0x9c, 0xcc,
-	0x96, 0xad, 0x66, 0xcc, 0xa9, 0x9f, 0x56, 0xff, 0x02, 0xf0, 0x00, 0x00,
-	0x1e, 0xff, 0x00, 0x1a, 0xf6, 0x89, 0xcc, 0x66, 0x6d, 0x98, 0xc1, 0x19,
-	0x19, 0xc8, 0x83, 0x23, 0x3f, 0x00, 0x0e, 0xff, 0x00, 0x1c, 0xa9, 0x96,
-	0x99, 0x99, 0xa9, 0x99, 0xcc, 0x9c, 0xc6, 0xaa, 0x69, 0x6c, 0xca, 0x6f,
-	0x56, 0xff, 0x02, 0xfc, 0x00, 0x00, 0x1e, 0xff, 0x00, 0x1a, 0xf9, 0xa8,
-	0x89, 0xc8, 0x9a, 0xa9, 0x6c, 0x64, 0x41, 0x19, 0xa3, 0x30, 0x3f, 0x00,
-	0x0e, 0xff, 0x00, 0x1c, 0x7a, 0xa6, 0x99, 0x9c, 0xa6, 0x66, 0xad, 0xc9,
-	0x9a, 0x6a, 0xa9, 0x96, 0xc9, 0x6f, 0x56, 0xff, 0x02, 0xfc, 0x00, 0x00,
-	0x1e, 0xff, 0x00, 0x1a, 0xf6, 0xc9, 0xac, 0x88, 0xc9, 0x88, 0xcc, 0xc6,
-	0x44, 0x00, 0x32, 0x70, 0x2f, 0x00, 0x10, 0xff, 0x00, 0x1a, 0x7d, 0xa9,
-	0x99, 0x66, 0x66, 0xae, 0x9c, 0xc9, 0x99, 0x9c, 0xc9, 0x99, 0xef, 0x00,
-	0x56, 0xff, 0x02, 0xf0, 0x00, 0x00, 0x20, 0xff, 0x00, 0x18, 0xa8, 0xca,
-	0xc9, 0x9b, 0x8c, 0x8b, 0x86, 0x11, 0x40, 0x32, 0x30, 0x3f, 0x0c, 0xff,
-	0x00, 0x1c, 0xf2, 0x32, 0xff, 0xff, 0xfe, 0x6a, 0x66, 0x6d, 0x9c, 0x99,
-	0x99, 0x66, 0x66, 0xae, 0x58, 0xff, 0x02, 0xfc, 0x00, 0x00, 0x20, 0xff,
-	0x00, 0x18, 0xf9, 0xcc, 0x88, 0x99, 0xc8, 0x88, 0x86, 0x00, 0x03, 0x32,
-	0x33, 0x02, 0x0c, 0xff, 0x00, 0x16, 0x23, 0x22, 0xff, 0xff, 0xff, 0xfd,
-	0x6d, 0x6a, 0xcc, 0x99, 0xd7, 0x00, 0x5e, 0xff, 0x02, 0xfb, 0x00, 0x00,
-	0x22, 0xff, 0x00, 0x18, 0xfa, 0xc8, 0xc8, 0x88, 0xc8, 0x8c, 0xa0, 0x33,
-	0x37, 0x32, 0x30, 0x02, 0x0a, 0xff, 0x02, 0x33, 0x02, 0x22, 0x08, 0xff,
-	0x00, 0x08, 0xad, 0xad, 0x69, 0x97, 0x60, 0xff, 0x02, 0xfb, 0x00, 0x00,
-	0x24, 0xff, 0x00, 0x24, 0x9c, 0xd9, 0x8c, 0xcc, 0x6d, 0xf2, 0x33, 0x23,
-	0x33, 0x50, 0x00, 0x02, 0xff, 0xff, 0xff, 0xf2, 0x00, 0x2f, 0x08, 0xff,
-	0x00, 0x08, 0x7a, 0xda, 0x9c, 0x7f, 0x60, 0xff, 0x02, 0xfb, 0x00, 0x00,
-	0x28, 0xff, 0x00, 0x20, 0xc9, 0x6a, 0xef, 0xf2, 0x32, 0x33, 0x00, 0x01,
-	0x00, 0x00, 0x52, 0xff, 0xff, 0xf0, 0x00, 0x2f, 0x08, 0xff, 0x00, 0x06,
-	0xfa, 0xad, 0xcd, 0x00, 0x62, 0xff, 0x02, 0xfc, 0x00, 0x00, 0x2a, 0xff,
-	0x00, 0x1c, 0xe7, 0xff, 0xf2, 0x32, 0x03, 0x33, 0x00, 0x01, 0x01, 0x00,
-	0x52, 0xff, 0x20, 0x03, 0x0a, 0xff, 0x00, 0x06, 0xfd, 0xad, 0xcf, 0x00,
-	0x62, 0xff, 0x02, 0xfa, 0x00, 0x00, 0x2e, 0xff, 0x00, 0x18, 0x23, 0x37,
-	0x32, 0xff, 0xf3, 0x00, 0x00, 0x11, 0x00, 0x52, 0x00, 0x0f, 0x0a, 0xff,
-	0x00, 0x06, 0xfd, 0x6d, 0xaf, 0x00, 0x62, 0xff, 0x02, 0xf0, 0x00, 0x00,
-	0x2e, 0xff, 0x00, 0x18, 0x23, 0x33, 0x3f, 0xff, 0xff, 0x23, 0x00, 0x00,
-	0x01, 0x00, 0x00, 0x2f, 0x0a, 0xff, 0x00, 0x06, 0xfe, 0xa0, 0x7f, 0x00,
-	0x62, 0xff, 0x02, 0xf0, 0x00, 0x00, 0x2e, 0xff, 0x02, 0x37, 0x02, 0x33,
-	0x08, 0xff, 0x00, 0x0c, 0x23, 0x00, 0x00, 0x10, 0x00, 0x02, 0x0a, 0xff,
-	0x00, 0x06, 0xf2, 0xd2, 0x32, 0x00, 0x62, 0xff, 0x02, 0xfc, 0x00, 0x00,
-	0x2c, 0xff, 0x00, 0x06, 0xf2, 0x33, 0x33, 0x00, 0x0a, 0xff, 0x00, 0x0c,
-	0xf3, 0x00, 0x01, 0x01, 0x00, 0x02, 0x08, 0xff, 0x00, 0x06, 0xf2, 0x02,
-	0x2f, 0x00, 0x62, 0xff, 0x02, 0xfa, 0x00, 0x00, 0x2c, 0xff, 0x00, 0x06,
-	0xf2, 0x22, 0x3f, 0x00, 0x0c, 0xff, 0x00, 0x18, 0xf3, 0x00, 0x10, 0x01,
-	0x00, 0x52, 0xff, 0xff, 0xff, 0xf3, 0x10, 0x2f, 0x62, 0xff, 0x02, 0xfc,
-	0x00, 0x00, 0x2c, 0xff, 0x00, 0x06, 0xf3, 0x23, 0x2f, 0x00, 0x0c, 0xff,
-	0x00, 0x16, 0xf2, 0x00, 0x00, 0x10, 0x10, 0x10, 0x03, 0xff, 0xff, 0x20,
-	0x03, 0x00, 0x64, 0xff, 0x02, 0xf9, 0x00, 0x00, 0x2e, 0xff, 0x02, 0x32,
-	0x0e, 0xff, 0x00, 0x16, 0x23, 0x13, 0x23, 0x01, 0x01, 0x01, 0x00, 0x03,
-	0x2f, 0x30, 0x0f, 0x00, 0x64, 0xff, 0x02, 0xfc, 0x00, 0x00, 0x3e, 0xff,
-	0x00, 0x16, 0x20, 0x02, 0xff, 0x23, 0x00, 0x10, 0x10, 0x10, 0x03, 0x00,
-	0x2f, 0x00, 0x0c, 0xff, 0x02, 0xf2, 0x56, 0xff, 0x02, 0xfb, 0x00, 0x00,
-	0x3e, 0xff, 0x00, 0x14, 0x00, 0x0f, 0xff, 0xff, 0x23, 0x00, 0x11, 0x10,
-	0x00, 0x00, 0x0e, 0xff, 0x02, 0x23, 0x02, 0x2f, 0x54, 0xff, 0x02, 0xf0,
-	0x00, 0x00, 0x3c, 0xff, 0x00, 0x1a, 0xf2, 0x00, 0x2f, 0xff, 0xff, 0xff,
-	0x23, 0x00, 0x01, 0x10, 0x00, 0x53, 0x2f, 0x00, 0x08, 0xff, 0x00, 0x06,
-	0xf2, 0x32, 0x3f, 0x00, 0x54, 0xff, 0x02, 0xfb, 0x00, 0x00, 0x3c, 0xff,
-	0x02, 0xf3, 0x02, 0x33, 0x0a, 0xff, 0x00, 0x1a, 0x23, 0x00, 0x11, 0x10,
-	0x10, 0x03, 0x2f, 0xff, 0xff, 0xff, 0xf3, 0x00, 0x2f, 0x00, 0x54, 0xff,
-	0x02, 0xfc, 0x00, 0x00, 0x3c, 0xff, 0x02, 0xf3, 0x02, 0x32, 0x0c, 0xff,
-	0x00, 0x16, 0x23, 0x00, 0x11, 0x11, 0x00, 0x03, 0x2f, 0xff, 0xff, 0x20,
-	0x13, 0x00, 0x56, 0xff, 0x02, 0xfb, 0x00, 0x00, 0x3c, 0xff, 0x02, 0xf2,
-	0x02, 0x2f, 0x0c, 0xff, 0x00, 0x16, 0xf3, 0x00, 0x00, 0x10, 0x11, 0x10,
-	0x53, 0x2f, 0xff, 0x30, 0x02, 0x00, 0x56, 0xff, 0x02, 0xfc, 0x00, 0x00,
-	0x4c, 0xff, 0x00, 0x16, 0x20, 0x02, 0x23, 0x01, 0x01, 0x01, 0x11, 0x03,
-	0x22, 0x01, 0x3f, 0x00, 0x56, 0xff, 0x02, 0xf0, 0x00, 0x00, 0x4a, 0xff,
-	0x00, 0x16, 0xf2, 0x30, 0x0f, 0xff, 0x23, 0x00, 0x11, 0x01, 0x10, 0x05,
-	0x00, 0x00, 0x58, 0xff, 0x02, 0xfc, 0x00, 0x00, 0x4a, 0xff, 0x00, 0x18,
-	0xf2, 0x01, 0x2f, 0xff, 0xff, 0x23, 0x00, 0x11, 0x01, 0x10, 0x15, 0x2f,
-	0x0c, 0xff, 0x02, 0x32, 0x02, 0x2f, 0x46, 0xff, 0x02, 0xf0, 0x00, 0x00,
-	0x4a, 0xff, 0x02, 0xf3, 0x02, 0x30, 0x08, 0xff, 0x00, 0x0e, 0x23, 0x00,
-	0x11, 0x11, 0x00, 0x03, 0x22, 0x00, 0x08, 0xff, 0x00, 0x06, 0xf2, 0x23,
-	0x2f, 0x00, 0x46, 0xff, 0x02, 0xf1, 0x00, 0x00, 0x4a, 0xff, 0x02, 0x23,
-	0x02, 0x32, 0x0a, 0xff, 0x00, 0x1a, 0x23, 0x00, 0x11, 0x11, 0x41, 0x03,
-	0x2f, 0xff, 0xff, 0xff, 0xf3, 0x33, 0x2f, 0x00, 0x46, 0xff, 0x02, 0xf0,
-	0x00, 0x00, 0x4a, 0xff, 0x02, 0xf2, 0x02, 0x32, 0x0c, 0xff, 0x00, 0x16,
-	0x23, 0x00, 0x11, 0x11, 0x01, 0x03, 0x2f, 0xff, 0xff, 0x20, 0x13, 0x00,
-	0x48, 0xff, 0x02, 0xf0, 0x00, 0x00, 0x5a, 0xff, 0x00, 0x16, 0xf0, 0x05,
-	0x00, 0x11, 0x14, 0x10, 0x00, 0x2f, 0xff, 0x31, 0x0f, 0x00, 0x48, 0xff,
-	0x02, 0xfa, 0x00, 0x00, 0x5a, 0xff, 0x00, 0x16, 0x20, 0x12, 0xf3, 0x01,
-	0x11, 0x11, 0x40, 0x03, 0x22, 0x01, 0x2f, 0x00, 0x48, 0xff, 0x02, 0xf0,
-	0x00, 0x00, 0x58, 0xff, 0x00, 0x16, 0xf2, 0x01, 0x3f, 0xff, 0xf3, 0x01,
-	0x01, 0x11, 0x41, 0x05, 0x00, 0x00, 0x4a, 0xff, 0x02, 0xf4, 0x00, 0x00,
-	0x58, 0xff, 0x00, 0x18, 0xf3, 0x00, 0x2f, 0xff, 0xff, 0xf3, 0x01, 0x11,
-	0x11, 0x11, 0x13, 0x2f, 0x0c, 0xff, 0x02, 0x22, 0x3a, 0xff, 0x02, 0xf0,
-	0x00, 0x00, 0x58, 0xff, 0x02, 0x23, 0x02, 0x30, 0x08, 0xff, 0x00, 0x0e,
-	0xf2, 0x30, 0x11, 0x14, 0x11, 0x03, 0x2f, 0x00, 0x08, 0xff, 0x02, 0xf3,
-	0x02, 0x33, 0x3a, 0xff, 0x02, 0xfb, 0x00, 0x00, 0x58, 0xff, 0x02, 0x23,
-	0x02, 0x22, 0x0a, 0xff, 0x00, 0x18, 0xf2, 0x30, 0x11, 0x14, 0x11, 0x03,
-	0x2f, 0xff, 0xff, 0xff, 0xf3, 0x33, 0x3a, 0xff, 0x02, 0xf0, 0x00, 0x00,
-	0x58, 0xff, 0x02, 0xf2, 0x02, 0x3f, 0x0c, 0xff, 0x00, 0x16, 0xf3, 0x01,
-	0x11, 0x11, 0x41, 0x03, 0x2f, 0xff, 0xff, 0x31, 0x02, 0x00, 0x3a, 0xff,
-	0x02, 0xf1, 0x00, 0x00, 0x68, 0xff, 0x00, 0x16, 0xf0, 0x13, 0x00, 0x11,
-	0x11, 0x11, 0x03, 0x2f, 0xff, 0x51, 0x3f, 0x00, 0x3a, 0xff, 0x02, 0xfc,
-	0x00, 0x00, 0x68, 0xff, 0x00, 0x16, 0x31, 0x02, 0xf3, 0x00, 0x11, 0x41,
-	0x41, 0x03, 0x22, 0x11, 0x2f, 0x00, 0x3a, 0xff, 0x02, 0xf0, 0x00, 0x00,
-	0x66, 0xff, 0x00, 0x16, 0xf2, 0x01, 0x3f, 0xff, 0xf3, 0x01, 0x11, 0x11,
-	0x11, 0x10, 0x13, 0x00, 0x3c, 0xff, 0x02, 0xf0, 0x00, 0x00, 0x66, 0xff,
-	0x00, 0x18, 0xf3, 0x10, 0x2f, 0xff, 0xff, 0xf2, 0x01, 0x11, 0x41, 0x41,
-	0x10, 0x2f, 0x0a, 0xff, 0x02, 0xf2, 0x02, 0x32, 0x2c, 0xff, 0x02, 0xf0,
-	0x00, 0x00, 0x66, 0xff, 0x02, 0x23, 0x02, 0x00, 0x08, 0xff, 0x00, 0x0e,
-	0xf2, 0x01, 0x11, 0x11, 0x14, 0x10, 0x3f, 0x00, 0x08, 0xff, 0x02, 0xf3,
-	0x02, 0x33, 0x2c, 0xff, 0x02, 0xf4, 0x00, 0x00, 0x66, 0xff, 0x02, 0x33,
-	0x02, 0x32, 0x0a, 0xff, 0x00, 0x18, 0xf3, 0x00, 0x14, 0x11, 0x11, 0x40,
-	0x2f, 0xff, 0xff, 0xff, 0x25, 0x32, 0x2c, 0xff, 0x02, 0xf0, 0x00, 0x00,
-	0x66, 0xff, 0x02, 0x23, 0x02, 0x3f, 0x0c, 0xff, 0x00, 0x16, 0xf0, 0x11,
-	0x11, 0x41, 0x11, 0x10, 0x2f, 0xff, 0xff, 0x01, 0x02, 0x00, 0x2c, 0xff,
-	0x02, 0xf2, 0x00, 0x00, 0x66, 0xff, 0x02, 0xf2, 0x02, 0x2f, 0x0c, 0xff,
-	0x00, 0x16, 0x21, 0x13, 0x01, 0x11, 0x14, 0x11, 0x10, 0x2f, 0xf2, 0x11,
-	0x3f, 0x00, 0x2c, 0xff, 0x02, 0xf0, 0x00, 0x00, 0x76, 0xff, 0x00, 0x16,
-	0x31, 0x0f, 0xf2, 0x01, 0x11, 0x14, 0x11, 0x15, 0x25, 0x10, 0x2f, 0x00,
-	0x2c, 0xff, 0x02, 0xf1, 0x00, 0x00, 0x74, 0xff, 0x00, 0x16, 0xf2, 0x11,
-	0x3f, 0xff, 0xf3, 0x00, 0x11, 0x14, 0x11, 0x11, 0x13, 0x00, 0x0e, 0xff,
-	0x02, 0x2f, 0x1e, 0xff, 0x02, 0xf0, 0x00, 0x00, 0x74, 0xff, 0x00, 0x18,
-	0xf3, 0x10, 0xff, 0xff, 0xff, 0xf2, 0x00, 0x11, 0x14, 0x11, 0x10, 0x32,
-	0x0a, 0xff, 0x02, 0xf3, 0x02, 0x33, 0x1e, 0xff, 0x02, 0xf0, 0x00, 0x00,
-	0x74, 0xff, 0x02, 0x23, 0x02, 0x32, 0x08, 0xff, 0x00, 0x0e, 0xf2, 0x30,
-	0x11, 0x14, 0x11, 0x10, 0x32, 0x00, 0x08, 0xff, 0x02, 0xf3, 0x02, 0x33,
-	0x1e, 0xff, 0x02, 0xfb, 0x00, 0x00, 0x74, 0xff, 0x02, 0x23, 0x02, 0x3f,
-	0x0a, 0xff, 0x00, 0x18, 0xf2, 0x31, 0x11, 0x41, 0x14, 0x10, 0x32, 0xff,
-	0xff, 0xff, 0x30, 0x32, 0x1e, 0xff, 0x02, 0xf0, 0x00, 0x00, 0x84, 0xff,
-	0x00, 0x16, 0x20, 0x11, 0x11, 0x41, 0x11, 0x10, 0x32, 0xff, 0xf2, 0x01,
-	0x0f, 0x00, 0x1e, 0xff, 0x02, 0xfb, 0x00, 0x00, 0x84, 0xff, 0x00, 0x16,
-	0x51, 0x13, 0x31, 0x11, 0x14, 0x11, 0x11, 0x32, 0xf3, 0x11, 0x3f, 0x00,
-	0x1e, 0xff, 0x02, 0xf0, 0x00, 0x00, 0x82, 0xff, 0x00, 0x18, 0xf2, 0x11,
-	0x3f, 0xf2, 0x01, 0x11, 0x14, 0x11, 0x10, 0x50, 0x10, 0x2f, 0x1e, 0xff,
-	0x02, 0xf7, 0x00, 0x00, 0x82, 0xff, 0x00, 0x16, 0xf0, 0x10, 0xff, 0xff,
-	0xf2, 0x51, 0x11, 0x41, 0x11, 0x11, 0x12, 0x00, 0x0c, 0xff, 0x02, 0xf2,
-	0x12, 0xff, 0x02, 0xf0, 0x00, 0x00, 0x82, 0xff, 0x00, 0x18, 0x20, 0x13,
-	0xff, 0xff, 0xff, 0xf2, 0x00, 0x11, 0x41, 0x41, 0x11, 0x2f, 0x0a, 0xff,
-	0x02, 0xf3, 0x02, 0x32, 0x10, 0xff, 0x02, 0xf2, 0x00, 0x00, 0x82, 0xff,
-	0x02, 0x33, 0x02, 0x32, 0x08, 0xff, 0x00, 0x0e, 0xf2, 0x01, 0x11, 0x11,
-	0x41, 0x11, 0x3f, 0x00, 0x08, 0xff, 0x02, 0x23, 0x02, 0x33, 0x10, 0xff,
-	0x02, 0xf0, 0x00, 0x00, 0x82, 0xff, 0x02, 0x33, 0x02, 0x3f, 0x0a, 0xff,
-	0x00, 0x18, 0xf2, 0x51, 0x41, 0x14, 0x11, 0x11, 0x3f, 0xff, 0xff, 0xff,
-	0x30, 0x02, 0x10, 0xff, 0x02, 0xf0, 0x00, 0x00, 0x82, 0xff, 0x02, 0xf2,
-	0x02, 0x2f, 0x0c, 0xff, 0x00, 0x16, 0x31, 0x11, 0x11, 0x41, 0x14, 0x11,
-	0x32, 0xff, 0xf2, 0x01, 0x3f, 0x00, 0x10, 0xff, 0x02, 0xf4, 0x00, 0x00,
-	0x92, 0xff, 0x00, 0x16, 0x01, 0x02, 0x31, 0x11, 0x41, 0x14, 0x11, 0x32,
-	0xf3, 0x11, 0x2f, 0x00, 0x10, 0xff, 0x02, 0xf0, 0x00, 0x00, 0x90, 0xff,
-	0x00, 0x16, 0xf2, 0x11, 0x3f, 0xf2, 0x00, 0x11, 0x41, 0x11, 0x11, 0x50,
-	0x13, 0x00, 0x12, 0xff, 0x02, 0xf7, 0x00, 0x00, 0x90, 0xff, 0x00, 0x16,
-	0xf0, 0x10, 0xff, 0xff, 0xf2, 0x31, 0x11, 0x41, 0x41, 0x11, 0x12, 0x00,
-	0x12, 0xff, 0x02, 0xf0, 0x00, 0x00, 0x90, 0xff, 0x00, 0x18, 0x20, 0x13,
-	0xff, 0xff, 0xff, 0xf2, 0x31, 0x11, 0x11, 0x41, 0x41, 0x3f, 0x10, 0xff,
-	0x02, 0xf2, 0x00, 0x00, 0x90, 0xff, 0x02, 0x33, 0x02, 0x32, 0x08, 0xff,
-	0x00, 0x0e, 0xf2, 0x31, 0x14, 0x11, 0x11, 0x11, 0x3f, 0x00, 0x0e, 0xff,
-	0x02, 0xf0, 0x00, 0x00, 0x90, 0xff, 0x02, 0x33, 0x02, 0x2f, 0x0a, 0xff,
-	0x00, 0x0e, 0xf2, 0x31, 0x11, 0x41, 0x41, 0x41, 0x32, 0x00, 0x0c, 0xff,
-	0x02, 0xf2, 0x00, 0x00, 0x90, 0xff, 0x02, 0xf2, 0x0e, 0xff, 0x00, 0x0c,
-	0x21, 0x00, 0x11, 0x11, 0x11, 0x13, 0x0c, 0xff, 0x02, 0xf0, 0x00, 0x00,
-	0xa0, 0xff, 0x00, 0x0c, 0x01, 0x3f, 0x20, 0x11, 0x41, 0x12, 0x0c, 0xff,
-	0x02, 0xf0, 0x00, 0x00, 0x9e, 0xff, 0x00, 0x0e, 0xf3, 0x11, 0xff, 0xff,
-	0x30, 0x11, 0x3f, 0x00, 0x0c, 0xff, 0x02, 0xf0, 0x00, 0x00, 0x9e, 0xff,
-	0x00, 0x0e, 0xf0, 0x13, 0xff, 0xff, 0xff, 0x33, 0x2f, 0x00, 0x0c, 0xff,
-	0x02, 0xf0, 0x00, 0x00, 0x9e, 0xff, 0x02, 0x33, 0x02, 0x02, 0x16, 0xff,
-	0x02, 0xf2, 0x00, 0x00, 0x9e, 0xff, 0x02, 0x32, 0x02, 0x3f, 0x16, 0xff,
-	0x02, 0xf0, 0x00, 0x00, 0x9e, 0xff, 0x02, 0x23, 0x02, 0x3f, 0x16, 0xff,
-	0x02, 0xfb, 0x00, 0x00, 0xb8, 0xff, 0x02, 0xf0, 0x00, 0x01, 0x00, 0x00
+/*
+ * Generated by tools/make_bitmap_runs.py from splash.bmp, do not edit.
+ */
+
+#ifndef __BITMAP_SPLASH_H__
+#define __BITMAP_SPLASH_H__
+
+#include "ui.hpp"
+
+namespace ui {
+
+static constexpr Color bitmap_splash_palette[] = {
+	0x80e2, 0xa964, 0x2020, 0x4840, 0xc800, 0x7000, 0x8410, 0x18e3,
+	0xce59, 0x9cd3, 0x6b4d, 0xffff, 0xb596, 0x528a, 0x31a6, 0x0000,
 };
-unsigned int splash_bmp_len = 12840;
+
+static constexpr uint8_t bitmap_splash_runs[] = {
+	0xff, 0xff, 0xff, 0x38, 0x02, 0x13, 0xff, 0xa6, 0x03, 0x02, 0x03, 0xff,
+	0xa6, 0x13, 0x00, 0x02, 0xff, 0xa6, 0x00, 0x01, 0x03, 0x5f, 0x13, 0x02,
+	0xff, 0x9d, 0x03, 0x11, 0x3f, 0x03, 0x00, 0x11, 0x03, 0xff, 0x9e, 0x00,
+	0x01, 0x03, 0x0f, 0x02, 0x00, 0x11, 0x04, 0x11, 0x02, 0xff, 0x8e, 0x02,
+	0xdf, 0x02, 0x01, 0x10, 0x61, 0x03, 0xff, 0x8d, 0x13, 0x02, 0xbf, 0x02,
+	0x03, 0x21, 0x04, 0x01, 0x04, 0x01, 0x04, 0x01, 0x03, 0x02, 0xff, 0x8d,
+	0x23, 0x02, 0x8f, 0x02, 0x03, 0x11, 0x04, 0x51, 0x03, 0xff, 0x90, 0x02,
+	0x00, 0x01, 0x03, 0x6f, 0x02, 0x03, 0x41, 0x04, 0x01, 0x04, 0x01, 0x03,
+	0xff, 0x93, 0x00, 0x01, 0x00, 0x4f, 0x02, 0x03, 0x21, 0x04, 0x01, 0x04,
+	0x31, 0x02, 0xff, 0x94, 0x02, 0x11, 0x03, 0x1f, 0x02, 0x10, 0x11, 0x04,
+	0x41, 0x05, 0x00, 0x01, 0x03, 0xff, 0x95, 0x00, 0x01, 0x00, 0x02, 0x03,
+	0x21, 0x04, 0x11, 0x04, 0x11, 0x03, 0x02, 0x0f, 0x03, 0x11, 0x02, 0xff,
+	0x85, 0x12, 0xcf, 0x03, 0x41, 0x04, 0x11, 0x04, 0x11, 0x03, 0x02, 0x2f,
+	0x02, 0x00, 0x01, 0x03, 0xff, 0x84, 0x23, 0xbf, 0x02, 0x05, 0x01, 0x04,
+	0x11, 0x04, 0x31, 0x03, 0x6f, 0x03, 0x10, 0x02, 0xff, 0x83, 0x23, 0x02,
+	0x8f, 0x02, 0x00, 0x41, 0x04, 0x21, 0x03, 0x8f, 0x02, 0x23, 0xff, 0x83,
+	0x02, 0x00, 0x01, 0x03, 0x6f, 0x02, 0x10, 0x11, 0x04, 0x01, 0x04, 0x21,
+	0x02, 0xbf, 0x13, 0x02, 0xff, 0x84, 0x00, 0x01, 0x00, 0x4f, 0x02, 0x05,
+	0x21, 0x04, 0x51, 0x02, 0xcf, 0x02, 0xff, 0x86, 0x02, 0x11, 0x03, 0x1f,
+	0x02, 0x00, 0x31, 0x04, 0x21, 0x00, 0x05, 0x00, 0x01, 0x00, 0x02, 0xff,
+	0x94, 0x05, 0x11, 0x13, 0x31, 0x04, 0x31, 0x03, 0x02, 0x0f, 0x03, 0x11,
+	0x03, 0xff, 0x94, 0x02, 0x00, 0x31, 0x04, 0x31, 0x00, 0x03, 0x02, 0x2f,
+	0x02, 0x00, 0x01, 0x00, 0xff, 0x84, 0x02, 0x13, 0xbf, 0x02, 0x03, 0x21,
+	0x04, 0x11, 0x04, 0x01, 0x00, 0x03, 0x02, 0x5f, 0x03, 0x00, 0x03, 0x02,
+	0xff, 0x83, 0x02, 0x13, 0x02, 0x8f, 0x02, 0x03, 0x00, 0x21, 0x04, 0x21,
+	0x00, 0x03, 0x02, 0x8f, 0x23, 0xff, 0x84, 0x03, 0x01, 0x00, 0x6f, 0x02,
+	0x10, 0x21, 0x04, 0x21, 0x00, 0x03, 0x02, 0xaf, 0x23, 0xff, 0x84, 0x02,
+	0x11, 0x03, 0x3f, 0x03, 0x10, 0x21, 0x04, 0x41, 0x03, 0xdf, 0x02, 0xff,
+	0x86, 0x03, 0x01, 0x00, 0x1f, 0x02, 0x00, 0x31, 0x04, 0x21, 0x05, 0x02,
+	0x05, 0x01, 0x00, 0x02, 0xff, 0x85, 0x12, 0xcf, 0x02, 0x11, 0x03, 0x00,
+	0x31, 0x04, 0x21, 0x00, 0x02, 0x1f, 0x02, 0x11, 0x03, 0xff, 0x84, 0x02,
+	0x13, 0xdf, 0x00, 0x31, 0x04, 0x31, 0x00, 0x02, 0x4f, 0x00, 0x01, 0x00,
+	0x02, 0xff, 0x83, 0x23, 0x02, 0xaf, 0x03, 0x10, 0x01, 0x04, 0x31, 0x04,
+	0x00, 0x02, 0x6f, 0x02, 0x05, 0x03, 0x02, 0xff, 0x83, 0x02, 0x03, 0x10,
+	0x8f, 0x02, 0x00, 0x51, 0x04, 0x01, 0x00, 0x03, 0x9f, 0x23, 0xff, 0x84,
+	0x03, 0x01, 0x00, 0x02, 0x5f, 0x02, 0x00, 0x21, 0x04, 0x01, 0x04, 0x11,
+	0x00, 0x02, 0xbf, 0x02, 0x03, 0x02, 0xff, 0x84, 0x02, 0x00, 0x01, 0x03,
+	0x3f, 0x03, 0x00, 0x71, 0x00, 0x01, 0x03, 0xff, 0x95, 0x03, 0x01, 0x00,
+	0x02, 0x0f, 0x03, 0x10, 0x11, 0x04, 0x01, 0x04, 0x01, 0x00, 0x03, 0x12,
+	0x11, 0x02, 0xff, 0x95, 0x00, 0x01, 0x03, 0x10, 0x51, 0x00, 0x03, 0x02,
+	0x2f, 0x05, 0x01, 0x03, 0xff, 0x85, 0x02, 0x03, 0xdf, 0x03, 0x00, 0x41,
+	0x04, 0x01, 0x00, 0x03, 0x02, 0x4f, 0x03, 0x01, 0x00, 0x02, 0xff, 0x83,
+	0x02, 0x03, 0x12, 0xaf, 0x02, 0x03, 0x00, 0x21, 0x04, 0x11, 0x00, 0x03,
+	0x02, 0x7f, 0x23, 0xff, 0x83, 0x02, 0x13, 0x00, 0x8f, 0x02, 0x03, 0x00,
+	0x21, 0x04, 0x11, 0x00, 0x03, 0x02, 0x9f, 0x23, 0xff, 0x84, 0x03, 0x10,
+	0x02, 0x5f, 0x03, 0x00, 0x71, 0x03, 0x02, 0xcf, 0x12, 0xff, 0x84, 0x02,
+	0x00, 0x01, 0x03, 0x3f, 0x03, 0x00, 0x01, 0x00, 0x21, 0x04, 0x01, 0x00,
+	0x05, 0x10, 0xff, 0x95, 0x02, 0x00, 0x01, 0x02, 0x0f, 0x03, 0x00, 0x41,
+	0x04, 0x10, 0x03, 0x12, 0x00, 0x01, 0x02, 0xff, 0x95, 0x10, 0x05, 0x10,
+	0x21, 0x04, 0x01, 0x20, 0x02, 0x2f, 0x03, 0x01, 0x00, 0xff, 0x85, 0x02,
+	0x03, 0x02, 0xbf, 0x02, 0x03, 0x10, 0x31, 0x00, 0x01, 0x00, 0x03, 0x02,
+	0x4f, 0x02, 0x00, 0x01, 0x03, 0xff, 0x83, 0x02, 0x13, 0x02, 0x9f, 0x02,
+	0x03, 0x10, 0x31, 0x04, 0x01, 0x00, 0x03, 0x02, 0x7f, 0x23, 0x02, 0xff,
+	0x83, 0x13, 0x00, 0x7f, 0x02, 0x03, 0x10, 0x31, 0x20, 0x03, 0x12, 0x8f,
+	0x12, 0x03, 0x02, 0xff, 0x83, 0x02, 0x00, 0x01, 0x02, 0x4f, 0x02, 0x03,
+	0x10, 0x11, 0x00, 0x11, 0x00, 0x01, 0x05, 0x02, 0xcf, 0x03, 0x12, 0xff,
+	0x83, 0x02, 0x03, 0x10, 0x2f, 0x02, 0x03, 0x10, 0x11, 0x00, 0x11, 0x10,
+	0x05, 0x10, 0xff, 0x95, 0x02, 0x10, 0x12, 0x03, 0x00, 0x01, 0x00, 0x01,
+	0x00, 0x21, 0x00, 0x03, 0x12, 0x00, 0x01, 0x03, 0xff, 0x85, 0x12, 0xdf,
+	0x03, 0x30, 0x01, 0x00, 0x21, 0x00, 0x05, 0x03, 0x02, 0x2f, 0x03, 0x10,
+	0x02, 0xff, 0x84, 0x13, 0x02, 0xbf, 0x02, 0x03, 0x10, 0x31, 0x20, 0x03,
+	0x02, 0x4f, 0x02, 0x00, 0x01, 0x03, 0xff, 0x84, 0x23, 0x9f, 0x02, 0x03,
+	0x10, 0x21, 0x00, 0x01, 0x10, 0x03, 0x02, 0x7f, 0x03, 0x10, 0x02, 0xff,
+	0x83, 0x02, 0x10, 0x02, 0x6f, 0x02, 0x03, 0x20, 0x11, 0x20, 0x05, 0x03,
+	0x02, 0x9f, 0x02, 0x03, 0x02, 0x03, 0xff, 0x84, 0x20, 0x4f, 0x02, 0x03,
+	0x10, 0x21, 0x40, 0xdf, 0x02, 0x03, 0x02, 0xff, 0x84, 0x02, 0x10, 0x02,
+	0x1f, 0x02, 0x03, 0x10, 0x01, 0x00, 0x01, 0x00, 0x01, 0x10, 0x03, 0x10,
+	0x02, 0xdf, 0x02, 0xff, 0x75, 0x03, 0x02, 0xdf, 0x02, 0x03, 0x01, 0x03,
+	0x02, 0x03, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x20, 0x03, 0x02, 0x0f,
+	0x03, 0x10, 0xff, 0x83, 0x03, 0x02, 0x03, 0x02, 0xdf, 0x02, 0x30, 0x01,
+	0x00, 0x01, 0x00, 0x01, 0x10, 0x03, 0x3f, 0x02, 0x10, 0x03, 0xff, 0x82,
+	0x22, 0x03, 0xdf, 0x03, 0x10, 0x01, 0x10, 0x01, 0x10, 0x05, 0x02, 0x6f,
+	0x03, 0x01, 0x00, 0x02, 0xff, 0x81, 0x02, 0x33, 0xaf, 0x03, 0x20, 0x01,
+	0x00, 0x01, 0x20, 0x02, 0x8f, 0x02, 0x00, 0x12, 0xff, 0x82, 0x03, 0x07,
+	0x13, 0x7f, 0x02, 0x03, 0x30, 0x01, 0x30, 0x02, 0xaf, 0x02, 0x0d, 0x02,
+	0x03, 0x02, 0xff, 0x81, 0x02, 0x33, 0x4f, 0x02, 0x03, 0x40, 0x01, 0x30,
+	0x02, 0xbf, 0x0e, 0x0a, 0x00, 0x07, 0xff, 0x82, 0x02, 0x13, 0x07, 0x03,
+	0x02, 0x2f, 0x03, 0x30, 0x11, 0x10, 0x05, 0x02, 0x20, 0xbf, 0x0d, 0x06,
+	0x0d, 0x0a, 0xff, 0x7e, 0x0e, 0x07, 0x2f, 0x02, 0x03, 0x02, 0x00, 0x23,
+	0x20, 0x01, 0x00, 0x01, 0x10, 0x05, 0x02, 0x1f, 0x02, 0x10, 0x03, 0xaf,
+	0x0d, 0x0a, 0x0d, 0x0c, 0xff, 0x7c, 0x0c, 0x09, 0x06, 0x0a, 0x0e, 0x1f,
+	0x02, 0x03, 0x02, 0x13, 0x20, 0x01, 0x30, 0x05, 0x02, 0x4f, 0x20, 0x02,
+	0x9f, 0x1a, 0x0d, 0x0c, 0x0d, 0xff, 0x77, 0x09, 0x0c, 0x0d, 0x09, 0x08,
+	0x2c, 0x06, 0x0d, 0x0f, 0x02, 0x13, 0x02, 0x23, 0x05, 0x30, 0x02, 0x6f,
+	0x02, 0x10, 0x02, 0x8f, 0x07, 0x0a, 0x0d, 0x0a, 0x09, 0x0c, 0x07, 0xff,
+	0x75, 0x0a, 0x0c, 0x08, 0x0c, 0x28, 0x0c, 0x18, 0x0c, 0x0a, 0x00, 0x23,
+	0x07, 0x03, 0x02, 0x03, 0x10, 0x02, 0x9f, 0x13, 0x12, 0x7f, 0x0a, 0x0d,
+	0x0a, 0x0d, 0x06, 0x19, 0x07, 0xff, 0x72, 0x09, 0x1c, 0x18, 0x19, 0x0c,
+	0x38, 0x06, 0x20, 0x13, 0x02, 0x13, 0x00, 0x02, 0xbf, 0x02, 0x03, 0x12,
+	0x6f, 0x0d, 0x06, 0x0d, 0x06, 0x0a, 0x1c, 0x19, 0x0d, 0x07, 0xff, 0x6f,
+	0x0a, 0x08, 0x0c, 0x0a, 0x0c, 0x19, 0x0b, 0x08, 0x0c, 0x08, 0x0b, 0x08,
+	0x06, 0x11, 0x04, 0x00, 0x03, 0x02, 0x03, 0x00, 0x03, 0xdf, 0x02, 0x03,
+	0x02, 0x4f, 0x0e, 0x06, 0x0a, 0x26, 0x0d, 0x09, 0x0c, 0x39, 0x36, 0x0a,
+	0x0e, 0xff, 0x68, 0x06, 0x0c, 0x09, 0x0a, 0x0c, 0x18, 0x0c, 0x09, 0x18,
+	0x2c, 0x06, 0x14, 0x10, 0x03, 0x02, 0x07, 0x00, 0x02, 0xff, 0x01, 0x07,
+	0x0d, 0x0a, 0x29, 0x36, 0x0a, 0x0e, 0x09, 0x1c, 0x39, 0x1c, 0x29, 0x0e,
+	0xff, 0x67, 0x09, 0x0a, 0x18, 0x09, 0x0c, 0x08, 0x09, 0x1a, 0x09, 0x06,
+	0x0c, 0x06, 0x14, 0x11, 0x09, 0x0a, 0x13, 0x00, 0x03, 0xef, 0x07, 0x1a,
+	0x06, 0x29, 0x0c, 0x0a, 0x26, 0x0a, 0x0d, 0x0c, 0x19, 0x0a, 0x06, 0x1a,
+	0x19, 0x06, 0x0c, 0x09, 0x06, 0xff, 0x67, 0x06, 0x08, 0x09, 0x1c, 0x26,
+	0x0d, 0x09, 0x08, 0x0c, 0x11, 0x09, 0x01, 0x09, 0x0c, 0x18, 0x03, 0x02,
+	0x13, 0xef, 0x0a, 0x19, 0x06, 0x39, 0x0a, 0x29, 0x1c, 0x09, 0x1c, 0x06,
+	0x1a, 0x06, 0x09, 0x06, 0x1c, 0x0a, 0x06, 0xff, 0x67, 0x07, 0x08, 0x0a,
+	0x06, 0x0d, 0x0e, 0x09, 0x08, 0x09, 0x1c, 0x11, 0x06, 0x09, 0x18, 0x2c,
+	0x0d, 0x03, 0x02, 0x13, 0xdf, 0x0a, 0x06, 0x0c, 0x09, 0x06, 0x09, 0x0c,
+	0x09, 0x0a, 0x39, 0x2c, 0x09, 0x06, 0x0a, 0x0d, 0x16, 0x1c, 0x0a, 0x19,
+	0xff, 0x68, 0x0a, 0x1c, 0x08, 0x0c, 0x09, 0x08, 0x0c, 0x06, 0x11, 0x38,
+	0x1c, 0x18, 0x0e, 0x13, 0x02, 0x03, 0x02, 0xcf, 0x0a, 0x16, 0x08, 0x09,
+	0x1c, 0x16, 0x29, 0x06, 0x0c, 0x09, 0x1c, 0x0a, 0x16, 0x0d, 0x09, 0x08,
+	0x06, 0x0a, 0x09, 0x0c, 0xff, 0x66, 0x02, 0x03, 0x00, 0x01, 0x0c, 0x08,
+	0x0c, 0x19, 0x0c, 0x11, 0x08, 0x0b, 0x08, 0x06, 0x0a, 0x0c, 0x18, 0x0a,
+	0x0f, 0x02, 0x13, 0x07, 0x02, 0xcf, 0x26, 0x09, 0x08, 0x29, 0x06, 0x09,
+	0x06, 0x09, 0x2c, 0x09, 0x0c, 0x06, 0x0d, 0x06, 0x18, 0x09, 0x0a, 0x09,
+	0x1c, 0xff, 0x64, 0x02, 0x03, 0x30, 0x0c, 0x18, 0x0c, 0x09, 0x01, 0x09,
+	0x08, 0x1c, 0x06, 0x0d, 0x09, 0x18, 0x09, 0x2f, 0x13, 0x02, 0x03, 0xcf,
+	0x26, 0x09, 0x1c, 0x09, 0x06, 0x39, 0x06, 0x1c, 0x09, 0x0c, 0x16, 0x0c,
+	0x09, 0x06, 0x0a, 0x06, 0x09, 0x0c, 0x08, 0x0e, 0xff, 0x63, 0x02, 0x40,
+	0x09, 0x18, 0x0c, 0x11, 0x08, 0x16, 0x0a, 0x0d, 0x09, 0x0c, 0x18, 0x0c,
+	0x2f, 0x02, 0x03, 0x02, 0x03, 0xcf, 0x0a, 0x26, 0x19, 0x0c, 0x09, 0x06,
+	0x09, 0x06, 0x29, 0x0c, 0x09, 0x0c, 0x06, 0x0c, 0x09, 0x16, 0x19, 0x2c,
+	0x0e, 0xff, 0x64, 0x40, 0x06, 0x08, 0x0c, 0x11, 0x08, 0x1c, 0x16, 0x09,
+	0x48, 0x0d, 0x2f, 0x02, 0x03, 0x02, 0xcf, 0x46, 0x19, 0x08, 0x19, 0x26,
+	0x09, 0x2c, 0x09, 0x08, 0x0a, 0x09, 0x06, 0x19, 0x2c, 0x0e, 0xff, 0x64,
+	0x02, 0x20, 0x02, 0x16, 0x11, 0x08, 0x0c, 0x09, 0x0c, 0x09, 0x1c, 0x08,
+	0x0b, 0x28, 0x0d, 0xff, 0x03, 0x0d, 0x09, 0x06, 0x0a, 0x26, 0x28, 0x09,
+	0x16, 0x09, 0x0c, 0x08, 0x0c, 0x08, 0x09, 0x06, 0x09, 0x06, 0x29, 0x0c,
+	0x06, 0x07, 0xff, 0x65, 0x12, 0x1f, 0x21, 0x28, 0x19, 0x08, 0x1c, 0x19,
+	0x08, 0x0b, 0x0c, 0x09, 0xff, 0x03, 0x0e, 0x66, 0x28, 0x06, 0x0a, 0x09,
+	0x0c, 0x18, 0x09, 0x06, 0x49, 0x2c, 0x07, 0xff, 0x69, 0x11, 0x0c, 0x19,
+	0x08, 0x2c, 0x09, 0x06, 0x0c, 0x08, 0x3c, 0x0d, 0xff, 0x02, 0x0e, 0x06,
+	0x1a, 0x46, 0x1c, 0x26, 0x1c, 0x19, 0x1c, 0x29, 0x0c, 0x08, 0x19, 0x0e,
+	0xff, 0x68, 0x03, 0x05, 0x00, 0x16, 0x0c, 0x08, 0x2c, 0x08, 0x0c, 0x09,
+	0x08, 0x0c, 0x09, 0x18, 0x0c, 0x07, 0xff, 0x01, 0x0e, 0x06, 0x0a, 0xa6,
+	0x0c, 0x09, 0x1c, 0x39, 0x4c, 0x0e, 0xff, 0x67, 0x02, 0x15, 0x0f, 0x1e,
+	0x06, 0x19, 0x0c, 0x08, 0x3c, 0x06, 0x0c, 0x28, 0x09, 0xff, 0x01, 0x07,
+	0x76, 0x0a, 0x26, 0x0a, 0x1c, 0x09, 0x5c, 0x18, 0x1c, 0x0d, 0xff, 0x66,
+	0x02, 0x15, 0x02, 0x2f, 0x16, 0x09, 0x18, 0x2c, 0x0d, 0x09, 0x0c, 0x08,
+	0x0b, 0x18, 0x06, 0xff, 0x01, 0x16, 0x09, 0x0a, 0x0e, 0x0d, 0x36, 0x0a,
+	0x06, 0x0a, 0x09, 0x1c, 0x09, 0x0c, 0x29, 0x0a, 0x09, 0x2c, 0x0d, 0xff,
+	0x66, 0x03, 0x05, 0x03, 0x4f, 0x1a, 0x06, 0x0a, 0x07, 0x0e, 0x09, 0x1c,
+	0x28, 0x0c, 0x08, 0x0c, 0x0a, 0xff, 0x00, 0x16, 0x09, 0x0d, 0x27, 0x0d,
+	0x36, 0x0a, 0x0c, 0x09, 0x2c, 0x09, 0x06, 0x0a, 0x0d, 0x06, 0x0c, 0x08,
+	0x0c, 0x0a, 0xff, 0x65, 0x02, 0x15, 0x6f, 0x09, 0x1c, 0x0a, 0x0d, 0x0a,
+	0x19, 0x0c, 0x08, 0x0c, 0x28, 0x0c, 0x07, 0xef, 0x16, 0x09, 0x0e, 0x37,
+	0x0e, 0x26, 0x0a, 0x3c, 0x09, 0x1a, 0x1d, 0x06, 0x0c, 0x08, 0x0c, 0x06,
+	0xff, 0x01, 0x02, 0x0f, 0x02, 0xff, 0x51, 0x03, 0x05, 0x02, 0x6f, 0x0d,
+	0x18, 0x19, 0x0c, 0x0d, 0x0a, 0x09, 0x0c, 0x48, 0x09, 0xbf, 0x17, 0x0d,
+	0x09, 0x06, 0x09, 0x0d, 0x07, 0x1d, 0x27, 0x16, 0x0a, 0x2c, 0x09, 0x06,
+	0x0a, 0x2d, 0x06, 0x0c, 0x18, 0x09, 0xcf, 0x12, 0x23, 0x05, 0x13, 0x12,
+	0xff, 0x4d, 0x02, 0x15, 0x02, 0x7f, 0x06, 0x1c, 0x06, 0x0a, 0x0e, 0x0d,
+	0x19, 0x18, 0x0c, 0x28, 0x06, 0x9f, 0x19, 0x06, 0x0e, 0x09, 0x06, 0x09,
+	0x06, 0x0e, 0x1a, 0x0d, 0x2e, 0x16, 0x0c, 0x08, 0x0c, 0x06, 0x0a, 0x2d,
+	0x0e, 0x06, 0x28, 0x09, 0xbf, 0x02, 0x35, 0x33, 0x15, 0x02, 0xff, 0x4c,
+	0x03, 0x05, 0x02, 0x9f, 0x06, 0x08, 0x0c, 0x29, 0x08, 0x0c, 0x09, 0x38,
+	0x0c, 0x08, 0x0a, 0x7f, 0x06, 0x0c, 0x19, 0x0c, 0x16, 0x09, 0x18, 0x0d,
+	0x0e, 0x1d, 0x2e, 0x06, 0x0c, 0x08, 0x06, 0x4d, 0x06, 0x38, 0x09, 0x07,
+	0x8f, 0x02, 0x25, 0x03, 0x02, 0x3f, 0x12, 0x03, 0x05, 0x03, 0xff, 0x4a,
+	0x02, 0x15, 0xaf, 0x0d, 0x06, 0x0c, 0x09, 0x0c, 0x09, 0x0a, 0x08, 0x1c,
+	0x18, 0x06, 0x28, 0x09, 0x5f, 0x06, 0x09, 0x0a, 0x0c, 0x18, 0x09, 0x06,
+	0x19, 0x0c, 0x08, 0x06, 0x3d, 0x17, 0x0d, 0x1a, 0x1e, 0x1d, 0x0c, 0x38,
+	0x1c, 0x0d, 0x7f, 0x02, 0x15, 0x03, 0x02, 0x8f, 0x03, 0x05, 0x03, 0xff,
+	0x49, 0x03, 0x04, 0x02, 0xbf, 0x4c, 0x06, 0x0a, 0x2c, 0x0d, 0x0a, 0x0c,
+	0x18, 0x0c, 0x0d, 0x3f, 0x06, 0x0c, 0x09, 0x0a, 0x28, 0x06, 0x29, 0x1c,
+	0x18, 0x0e, 0x0d, 0x0e, 0x17, 0x0e, 0x0a, 0x2d, 0x09, 0x68, 0x0c, 0x09,
+	0x07, 0x5f, 0x02, 0x15, 0x03, 0xbf, 0x13, 0x02, 0xff, 0x47, 0x02, 0x15,
+	0xcf, 0x0d, 0x0c, 0x09, 0x08, 0x0a, 0x09, 0x06, 0x0c, 0x09, 0x06, 0x0c,
+	0x09, 0x0c, 0x28, 0x0c, 0x0e, 0x1f, 0x09, 0x0c, 0x09, 0x06, 0x08, 0x0b,
+	0x08, 0x0c, 0x59, 0x0c, 0x18, 0x0c, 0x06, 0x0d, 0x07, 0x1d, 0x0a, 0x09,
+	0x98, 0x09, 0x06, 0x0e, 0x3f, 0x02, 0x15, 0x02, 0xcf, 0x02, 0x13, 0xff,
+	0x47, 0x02, 0x05, 0x03, 0xdf, 0x19, 0x2c, 0x06, 0x0e, 0x0a, 0x1c, 0x0e,
+	0x09, 0x08, 0x0b, 0x08, 0x0c, 0x06, 0x0f, 0x2c, 0x06, 0x38, 0x0c, 0x89,
+	0x0c, 0x08, 0x0c, 0x0a, 0x0e, 0x0a, 0x88, 0x0c, 0x08, 0x0c, 0x08, 0x0c,
+	0x0d, 0x2f, 0x02, 0x15, 0x03, 0xef, 0x02, 0x03, 0x02, 0xff, 0x46, 0x03,
+	0x05, 0x02, 0xdf, 0x0d, 0x08, 0x1c, 0x06, 0x0a, 0x08, 0x09, 0x18, 0x09,
+	0x0d, 0x0c, 0x28, 0x19, 0x0c, 0x08, 0x09, 0x06, 0x28, 0x0c, 0x29, 0x06,
+	0x89, 0x08, 0x1c, 0x78, 0x0c, 0x48, 0x07, 0x2f, 0x03, 0x05, 0x03, 0xff,
+	0x00, 0x02, 0x03, 0x02, 0xff, 0x45, 0x02, 0x15, 0xef, 0x07, 0x3c, 0x08,
+	0x0c, 0x09, 0x0a, 0x08, 0x1c, 0x0a, 0x06, 0x08, 0x0b, 0x09, 0x08, 0x09,
+	0x0c, 0x1a, 0x1c, 0x08, 0x49, 0x06, 0x29, 0x16, 0x49, 0x0c, 0x08, 0x2c,
+	0x18, 0x2c, 0x38, 0x06, 0x2f, 0x03, 0x15, 0xff, 0x02, 0x03, 0x02, 0xff,
+	0x45, 0x02, 0x05, 0x03, 0xff, 0x00, 0x09, 0x28, 0x0c, 0x09, 0x0c, 0x06,
+	0x0a, 0x1c, 0x09, 0x0c, 0x08, 0x4c, 0x06, 0x0a, 0x0c, 0x09, 0x06, 0x0c,
+	0x29, 0x26, 0x09, 0x06, 0x09, 0x06, 0x1a, 0x06, 0x09, 0x0c, 0x08, 0x3c,
+	0x38, 0x0c, 0x28, 0x0c, 0x0a, 0x27, 0x15, 0x02, 0xff, 0x01, 0x02, 0x13,
+	0xff, 0x45, 0x03, 0x05, 0x02, 0xff, 0x00, 0x0a, 0x0c, 0x18, 0x09, 0x1c,
+	0x0a, 0x07, 0x06, 0x0c, 0x18, 0x09, 0x06, 0x2c, 0x09, 0x0a, 0x0c, 0x18,
+	0x0b, 0x08, 0x19, 0x36, 0x19, 0x36, 0x1a, 0x06, 0x1c, 0x09, 0x1c, 0x28,
+	0x0c, 0x28, 0x07, 0x09, 0x0c, 0x0a, 0x0e, 0x00, 0x01, 0x03, 0xff, 0x03,
+	0x13, 0xff, 0x45, 0x03, 0x05, 0x02, 0xff, 0x00, 0x07, 0x0c, 0x08, 0x2c,
+	0x09, 0x1a, 0x0d, 0x18, 0x09, 0x06, 0x39, 0x0c, 0x06, 0x08, 0x1b, 0x09,
+	0x0c, 0x18, 0x0a, 0x56, 0x09, 0x0c, 0x19, 0x1a, 0x16, 0x09, 0x0c, 0x38,
+	0x0c, 0x18, 0x0a, 0x0f, 0x09, 0x06, 0x07, 0x0e, 0x00, 0x01, 0x0e, 0xff,
+	0x03, 0x02, 0x03, 0xff, 0x44, 0x02, 0x15, 0xff, 0x02, 0x2c, 0x08, 0x09,
+	0x06, 0x09, 0x06, 0x0c, 0x08, 0x1c, 0x29, 0x06, 0x09, 0x0e, 0x0d, 0x28,
+	0x0c, 0x28, 0x0c, 0x06, 0x0a, 0x36, 0x59, 0x06, 0x09, 0x0c, 0x18, 0x3c,
+	0x28, 0x0a, 0x06, 0x1e, 0x00, 0x04, 0x19, 0x0e, 0x27, 0xef, 0x13, 0xff,
+	0x44, 0x02, 0x05, 0x03, 0xff, 0x02, 0x09, 0x2c, 0x06, 0x0c, 0x09, 0x18,
+	0x0c, 0x09, 0x0c, 0x06, 0x29, 0x06, 0x0d, 0x09, 0x1b, 0x18, 0x0b, 0x28,
+	0x0c, 0x06, 0x1a, 0x76, 0x09, 0x1c, 0x08, 0x0c, 0x18, 0x09, 0x08, 0x0b,
+	0x18, 0x09, 0x0d, 0x0e, 0x0d, 0x00, 0x01, 0x19, 0x0a, 0x0e, 0x0d, 0x0e,
+	0x07, 0xdf, 0x12, 0xff, 0x44, 0x02, 0x05, 0x03, 0xff, 0x02, 0x0e, 0x0c,
+	0x19, 0x0c, 0x06, 0x18, 0x06, 0x19, 0x08, 0x06, 0x29, 0x1a, 0x0c, 0x78,
+	0x1c, 0x09, 0x06, 0x0a, 0x06, 0x09, 0x06, 0x3a, 0x06, 0x0c, 0x09, 0x4c,
+	0x08, 0x0b, 0x08, 0x0c, 0x06, 0x1d, 0x0a, 0x01, 0x06, 0x0c, 0x08, 0x09,
+	0x3e, 0x07, 0xcf, 0x03, 0x02, 0xff, 0x44, 0x02, 0x05, 0x02, 0xff, 0x03,
+	0x0d, 0x0c, 0x08, 0x09, 0x18, 0x0c, 0x19, 0x08, 0x0c, 0x06, 0x29, 0x0e,
+	0x09, 0x18, 0x0b, 0x28, 0x0b, 0x28, 0x0c, 0x09, 0x06, 0x0a, 0x36, 0x09,
+	0x1a, 0x16, 0x0c, 0x08, 0x0c, 0x08, 0x1c, 0x28, 0x09, 0x2a, 0x11, 0x06,
+	0x1c, 0x19, 0x0d, 0x3e, 0xaf, 0x02, 0x03, 0x02, 0xff, 0x44, 0x03, 0x05,
+	0x02, 0xff, 0x04, 0x0a, 0x38, 0x06, 0x09, 0x0c, 0x08, 0x29, 0x0c, 0x09,
+	0x0e, 0x0c, 0x08, 0x0b, 0x18, 0x09, 0x18, 0x0b, 0x18, 0x1c, 0x06, 0x0a,
+	0x06, 0x0a, 0x26, 0x19, 0x06, 0x09, 0x0c, 0x08, 0x2c, 0x08, 0x0b, 0x08,
+	0x0c, 0x09, 0x0d, 0x06, 0x0a, 0x11, 0x09, 0x1c, 0x09, 0x06, 0x0a, 0x2e,
+	0x0d, 0x09, 0x0e, 0x8f, 0x02, 0x03, 0xff, 0x45, 0x03, 0x05, 0x02, 0xff,
+	0x04, 0x0e, 0x0c, 0x08, 0x1c, 0x09, 0x08, 0x09, 0x0c, 0x0a, 0x19, 0x0c,
+	0x06, 0x0e, 0x0c, 0x28, 0x09, 0x06, 0x08, 0x0b, 0x38, 0x0c, 0x19, 0x4a,
+	0x16, 0x09, 0x4c, 0x09, 0x08, 0x0b, 0x1c, 0x0a, 0x06, 0x09, 0x06, 0x01,
+	0x06, 0x19, 0x0c, 0x06, 0x29, 0x07, 0x0d, 0x0e, 0x09, 0x06, 0x0e, 0x7f,
+	0x02, 0x03, 0xff, 0x45, 0x03, 0x05, 0x02, 0xff, 0x05, 0x1c, 0x08, 0x0c,
+	0x19, 0x0c, 0x08, 0x0a, 0x09, 0x0c, 0x09, 0x06, 0x0a, 0x18, 0x0b, 0x08,
+	0x0c, 0x0a, 0x18, 0x0b, 0x28, 0x1c, 0x19, 0x0a, 0x26, 0x2a, 0x06, 0x19,
+	0x08, 0x09, 0x08, 0x0b, 0x08, 0x19, 0x0d, 0x19, 0x11, 0x0a, 0x06, 0x0c,
+	0x09, 0x0c, 0x09, 0x06, 0x09, 0x06, 0x0d, 0x0e, 0x06, 0x09, 0x06, 0x07,
+	0x6f, 0x03, 0x02, 0xff, 0x45, 0x03, 0x05, 0x02, 0xff, 0x05, 0x0c, 0x08,
+	0x1c, 0x08, 0x0c, 0x06, 0x0c, 0x0a, 0x06, 0x0c, 0x09, 0x06, 0x0a, 0x08,
+	0x0b, 0x18, 0x0c, 0x16, 0x18, 0x0b, 0x28, 0x2c, 0x09, 0x0a, 0x06, 0x0a,
+	0x06, 0x0a, 0x16, 0x09, 0x08, 0x0c, 0x09, 0x0b, 0x08, 0x09, 0x0c, 0x06,
+	0x2c, 0x06, 0x01, 0x06, 0x09, 0x08, 0x0c, 0x08, 0x2c, 0x19, 0x0d, 0x0e,
+	0x0c, 0x09, 0x06, 0x07, 0x4f, 0x02, 0x03, 0x02, 0xff, 0x45, 0x03, 0x05,
+	0x02, 0xff, 0x05, 0x06, 0x0c, 0x18, 0x1c, 0x0a, 0x0c, 0x0a, 0x09, 0x1c,
+	0x06, 0x09, 0x48, 0x0a, 0x0d, 0x08, 0x0b, 0x78, 0x0c, 0x16, 0x1a, 0x09,
+	0x1c, 0x38, 0x0c, 0x19, 0x06, 0x2c, 0x01, 0x09, 0x1c, 0x08, 0x1c, 0x08,
+	0x0c, 0x28, 0x09, 0x1a, 0x09, 0x06, 0x0a, 0x4f, 0x12, 0xff, 0x46, 0x03,
+	0x05, 0x02, 0xff, 0x05, 0x07, 0x09, 0x2c, 0x0a, 0x36, 0x09, 0x0c, 0x19,
+	0x08, 0x0b, 0x28, 0x06, 0x0d, 0x09, 0x48, 0x0b, 0x38, 0x0c, 0x09, 0x16,
+	0x09, 0x0c, 0x18, 0x0b, 0x08, 0x0c, 0x06, 0x0c, 0x06, 0x09, 0x2c, 0x01,
+	0x08, 0x1a, 0x18, 0x0b, 0x08, 0x0c, 0x0a, 0x09, 0x3c, 0x0a, 0x0d, 0x0a,
+	0x0d, 0x3f, 0x12, 0xff, 0x46, 0x03, 0x05, 0x02, 0xff, 0x09, 0x06, 0x0a,
+	0x09, 0x0d, 0x06, 0x0a, 0x19, 0x0c, 0x09, 0x0b, 0x08, 0x0b, 0x18, 0x09,
+	0x0a, 0x06, 0x1c, 0x0d, 0x0c, 0x18, 0x0b, 0x08, 0x1b, 0x08, 0x0b, 0x18,
+	0x0b, 0x08, 0x0b, 0x18, 0x0c, 0x06, 0x0c, 0x09, 0x06, 0x0c, 0x58, 0x06,
+	0x09, 0x08, 0x0b, 0x08, 0x1b, 0x0c, 0x0a, 0x09, 0x08, 0x0c, 0x09, 0x0d,
+	0x07, 0x0a, 0x07, 0x1f, 0x22, 0xff, 0x46, 0x03, 0x05, 0x02, 0xff, 0x0a,
+	0x0c, 0x09, 0x0d, 0x06, 0x0a, 0x0c, 0x09, 0x0c, 0x06, 0x08, 0x0b, 0x28,
+	0x0c, 0x0d, 0x06, 0x0c, 0x09, 0x0a, 0x0e, 0x0a, 0x0c, 0x08, 0x0b, 0x18,
+	0x0b, 0x08, 0x0b, 0x18, 0x0b, 0x09, 0x1a, 0x06, 0x09, 0x06, 0x1d, 0x06,
+	0x09, 0x0c, 0x08, 0x0c, 0x28, 0x0c, 0x58, 0x0c, 0x39, 0x0a, 0x09, 0x1d,
+	0x1f, 0x12, 0xff, 0x47, 0x02, 0x05, 0x03, 0xff, 0x0a, 0x09, 0x16, 0x19,
+	0x08, 0x19, 0x06, 0x08, 0x0b, 0x08, 0x0b, 0x08, 0x0c, 0x2a, 0x09, 0x0a,
+	0x0d, 0x0f, 0x07, 0x0e, 0x0a, 0x09, 0x48, 0x09, 0x0e, 0x0f, 0x0e, 0x0a,
+	0x06, 0x0d, 0x0e, 0x0d, 0x0a, 0x26, 0x28, 0x1c, 0x06, 0x09, 0x78, 0x0c,
+	0x0a, 0x09, 0x0c, 0x09, 0x0a, 0x0e, 0x22, 0xff, 0x47, 0x02, 0x05, 0x03,
+	0xff, 0x0a, 0x16, 0x09, 0x06, 0x09, 0x08, 0x09, 0x06, 0x09, 0x0b, 0x08,
+	0x0b, 0x18, 0x0c, 0x0a, 0x16, 0x09, 0x2d, 0x3f, 0x1e, 0x2a, 0x1e, 0x0d,
+	0x0a, 0x09, 0x16, 0x19, 0x08, 0x0c, 0x06, 0x09, 0x08, 0x1c, 0x09, 0x16,
+	0x2c, 0x08, 0x0c, 0x08, 0x0c, 0x08, 0x0c, 0x18, 0x09, 0x0a, 0x1c, 0x06,
+	0x0e, 0x02, 0xff, 0x48, 0x02, 0x05, 0x03, 0xff, 0x0b, 0x0c, 0x0a, 0x16,
+	0x08, 0x29, 0x0b, 0x18, 0x0b, 0x08, 0x0c, 0x0a, 0x06, 0x09, 0x0a, 0x3e,
+	0x0d, 0x0e, 0x07, 0x1f, 0x17, 0x0f, 0x0e, 0x0d, 0x1c, 0x06, 0x0a, 0x06,
+	0x09, 0x0c, 0x18, 0x0d, 0x1c, 0x08, 0x19, 0x06, 0x09, 0x7c, 0x08, 0x0c,
+	0x28, 0x0a, 0x09, 0x0c, 0x06, 0x0a, 0x0d, 0x07, 0xff, 0x47, 0x03, 0x05,
+	0x02, 0xff, 0x0a, 0x1d, 0x0a, 0x1c, 0x16, 0x68, 0x1a, 0x09, 0x06, 0x1e,
+	0x0d, 0x0a, 0x0d, 0x0a, 0x1f, 0x07, 0x0e, 0x0f, 0x0d, 0x06, 0x08, 0x0c,
+	0x09, 0x0a, 0x06, 0x0a, 0x06, 0x18, 0x09, 0x0e, 0x0c, 0x09, 0x1c, 0x06,
+	0x09, 0x0c, 0x09, 0x2c, 0x08, 0x3c, 0x08, 0x09, 0x28, 0x09, 0x0a, 0x19,
+	0x0a, 0x16, 0x0d, 0xff, 0x45, 0x02, 0x05, 0x02, 0xff, 0x0b, 0x0d, 0x0a,
+	0x0c, 0x29, 0x0b, 0x18, 0x0b, 0x18, 0x0c, 0x06, 0x09, 0x2d, 0x0a, 0x1e,
+	0x0d, 0x07, 0x0f, 0x17, 0x1e, 0x0c, 0x08, 0x09, 0x1a, 0x26, 0x0c, 0x18,
+	0x16, 0x1c, 0x09, 0x16, 0x19, 0x5c, 0x08, 0x4c, 0x09, 0x0c, 0x0b, 0x08,
+	0x06, 0x1c, 0x09, 0x16, 0x09, 0x0e, 0xff, 0x43, 0x02, 0x13, 0xff, 0x0c,
+	0x0a, 0x1c, 0x09, 0x78, 0x1c, 0x1a, 0x0e, 0x0d, 0x5f, 0x07, 0x0d, 0x09,
+	0x08, 0x0c, 0x0d, 0x0a, 0x16, 0x09, 0x06, 0x18, 0x0c, 0x0e, 0x1c, 0x19,
+	0x36, 0x9c, 0x09, 0x1c, 0x19, 0x18, 0x19, 0x08, 0x09, 0x0c, 0x09, 0x06,
+	0xff, 0x44, 0x13, 0x02, 0xff, 0x0b, 0x0a, 0x1c, 0x09, 0x08, 0x06, 0x38,
+	0x0c, 0x18, 0x0c, 0x0a, 0x2d, 0x5f, 0x0a, 0x09, 0x08, 0x0c, 0x0a, 0x0e,
+	0x19, 0x16, 0x09, 0x18, 0x09, 0x0d, 0x0c, 0x09, 0x0c, 0x39, 0x0a, 0x0c,
+	0x0a, 0x0c, 0x06, 0x39, 0x16, 0x0c, 0x59, 0x08, 0x0c, 0x06, 0x0c, 0x09,
+	0x0d, 0x0e, 0x1f, 0x0d, 0xff, 0x41, 0x02, 0x05, 0x02, 0xff, 0x0b, 0x0c,
+	0x19, 0x0c, 0x0f, 0x0d, 0x08, 0x0b, 0x08, 0x1c, 0x18, 0x0c, 0x1a, 0x09,
+	0x0d, 0x0e, 0x27, 0x1d, 0x06, 0x18, 0x0a, 0x0d, 0x19, 0x0c, 0x0a, 0x09,
+	0x0c, 0x18, 0x1a, 0x0c, 0x06, 0x0a, 0x16, 0x19, 0x0a, 0x29, 0x06, 0x29,
+	0x06, 0x0c, 0x5a, 0x06, 0x09, 0x0c, 0x08, 0x0c, 0x16, 0x0d, 0x1f, 0x0e,
+	0x0c, 0xff, 0x42, 0x13, 0x02, 0xff, 0x09, 0x0d, 0x19, 0x06, 0x0e, 0x0f,
+	0x0a, 0x18, 0x2c, 0x18, 0x19, 0x2d, 0x0e, 0x0a, 0x09, 0x06, 0x0d, 0x06,
+	0x0c, 0x08, 0x0c, 0x0d, 0x06, 0x09, 0x1c, 0x06, 0x09, 0x28, 0x0d, 0x1c,
+	0x06, 0x1a, 0x09, 0x0c, 0x06, 0x0d, 0x19, 0x1c, 0x29, 0x06, 0x09, 0x16,
+	0x1a, 0x06, 0x0a, 0x06, 0x09, 0x0c, 0x18, 0x06, 0x0e, 0x06, 0x0d, 0x0a,
+	0x1c, 0x0d, 0xff, 0x41, 0x02, 0x05, 0x02, 0xff, 0x08, 0x07, 0x06, 0x09,
+	0x0a, 0x2f, 0x09, 0x08, 0x0c, 0x09, 0x0c, 0x18, 0x0c, 0x09, 0x0c, 0x0a,
+	0x1d, 0x16, 0x09, 0x08, 0x0c, 0x09, 0x18, 0x16, 0x09, 0x0c, 0x09, 0x16,
+	0x09, 0x28, 0x09, 0x1c, 0x09, 0x26, 0x09, 0x06, 0x0d, 0x0a, 0x09, 0x0c,
+	0x06, 0x09, 0x0c, 0x06, 0x09, 0x16, 0x19, 0x16, 0x09, 0x06, 0x19, 0x0c,
+	0x0b, 0x0e, 0x0f, 0x06, 0x0c, 0x09, 0x2c, 0xff, 0x42, 0x03, 0x05, 0x02,
+	0xff, 0x07, 0x0e, 0x0a, 0x07, 0x3f, 0x09, 0x6c, 0x09, 0x0c, 0x1a, 0x06,
+	0x0a, 0x09, 0x06, 0x0c, 0x28, 0x09, 0x0a, 0x2c, 0x09, 0x06, 0x0c, 0x09,
+	0x5c, 0x09, 0x0c, 0x19, 0x0c, 0x09, 0x1a, 0x09, 0x0c, 0x16, 0x0c, 0x06,
+	0x19, 0x0c, 0x09, 0x16, 0x1a, 0x09, 0x16, 0x18, 0x1e, 0x0d, 0x0a, 0x06,
+	0x18, 0x09, 0x07, 0xff, 0x41, 0x02, 0x13, 0x02, 0xff, 0x0d, 0x29, 0x1c,
+	0x08, 0x1c, 0x09, 0x1d, 0x0a, 0x16, 0x0d, 0x0e, 0x0d, 0x0c, 0x18, 0x06,
+	0x0d, 0x09, 0x0c, 0x09, 0x06, 0x0a, 0x09, 0x4c, 0x26, 0x39, 0x06, 0x1a,
+	0x49, 0x16, 0x09, 0x26, 0x0a, 0x36, 0x0c, 0x18, 0x0c, 0x09, 0x18, 0x09,
+	0x0a, 0x09, 0x0c, 0x0a, 0xff, 0x42, 0x02, 0x05, 0x02, 0xff, 0x0d, 0x06,
+	0x28, 0x3c, 0x09, 0x0d, 0x06, 0x0a, 0x06, 0x3f, 0x0d, 0x0c, 0x08, 0x19,
+	0x0a, 0x0c, 0x08, 0x09, 0x16, 0x08, 0x0c, 0x08, 0x06, 0x0c, 0x09, 0x0d,
+	0x16, 0x0c, 0x19, 0x06, 0x09, 0x0a, 0x06, 0x0c, 0x36, 0x0a, 0x09, 0x1a,
+	0x16, 0x1a, 0x0c, 0x06, 0x08, 0x1c, 0x28, 0x0b, 0x08, 0x19, 0x1c, 0xff,
+	0x43, 0x02, 0x05, 0x03, 0xff, 0x0c, 0x0a, 0x16, 0x2c, 0x09, 0x0c, 0x09,
+	0x06, 0x0d, 0x06, 0x2f, 0x0e, 0x17, 0x0d, 0x09, 0x2a, 0x08, 0x09, 0x2a,
+	0x18, 0x09, 0x0a, 0x0c, 0x09, 0x0a, 0x06, 0x09, 0x1a, 0x19, 0x0c, 0x0e,
+	0x0a, 0x29, 0x06, 0x09, 0x0d, 0x0a, 0x0e, 0x0d, 0x16, 0x09, 0x0d, 0x06,
+	0x18, 0x09, 0x1c, 0x09, 0x06, 0x0c, 0x08, 0x09, 0x0d, 0x1c, 0x07, 0xff,
+	0x42, 0x12, 0x05, 0x03, 0xff, 0x0b, 0x1a, 0x06, 0x29, 0x0c, 0x06, 0x09,
+	0x0a, 0x06, 0x4f, 0x17, 0x0e, 0x0a, 0x06, 0x1a, 0x16, 0x0a, 0x0d, 0x0c,
+	0x08, 0x0c, 0x0d, 0x16, 0x09, 0x0d, 0x06, 0x0d, 0x09, 0x3c, 0x07, 0x0d,
+	0x2a, 0x06, 0x09, 0x1e, 0x07, 0x0a, 0x16, 0x09, 0x06, 0x1c, 0x08, 0x09,
+	0x2c, 0x09, 0x0c, 0x08, 0x0c, 0x0e, 0x0a, 0x08, 0x06, 0xff, 0x44, 0x23,
+	0xff, 0x0a, 0x1a, 0x16, 0x09, 0x0c, 0x19, 0x06, 0x0d, 0x0e, 0x1f, 0x07,
+	0x2f, 0x07, 0x0e, 0x1d, 0x0a, 0x09, 0x06, 0x0c, 0x1e, 0x18, 0x0c, 0x19,
+	0x0c, 0x09, 0x1a, 0x16, 0x3c, 0x0d, 0x0e, 0x1a, 0x06, 0x1a, 0x0e, 0x06,
+	0x1c, 0x09, 0x06, 0x0a, 0x1c, 0x09, 0x2c, 0x09, 0x2c, 0x18, 0x1e, 0x1c,
+	0xff, 0x45, 0x13, 0x12, 0xff, 0x08, 0x0d, 0x06, 0x0a, 0x06, 0x19, 0x0c,
+	0x06, 0x0d, 0x09, 0x6f, 0x0e, 0x0d, 0x09, 0x0a, 0x0e, 0x19, 0x0a, 0x07,
+	0x0a, 0x08, 0x1c, 0x09, 0x0c, 0x29, 0x16, 0x4c, 0x0a, 0x0e, 0x1d, 0x2a,
+	0x0c, 0x09, 0x0c, 0x16, 0x0c, 0x09, 0x0d, 0x0a, 0x09, 0x0a, 0x06, 0x09,
+	0x2c, 0x08, 0x09, 0x08, 0x0e, 0x0f, 0x1c, 0x0e, 0xff, 0x45, 0x02, 0x13,
+	0x02, 0xff, 0x06, 0x07, 0x06, 0x0a, 0x16, 0x1c, 0x09, 0x1a, 0x08, 0x06,
+	0x5f, 0x0a, 0x28, 0x16, 0x09, 0x1d, 0x09, 0x08, 0x0c, 0x06, 0x19, 0x0c,
+	0x09, 0x1c, 0x09, 0x0c, 0x09, 0x2c, 0x06, 0x0d, 0x0a, 0x16, 0x0d, 0x08,
+	0x3c, 0x38, 0x0d, 0x16, 0x09, 0x0c, 0x09, 0x1c, 0x08, 0x06, 0x08, 0x0d,
+	0x0f, 0x06, 0x08, 0x09, 0xff, 0x46, 0x12, 0x03, 0x02, 0xff, 0x06, 0x06,
+	0x2a, 0x06, 0x09, 0x06, 0x0a, 0x16, 0x0c, 0x06, 0x17, 0x0f, 0x0e, 0x0a,
+	0x08, 0x09, 0x06, 0x0c, 0x18, 0x09, 0x1d, 0x08, 0x0c, 0x08, 0x0a, 0x4c,
+	0x19, 0x0c, 0x09, 0x2c, 0x06, 0x0e, 0x0a, 0x06, 0x0a, 0x06, 0x08, 0x0a,
+	0x0d, 0x0e, 0x06, 0x0a, 0x16, 0x08, 0x0c, 0x0a, 0x09, 0x5c, 0x09, 0x08,
+	0x09, 0x0f, 0x0e, 0x1c, 0xff, 0x48, 0x02, 0x13, 0x02, 0xff, 0x04, 0x09,
+	0x1a, 0x36, 0x0a, 0x1d, 0x09, 0x0c, 0x18, 0x0c, 0x08, 0x0c, 0x1a, 0x06,
+	0x0a, 0x06, 0x09, 0x0a, 0x16, 0x0c, 0x08, 0x09, 0x06, 0x09, 0x0c, 0x19,
+	0x0c, 0x39, 0x0c, 0x19, 0x06, 0x09, 0x06, 0x1a, 0x08, 0x06, 0x1a, 0x2c,
+	0x09, 0x06, 0x09, 0x08, 0x19, 0x3c, 0x08, 0x09, 0x0c, 0x08, 0x0c, 0x0f,
+	0x0e, 0x1c, 0x0d, 0xff, 0x48, 0x12, 0x03, 0x12, 0xff, 0x02, 0x06, 0x0d,
+	0x1a, 0x26, 0x2d, 0x1a, 0x26, 0x0a, 0x0d, 0x2a, 0x0e, 0x0a, 0x06, 0x1a,
+	0x09, 0x0c, 0x08, 0x06, 0x09, 0x06, 0x0c, 0x66, 0x0a, 0x26, 0x2a, 0x06,
+	0x0c, 0x0e, 0x09, 0x2c, 0x19, 0x06, 0x29, 0x06, 0x2c, 0x08, 0x0c, 0x09,
+	0x0c, 0x09, 0x08, 0x0a, 0x0f, 0x06, 0x0c, 0x09, 0xff, 0x4a, 0x52, 0xef,
+	0x0e, 0x09, 0x0d, 0x1a, 0x06, 0x1a, 0x0d, 0x06, 0x0d, 0x1a, 0x06, 0x0d,
+	0x1a, 0x0d, 0x0e, 0x0a, 0x07, 0x1a, 0x06, 0x0a, 0x08, 0x0c, 0x08, 0x0a,
+	0x0c, 0x16, 0x29, 0x0a, 0x0d, 0x06, 0x09, 0x1c, 0x16, 0x0d, 0x0a, 0x06,
+	0x09, 0x0c, 0x09, 0x0c, 0x18, 0x0c, 0x19, 0x0c, 0x09, 0x0c, 0x19, 0x4c,
+	0x06, 0x0c, 0x09, 0x0c, 0x08, 0x07, 0x0a, 0x1c, 0xff, 0x4c, 0x72, 0xaf,
+	0x07, 0x0a, 0x0c, 0x0e, 0x1d, 0x0a, 0x16, 0x3a, 0x0d, 0x0e, 0x0a, 0x2d,
+	0x06, 0x0d, 0x1a, 0x06, 0x1c, 0x08, 0x09, 0x0a, 0x49, 0x0a, 0x0c, 0x18,
+	0x0b, 0x08, 0x1b, 0x28, 0x06, 0x09, 0x0a, 0x39, 0x0c, 0x08, 0x3c, 0x19,
+	0x1c, 0x09, 0x0d, 0x0c, 0x09, 0x0c, 0x06, 0x09, 0x1c, 0x0e, 0x09, 0x0c,
+	0x0d, 0xff, 0x4e, 0x32, 0x13, 0x12, 0x0f, 0x02, 0x6f, 0x0a, 0x16, 0x7a,
+	0x06, 0x4d, 0x0a, 0x16, 0x2a, 0x28, 0x16, 0x09, 0x0c, 0x06, 0x29, 0x28,
+	0x09, 0x1c, 0x48, 0x19, 0x06, 0x09, 0x06, 0x1a, 0x06, 0x09, 0x1c, 0x08,
+	0x0c, 0x09, 0x0c, 0x09, 0x1c, 0x08, 0x06, 0x29, 0x0c, 0x0b, 0x0a, 0x09,
+	0x08, 0x09, 0xff, 0x50, 0x42, 0x13, 0x02, 0x03, 0x22, 0x0f, 0x02, 0x0f,
+	0x0d, 0x0a, 0x09, 0x1d, 0x1a, 0x16, 0x0a, 0x16, 0x0a, 0x1e, 0x17, 0x06,
+	0x19, 0x26, 0x08, 0x1c, 0x0d, 0x0a, 0x06, 0x09, 0x0d, 0x09, 0x06, 0x08,
+	0x0c, 0x1d, 0x0a, 0x1c, 0x09, 0x08, 0x0c, 0x08, 0x0c, 0x18, 0x0c, 0x06,
+	0x0c, 0x29, 0x06, 0x19, 0x0c, 0x06, 0x39, 0x1c, 0x09, 0x0c, 0x19, 0x0c,
+	0x08, 0x0c, 0x0a, 0x1c, 0xff, 0x56, 0x82, 0x0e, 0x0a, 0x09, 0x06, 0x1d,
+	0x1a, 0x16, 0x0a, 0x16, 0x09, 0x06, 0x19, 0x06, 0x09, 0x06, 0x1d, 0x0c,
+	0x18, 0x0a, 0x06, 0x1a, 0x16, 0x09, 0x0c, 0x0b, 0x1d, 0x0c, 0x09, 0x1c,
+	0x06, 0x1a, 0x19, 0x0c, 0x08, 0x0b, 0x08, 0x19, 0x0c, 0x09, 0x0c, 0x06,
+	0x19, 0x0c, 0x09, 0x28, 0x4c, 0x09, 0x1c, 0x08, 0x06, 0x0c, 0x08, 0x0e,
+	0xff, 0x5e, 0x0e, 0x0a, 0x19, 0x0e, 0x0d, 0x2a, 0x06, 0x0a, 0x06, 0x09,
+	0x16, 0x19, 0x1c, 0x06, 0x0a, 0x0d, 0x28, 0x09, 0x0b, 0x28, 0x0c, 0x06,
+	0x0c, 0x09, 0x0d, 0x29, 0x08, 0x09, 0x0c, 0x09, 0x06, 0x09, 0x08, 0x0c,
+	0x38, 0x0c, 0x09, 0x0c, 0x09, 0x0c, 0x09, 0x06, 0x09, 0x1c, 0x18, 0x0b,
+	0x08, 0x1c, 0x19, 0x08, 0x0c, 0x18, 0x0a, 0x0c, 0x06, 0xff, 0x5e, 0x0d,
+	0x0a, 0x19, 0x1d, 0x1a, 0x06, 0x0a, 0x16, 0x19, 0x28, 0x0c, 0x09, 0x0a,
+	0x0d, 0x06, 0x18, 0x1a, 0x0d, 0x48, 0x0c, 0x29, 0x06, 0x0a, 0x08, 0x19,
+	0x06, 0x38, 0x0c, 0x08, 0x0b, 0x08, 0x09, 0x2c, 0x09, 0x0c, 0x39, 0x0c,
+	0x28, 0x0c, 0x16, 0x1c, 0x08, 0x0c, 0x08, 0x0a, 0x09, 0x0c, 0xff, 0x5e,
+	0x0d, 0x06, 0x19, 0x06, 0x1d, 0x1a, 0x06, 0x0a, 0x06, 0x09, 0x38, 0x0c,
+	0x19, 0x0d, 0x0c, 0x18, 0x16, 0x19, 0x0c, 0x06, 0x09, 0x2a, 0x09, 0x06,
+	0x0c, 0x18, 0x0c, 0x09, 0x0c, 0x58, 0x0b, 0x18, 0x09, 0x2c, 0x09, 0x1c,
+	0x19, 0x0c, 0x29, 0x06, 0x09, 0x06, 0x1c, 0x08, 0x0c, 0x08, 0x09, 0x06,
+	0x08, 0x0e, 0xff, 0x5d, 0x0d, 0x39, 0x1d, 0x0a, 0x36, 0x09, 0x28, 0x0c,
+	0x09, 0x0c, 0x1a, 0x18, 0x19, 0x0a, 0x09, 0x0c, 0x19, 0x0d, 0x1a, 0x29,
+	0x0c, 0x08, 0x0c, 0x19, 0x0c, 0x68, 0x0b, 0x08, 0x06, 0x0c, 0x09, 0x1c,
+	0x19, 0x0c, 0x19, 0x1c, 0x09, 0x26, 0x19, 0x18, 0x0c, 0x08, 0x0e, 0x0c,
+	0x06, 0xff, 0x5d, 0x0a, 0x19, 0x0c, 0x09, 0x1d, 0x0a, 0x06, 0x1a, 0x06,
+	0x09, 0x18, 0x0c, 0x09, 0x0c, 0x09, 0x0d, 0x06, 0x18, 0x06, 0x09, 0x16,
+	0x29, 0x26, 0x0c, 0x09, 0x06, 0x18, 0x19, 0x0c, 0x09, 0x0c, 0x0b, 0x68,
+	0x06, 0x09, 0x4c, 0x39, 0x1c, 0x08, 0x5c, 0x18, 0x0e, 0x06, 0x0c, 0xff,
+	0x5d, 0x0d, 0x29, 0x0c, 0x06, 0x0a, 0x0d, 0x0a, 0x26, 0x09, 0x08, 0x0c,
+	0x29, 0x06, 0x0a, 0x09, 0x0c, 0x08, 0x09, 0x06, 0x19, 0x06, 0x09, 0x06,
+	0x29, 0x08, 0x0a, 0x0c, 0x08, 0x49, 0x0c, 0x0b, 0x48, 0x0b, 0x08, 0x09,
+	0x06, 0x09, 0x4c, 0x09, 0x0c, 0x19, 0x0c, 0x09, 0x0c, 0x08, 0x1c, 0x38,
+	0x09, 0x0e, 0x0c, 0x0e, 0xff, 0x5c, 0x0a, 0x39, 0x0c, 0x0a, 0x0d, 0x06,
+	0x1a, 0x19, 0x08, 0x0c, 0x06, 0x09, 0x06, 0x29, 0x0c, 0x08, 0x06, 0x0c,
+	0x09, 0x06, 0x0c, 0x19, 0x26, 0x0c, 0x09, 0x1c, 0x09, 0x0c, 0x19, 0x1c,
+	0x18, 0x0b, 0x48, 0x06, 0x19, 0x3c, 0x09, 0x0c, 0x39, 0x5c, 0x06, 0x08,
+	0x09, 0x08, 0x0e, 0x09, 0x0a, 0xff, 0x5c, 0x0d, 0x09, 0x06, 0x39, 0x0a,
+	0x36, 0x09, 0x18, 0x06, 0x0f, 0x0d, 0x19, 0x0c, 0x19, 0x0a, 0x0c, 0x09,
+	0x26, 0x09, 0x16, 0x09, 0x0c, 0x09, 0x08, 0x19, 0x08, 0x39, 0x06, 0x0c,
+	0x28, 0x0b, 0x08, 0x0c, 0x19, 0x0c, 0x09, 0x3c, 0x09, 0x0c, 0x09, 0x0c,
+	0x29, 0x0c, 0x09, 0x16, 0x0d, 0x1c, 0x08, 0x09, 0x0a, 0x0c, 0xff, 0x5c,
+	0x29, 0x0d, 0x19, 0x0c, 0x06, 0x0a, 0x26, 0x09, 0x08, 0x0c, 0x06, 0x1f,
+	0x0a, 0x29, 0x06, 0x09, 0x0a, 0x06, 0x29, 0x16, 0x09, 0x0c, 0x19, 0x08,
+	0x09, 0x0c, 0x59, 0x48, 0x19, 0x1c, 0x19, 0x2c, 0x09, 0x1c, 0x19, 0x0c,
+	0x19, 0x0c, 0x09, 0x0c, 0x06, 0x09, 0x0c, 0x09, 0x18, 0x07, 0x0c, 0x0e,
+	0xff, 0x5b, 0x19, 0x0a, 0x09, 0x06, 0x0a, 0x0c, 0x09, 0x0a, 0x16, 0x19,
+	0x18, 0x06, 0x1f, 0x0d, 0x0e, 0x1c, 0x19, 0x0c, 0x29, 0x0a, 0x09, 0x16,
+	0x08, 0x09, 0x1c, 0x59, 0x16, 0x09, 0x1c, 0x29, 0x0c, 0x09, 0x1c, 0x19,
+	0x3c, 0x09, 0x0c, 0x39, 0x0c, 0x09, 0x06, 0x0c, 0x08, 0x0c, 0x28, 0x07,
+	0x09, 0x06, 0xff, 0x5a, 0x07, 0x19, 0x16, 0x09, 0x06, 0x08, 0x16, 0x0a,
+	0x06, 0x09, 0x06, 0x1c, 0x0a, 0x1f, 0x0a, 0x0e, 0x19, 0x1c, 0x08, 0x0a,
+	0x06, 0x0a, 0x09, 0x06, 0x19, 0x0c, 0x09, 0x08, 0x0c, 0x39, 0x0c, 0x39,
+	0x0c, 0x29, 0x0c, 0x09, 0x1c, 0x29, 0x1c, 0x09, 0x1c, 0x09, 0x0c, 0x09,
+	0x0c, 0x19, 0x0c, 0x18, 0x09, 0x0c, 0x28, 0x0a, 0x0d, 0x08, 0xff, 0x5a,
+	0x0d, 0x1c, 0x09, 0x0a, 0x09, 0x0a, 0x08, 0x0a, 0x16, 0x0a, 0x09, 0x06,
+	0x09, 0x0c, 0x0d, 0x07, 0x0f, 0x1a, 0x16, 0x09, 0x0a, 0x0c, 0x06, 0x0d,
+	0x16, 0x0a, 0x16, 0x0c, 0x18, 0x29, 0x1c, 0x09, 0x06, 0x09, 0x0c, 0x09,
+	0x2c, 0x09, 0x4c, 0x29, 0x1c, 0x09, 0x0c, 0x69, 0x08, 0x0b, 0x48, 0x0c,
+	0x0d, 0x0c, 0x07, 0xff, 0x59, 0x09, 0x2c, 0x06, 0x19, 0x0c, 0x0a, 0x26,
+	0x09, 0x06, 0x0e, 0x0a, 0x09, 0x0e, 0x07, 0x0e, 0x0a, 0x09, 0x0c, 0x09,
+	0x0c, 0x08, 0x09, 0x0e, 0x06, 0x09, 0x0d, 0x09, 0x0c, 0x19, 0x06, 0x19,
+	0x0c, 0x09, 0x18, 0x06, 0x0a, 0x0c, 0x09, 0x2c, 0x09, 0x0c, 0x09, 0x1c,
+	0x09, 0x0c, 0x29, 0x1c, 0x19, 0x0c, 0x29, 0x0c, 0x29, 0x0b, 0x18, 0x0c,
+	0x08, 0x0c, 0x0e, 0x0c, 0x09, 0xff, 0x59, 0x09, 0x08, 0x09, 0x0c, 0x49,
+	0x0a, 0x16, 0x1c, 0x0e, 0x1d, 0x0e, 0x17, 0x0a, 0x0c, 0x38, 0x0c, 0x06,
+	0x0d, 0x06, 0x0a, 0x09, 0x0c, 0x06, 0x09, 0x0c, 0x29, 0x08, 0x0b, 0x08,
+	0x09, 0x0a, 0x06, 0x09, 0x1c, 0x09, 0x4c, 0x09, 0x0c, 0x29, 0x3c, 0x59,
+	0x2c, 0x19, 0x0c, 0x18, 0x0e, 0x09, 0x0c, 0xff, 0x59, 0x06, 0x2c, 0x19,
+	0x1c, 0x08, 0x09, 0x06, 0x0c, 0x08, 0x0c, 0x2d, 0x0a, 0x0e, 0x0f, 0x0a,
+	0x2c, 0x06, 0x09, 0x0c, 0x18, 0x09, 0x06, 0x19, 0x06, 0x18, 0x29, 0x28,
+	0x09, 0x06, 0x0e, 0x09, 0x3c, 0x19, 0x0c, 0x69, 0x0c, 0x29, 0x0c, 0x09,
+	0x0c, 0x09, 0x0c, 0x09, 0x0c, 0x08, 0x0c, 0x09, 0x1c, 0x08, 0x09, 0x0e,
+	0x0c, 0x0e, 0xff, 0x57, 0x07, 0x0a, 0x06, 0x09, 0x1c, 0x09, 0x2c, 0x08,
+	0x0c, 0x08, 0x0c, 0x19, 0x0d, 0x06, 0x1d, 0x0f, 0x0d, 0x2c, 0x0a, 0x09,
+	0x06, 0x19, 0x18, 0x0c, 0x0a, 0x18, 0x19, 0x0c, 0x38, 0x0c, 0x09, 0x0e,
+	0x06, 0x5c, 0x09, 0x1c, 0x19, 0x0c, 0x19, 0x5c, 0x19, 0x2c, 0x08, 0x0c,
+	0x09, 0x0c, 0x28, 0x0e, 0x08, 0x0a, 0xff, 0x57, 0x07, 0x16, 0x0a, 0x09,
+	0x0c, 0x09, 0x0c, 0x09, 0x3c, 0x16, 0x09, 0x0a, 0x0d, 0x1e, 0x17, 0x06,
+	0x0c, 0x0a, 0x06, 0x0a, 0x09, 0x0a, 0x06, 0x09, 0x0c, 0x0b, 0x0c, 0x18,
+	0x19, 0x0c, 0x48, 0x0c, 0x07, 0x0a, 0x09, 0x2c, 0x19, 0x0c, 0x18, 0x0c,
+	0x49, 0x2c, 0x09, 0x0c, 0x19, 0x0c, 0x09, 0x1c, 0x08, 0x2c, 0x18, 0x0e,
+	0x1c, 0xff, 0x58, 0x1a, 0x0d, 0x0a, 0x08, 0x0c, 0x39, 0x0a, 0x09, 0x0a,
+	0x16, 0x2a, 0x0d, 0x0e, 0x0f, 0x0d, 0x0c, 0x2a, 0x1d, 0x06, 0x1a, 0x08,
+	0x09, 0x0c, 0x09, 0x0c, 0x29, 0x38, 0x09, 0x0e, 0x0d, 0x09, 0x2c, 0x09,
+	0x0c, 0x38, 0x1c, 0x19, 0x1c, 0x18, 0x1c, 0x19, 0x0c, 0x09, 0x1c, 0x18,
+	0x0c, 0x09, 0x08, 0x0c, 0x1d, 0x08, 0x07, 0xff, 0x58, 0x2d, 0x09, 0x0c,
+	0x39, 0x26, 0x0e, 0x06, 0x0a, 0x0d, 0x1a, 0x0e, 0x0f, 0x07, 0x09, 0x0c,
+	0x06, 0x1d, 0x06, 0x1a, 0x06, 0x0c, 0x06, 0x29, 0x0c, 0x09, 0x06, 0x1c,
+	0x18, 0x09, 0x1d, 0x09, 0x2c, 0x09, 0x0c, 0x48, 0x0c, 0x29, 0x48, 0x09,
+	0x1c, 0x09, 0x1c, 0x08, 0x0c, 0x08, 0x1c, 0x08, 0x09, 0x0e, 0x08, 0x0d,
+	0xff, 0x57, 0x06, 0x2e, 0x0d, 0x0c, 0x19, 0x0c, 0x06, 0x19, 0x06, 0x1a,
+	0x19, 0x1a, 0x1e, 0x0f, 0x06, 0x09, 0x06, 0x0a, 0x0e, 0x1a, 0x06, 0x09,
+	0x0c, 0x0a, 0x06, 0x19, 0x26, 0x2c, 0x08, 0x09, 0x0d, 0x0a, 0x19, 0x1c,
+	0x19, 0x0c, 0x48, 0x0c, 0x19, 0x58, 0x5c, 0x28, 0x0c, 0x08, 0x0c, 0x0a,
+	0x08, 0x09, 0xff, 0x56, 0x07, 0x19, 0x0e, 0x1d, 0x06, 0x1c, 0x09, 0x0e,
+	0x0d, 0x0c, 0x09, 0x06, 0x0a, 0x06, 0x0a, 0x0d, 0x0a, 0x0d, 0x0e, 0x0f,
+	0x0a, 0x29, 0x0d, 0x16, 0x0a, 0x0c, 0x06, 0x0a, 0x06, 0x09, 0x06, 0x19,
+	0x06, 0x09, 0x1c, 0x08, 0x09, 0x0d, 0x0a, 0x09, 0x2c, 0x29, 0x0c, 0x08,
+	0x0c, 0x08, 0x0b, 0x08, 0x0c, 0x09, 0x0c, 0x38, 0x0b, 0x08, 0x1c, 0x09,
+	0x0c, 0x28, 0x0c, 0x09, 0x18, 0x0a, 0x0c, 0x08, 0xff, 0x56, 0x0a, 0x06,
+	0x1a, 0x0e, 0x1d, 0x0a, 0x16, 0x1e, 0x09, 0x16, 0x0d, 0x0a, 0x19, 0x1a,
+	0x0e, 0x07, 0x0e, 0x06, 0x09, 0x0c, 0x06, 0x0a, 0x16, 0x0c, 0x0a, 0x16,
+	0x0c, 0x06, 0x0a, 0x09, 0x06, 0x09, 0x0c, 0x08, 0x0c, 0x06, 0x0d, 0x0a,
+	0x29, 0x0c, 0x19, 0x28, 0x0c, 0x0b, 0x38, 0x09, 0x68, 0x29, 0x0c, 0x18,
+	0x0a, 0x09, 0x18, 0x19, 0x0c, 0x0d, 0xff, 0x54, 0x0e, 0x0a, 0x0c, 0x1a,
+	0x5d, 0x07, 0x1f, 0x0e, 0x06, 0x0d, 0x0a, 0x06, 0x0a, 0x0e, 0x0d, 0x0e,
+	0x07, 0x0f, 0x0a, 0x29, 0x0e, 0x0a, 0x06, 0x0c, 0x0a, 0x16, 0x09, 0x0a,
+	0x06, 0x19, 0x06, 0x0c, 0x09, 0x0c, 0x0a, 0x0e, 0x0a, 0x06, 0x09, 0x1c,
+	0x19, 0x0c, 0x09, 0x1c, 0x28, 0x0b, 0x08, 0x0c, 0x18, 0x0c, 0x18, 0x0b,
+	0x08, 0x0c, 0x06, 0x09, 0x0c, 0x18, 0x1c, 0x09, 0x08, 0x0c, 0x0a, 0x08,
+	0x06, 0xff, 0x53, 0x07, 0x0c, 0x06, 0x0c, 0x06, 0x0d, 0x0a, 0x4d, 0x7f,
+	0x0e, 0x0d, 0x1f, 0x17, 0x0e, 0x29, 0x06, 0x0a, 0x06, 0x0a, 0x46, 0x0a,
+	0x09, 0x1a, 0x18, 0x0c, 0x0d, 0x0e, 0x0a, 0x29, 0x0c, 0x29, 0x0c, 0x38,
+	0x0b, 0x18, 0x09, 0x0c, 0x09, 0x0c, 0x08, 0x1c, 0x18, 0x0c, 0x19, 0x28,
+	0x1c, 0x18, 0x0a, 0x18, 0xff, 0x53, 0x0a, 0x09, 0x06, 0x19, 0x2d, 0x0e,
+	0x1d, 0x0e, 0x8f, 0x0e, 0x06, 0x0d, 0x07, 0x0e, 0x0f, 0x0a, 0x19, 0x06,
+	0x07, 0x0d, 0x26, 0x09, 0x0a, 0x0e, 0x06, 0x29, 0x18, 0x0c, 0x1e, 0x0d,
+	0x06, 0x19, 0x0c, 0x19, 0x0c, 0x08, 0x09, 0x38, 0x0b, 0x08, 0x09, 0x06,
+	0x1c, 0x06, 0x09, 0x0c, 0x28, 0x19, 0x0c, 0x18, 0x0c, 0x28, 0x0a, 0x0c,
+	0x08, 0x0e, 0xff, 0x52, 0x0a, 0x09, 0x06, 0x09, 0x0c, 0x0a, 0x0d, 0x0e,
+	0x2d, 0x0e, 0x8f, 0x07, 0x0a, 0x0d, 0x27, 0x0e, 0x19, 0x1a, 0x0d, 0x16,
+	0x19, 0x0a, 0x0d, 0x0c, 0x0a, 0x06, 0x0c, 0x08, 0x0c, 0x06, 0x0d, 0x0a,
+	0x0d, 0x0a, 0x59, 0x0a, 0x09, 0x0c, 0x09, 0x0c, 0x28, 0x1c, 0x19, 0x06,
+	0x0c, 0x08, 0x1b, 0x08, 0x0c, 0x06, 0x0c, 0x08, 0x0b, 0x38, 0x0d, 0x18,
+	0x06, 0xff, 0x51, 0x07, 0x16, 0x29, 0x06, 0x0e, 0x0f, 0x2d, 0x07, 0x2f,
+	0x07, 0x1f, 0x07, 0x0f, 0x17, 0x0e, 0x1d, 0x0e, 0x07, 0x0f, 0x06, 0x09,
+	0x06, 0x0a, 0x0e, 0x26, 0x09, 0x1a, 0x09, 0x0a, 0x0c, 0x08, 0x0c, 0x09,
+	0x06, 0x0a, 0x0d, 0x0a, 0x06, 0x69, 0x0c, 0x1a, 0x0c, 0x06, 0x38, 0x2c,
+	0x0b, 0x08, 0x0b, 0x18, 0x0c, 0x06, 0x09, 0x28, 0x0b, 0x18, 0x09, 0x0c,
+	0x08, 0x0c, 0xff, 0x50, 0x07, 0x0a, 0x06, 0x09, 0x06, 0x09, 0x16, 0x2e,
+	0x1d, 0x0e, 0x1f, 0x17, 0x0d, 0x1e, 0x2d, 0x1a, 0x0d, 0x06, 0x0e, 0x07,
+	0x0d, 0x09, 0x16, 0x0a, 0x0e, 0x0a, 0x06, 0x19, 0x06, 0x0d, 0x06, 0x08,
+	0x09, 0x06, 0x09, 0x16, 0x0a, 0x06, 0x0a, 0x06, 0x39, 0x26, 0x19, 0x16,
+	0x1c, 0x09, 0x58, 0x0c, 0x28, 0x19, 0x0c, 0x18, 0x0c, 0x58, 0x07, 0xff,
+	0x4f, 0x0d, 0x26, 0x1d, 0x1a, 0x06, 0x0e, 0x07, 0x0e, 0x1a, 0x0d, 0x0e,
+	0x07, 0x0d, 0x0a, 0x26, 0x0a, 0x16, 0x0d, 0x07, 0x1d, 0x17, 0x36, 0x1e,
+	0x0d, 0x2a, 0x0d, 0x19, 0x06, 0x0a, 0x06, 0x19, 0x06, 0x1a, 0x16, 0x49,
+	0x26, 0x0a, 0x19, 0x0d, 0x0c, 0x16, 0x0b, 0x18, 0x2c, 0x08, 0x0c, 0x19,
+	0x0c, 0x08, 0x0b, 0x18, 0x09, 0x0a, 0x06, 0x0c, 0x08, 0x0a, 0xff, 0x4e,
+	0x0e, 0x0a, 0x0d, 0x1a, 0x16, 0x19, 0x1a, 0x36, 0x1a, 0x0d, 0x09, 0x0a,
+	0x0d, 0x0e, 0x2a, 0x06, 0x0d, 0x0f, 0x0d, 0x0a, 0x0e, 0x07, 0x0d, 0x46,
+	0x19, 0x06, 0x1a, 0x19, 0x06, 0x19, 0x16, 0x09, 0x06, 0x0a, 0x26, 0x59,
+	0x06, 0x09, 0x26, 0x09, 0x06, 0x0c, 0x28, 0x2c, 0x18, 0x0c, 0x19, 0x18,
+	0x0b, 0x0c, 0x09, 0x0a, 0x0d, 0x06, 0x09, 0x0c, 0xff, 0x4e, 0x0e, 0x2a,
+	0x66, 0x0a, 0x0d, 0x0a, 0x06, 0x5a, 0x1e, 0x0d, 0x1a, 0x0d, 0x0f, 0x0d,
+	0x1a, 0x17, 0x0a, 0x16, 0x09, 0x0d, 0x16, 0x0c, 0x09, 0x26, 0x0a, 0x26,
+	0x19, 0x0c, 0x06, 0x0a, 0x36, 0xb9, 0x0a, 0x06, 0x08, 0x3c, 0x18, 0x1c,
+	0x08, 0x0c, 0x28, 0x2c, 0x06, 0x09, 0x07, 0xff, 0x4c, 0x1d, 0x0a, 0x0d,
+	0x26, 0x4a, 0x06, 0x0a, 0x1d, 0x1a, 0x2d, 0x1a, 0x0d, 0x07, 0x06, 0x1d,
+	0x0f, 0x0d, 0x1a, 0x0e, 0x17, 0x0a, 0x26, 0x0e, 0x0d, 0x2a, 0x0d, 0x1a,
+	0x09, 0x16, 0x29, 0x0c, 0x09, 0x06, 0x0a, 0x26, 0xa9, 0x1c, 0x18, 0x3c,
+	0x08, 0x0c, 0x09, 0x0c, 0x38, 0x09, 0x1c, 0x08, 0x09, 0x0d, 0xff, 0x4b,
+	0x07, 0x0a, 0x0d, 0x06, 0x0e, 0x1a, 0x0d, 0x0a, 0x2d, 0x1a, 0x06, 0x1d,
+	0x3a, 0x0d, 0x0a, 0x0e, 0x0a, 0x0d, 0x0a, 0x1d, 0x07, 0x1d, 0x06, 0x0e,
+	0x07, 0x0f, 0x0d, 0x0a, 0x16, 0x2d, 0x06, 0x0a, 0x06, 0x0a, 0x16, 0x0a,
+	0x36, 0x29, 0x96, 0x49, 0x0c, 0x09, 0x06, 0x09, 0x08, 0x0c, 0x09, 0x0c,
+	0x08, 0x4c, 0x18, 0x1c, 0x28, 0x0c, 0xff, 0x4b, 0x07, 0x0d, 0x0e, 0x0d,
+	0x2e, 0x2d, 0x0e, 0x0d, 0x2a, 0x0d, 0x0a, 0x0d, 0x0e, 0x0a, 0x0d, 0x1e,
+	0x3d, 0x1e, 0x0f, 0x1e, 0x1a, 0x0e, 0x07, 0x0f, 0x0a, 0x06, 0x0a, 0x06,
+	0x0e, 0x0d, 0x0e, 0x5d, 0x4a, 0x16, 0x69, 0x0c, 0x09, 0x16, 0x1a, 0x06,
+	0x0a, 0x26, 0x19, 0x36, 0x19, 0x16, 0x09, 0x0c, 0x28, 0x0c, 0x18, 0x09,
+	0xff, 0x56, 0x07, 0x3e, 0x07, 0x0e, 0x1d, 0x0e, 0x07, 0xaf, 0x07, 0x0d,
+	0x07, 0x0f, 0x0d, 0x2a, 0x0d, 0x0e, 0x07, 0xaf, 0x07, 0x0d, 0x06, 0x09,
+	0x0c, 0x09, 0x1c, 0x09, 0x0a, 0x0e, 0xff, 0x04, 0x0e, 0x0a, 0x1c, 0x09,
+	0x18, 0x0d, 0xff, 0x17, 0x05, 0x03, 0x15, 0x03, 0x15, 0x03, 0x15, 0x13,
+	0x9f, 0x02, 0x15, 0x03, 0x15, 0x03, 0x15, 0x03, 0x15, 0x9f, 0x03, 0x15,
+	0x03, 0x15, 0x03, 0x35, 0x03, 0x15, 0x03, 0x15, 0x03, 0x05, 0x1f, 0x07,
+	0x0e, 0x0d, 0x0a, 0x1d, 0x0e, 0x07, 0x03, 0x15, 0x03, 0x35, 0x03, 0x25,
+	0x02, 0x07, 0x0e, 0x07, 0x0e, 0x2a, 0x0d, 0x0f, 0x02, 0x05, 0x03, 0x15,
+	0x03, 0x15, 0x03, 0x15, 0x13, 0x07, 0x0a, 0x2c, 0x06, 0x0d, 0x07, 0x0f,
+	0x02, 0x05, 0x03, 0x15, 0x03, 0x15, 0x03, 0x25, 0x03, 0x15, 0x03, 0x15,
+	0x03, 0x05, 0x03, 0x02, 0x0f, 0x07, 0x0d, 0x09, 0x08, 0x0c, 0x8f, 0x02,
+	0x05, 0x03, 0x15, 0x03, 0x15, 0x03, 0x15, 0x03, 0x15, 0x03, 0x15, 0x03,
+	0x15, 0x13, 0x8f, 0xa4, 0x03, 0x9f, 0x03, 0xa4, 0x9f, 0xf4, 0x03, 0x02,
+	0x07, 0x0e, 0x4d, 0x0e, 0x0f, 0x05, 0xa4, 0x05, 0x0f, 0x0e, 0x07, 0x0f,
+	0x0e, 0x1a, 0x0e, 0x0f, 0x05, 0xa4, 0x05, 0x0f, 0x06, 0x1c, 0x06, 0x0e,
+	0x0f, 0x03, 0xf4, 0x08, 0x03, 0x0f, 0x07, 0x06, 0x09, 0x6f, 0x03, 0xf4,
+	0x08, 0x03, 0x6f, 0xa4, 0x03, 0x9f, 0x03, 0x94, 0x05, 0x8f, 0x02, 0xf4,
+	0x03, 0x03, 0x0f, 0x2e, 0x1d, 0x0e, 0x07, 0x0f, 0x03, 0x05, 0xa4, 0x0f,
+	0x1e, 0x17, 0x1d, 0x0e, 0x0f, 0xa4, 0x05, 0x02, 0x07, 0x06, 0x09, 0x0a,
+	0x1f, 0x05, 0xf4, 0x0a, 0x05, 0x0f, 0x07, 0x0e, 0x4f, 0x02, 0x05, 0xf4,
+	0x0a, 0x05, 0x5f, 0x15, 0x74, 0x05, 0x03, 0x9f, 0x03, 0x05, 0x84, 0x05,
+	0x8f, 0x03, 0xf4, 0x03, 0x05, 0x0f, 0x07, 0x0e, 0x0d, 0x0e, 0x0d, 0x0e,
+	0x07, 0x0f, 0x02, 0x15, 0x94, 0x0f, 0x27, 0x0f, 0x0e, 0x0d, 0x07, 0x02,
+	0x94, 0x15, 0x02, 0x0e, 0x1a, 0x07, 0x0f, 0xf4, 0x0e, 0x6f, 0xf4, 0x0e,
+	0x4f, 0x05, 0x74, 0x15, 0x03, 0x9f, 0x03, 0x15, 0x64, 0x15, 0x8f, 0x05,
+	0xf4, 0x03, 0x05, 0x0f, 0x07, 0x3e, 0x07, 0x0e, 0x07, 0x0f, 0x25, 0x74,
+	0x05, 0x03, 0x0f, 0x1e, 0x17, 0x0e, 0x0f, 0x03, 0x84, 0x25, 0x0f, 0x0e,
+	0x0a, 0x0d, 0x0f, 0x05, 0x84, 0xb5, 0x94, 0x4f, 0x05, 0x84, 0xb5, 0x94,
+	0x3f, 0x25, 0x64, 0x05, 0x03, 0x9f, 0x03, 0x15, 0x64, 0x15, 0x8f, 0xf4,
+	0x05, 0x02, 0x0f, 0x07, 0x1e, 0x37, 0x0f, 0x03, 0x25, 0x74, 0x05, 0x0f,
+	0x27, 0x0f, 0x07, 0x0f, 0x05, 0x74, 0x25, 0x03, 0x0f, 0x1d, 0x07, 0x05,
+	0x84, 0xd5, 0x84, 0x02, 0x2f, 0x05, 0x84, 0xd5, 0x84, 0x02, 0x2f, 0x15,
+	0x64, 0x15, 0x03, 0x9f, 0x03, 0x05, 0x64, 0x15, 0x04, 0x7f, 0x02, 0x04,
+	0x05, 0x54, 0x35, 0x64, 0x05, 0x04, 0x02, 0x0f, 0x0e, 0x57, 0x0f, 0x02,
+	0x15, 0x84, 0x05, 0x0f, 0x17, 0x0e, 0x07, 0x1f, 0x94, 0x15, 0x02, 0x0f,
+	0x0d, 0x0e, 0x0f, 0x05, 0x74, 0xf5, 0x00, 0x74, 0x05, 0x2f, 0x05, 0x74,
+	0xf5, 0x00, 0x74, 0x05, 0x2f, 0x05, 0x04, 0x05, 0x54, 0x15, 0x03, 0x9f,
+	0x03, 0x15, 0x64, 0x15, 0x7f, 0x03, 0x74, 0x45, 0x74, 0x03, 0x0f, 0x47,
+	0x0e, 0x07, 0x0f, 0x02, 0x25, 0x84, 0x02, 0x0f, 0x07, 0x0e, 0x07, 0x0f,
+	0x02, 0x04, 0x05, 0x64, 0x25, 0x0f, 0x07, 0x0a, 0x0e, 0x0f, 0x05, 0x74,
+	0x25, 0x03, 0x7f, 0x03, 0x25, 0x74, 0x05, 0x2f, 0x05, 0x74, 0x25, 0x03,
+	0x7f, 0x03, 0x25, 0x74, 0x05, 0x2f, 0x15, 0x64, 0x05, 0x04, 0x02, 0x9f,
+	0x03, 0x05, 0x74, 0x15, 0x7f, 0x15, 0x64, 0x55, 0x64, 0x05, 0x0f, 0x77,
+	0x0f, 0x25, 0x64, 0x05, 0x04, 0x03, 0x0f, 0x0e, 0x17, 0x0f, 0x03, 0x84,
+	0x15, 0x03, 0x0f, 0x0e, 0x0a, 0x0e, 0x0f, 0x15, 0x74, 0x15, 0x1f, 0x5d,
+	0x1f, 0x15, 0x74, 0x05, 0x04, 0x2f, 0x15, 0x74, 0x15, 0x9f, 0x15, 0x74,
+	0x05, 0x04, 0x2f, 0x15, 0x64, 0x15, 0x03, 0x9f, 0x03, 0x15, 0x54, 0x05,
+	0x04, 0x05, 0x7f, 0x74, 0x25, 0x02, 0x25, 0x74, 0x1f, 0x57, 0x1f, 0x03,
+	0x25, 0x74, 0x05, 0x4f, 0x05, 0x74, 0x25, 0x03, 0x0f, 0x0e, 0x0d, 0x0e,
+	0x02, 0x15, 0x64, 0x25, 0x0f, 0x0d, 0x09, 0x0c, 0x09, 0x0c, 0x19, 0x0e,
+	0x0f, 0x25, 0x64, 0x15, 0x1f, 0x02, 0x15, 0x64, 0x25, 0x9f, 0xb5, 0x2f,
+	0x05, 0x04, 0x05, 0x74, 0x05, 0x9f, 0x05, 0x84, 0x15, 0x6f, 0x02, 0x74,
+	0x25, 0x02, 0x25, 0x54, 0x05, 0x04, 0x03, 0x0f, 0x27, 0x0e, 0x07, 0x2f,
+	0x02, 0x15, 0x84, 0x05, 0x4f, 0x84, 0x25, 0x02, 0x0f, 0x1d, 0x0e, 0x0f,
+	0x05, 0x04, 0x05, 0x74, 0x05, 0x0f, 0x0d, 0x49, 0x06, 0x0d, 0x0f, 0x15,
+	0x64, 0x25, 0x2f, 0x05, 0x04, 0x05, 0x74, 0x05, 0x9f, 0xb5, 0x2f, 0x15,
+	0xf4, 0x0e, 0x15, 0x6f, 0x03, 0x05, 0x64, 0x25, 0x0f, 0x03, 0x15, 0x74,
+	0x03, 0x0f, 0x17, 0x2e, 0x07, 0x1f, 0x02, 0x25, 0x84, 0x02, 0x2f, 0x02,
+	0x04, 0x05, 0x64, 0x25, 0x0f, 0x07, 0x1d, 0x0e, 0x0f, 0x15, 0x64, 0x25,
+	0x0f, 0x0d, 0x39, 0x06, 0x0c, 0x0e, 0x0f, 0x05, 0x04, 0x05, 0x64, 0x05,
+	0x04, 0x2f, 0x15, 0x64, 0x25, 0x9f, 0xb5, 0x2f, 0x15, 0xf4, 0x0d, 0x05,
+	0x04, 0x05, 0x6f, 0x05, 0x04, 0x05, 0x54, 0x15, 0x03, 0x0f, 0x03, 0x25,
+	0x54, 0x15, 0x0f, 0x07, 0x0e, 0x07, 0x1e, 0x07, 0x2f, 0x25, 0x64, 0x05,
+	0x04, 0x03, 0x2f, 0x03, 0x84, 0x25, 0x0f, 0x07, 0x1d, 0x07, 0x0f, 0x15,
+	0x74, 0x15, 0x0f, 0x0d, 0x49, 0x06, 0x0e, 0x0f, 0x15, 0x74, 0x15, 0x2f,
+	0x15, 0x74, 0x15, 0xaf, 0x12, 0x0f, 0x22, 0x0f, 0x02, 0x0f, 0x02, 0x3f,
+	0x04, 0x15, 0xf4, 0x0d, 0x15, 0x6f, 0x05, 0x64, 0x25, 0x02, 0x0f, 0x02,
+	0x15, 0x84, 0x0f, 0x17, 0x0e, 0x07, 0x1e, 0x07, 0x1f, 0x03, 0x15, 0x84,
+	0x05, 0x2f, 0x05, 0x74, 0x25, 0x03, 0x0f, 0x0e, 0x1d, 0x0e, 0x0f, 0x04,
+	0x15, 0x54, 0x05, 0x04, 0x05, 0x0f, 0x0e, 0x06, 0x09, 0x16, 0x19, 0x0e,
+	0x0f, 0x15, 0x74, 0x15, 0x2f, 0x04, 0x15, 0x54, 0x05, 0x04, 0x05, 0xff,
+	0x09, 0x15, 0xf4, 0x0e, 0x15, 0x5f, 0x02, 0x84, 0x15, 0x02, 0x0f, 0x02,
+	0x25, 0x54, 0x05, 0x04, 0x02, 0x0f, 0x17, 0x1e, 0x17, 0x1f, 0x02, 0x25,
+	0x74, 0x05, 0x2f, 0x94, 0x15, 0x02, 0x0f, 0x1e, 0x0d, 0x07, 0x0f, 0x15,
+	0x74, 0x15, 0x0f, 0x0e, 0x09, 0x06, 0x29, 0x06, 0x0d, 0x0f, 0x05, 0x04,
+	0x05, 0x64, 0x15, 0x2f, 0x15, 0x74, 0x15, 0xff, 0x09, 0x15, 0x84, 0xb5,
+	0x74, 0x15, 0x04, 0x5f, 0x03, 0x04, 0x05, 0x54, 0x25, 0x2f, 0x25, 0x74,
+	0x03, 0x0f, 0x07, 0x0e, 0x17, 0x1e, 0x07, 0x0f, 0x02, 0x25, 0x84, 0x02,
+	0x0f, 0x02, 0x04, 0x05, 0x64, 0x25, 0x0f, 0x07, 0x1e, 0x0d, 0x07, 0x0f,
+	0x15, 0x74, 0x15, 0x02, 0x0e, 0x36, 0x09, 0x06, 0x0e, 0x0f, 0x15, 0x64,
+	0x15, 0x04, 0x2f, 0x15, 0x74, 0x15, 0xff, 0x09, 0x15, 0x64, 0xf5, 0x00,
+	0x64, 0x15, 0x5f, 0x05, 0x74, 0x25, 0x2f, 0x03, 0x15, 0x74, 0x05, 0x0f,
+	0x27, 0x0e, 0x07, 0x0e, 0x17, 0x0f, 0x25, 0x64, 0x05, 0x04, 0x03, 0x0f,
+	0x03, 0x84, 0x15, 0x03, 0x0f, 0x07, 0x2e, 0x07, 0x0f, 0x15, 0x64, 0x05,
+	0x04, 0x05, 0x0f, 0x0e, 0x2a, 0x06, 0x09, 0x0a, 0x0d, 0x0f, 0x15, 0x74,
+	0x15, 0x2f, 0x15, 0x64, 0x05, 0x04, 0x05, 0xff, 0x09, 0x04, 0x15, 0x54,
+	0xf5, 0x00, 0x64, 0x15, 0x5f, 0x15, 0x64, 0x05, 0x04, 0x05, 0x2f, 0x05,
+	0x04, 0x05, 0x84, 0x0f, 0x57, 0x0e, 0x07, 0x0f, 0x03, 0x15, 0x84, 0x05,
+	0x0f, 0x05, 0x74, 0x25, 0x03, 0x0f, 0x07, 0x2e, 0x07, 0x0f, 0x04, 0x15,
+	0x64, 0x15, 0x0f, 0x0e, 0x0a, 0x36, 0x0a, 0x0e, 0x0f, 0x04, 0x15, 0x64,
+	0x15, 0x2f, 0x04, 0x15, 0x64, 0x15, 0x9f, 0x04, 0x05, 0x04, 0x05, 0x04,
+	0x05, 0x04, 0x05, 0x04, 0x05, 0x04, 0x05, 0x2f, 0x15, 0x54, 0x25, 0x03,
+	0x92, 0x03, 0x25, 0x54, 0x15, 0x5f, 0xf4, 0x09, 0x05, 0x04, 0x02, 0x0f,
+	0x17, 0x0e, 0x37, 0x0f, 0x02, 0x25, 0x74, 0x05, 0x0f, 0x84, 0x25, 0x02,
+	0x0f, 0x0e, 0x07, 0x1e, 0x07, 0x0f, 0x15, 0x74, 0x15, 0x0f, 0x0e, 0x0d,
+	0x1a, 0x06, 0x1a, 0x0e, 0x0f, 0x15, 0x74, 0x15, 0x2f, 0x15, 0x74, 0x15,
+	0x9f, 0xb4, 0x2f, 0x15, 0x64, 0x15, 0x02, 0x9f, 0x02, 0x15, 0x54, 0x15,
+	0x04, 0x4f, 0x03, 0x04, 0x05, 0xf4, 0x09, 0x03, 0x0f, 0x27, 0x0e, 0x27,
+	0x0f, 0x02, 0x25, 0x84, 0x05, 0x84, 0x25, 0x0f, 0x07, 0x3e, 0x07, 0x0f,
+	0x15, 0x64, 0x15, 0x04, 0x0f, 0x07, 0x0d, 0x4a, 0x0e, 0x0f, 0x15, 0x64,
+	0x15, 0x04, 0x2f, 0x15, 0x64, 0x15, 0x04, 0x9f, 0x05, 0x94, 0x05, 0x2f,
+	0x15, 0x64, 0x15, 0x03, 0x9f, 0x03, 0x15, 0x64, 0x15, 0x4f, 0x03, 0xf4,
+	0x0a, 0x15, 0x0f, 0x07, 0x0e, 0x17, 0x0e, 0x17, 0x1f, 0x25, 0xf4, 0x03,
+	0x25, 0x1f, 0x07, 0x2e, 0x07, 0x0f, 0x15, 0x74, 0x15, 0x0f, 0x07, 0x1d,
+	0x3a, 0x0e, 0x0f, 0x15, 0x74, 0x15, 0x2f, 0x15, 0x74, 0x15, 0x9f, 0x05,
+	0x84, 0x05, 0x04, 0x2f, 0x04, 0x15, 0x64, 0x05, 0x03, 0x9f, 0x03, 0x04,
+	0x05, 0x64, 0x15, 0x4f, 0x05, 0xf4, 0x0c, 0x0f, 0x47, 0x3f, 0x03, 0x15,
+	0xf4, 0x02, 0x25, 0x03, 0x1f, 0x17, 0x1e, 0x07, 0x0f, 0x04, 0x15, 0x64,
+	0x05, 0x04, 0x0f, 0x07, 0x2e, 0x2d, 0x07, 0x0f, 0x04, 0x05, 0x74, 0x15,
+	0x2f, 0x04, 0x15, 0x64, 0x05, 0x04, 0x9f, 0x04, 0x05, 0x74, 0x15, 0x2f,
+	0x15, 0x64, 0x15, 0x03, 0x9f, 0x03, 0x15, 0x64, 0x15, 0x4f, 0x94, 0x85,
+	0x74, 0x05, 0x04, 0x02, 0x0f, 0x37, 0x3f, 0x02, 0x25, 0xf4, 0x02, 0x15,
+	0x02, 0x0f, 0x37, 0x0e, 0x07, 0x0f, 0x15, 0x94, 0x02, 0x7f, 0x02, 0x94,
+	0x15, 0x2f, 0x15, 0x94, 0x02, 0x7f, 0x02, 0x94, 0x15, 0x2f, 0x15, 0x64,
+	0x15, 0x03, 0x9f, 0x03, 0x05, 0x64, 0x15, 0x04, 0x3f, 0x02, 0x04, 0x05,
+	0x54, 0xc5, 0x74, 0x03, 0x0f, 0x27, 0x4f, 0x02, 0x25, 0xf4, 0x01, 0x25,
+	0x0f, 0x07, 0x0e, 0x07, 0x1f, 0x17, 0x0f, 0x25, 0x94, 0x15, 0x03, 0x15,
+	0x03, 0x15, 0x94, 0x25, 0x2f, 0x25, 0x94, 0x05, 0x03, 0x15, 0x03, 0x15,
+	0x03, 0x94, 0x25, 0x2f, 0x15, 0x64, 0x05, 0x04, 0x02, 0x9f, 0x03, 0x15,
+	0x64, 0x15, 0x3f, 0x03, 0x74, 0xc5, 0x64, 0x15, 0x0f, 0x17, 0x6f, 0x25,
+	0xf4, 0x01, 0x15, 0x03, 0x1f, 0x37, 0x0f, 0x07, 0x0f, 0x03, 0x25, 0xf4,
+	0x0a, 0x35, 0x2f, 0x03, 0x25, 0xf4, 0x0a, 0x35, 0x2f, 0x04, 0x15, 0x54,
+	0x15, 0x03, 0x9f, 0x03, 0x15, 0x64, 0x15, 0x3f, 0x05, 0x64, 0x25, 0x03,
+	0x62, 0x03, 0x25, 0x64, 0x05, 0x9f, 0x03, 0x15, 0xf4, 0x00, 0x25, 0x03,
+	0x2f, 0x37, 0x1f, 0x02, 0x25, 0xf4, 0x0a, 0x25, 0x02, 0x2f, 0x02, 0x25,
+	0xf4, 0x0a, 0x25, 0x02, 0x2f, 0x15, 0x74, 0x05, 0x03, 0x9f, 0x02, 0x04,
+	0x05, 0x64, 0x15, 0x3f, 0x04, 0x05, 0x64, 0x15, 0x02, 0x6f, 0x02, 0x15,
+	0x84, 0x02, 0x8f, 0x02, 0x25, 0xe4, 0x25, 0x02, 0x0f, 0x67, 0x1f, 0x25,
+	0x03, 0xf4, 0x07, 0x45, 0x4f, 0x25, 0x03, 0xf4, 0x07, 0x45, 0x3f, 0x15,
+	0x64, 0x15, 0x03, 0x9f, 0x03, 0x15, 0x54, 0x15, 0x04, 0x2f, 0x02, 0x74,
+	0x25, 0x02, 0x0f, 0x07, 0x0f, 0x27, 0x1f, 0x25, 0x54, 0x05, 0x04, 0x02,
+	0x8f, 0x02, 0x25, 0xe4, 0x25, 0x1f, 0x47, 0x0e, 0x17, 0x0f, 0x02, 0x55,
+	0xf4, 0x02, 0x55, 0x02, 0x4f, 0x02, 0x55, 0xf4, 0x02, 0x55, 0x02, 0x3f,
+	0xa5, 0x03, 0x9f, 0x03, 0xa5, 0x2f, 0x03, 0xa5, 0x0f, 0x02, 0x57, 0x0f,
+	0xb5, 0x9f, 0xf5, 0x05, 0x0f, 0x57, 0x0e, 0x17, 0x1f, 0x02, 0xf5, 0x0c,
+	0x02, 0x6f, 0x02, 0xf5, 0x0c, 0x02, 0x4f, 0xa5, 0x03, 0x9f, 0x03, 0xa5,
+	0x2f, 0xb5, 0x0f, 0x17, 0x1e, 0x17, 0x1f, 0x03, 0xa5, 0x9f, 0x03, 0xf5,
+	0x03, 0x03, 0x0f, 0xa7, 0x1f, 0x03, 0xf5, 0x08, 0x03, 0xaf, 0x03, 0xf5,
+	0x08, 0x03, 0x6f, 0xa5, 0x02, 0x9f, 0x02, 0xa5, 0x2f, 0x03, 0x95, 0x03,
+	0x0f, 0x17, 0x0e, 0x07, 0x1e, 0x07, 0x0f, 0x03, 0xa5, 0x9f, 0x02, 0xf5,
+	0x03, 0x02, 0x0f, 0xa7, 0x2f, 0x12, 0x03, 0xf5, 0x02, 0x03, 0x12, 0xcf,
+	0x12, 0x03, 0xf5, 0x02, 0x03, 0x12, 0xff, 0x2a, 0x07, 0x4e, 0x17, 0xff,
+	0x1b, 0x37, 0x0e, 0x07, 0x0e, 0x37, 0x0f, 0x17, 0xff, 0x09, 0x07, 0xff,
+	0x41, 0x07, 0x0f, 0x47, 0x4f, 0x27, 0x4e, 0x57, 0xff, 0x10, 0x67, 0x1e,
+	0x07, 0x0e, 0x47, 0x2f, 0x07, 0x0e, 0x07, 0x1f, 0x67, 0x0f, 0x57, 0x0f,
+	0x47, 0x1e, 0xff, 0x1b, 0x03, 0x45, 0x3f, 0x03, 0x35, 0x13, 0x25, 0x03,
+	0x1f, 0x03, 0x65, 0x3f, 0x03, 0x35, 0x03, 0x15, 0x07, 0x0e, 0x35, 0x03,
+	0x0f, 0x02, 0x15, 0x03, 0x05, 0x03, 0x25, 0x03, 0x07, 0x03, 0x75, 0x03,
+	0x85, 0x03, 0x4f, 0x02, 0x85, 0x13, 0x05, 0x03, 0x05, 0x23, 0x45, 0x03,
+	0x25, 0x07, 0x02, 0x03, 0x35, 0x03, 0x27, 0x02, 0x25, 0x03, 0x05, 0x03,
+	0x05, 0x03, 0x05, 0x03, 0x0e, 0x07, 0x15, 0x03, 0x05, 0x03, 0x0f, 0x02,
+	0x35, 0x02, 0x0f, 0x03, 0x55, 0x02, 0x0f, 0x03, 0x85, 0x02, 0x0f, 0x03,
+	0x85, 0x03, 0x1f, 0x05, 0x08, 0x0c, 0x18, 0x06, 0x05, 0x1f, 0x02, 0x00,
+	0x0c, 0x08, 0x0c, 0x08, 0x16, 0x0c, 0x18, 0x00, 0x02, 0x03, 0x01, 0x1c,
+	0x18, 0x0c, 0x08, 0x06, 0x00, 0x13, 0x05, 0x06, 0x0c, 0x08, 0x0c, 0x28,
+	0x09, 0x00, 0x05, 0x09, 0x28, 0x05, 0x07, 0x05, 0x09, 0x28, 0x00, 0x28,
+	0x06, 0x05, 0x09, 0x28, 0x0c, 0x18, 0x0c, 0x08, 0x06, 0x09, 0x0c, 0x18,
+	0x0c, 0x18, 0x0c, 0x08, 0x06, 0x03, 0x3f, 0x05, 0x06, 0x18, 0x0c, 0x18,
+	0x0c, 0x18, 0x01, 0x06, 0x28, 0x00, 0x05, 0x18, 0x0c, 0x58, 0x06, 0x00,
+	0x05, 0x09, 0x28, 0x0c, 0x05, 0x17, 0x0e, 0x05, 0x0c, 0x28, 0x09, 0x06,
+	0x28, 0x00, 0x03, 0x05, 0x09, 0x28, 0x00, 0x02, 0x05, 0x09, 0x18, 0x09,
+	0x05, 0x02, 0x01, 0x0c, 0x18, 0x0c, 0x08, 0x09, 0x05, 0x03, 0x06, 0x18,
+	0x0c, 0x18, 0x0c, 0x18, 0x0c, 0x01, 0x05, 0x00, 0x08, 0x0c, 0x18, 0x0c,
+	0x18, 0x0c, 0x08, 0x05, 0x1f, 0x05, 0x4b, 0x01, 0x02, 0x0f, 0x05, 0x0c,
+	0x3b, 0x06, 0x01, 0x2b, 0x01, 0x03, 0x06, 0x7b, 0x08, 0x15, 0x08, 0x8b,
+	0x05, 0x08, 0x2b, 0x05, 0x07, 0x05, 0x08, 0x2b, 0x01, 0x2b, 0x06, 0x05,
+	0x08, 0x7b, 0x06, 0x08, 0x7b, 0x06, 0x05, 0x3f, 0x05, 0x08, 0x7b, 0x09,
+	0x06, 0x2b, 0x01, 0x03, 0x9b, 0x09, 0x05, 0x08, 0x3b, 0x06, 0x05, 0x07,
+	0x05, 0x06, 0x3b, 0x08, 0x01, 0x2b, 0x06, 0x05, 0x03, 0x3b, 0x06, 0x05,
+	0x00, 0x2b, 0x0c, 0x05, 0x03, 0x06, 0x5b, 0x05, 0x03, 0x06, 0x9b, 0x00,
+	0x0a, 0x8b, 0x05, 0x1f, 0x05, 0x4b, 0x08, 0x05, 0x03, 0x01, 0x4b, 0x06,
+	0x09, 0x2b, 0x0a, 0x05, 0x3b, 0x16, 0x0c, 0x2b, 0x06, 0x00, 0x2b, 0x08,
+	0x16, 0x0c, 0x2b, 0x06, 0x08, 0x2b, 0x13, 0x05, 0x0c, 0x2b, 0x0a, 0x2b,
+	0x06, 0x05, 0x08, 0x2b, 0x46, 0x01, 0x08, 0x2b, 0x46, 0x01, 0x02, 0x3f,
+	0x05, 0x08, 0x2b, 0x46, 0x01, 0x06, 0x2b, 0x0a, 0x05, 0x3b, 0x08, 0x0c,
+	0x18, 0x1b, 0x08, 0x05, 0x08, 0x4b, 0x05, 0x02, 0x05, 0x4b, 0x0c, 0x05,
+	0x2b, 0x08, 0x05, 0x01, 0x3b, 0x0c, 0x05, 0x0a, 0x2b, 0x06, 0x15, 0x08,
+	0x5b, 0x00, 0x05, 0x06, 0x2b, 0x38, 0x2b, 0x11, 0x2b, 0x08, 0x46, 0x05,
+	0x1f, 0x05, 0x5b, 0x06, 0x05, 0x08, 0x4b, 0x16, 0x2b, 0x01, 0x05, 0x2b,
+	0x08, 0x11, 0x00, 0x26, 0x0a, 0x01, 0x2b, 0x06, 0x15, 0x01, 0x2b, 0x06,
+	0x08, 0x2b, 0x01, 0x0a, 0x01, 0x08, 0x2b, 0x01, 0x2b, 0x06, 0x05, 0x08,
+	0x2b, 0x41, 0x05, 0x08, 0x2b, 0x41, 0x05, 0x4f, 0x05, 0x08, 0x2b, 0x41,
+	0x05, 0x06, 0x2b, 0x01, 0x05, 0x2b, 0x0c, 0x25, 0x01, 0x1b, 0x08, 0x05,
+	0x08, 0x4b, 0x0c, 0x05, 0x09, 0x4b, 0x08, 0x05, 0x08, 0x2b, 0x05, 0x06,
+	0x4b, 0x05, 0x09, 0x2b, 0x01, 0x02, 0x05, 0x2b, 0x08, 0x2b, 0x06, 0x05,
+	0x06, 0x2b, 0x01, 0x25, 0x08, 0x1b, 0x01, 0x0a, 0x2b, 0x0c, 0x31, 0x00,
+	0x02, 0x1f, 0x05, 0x5b, 0x08, 0x06, 0x5b, 0x16, 0x2b, 0x0d, 0x05, 0x08,
+	0x5b, 0x08, 0x0c, 0x06, 0x05, 0x01, 0x2b, 0x06, 0x05, 0x07, 0x05, 0x03,
+	0x25, 0x08, 0x9b, 0x01, 0x2b, 0x06, 0x05, 0x08, 0x7b, 0x05, 0x08, 0x7b,
+	0x05, 0x4f, 0x05, 0x08, 0x7b, 0x05, 0x06, 0x2b, 0x01, 0x03, 0x3b, 0x38,
+	0x1b, 0x08, 0x05, 0x08, 0x5b, 0x01, 0x5b, 0x08, 0x05, 0x06, 0x2b, 0x00,
+	0x08, 0x4b, 0x00, 0x08, 0x2b, 0x03, 0x02, 0x00, 0x2b, 0x06, 0x2b, 0x0c,
+	0x05, 0x06, 0x2b, 0x38, 0x2b, 0x0d, 0x01, 0x7b, 0x06, 0x03, 0x1f, 0x05,
+	0xdb, 0x06, 0x09, 0x2b, 0x01, 0x03, 0x05, 0x06, 0x0c, 0x08, 0x5b, 0x06,
+	0x01, 0x2b, 0x06, 0x05, 0x0e, 0x00, 0x01, 0x0a, 0x01, 0x00, 0x08, 0x9b,
+	0x0a, 0x2b, 0x06, 0x05, 0x08, 0x7b, 0x05, 0x0c, 0x7b, 0x03, 0x4f, 0x05,
+	0x0c, 0x7b, 0x05, 0x06, 0x2b, 0x0a, 0x05, 0x9b, 0x09, 0x05, 0x08, 0xcb,
+	0x08, 0x05, 0x01, 0x2b, 0x06, 0x5b, 0x06, 0x2b, 0x0c, 0x15, 0x06, 0x2b,
+	0x06, 0x08, 0x2b, 0x05, 0x06, 0x9b, 0x00, 0x0a, 0x7b, 0x06, 0x05, 0x1f,
+	0x03, 0x2b, 0x08, 0x09, 0x4b, 0x06, 0x2b, 0x06, 0x01, 0x2b, 0x0a, 0x05,
+	0x16, 0x09, 0x06, 0x05, 0x01, 0x06, 0x2b, 0x08, 0x01, 0x2b, 0x06, 0x05,
+	0x03, 0x0a, 0x2b, 0x06, 0x08, 0x2b, 0x25, 0x08, 0x2b, 0x01, 0x2b, 0x06,
+	0x05, 0x08, 0x2b, 0x35, 0x03, 0x05, 0x08, 0x2b, 0x55, 0x4f, 0x05, 0x08,
+	0x2b, 0x35, 0x03, 0x05, 0x06, 0x2b, 0x01, 0x03, 0x3b, 0x0c, 0x08, 0x2b,
+	0x0c, 0x15, 0x0c, 0x2b, 0x06, 0x4b, 0x06, 0x2b, 0x08, 0x05, 0x03, 0x2b,
+	0x08, 0x5b, 0x08, 0x2b, 0x06, 0x15, 0x0c, 0x7b, 0x01, 0x06, 0x2b, 0x18,
+	0x3b, 0x00, 0x05, 0x01, 0x2b, 0x06, 0x45, 0x2f, 0x05, 0x2b, 0x08, 0x05,
+	0x3b, 0x09, 0x01, 0x2b, 0x19, 0x2b, 0x01, 0x05, 0x3b, 0x06, 0x01, 0x06,
+	0x2b, 0x08, 0x0a, 0x2b, 0x08, 0x0a, 0x01, 0x09, 0x2b, 0x06, 0x08, 0x2b,
+	0x03, 0x0e, 0x05, 0x08, 0x2b, 0x0a, 0x2b, 0x06, 0x05, 0x08, 0x2b, 0x01,
+	0x0d, 0x01, 0x0a, 0x01, 0x00, 0x08, 0x2b, 0x03, 0x9f, 0x05, 0x08, 0x2b,
+	0x03, 0x3f, 0x05, 0x06, 0x2b, 0x01, 0x05, 0x2b, 0x08, 0x05, 0x00, 0x2b,
+	0x08, 0x15, 0x08, 0x2b, 0x05, 0x08, 0x2b, 0x08, 0x05, 0x2b, 0x0c, 0x15,
+	0x08, 0x4b, 0x08, 0x06, 0x5b, 0x01, 0x02, 0x05, 0x8b, 0x16, 0x2b, 0x01,
+	0x05, 0x09, 0x2b, 0x0a, 0x03, 0x0a, 0x2b, 0x0c, 0x01, 0x0d, 0x01, 0x0a,
+	0x01, 0x05, 0x1f, 0x05, 0x2b, 0x08, 0x05, 0x06, 0x2b, 0x00, 0x01, 0x2b,
+	0x16, 0x2b, 0x0d, 0x05, 0x08, 0x8b, 0x06, 0x05, 0x9b, 0x01, 0x08, 0x2b,
+	0x05, 0x0e, 0x05, 0x08, 0x2b, 0x01, 0x2b, 0x06, 0x05, 0x08, 0x7b, 0x06,
+	0x08, 0x2b, 0x05, 0x9f, 0x05, 0x08, 0x2b, 0x05, 0x3f, 0x05, 0x06, 0x2b,
+	0x0a, 0x03, 0x2b, 0x08, 0x15, 0x06, 0x2b, 0x06, 0x05, 0x08, 0x2b, 0x03,
+	0x01, 0x2b, 0x01, 0x05, 0x2b, 0x08, 0x15, 0x09, 0x4b, 0x09, 0x01, 0x5b,
+	0x05, 0x02, 0x00, 0x2b, 0x09, 0x0a, 0x01, 0x2b, 0x09, 0x06, 0x2b, 0x01,
+	0x02, 0x05, 0x2b, 0x08, 0x00, 0x01, 0x8b, 0x03, 0x1f, 0x05, 0x2b, 0x08,
+	0x15, 0x08, 0x0b, 0x06, 0x05, 0x0d, 0x2b, 0x06, 0x01, 0x2b, 0x01, 0x03,
+	0x05, 0x09, 0x6b, 0x06, 0x15, 0x00, 0x08, 0x5b, 0x08, 0x06, 0x05, 0x08,
+	0x2b, 0x05, 0x0d, 0x03, 0x08, 0x2b, 0x01, 0x2b, 0x06, 0x05, 0x08, 0x7b,
+	0x06, 0x08, 0x2b, 0x05, 0x9f, 0x05, 0x08, 0x2b, 0x05, 0x3f, 0x05, 0x06,
+	0x2b, 0x01, 0x05, 0x2b, 0x08, 0x05, 0x07, 0x05, 0x08, 0x2b, 0x05, 0x08,
+	0x2b, 0x05, 0x03, 0x0c, 0x0b, 0x0c, 0x05, 0x03, 0x2b, 0x08, 0x05, 0x02,
+	0x01, 0x4b, 0x01, 0x05, 0x4b, 0x08, 0x05, 0x03, 0x06, 0x2b, 0x01, 0x03,
+	0x05, 0x08, 0x1b, 0x08, 0x09, 0x2b, 0x0a, 0x03, 0x05, 0x0a, 0x2b, 0x06,
+	0x01, 0x8b, 0x05, 0x1f, 0x05, 0x03, 0x25, 0x02, 0x35, 0x0f, 0x45, 0x00,
+	0x15, 0x03, 0x05, 0x0f, 0x02, 0x85, 0x1f, 0x03, 0x85, 0x03, 0x25, 0x03,
+	0x05, 0x0d, 0x00, 0x25, 0x13, 0x35, 0x00, 0xc5, 0x03, 0x05, 0x9f, 0x03,
+	0x25, 0x03, 0x05, 0x3f, 0x07, 0x25, 0x03, 0x05, 0x03, 0x35, 0x03, 0x07,
+	0x03, 0x95, 0x03, 0x25, 0x03, 0x45, 0x03, 0x0f, 0x45, 0x03, 0x05, 0x03,
+	0x55, 0x02, 0x0f, 0x25, 0x03, 0x05, 0x0f, 0x03, 0x85, 0x1f, 0x45, 0x03,
+	0x85, 0x03, 0xff, 0x19, 0x07, 0x2e, 0x7d, 0x0a, 0x1d, 0x0a, 0x0d, 0x0a,
+	0x0d, 0x0a, 0x0d, 0x6a, 0x06, 0x0a, 0x07, 0xff, 0x0b, 0x0e, 0x1d, 0x1e,
+	0x0d, 0x3e, 0x07, 0x1e, 0x27, 0x1f, 0x57, 0x0e, 0x07, 0x1e, 0x37, 0xff,
+	0x50, 0x07, 0x0e, 0x1d, 0x2a, 0x2d, 0x0a, 0x0d, 0x1a, 0x0d, 0x6a, 0x16,
+	0x2a, 0x06, 0x0a, 0x07, 0xff, 0x0b, 0x1e, 0x1d, 0x0e, 0x0d, 0x0e, 0x0d,
+	0x0e, 0x07, 0x1e, 0x0d, 0x4e, 0x47, 0x0e, 0x07, 0x3e, 0x27, 0xff, 0x53,
+	0x1d, 0x0a, 0x2d, 0x0a, 0x3d, 0x4a, 0x56, 0x1a, 0x09, 0x0a, 0xff, 0x0c,
+	0x2d, 0x4e, 0x0d, 0x0e, 0x07, 0x1e, 0x17, 0x3e, 0x27, 0x2e, 0x07, 0x0e,
+	0x07, 0x0e, 0x27, 0xff, 0x54, 0x07, 0x1d, 0x1a, 0x2d, 0x0e, 0x0d, 0x06,
+	0x0a, 0x0d, 0x4a, 0x0d, 0x06, 0x09, 0x06, 0x0a, 0x06, 0x0a, 0xff, 0x0c,
+	0x4d, 0x1e, 0x0d, 0x2e, 0x0d, 0x1e, 0x27, 0x3e, 0x07, 0x0e, 0x07, 0x4e,
+	0x17, 0xff, 0x56, 0x0e, 0x0d, 0x0a, 0x06, 0x3a, 0x16, 0x3a, 0x19, 0x06,
+	0x0a, 0x16, 0x1a, 0x06, 0x0a, 0xff, 0x0c, 0x1d, 0x0e, 0x2d, 0x0e, 0x1d,
+	0x1e, 0x0d, 0x3e, 0x17, 0x4e, 0x17, 0x3e, 0x17, 0xff, 0x57, 0x07, 0x1d,
+	0x1a, 0x26, 0x2a, 0x06, 0x19, 0x1c, 0x19, 0x2a, 0x09, 0x0d, 0xff, 0x0c,
+	0x0d, 0x0a, 0x6d, 0x1e, 0x1d, 0x1e, 0x07, 0x0e, 0x07, 0x0e, 0x07, 0x2e,
+	0x07, 0x5e, 0x07, 0xff, 0x5b, 0x0e, 0x0d, 0x26, 0x0a, 0x49, 0x1c, 0x09,
+	0x06, 0x1a, 0x09, 0x0e, 0xff, 0x0d, 0x1e, 0x5d, 0x1e, 0x1d, 0x6e, 0x07,
+	0x0e, 0x07, 0x4e, 0x27, 0xff, 0x5d, 0x0a, 0x06, 0x0a, 0x06, 0x29, 0x0c,
+	0x09, 0x0a, 0x0c, 0x08, 0x09, 0x16, 0x09, 0x0d, 0xff, 0x0e, 0x0d, 0x1a,
+	0x0d, 0x0a, 0x1d, 0x0e, 0x0d, 0x0a, 0x0d, 0x07, 0x5e, 0x07, 0x5e, 0x0d,
+	0x07, 0xff, 0x60, 0x0d, 0x26, 0x09, 0x06, 0x29, 0x0a, 0x0c, 0x08, 0x06,
+	0x19, 0x0d, 0xff, 0x0e, 0x07, 0x1a, 0x1d, 0x0a, 0x0d, 0x0e, 0x0d, 0x2a,
+	0x0d, 0x6e, 0x0d, 0x0e, 0x2d, 0x0e, 0x07, 0xff, 0x60, 0x0d, 0x1a, 0x09,
+	0x36, 0x0c, 0x16, 0x08, 0x09, 0x06, 0x09, 0x06, 0xff, 0x0f, 0x0e, 0x0a,
+	0x5d, 0x2a, 0x1d, 0x2e, 0x0d, 0x1e, 0x0d, 0x0e, 0x3d, 0x0e, 0x07, 0xff,
+	0x60, 0x06, 0x0d, 0x09, 0x16, 0x0a, 0x06, 0x09, 0x0c, 0x0a, 0x08, 0x0c,
+	0x06, 0x0c, 0x09, 0xff, 0x0f, 0x07, 0x0a, 0x0d, 0x1a, 0x0d, 0x0e, 0x4a,
+	0x0d, 0x0a, 0x0d, 0x2e, 0x5d, 0x0e, 0x0d, 0x07, 0xff, 0x60, 0x0d, 0x16,
+	0x09, 0x26, 0x39, 0x3c, 0xff, 0x10, 0x0a, 0x1d, 0x06, 0x1a, 0x06, 0x1a,
+	0x0d, 0x1a, 0x2d, 0x1e, 0x6d, 0x0e, 0x17, 0xff, 0x60, 0x06, 0x39, 0x06,
+	0x29, 0x06, 0x08, 0x1c, 0x09, 0xff, 0x10, 0x0e, 0x0a, 0x0d, 0x06, 0x0a,
+	0x16, 0x2a, 0x1d, 0x0a, 0x2d, 0x0e, 0x1d, 0x0a, 0x3d, 0x0e, 0x07, 0x0e,
+	0xff, 0x60, 0x0d, 0x2c, 0x19, 0x06, 0x09, 0x06, 0x09, 0x08, 0x09, 0x1c,
+	0x07, 0xff, 0x0f, 0x07, 0x1d, 0x0a, 0x26, 0x2a, 0x3d, 0x1a, 0x07, 0x0d,
+	0x0e, 0x0a, 0x0d, 0x0a, 0x0d, 0x0e, 0x1f, 0x0e, 0xff, 0x61, 0x09, 0x2c,
+	0x09, 0x26, 0x09, 0x08, 0x2c, 0x0a, 0xff, 0x10, 0x1d, 0x0a, 0x56, 0x0a,
+	0x5d, 0x07, 0x2a, 0x0d, 0x0a, 0x07, 0x1f, 0x17, 0xff, 0x60, 0x06, 0x0c,
+	0x08, 0x1c, 0x39, 0x28, 0x0c, 0x09, 0xff, 0x10, 0x1d, 0x0a, 0x76, 0x0a,
+	0x1e, 0x1a, 0x0e, 0x4a, 0x07, 0xff, 0x64, 0x06, 0x09, 0x2c, 0x36, 0x18,
+	0x09, 0x1c, 0xff, 0x10, 0x0e, 0x0d, 0x0a, 0x09, 0x06, 0x09, 0x0a, 0x16,
+	0x4a, 0x2d, 0x06, 0x3a, 0x0e, 0xff, 0x63, 0x0e, 0x0c, 0x29, 0x1a, 0x06,
+	0x1a, 0x18, 0x0c, 0x08, 0x09, 0x07, 0xff, 0x0f, 0x0e, 0x0d, 0x0a, 0x29,
+	0x0d, 0x0a, 0x16, 0x0a, 0x06, 0x0a, 0x0d, 0x06, 0x1a, 0x06, 0x3a, 0x0d,
+	0xff, 0x63, 0x0a, 0x08, 0x0c, 0x09, 0x06, 0x1a, 0x06, 0x0a, 0x06, 0x0c,
+	0x28, 0x0c, 0x0a, 0xff, 0x0f, 0x07, 0x0e, 0x1d, 0x06, 0x09, 0x0a, 0x26,
+	0x0a, 0x06, 0x0a, 0x26, 0x2a, 0x06, 0x1a, 0x0d, 0xff, 0x63, 0x0d, 0x09,
+	0x06, 0x19, 0x06, 0x2a, 0x06, 0x0c, 0x18, 0x0c, 0x08, 0x0c, 0xff, 0x0f,
+	0x0e, 0x0a, 0x06, 0x0f, 0x06, 0x09, 0x0a, 0x09, 0x06, 0x09, 0x0a, 0x16,
+	0x3a, 0x36, 0x1a, 0xff, 0x63, 0x09, 0x0c, 0x19, 0x0a, 0x0e, 0x0d, 0x1a,
+	0x09, 0x0c, 0x38, 0x0c, 0x0d, 0xff, 0x12, 0x0d, 0x09, 0x0d, 0x09, 0x26,
+	0x09, 0x16, 0x0d, 0x06, 0x1a, 0x36, 0x0a, 0xff, 0x62, 0x07, 0x0c, 0x0a,
+	0x0c, 0x08, 0x0c, 0x1a, 0x0d, 0x06, 0x09, 0x0c, 0x38, 0x09, 0x0a, 0xff,
+	0x13, 0x0c, 0x0a, 0x29, 0x06, 0x0a, 0x06, 0x2a, 0x1d, 0x09, 0x26, 0x0a,
+	0xff, 0x62, 0x1c, 0x0a, 0x1c, 0x19, 0x1c, 0x09, 0x1c, 0x28, 0x1c, 0x06,
+	0xff, 0x13, 0x1a, 0x19, 0x06, 0x09, 0x06, 0x09, 0x26, 0x0a, 0x0d, 0x09,
+	0x06, 0x09, 0x06, 0x0a, 0xff, 0x61, 0x09, 0x08, 0x0a, 0x08, 0x1c, 0x0d,
+	0x48, 0x0c, 0x18, 0x0c, 0x18, 0x09, 0xff, 0x13, 0x07, 0x0a, 0x39, 0x0a,
+	0x16, 0x0a, 0x06, 0x0a, 0x0d, 0x29, 0x06, 0x0a, 0xff, 0x60, 0x09, 0x06,
+	0x09, 0x1c, 0x08, 0x0d, 0x0c, 0x08, 0x1c, 0x18, 0x09, 0x48, 0x0a, 0xff,
+	0x14, 0x0a, 0x06, 0x0c, 0x09, 0x1a, 0x06, 0x2a, 0x16, 0x29, 0x06, 0x0a,
+	0xff, 0x5f, 0x06, 0x09, 0x06, 0x09, 0x18, 0x0a, 0x1c, 0x08, 0x0c, 0x09,
+	0x0c, 0x18, 0x0c, 0x0b, 0x28, 0x06, 0xff, 0x14, 0x07, 0x0a, 0x19, 0x0a,
+	0x06, 0x1a, 0x16, 0x09, 0x0a, 0x09, 0x0c, 0x09, 0x06, 0x0d, 0xff, 0x5e,
+	0x06, 0x09, 0x0d, 0x09, 0x18, 0x09, 0x0c, 0x08, 0x0c, 0x08, 0x06, 0x1c,
+	0x09, 0x48, 0x0c, 0x09, 0xff, 0x15, 0x06, 0x09, 0x0c, 0x36, 0x1a, 0x16,
+	0x0c, 0x29, 0x0a, 0xff, 0x5e, 0x1c, 0x08, 0x0c, 0x19, 0x0a, 0x4c, 0x08,
+	0x0c, 0x09, 0x0c, 0x38, 0x0c, 0x08, 0xff, 0x15, 0x19, 0x0c, 0x09, 0x06,
+	0x09, 0x06, 0x09, 0x0a, 0x09, 0x0d, 0x06, 0x1c, 0x09, 0x0d, 0xff, 0x5d,
+	0x0a, 0x09, 0x06, 0x08, 0x0c, 0x0d, 0x0a, 0x06, 0x0c, 0x08, 0x1c, 0x18,
+	0x3c, 0x18, 0x0c, 0x08, 0x0c, 0x0e, 0xff, 0x14, 0x0e, 0x06, 0x1c, 0x06,
+	0x09, 0x0d, 0x06, 0x0d, 0x0a, 0x0d, 0x06, 0x0c, 0x09, 0x0c, 0x0a, 0xff,
+	0x5c, 0x0a, 0x09, 0x08, 0x0c, 0x08, 0x06, 0x0c, 0x09, 0x2c, 0x28, 0x0c,
+	0x09, 0x08, 0x1c, 0x08, 0x0c, 0x08, 0x0c, 0x08, 0x07, 0xff, 0x15, 0x0e,
+	0x09, 0x0c, 0x16, 0x09, 0x06, 0x0d, 0x0a, 0x16, 0x1c, 0x09, 0x0a, 0xff,
+	0x5a, 0x0d, 0x16, 0x38, 0x1c, 0x08, 0x0a, 0x0c, 0x09, 0x2c, 0x09, 0x1c,
+	0x18, 0x2c, 0x08, 0x0c, 0xff, 0x17, 0x0d, 0x1c, 0x19, 0x0c, 0x09, 0x16,
+	0x0d, 0x2c, 0x0a, 0xff, 0x59, 0x0e, 0x08, 0x2c, 0x08, 0x0c, 0x38, 0x06,
+	0x0a, 0x09, 0x08, 0x1c, 0x28, 0x0c, 0x08, 0x0c, 0x18, 0x0c, 0xff, 0x19,
+	0x09, 0x1c, 0x09, 0x0c, 0x16, 0x09, 0x0d, 0x2c, 0x0a, 0xff, 0x58, 0x0e,
+	0x0c, 0x09, 0x0c, 0x18, 0x06, 0x09, 0x18, 0x0c, 0x18, 0x3c, 0x38, 0x1c,
+	0x08, 0x0c, 0x0d, 0xff, 0x1a, 0x06, 0x0c, 0x09, 0x1c, 0x09, 0x0d, 0x06,
+	0x0d, 0x08, 0x1c, 0x0a, 0xff, 0x58, 0x0a, 0x09, 0x1c, 0x08, 0x1c, 0x09,
+	0x48, 0x09, 0x0c, 0x09, 0x38, 0x0c, 0x08, 0x0c, 0x0e, 0xff, 0x1c, 0x0d,
+	0x1c, 0x06, 0x09, 0x06, 0x2e, 0x2c, 0x09, 0xff, 0x56, 0x0e, 0x0a, 0x4c,
+	0x18, 0x1c, 0x18, 0x0c, 0x0b, 0x09, 0x1c, 0x38, 0x09, 0x0e, 0xff, 0x1e,
+	0x06, 0x29, 0x06, 0x09, 0x0a, 0x0d, 0x06, 0x0c, 0x08, 0x1c, 0xff, 0x55,
+	0x07, 0x06, 0x09, 0x08, 0x09, 0x0c, 0x08, 0x0c, 0x06, 0x0c, 0x08, 0x09,
+	0x0c, 0x28, 0x2c, 0x18, 0x0a, 0x0e, 0xff, 0x20, 0x0d, 0x09, 0x3c, 0x06,
+	0x0a, 0x0d, 0x06, 0x0c, 0x08, 0x0c, 0x07, 0xff, 0x54, 0x06, 0x1c, 0x08,
+	0x0c, 0x09, 0x3c, 0x08, 0x09, 0x0c, 0x08, 0x0c, 0x0b, 0x09, 0x08, 0x0c,
+	0x09, 0x0e, 0xff, 0x23, 0x19, 0x0c, 0x06, 0x19, 0x0d, 0x0a, 0x0d, 0x08,
+	0x1c, 0x0a, 0xff, 0x53, 0x06, 0x0c, 0x28, 0x09, 0x0c, 0x08, 0x0c, 0x18,
+	0x3c, 0x18, 0x0c, 0x08, 0x0a, 0x07, 0xff, 0x24, 0x0a, 0x09, 0x0c, 0x19,
+	0x0c, 0x0d, 0x06, 0x0d, 0x3c, 0xff, 0x52, 0x19, 0x68, 0x0c, 0x18, 0x0c,
+	0x18, 0x1c, 0x08, 0x06, 0x07, 0xff, 0x26, 0x07, 0x09, 0x0c, 0x19, 0x0c,
+	0x06, 0x09, 0x16, 0x08, 0x1c, 0x0e, 0xff, 0x50, 0x0e, 0x09, 0x0c, 0x78,
+	0x1c, 0x28, 0x0c, 0x06, 0x07, 0xff, 0x29, 0x1c, 0x39, 0x0c, 0x08, 0x0d,
+	0x0c, 0x08, 0x0c, 0x09, 0xff, 0x51, 0x0e, 0x16, 0x0a, 0x06, 0x0c, 0x09,
+	0x18, 0x09, 0x18, 0x0c, 0x1a, 0x07, 0xff, 0x2a, 0x07, 0x0c, 0x19, 0x06,
+	0x09, 0x1c, 0x06, 0x0d, 0x09, 0x1c, 0x09, 0x07, 0xff, 0x51, 0x07, 0x0a,
+	0x09, 0x0c, 0x08, 0x4c, 0x06, 0x0e, 0xff, 0x2d, 0x0d, 0x0c, 0x09, 0x0c,
+	0x29, 0x0c, 0x28, 0x0b, 0x08, 0x0c, 0x06, 0xff, 0x53, 0x1e, 0x0d, 0x0e,
+	0x0d, 0x1e, 0x07, 0xff, 0x30, 0x1c, 0x09, 0x06, 0x28, 0x2c, 0x38, 0x0d,
+	0xff, 0x9a, 0x0c, 0x09, 0x0c, 0x18, 0x29, 0x0e, 0x07, 0x16, 0x1a, 0x09,
+	0xff, 0x9a, 0x06, 0x28, 0x0c, 0x0d, 0x0a, 0x09, 0x16, 0x09, 0x08, 0x0c,
+	0x06, 0x09, 0xff, 0x9a, 0x0d, 0x18, 0x1c, 0x0a, 0x09, 0x06, 0x09, 0x0d,
+	0x0c, 0x08, 0x0c, 0x09, 0x0c, 0x07, 0xff, 0x99, 0x0d, 0x08, 0x2c, 0x06,
+	0x08, 0x0c, 0x06, 0x0d, 0x0c, 0x18, 0x09, 0x08, 0xff, 0x9a, 0x06, 0x0b,
+	0x08, 0x0c, 0x08, 0x09, 0x0c, 0x18, 0x0d, 0x06, 0x08, 0x0c, 0x09, 0x0c,
+	0xff, 0x9a, 0x0c, 0x38, 0x1c, 0x18, 0x1a, 0x0c, 0x16, 0x08, 0xff, 0x9c,
+	0x0c, 0x28, 0x0c, 0x18, 0x1a, 0x0c, 0x08, 0x06, 0x08, 0x0e, 0xff, 0x9b,
+	0x0c, 0x28, 0x0c, 0x08, 0x09, 0x0a, 0x0d, 0x08, 0x0c, 0x06, 0x08, 0x0e,
+	0xff, 0x9a, 0x0e, 0x0c, 0x28, 0x09, 0x1c, 0x06, 0x0a, 0x19, 0x1c, 0x0d,
+	0xff, 0x9a, 0x0a, 0x0c, 0x18, 0x09, 0x5c, 0x09, 0x0a, 0x16, 0xff, 0x9b,
+	0x09, 0x18, 0x19, 0x18, 0x19, 0x18, 0x1c, 0x08, 0xff, 0x9b, 0x06, 0x2c,
+	0x08, 0x0c, 0x18, 0x06, 0x18, 0x0c, 0x18, 0x0d, 0xff, 0x9a, 0x06, 0x1c,
+	0x48, 0x0d, 0x0c, 0x08, 0x0c, 0x18, 0x0a, 0xff, 0x9a, 0x0c, 0x28, 0x06,
+	0x1c, 0x06, 0x0e, 0x1c, 0x16, 0x08, 0x0c, 0xff, 0x99, 0x0e, 0x09, 0x0c,
+	0x18, 0x06, 0x0d, 0x09, 0x0a, 0x0f, 0x0d, 0x1a, 0x06, 0x08, 0x0c, 0xff,
+	0x99, 0x0e, 0x0c, 0x18, 0x0d, 0x06, 0x09, 0x0a, 0x0c, 0x0a, 0x09, 0x1e,
+	0x0a, 0x0c, 0x09, 0xff, 0x99, 0x07, 0x08, 0x0c, 0x0a, 0x06, 0x1c, 0x08,
+	0x06, 0x19, 0x1c, 0x09, 0x0a, 0x08, 0x07, 0xff, 0x98, 0x0e, 0x08, 0x09,
+	0x06, 0x0c, 0x18, 0x09, 0x0e, 0x08, 0x0a, 0x09, 0x08, 0x0a, 0x0d, 0x09,
+	0x0d, 0xff, 0x98, 0x06, 0x08, 0x0a, 0x06, 0x0c, 0x08, 0x09, 0x0e, 0x18,
+	0x09, 0x18, 0x0c, 0x06, 0x0c, 0x06, 0xff, 0x98, 0x09, 0x0c, 0x09, 0x08,
+	0x1c, 0x16, 0x0c, 0x18, 0x09, 0x0c, 0x08, 0x0c, 0x09, 0x0c, 0xff, 0x98,
+	0x06, 0x09, 0x18, 0x4c, 0x18, 0x0c, 0x18, 0x2c, 0xff, 0x98, 0x0d, 0x0a,
+	0x0c, 0x08, 0x0a, 0x0c, 0x28, 0x3c, 0x06, 0x0c, 0x09, 0x0a, 0xff, 0x98,
+	0x07, 0x0a, 0x0d, 0x19, 0x58, 0x2c, 0x06, 0x0a, 0x0d, 0xff, 0x99, 0x0d,
+	0x0a, 0x0d, 0x0a, 0x0c, 0x48, 0x1c, 0x06, 0x0d, 0x0e, 0xff, 0x9b, 0x0d,
+	0x0a, 0x06, 0x0c, 0x18, 0x0c, 0x08, 0x1c, 0x09, 0x0a, 0x0e, 0xff, 0x9d,
+	0x1e, 0x0d, 0x3a, 0x1d, 0x0e, 0x07, 0xff, 0x27,
+};
+
+static constexpr RunBitmap bitmap_splash {
+	{ 185, 283 }, bitmap_splash_palette, bitmap_splash_runs, -1
+};
+
+} /* namespace ui */
+
+#endif/*__BITMAP_SPLASH_H__*/
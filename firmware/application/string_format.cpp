@@ -105,6 +105,15 @@ static void to_string_hex_internal(char* p, const uint32_t n, const int32_t l) {
 	}
 }
 
+std::string to_string_dec_uint64(const uint64_t n) {
+	constexpr uint32_t split = 1000000000U;
+	if( n < split ) {
+		return to_string_dec_uint(n);
+	} else {
+		return to_string_dec_uint64(n / split) + to_string_dec_uint(n % split, 9, '0');
+	}
+}
+
 std::string to_string_hex(const uint32_t n, const int32_t l) {
 	char p[16];
 	to_string_hex_internal(p, n, l - 1);
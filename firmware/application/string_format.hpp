@@ -33,6 +33,7 @@ using namespace lpc43xx;
 
 std::string to_string_dec_uint(const uint32_t n, const int32_t l = 0, const char fill = 0);
 std::string to_string_dec_int(const int32_t n, const int32_t l = 0, const char fill = 0);
+std::string to_string_dec_uint64(const uint64_t n);
 std::string to_string_hex(const uint32_t n, const int32_t l = 0);
 
 std::string to_string_datetime(const rtc::RTC& value);
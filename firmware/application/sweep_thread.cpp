@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) 2016 Jared Boone, ShareBrained Technology, Inc.
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "sweep_thread.hpp"
+
+#include "portapack_shared_memory.hpp"
+
+#include <utility>
+#include <algorithm>
+
+// SweepThread ////////////////////////////////////////////////////////////
+
+/* How long to wait for a capture before giving up on it and retuning. */
+constexpr systime_t capture_timeout = MS2ST(100);
+
+Thread* SweepThread::thread = nullptr;
+
+SweepThread::SweepThread(
+	std::vector<radio::TuningPlan> plans,
+	size_t settle_blocks,
+	size_t capture_blocks
+) : config { settle_blocks, std::max<size_t>(capture_blocks, 1) },
+	plans { std::move(plans) }
+{
+	shared_memory.baseband_queue.push_and_wait(
+		SweepConfigMessage { &config }
+	);
+
+	// Retunes must not wait behind the UI thread
+	thread = chThdCreateFromHeap(NULL, 512, NORMALPRIO + 10, SweepThread::static_fn, this);
+}
+
+SweepThread::~SweepThread() {
+	if( thread ) {
+		chThdTerminate(thread);
+		chEvtSignal(thread, EVT_MASK_SWEEP_THREAD);
+		chThdWait(thread);
+		thread = nullptr;
+	}
+
+	shared_memory.baseband_queue.push_and_wait(
+		SweepConfigMessage { nullptr }
+	);
+}
+
+void SweepThread::check_fifo_isr() {
+	if( thread ) {
+		chEvtSignalI(thread, EVT_MASK_SWEEP_THREAD);
+	}
+}
+
+msg_t SweepThread::run() {
+	if( plans.empty() ) {
+		return false;
+	}
+
+	size_t slice = 0;
+	uint32_t sequence = config.tuned_sequence;
+
+	while( !chThdShouldTerminate() ) {
+		radio::set_tuning(plans[slice]);
+		config.tuned_slice = slice;
+		config.tuned_sequence = ++sequence;
+
+		while( (config.captured_sequence != sequence) && !chThdShouldTerminate() ) {
+			if( chEvtWaitAnyTimeout(EVT_MASK_SWEEP_THREAD, capture_timeout) == 0 ) {
+				break;
+			}
+		}
+
+		slice = (slice + 1) % plans.size();
+	}
+
+	return true;
+}
@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2016 Jared Boone, ShareBrained Technology, Inc.
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __SWEEP_THREAD_H__
+#define __SWEEP_THREAD_H__
+
+#include "ch.h"
+
+#include "event_m0.hpp"
+#include "message.hpp"
+#include "radio.hpp"
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+/* Steps the radio through a list of tuning plans without involving the UI
+ * thread. Each hop is started as soon as the baseband reports the previous
+ * slice captured. Spectra arrive in fifo(), tagged with the plan index.
+ */
+class SweepThread {
+public:
+	SweepThread(
+		std::vector<radio::TuningPlan> plans,
+		size_t settle_blocks = 2,
+		size_t capture_blocks = 8
+	);
+	~SweepThread();
+
+	SweepSliceFIFO* fifo() const {
+		return config.fifo;
+	}
+
+	static void check_fifo_isr();
+
+private:
+	SweepConfig config;
+	std::vector<radio::TuningPlan> plans;
+	static Thread* thread;
+
+	static msg_t static_fn(void* arg) {
+		auto obj = static_cast<SweepThread*>(arg);
+		return obj->run();
+	}
+
+	msg_t run();
+};
+
+#endif/*__SWEEP_THREAD_H__*/
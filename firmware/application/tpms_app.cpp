@@ -59,15 +59,14 @@ TPMSLogger::TPMSLogger(
 {
 }
 
-void TPMSLogger::on_packet(const tpms::Packet& packet, const uint32_t target_frequency) {
-	const auto hex_formatted = packet.symbols_formatted();
-
+void TPMSLogger::on_packet(
+	const tpms::SignalType signal_type,
+	const baseband::Packet& packet,
+	const bool valid,
+	const uint32_t target_frequency
+) {
 	if( log_file.is_open() ) {
-		// TODO: function doesn't take uint64_t, so when >= 1<<32, weirdness will ensue!
-		const auto tuning_frequency_str = to_string_dec_uint(target_frequency, 10);
-
-		std::string entry = tuning_frequency_str + " FSK 38.4 19.2 " + hex_formatted.data + "/" + hex_formatted.errors;
-		log_file.write_entry(packet.received_at(), entry);
+		log_file.write(packet_log::Protocol::TPMS, signal_type, valid, packet, target_frequency);
 	}
 }
 
@@ -156,6 +155,10 @@ TPMSAppView::TPMSAppView(NavigationView&) {
 		[this](Message* const p) {
 			const auto message = static_cast<const TPMSPacketMessage*>(p);
 			const tpms::Packet packet { message->packet };
+			if( this->logger ) {
+				const auto valid = packet.reading(message->signal_type).is_valid();
+				this->logger->on_packet(message->signal_type, message->packet, valid, this->target_frequency());
+			}
 			this->on_packet(message->signal_type, packet);
 		}
 	);
@@ -165,7 +168,7 @@ TPMSAppView::TPMSAppView(NavigationView&) {
 		sampling_rate,
 		baseband_bandwidth,
 		rf::Direction::Receive,
-		false, 32, 32,
+		false, lna_gain_db, vga_gain_db,
 		1,
 	});
 
@@ -175,14 +178,34 @@ TPMSAppView::TPMSAppView(NavigationView&) {
 		.decimation_factor = 1,
 	});
 
-	logger = std::make_unique<TPMSLogger>("tpms.txt");
+	// Strong signals nearby overload the front end at fixed gain.
+	agc_thread = std::make_unique<AGCThread>(agc::settings_for_mode(5), lna_gain_db, vga_gain_db);
+
+	logger = std::make_unique<TPMSLogger>(next_filename_stem_matching_pattern("TPMS????") + ".PKT");
+}
+
+/* No receiver and no log: a new, empty log would become the last one. */
+TPMSAppView::TPMSAppView(
+	NavigationView&,
+	const std::string& replay_file_path
+) : live { false }
+{
+	add_children({ {
+		&recent_entries_view,
+	} });
+
+	replay(replay_file_path);
 }
 
 TPMSAppView::~TPMSAppView() {
-	baseband::stop();
-	radio::disable();
+	if( live ) {
+		agc_thread.reset();
 
-	EventDispatcher::message_map().unregister_handler(Message::ID::TPMSPacket);
+		baseband::stop();
+		radio::disable();
+
+		EventDispatcher::message_map().unregister_handler(Message::ID::TPMSPacket);
+	}
 }
 
 void TPMSAppView::focus() {
@@ -194,11 +217,18 @@ void TPMSAppView::set_parent_rect(const Rect new_parent_rect) {
 	recent_entries_view.set_parent_rect({ 0, 0, new_parent_rect.width(), new_parent_rect.height() });
 }
 
-void TPMSAppView::on_packet(const tpms::SignalType signal_type, const tpms::Packet& packet) {
-	if( logger ) {
-		logger->on_packet(packet, target_frequency());
+void TPMSAppView::replay(const std::string& file_path) {
+	packet_log::Reader reader { file_path };
+	packet_log::Record record;
+	while( reader.read(record) ) {
+		if( record.protocol() == packet_log::Protocol::TPMS ) {
+			const tpms::Packet packet { record.packet() };
+			on_packet(static_cast<tpms::SignalType>(record.subtype()), packet);
+		}
 	}
+}
 
+void TPMSAppView::on_packet(const tpms::SignalType signal_type, const tpms::Packet& packet) {
 	const auto reading_opt = packet.reading(signal_type);
 	if( reading_opt.is_valid() ) {
 		const auto reading = reading_opt.value();
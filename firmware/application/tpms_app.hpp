@@ -25,12 +25,14 @@
 #include "ui_widget.hpp"
 #include "ui_navigation.hpp"
 
-#include "log_file.hpp"
+#include "packet_log.hpp"
 
 #include "recent_entries.hpp"
 
 #include "tpms_packet.hpp"
 
+#include "agc_thread.hpp"
+
 namespace std {
 
 constexpr bool operator==(const tpms::TransponderID& lhs, const tpms::TransponderID& rhs) {
@@ -72,10 +74,15 @@ class TPMSLogger {
 public:
 	TPMSLogger(const std::string& file_path);
 	
-	void on_packet(const tpms::Packet& packet, const uint32_t target_frequency);
+	void on_packet(
+		const tpms::SignalType signal_type,
+		const baseband::Packet& packet,
+		const bool valid,
+		const uint32_t target_frequency
+	);
 
 private:
-	LogFile log_file;
+	packet_log::Writer log_file;
 };
 
 namespace ui {
@@ -85,6 +92,8 @@ using TPMSRecentEntriesView = RecentEntriesView<TPMSRecentEntries>;
 class TPMSAppView : public View {
 public:
 	TPMSAppView(NavigationView& nav);
+	/* Shows the packets in a log instead of receiving. */
+	TPMSAppView(NavigationView& nav, const std::string& replay_file_path);
 	~TPMSAppView();
 
 	void set_parent_rect(const Rect new_parent_rect) override;
@@ -95,18 +104,23 @@ public:
 
 	void focus() override;
 
-	std::string title() const override { return "TPMS"; };
+	std::string title() const override { return live ? "TPMS" : "TPMS Replay"; };
 
 private:
 	static constexpr uint32_t initial_target_frequency = 315000000;
 	static constexpr uint32_t sampling_rate = 2457600;
 	static constexpr uint32_t baseband_bandwidth = 1750000;
+	static constexpr int32_t lna_gain_db = 32;
+	static constexpr int32_t vga_gain_db = 32;
 
+	const bool live { true };
 	TPMSRecentEntries recent;
 	std::unique_ptr<TPMSLogger> logger;
+	std::unique_ptr<AGCThread> agc_thread;
 
 	TPMSRecentEntriesView recent_entries_view { recent };
 
+	void replay(const std::string& file_path);
 	void on_packet(const tpms::SignalType signal_type, const tpms::Packet& packet);
 	void on_show_list();
 
@@ -80,12 +80,15 @@ uint32_t TransmitterModel::sampling_rate() const {
 
 void TransmitterModel::enable() {
 	enabled_ = true;
-	radio::set_direction(rf::Direction::Transmit);
-	update_tuning_frequency();
-	update_rf_amp();
-	update_lna();
-	update_vga();
-	update_baseband_bandwidth();
+	{
+		radio::Transaction transaction;
+		radio::set_direction(rf::Direction::Transmit);
+		update_tuning_frequency();
+		update_rf_amp();
+		update_lna();
+		update_vga();
+		update_baseband_bandwidth();
+	}
 	update_baseband_configuration();
 }
 
@@ -140,9 +143,12 @@ void TransmitterModel::update_baseband_configuration() {
 	// Disabling baseband while changing sampling rates seems like a good idea...
 	baseband::stop();
 
-	radio::set_baseband_rate(sampling_rate() * baseband_oversampling());
-	update_tuning_frequency();
-	radio::set_baseband_decimation_by(baseband_oversampling());
+	{
+		radio::Transaction transaction;
+		radio::set_baseband_rate(sampling_rate() * baseband_oversampling());
+		update_tuning_frequency();
+		radio::set_baseband_decimation_by(baseband_oversampling());
+	}
 
 	baseband::start(baseband_configuration);
 }
@@ -69,7 +69,8 @@ void BasebandStatsView::on_statistics_update(const BasebandStatistics& statistic
 	std::string message = ticks_to_percent_string(statistics.idle_ticks)
 		+ " " + ticks_to_percent_string(statistics.main_ticks)
 		+ " " + ticks_to_percent_string(statistics.rssi_ticks)
-		+ " " + ticks_to_percent_string(statistics.baseband_ticks);
+		+ " " + ticks_to_percent_string(statistics.baseband_ticks)
+		+ " " + to_string_dec_uint(statistics.arena_peak / 1024, 2) + "K";
 
 	text_stats.set(message);
 }
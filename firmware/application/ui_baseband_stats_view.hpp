@@ -36,7 +36,7 @@ public:
 
 private:
 	Text text_stats {
-		{  0 * 8, 0, (4 * 4 + 3) * 8, 1 * 16 },
+		{  0 * 8, 0, (4 * 4 + 3 + 4) * 8, 1 * 16 },
 		"",
 	};
 
@@ -48,6 +48,7 @@ void CloseCallView::focus() {
 }
 
 CloseCallView::~CloseCallView() {
+	sweep_thread.reset();
 	receiver_model.disable();
 	time::signal_tick_second -= signal_token_tick_second;
 }
@@ -154,22 +155,53 @@ void CloseCallView::do_detection() {
 }
 
 void CloseCallView::on_channel_spectrum(const ChannelSpectrum& spectrum) {
+	baseband::spectrum_streaming_stop;
+	
+	on_slice_spectrum(spectrum.db);
+	do_detection();
+	
+	baseband::spectrum_streaming_start(1);
+}
+
+void CloseCallView::on_sweep_slice(const SweepSlice& slice) {
+	if (slice.index >= slices_max)
+		return;
+	
+	// The baseband drops slices when the FIFO is full, so a slice seen
+	// twice means the sweep wrapped before completing: start over
+	if (slices_received & (1UL << slice.index)) {
+		slices_received = 0;
+		mean = 0;
+	}
+	slices_received |= (1UL << slice.index);
+	
+	slices_counter = slice.index;
+	on_slice_spectrum(slice.db);
+	
+	if (slices_counter == (slices_max - 1)) {
+		// Only judge sweeps that arrived whole
+		if (slices_received == (0xFFFFFFFFUL >> (32 - slices_max)))
+			do_detection();
+		slices_received = 0;
+		mean = 0;
+	}
+}
+
+void CloseCallView::on_slice_spectrum(const std::array<uint8_t, 256>& db) {
 	uint8_t xmax = 0;
 	uint16_t imax = 0;
 	uint8_t threshold;
 	size_t i, m;
 	
-	baseband::spectrum_streaming_stop;
-	
 	// Spectrum line (for debug)
 	std::array<Color, 240> pixel_row;
 	for(i = 0; i < 118; i++) {
-		const auto pixel_color = spectrum_rgb3_lut[spectrum.db[256 - 120 + i]];
+		const auto pixel_color = spectrum_rgb3_lut[db[256 - 120 + i]];
 		pixel_row[i + 2] = pixel_color;
 	}
 
 	for(i = 122; i < 240; i++) {
-		const auto pixel_color = spectrum_rgb3_lut[spectrum.db[i - 120]];
+		const auto pixel_color = spectrum_rgb3_lut[db[i - 120]];
 		pixel_row[i - 2] = pixel_color;
 	}
 
@@ -186,7 +218,7 @@ void CloseCallView::on_channel_spectrum(const ChannelSpectrum& spectrum) {
 	else
 		i = 0;
 	for ( ; i < 118; i++) {
-		threshold = spectrum.db[256 - 120 + i];		// 128+8 = 136 ~254
+		threshold = db[256 - 120 + i];		// 128+8 = 136 ~254
 		if (threshold > xmax) {
 			xmax = threshold;
 			imax = i;
@@ -198,7 +230,7 @@ void CloseCallView::on_channel_spectrum(const ChannelSpectrum& spectrum) {
 	else
 		m = 240;
 	for (i = 122 ; i < m; i++) {
-		threshold = spectrum.db[i - 120];			// 240-120 = 120 -> +8 = 128
+		threshold = db[i - 120];			// 240-120 = 120 -> +8 = 128
 		if (threshold > xmax) {						// (0~2) 2~120 (120~136) 136~254 (254~256)
 			xmax = threshold;
 			imax = i - 4;
@@ -209,26 +241,9 @@ void CloseCallView::on_channel_spectrum(const ChannelSpectrum& spectrum) {
 
 	// Add to mean
 	for (i = 136; i < 254; i++)
-		mean += spectrum.db[i];
+		mean += db[i];
 	for (i = 2; i < 120; i++)
-		mean += spectrum.db[i];
-	
-	// Slice update
-	if (slicing) {
-		if (slices_counter >= (slices_max - 1)) {
-			do_detection();
-			mean = 0;
-			slices_counter = 0;
-		} else {
-			slices_counter++;
-		}
-		slice_frequency = slice_start + (slices_counter * CC_SLICE_WIDTH);
-		receiver_model.set_tuning_frequency(slice_frequency);
-	} else {
-		do_detection();
-	}
-	
-	baseband::spectrum_streaming_start(1);
+		mean += db[i];
 }
 
 void CloseCallView::on_show() {
@@ -240,7 +255,13 @@ void CloseCallView::on_show() {
 	);
 	EventDispatcher::message_map().register_handler(Message::ID::DisplayFrameSync,
 		[this](const Message* const) {
-			if( this->fifo ) {
+			if( this->sweep_thread ) {
+				const auto sweep_fifo = this->sweep_thread->fifo();
+				SweepSlice slice;
+				while( sweep_fifo && sweep_fifo->out(slice) ) {
+					this->on_sweep_slice(slice);
+				}
+			} else if( this->fifo ) {
 				ChannelSpectrum channel_spectrum;
 				while( fifo->out(channel_spectrum) ) {
 					this->on_channel_spectrum(channel_spectrum);
@@ -271,15 +292,24 @@ void CloseCallView::on_range_changed() {
 	
 	if (scan_span > CC_SLICE_WIDTH) {
 		// ex: 100~115 (15): 102.5(97.5~107.5) -> 112.5(107.5~117.5) = 2.5 lost left and right
-		slices_max = (scan_span + CC_SLICE_WIDTH - 1) / CC_SLICE_WIDTH;
+		slices_max = std::min<rf::Frequency>((scan_span + CC_SLICE_WIDTH - 1) / CC_SLICE_WIDTH, CC_SLICES_MAX);
 		slices_span = slices_max * CC_SLICE_WIDTH;
 		offset = ((scan_span - slices_span) / 2) + (CC_SLICE_WIDTH / 2);
 		slice_start = std::min(f_min, f_max) + offset;
 		slice_trim = 0;
 		slicing = true;
 		
+		// Hand the slices over to the sweep thread, which hops without waiting on the UI
+		std::vector<radio::TuningPlan> plans;
+		for (size_t n = 0; n < slices_max; n++)
+			plans.push_back(receiver_model.plan_tuning(slice_start + (n * CC_SLICE_WIDTH)));
+		sweep_thread.reset();
+		sweep_thread = std::make_unique<SweepThread>(std::move(plans));
+		
 		// Todo: trims
 	} else {
+		sweep_thread.reset();
+		
 		slice_frequency = (f_max + f_min) / 2;
 		slice_start = slice_frequency;
 		receiver_model.set_tuning_frequency(slice_frequency);
@@ -312,6 +342,8 @@ void CloseCallView::on_range_changed() {
 
 	text_slices.set(to_string_dec_int(slices_max));
 	slices_counter = 0;
+	slices_received = 0;
+	mean = 0;
 }
 
 void CloseCallView::on_lna_changed(int32_t v_db) {
@@ -439,8 +471,6 @@ CloseCallView::CloseCallView(
 		this->on_vga_changed(v_db);
 	};
 	
-	on_range_changed();
-	
 	button_exit.on_select = [&nav](Button&){
 		nav.pop();
 	};
@@ -456,6 +486,10 @@ CloseCallView::CloseCallView(
 	});
 	receiver_model.set_baseband_bandwidth(CC_SLICE_WIDTH);
 	receiver_model.enable();
+	
+	// Slice tuning plans depend on the mode's tuning offset, and the sweep
+	// needs the baseband processor running, so set up the range last
+	on_range_changed();
 }
 
 } /* namespace ui */
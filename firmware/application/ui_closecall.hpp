@@ -21,6 +21,7 @@
  */
 
 #include "receiver_model.hpp"
+#include "sweep_thread.hpp"
 
 #include "spectrum_color_lut.hpp"
 
@@ -35,6 +36,7 @@ namespace ui {
 #define CC_SLICE_WIDTH	3000000		// Radio bandwidth
 #define CC_BIN_NB		236			// Total power bins
 #define CC_BIN_WIDTH	CC_SLICE_WIDTH/CC_BIN_NB
+#define CC_SLICES_MAX	32			// Slices tracked in slices_received
 
 class CloseCallView : public View {
 public:
@@ -71,14 +73,18 @@ private:
 	uint16_t last_channel;
 	rf::Frequency scan_span, resolved_frequency;
 	uint16_t locked_imax;
-	uint8_t slicemax_db[32];		// Todo: Cap max slices !
-	uint8_t slicemax_idx[32];
+	uint8_t slicemax_db[CC_SLICES_MAX];
+	uint8_t slicemax_idx[CC_SLICES_MAX];
+	uint32_t slices_received = 0;	// Bit per slice of the sweep in progress
+	std::unique_ptr<SweepThread> sweep_thread;
 	uint8_t scan_counter;
 	SignalToken signal_token_tick_second;
 	bool ignore = true;
 	bool slicing;
 	bool locked = false;
 	void on_channel_spectrum(const ChannelSpectrum& spectrum);
+	void on_sweep_slice(const SweepSlice& slice);
+	void on_slice_spectrum(const std::array<uint8_t, 256>& db);
 	void on_range_changed();
 	void do_detection();
 	void on_lna_changed(int32_t v_db);
@@ -27,6 +27,7 @@
 #include "string_format.hpp"
 
 #include "audio.hpp"
+#include "event_m0.hpp"
 
 #include "ui_sd_card_debug.hpp"
 
@@ -61,6 +62,48 @@ void DebugMemoryView::focus() {
 	button_done.focus();
 }
 
+/* DebugFramesView *******************************************************/
+
+DebugFramesView::DebugFramesView(NavigationView& nav) {
+	add_children({ {
+		&text_title,
+		&text_label_frames,
+		&text_label_frames_value,
+		&text_label_missed,
+		&text_label_missed_value,
+		&text_label_deferred,
+		&text_label_deferred_value,
+		&button_done
+	} });
+
+	refresh();
+
+	button_done.on_select = [&nav](Button&){ nav.pop(); };
+}
+
+void DebugFramesView::on_show() {
+	EventDispatcher::message_map().register_handler(Message::ID::DisplayFrameSync,
+		[this](const Message* const) {
+			this->refresh();
+		}
+	);
+}
+
+void DebugFramesView::on_hide() {
+	EventDispatcher::message_map().unregister_handler(Message::ID::DisplayFrameSync);
+}
+
+void DebugFramesView::focus() {
+	button_done.focus();
+}
+
+void DebugFramesView::refresh() {
+	const auto stats = EventDispatcher::frame_statistics();
+	text_label_frames_value.set(to_string_dec_uint(stats.frames, 10));
+	text_label_missed_value.set(to_string_dec_uint(stats.missed, 10));
+	text_label_deferred_value.set(to_string_dec_uint(stats.deferred, 10));
+}
+
 /* TemperatureWidget *****************************************************/
 
 void TemperatureWidget::paint(Painter& painter) {
@@ -271,8 +314,9 @@ DebugPeripheralsMenuView::DebugPeripheralsMenuView(NavigationView& nav) {
 /* DebugMenuView *********************************************************/
 
 DebugMenuView::DebugMenuView(NavigationView& nav) {
-	add_items<5>({ {
+	add_items<6>({ {
 		{ "Memory", ui::Color::white(),     	[&nav](){ nav.push<DebugMemoryView>(); } },
+		{ "Frames", ui::Color::white(),     	[&nav](){ nav.push<DebugFramesView>(); } },
 		{ "Radio State", ui::Color::white(),	[&nav](){ nav.push<NotImplementedView>(); } },
 		{ "SD Card", ui::Color::white(),    	[&nav](){ nav.push<SDCardDebugView>(); } },
 		{ "Peripherals", ui::Color::white(),	[&nav](){ nav.push<DebugPeripheralsMenuView>(); } },
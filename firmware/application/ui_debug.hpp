@@ -82,6 +82,56 @@ private:
 	};
 };
 
+class DebugFramesView : public View {
+public:
+	DebugFramesView(NavigationView& nav);
+
+	void on_show() override;
+	void on_hide() override;
+
+	void focus() override;
+
+private:
+	void refresh();
+
+	Text text_title {
+		{ 96, 96, 48, 16 },
+		"Frames",
+	};
+
+	Text text_label_frames {
+		{ 0, 128, 120, 16 },
+		"LCD Frames Seen",
+	};
+
+	Text text_label_frames_value {
+		{ 160, 128, 80, 16 },
+	};
+
+	Text text_label_missed {
+		{ 0, 144, 104, 16 },
+		"Frames Missed",
+	};
+
+	Text text_label_missed_value {
+		{ 160, 144, 80, 16 },
+	};
+
+	Text text_label_deferred {
+		{ 0, 160, 120, 16 },
+		"Paints Deferred",
+	};
+
+	Text text_label_deferred_value {
+		{ 160, 160, 80, 16 },
+	};
+
+	Button button_done {
+		{ 72, 192, 96, 24 },
+		"Done"
+	};
+};
+
 class TemperatureWidget : public Widget {
 public:
 	explicit TemperatureWidget(
@@ -0,0 +1,796 @@
+/*
+ * Generated by tools/make_font_aa.py from ui_font_fixed_8x16.cpp, do not edit.
+ */
+
+#include "ui_font_aa_16x32.hpp"
+
+#include <cstdint>
+
+namespace ui {
+namespace font {
+
+namespace {
+
+const uint8_t aa_16x32_glyph_data[] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+	0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+	0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+	0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+	0x3c, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x80, 0x02, 0x00, 0x3c, 0xc0, 0x03, 0x00,
+	0x3c, 0xc0, 0x03, 0x00, 0x3c, 0xc0, 0x03, 0x00, 0x3c, 0xc0, 0x03, 0x00, 0x3c, 0xc0, 0x03, 0x00,
+	0x3c, 0xc0, 0x03, 0x00, 0x28, 0x80, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x0a, 0x00, 0xf0, 0x00, 0x0f,
+	0x00, 0xf0, 0x00, 0x0f, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0xf4, 0x41, 0x1f, 0x00, 0xf9, 0x96, 0x6f,
+	0xfe, 0xff, 0xff, 0xbf, 0xfe, 0xff, 0xff, 0xbf, 0x90, 0x6f, 0xf9, 0x06, 0x40, 0x1f, 0xf4, 0x01,
+	0x40, 0x1f, 0xf4, 0x01, 0x90, 0x6f, 0xf9, 0x06, 0xfe, 0xff, 0xff, 0xbf, 0xfe, 0xff, 0xff, 0xbf,
+	0xf9, 0x96, 0x6f, 0x00, 0xf4, 0x41, 0x1f, 0x00, 0xf0, 0x00, 0x0f, 0x00, 0xf0, 0x00, 0x0f, 0x00,
+	0xf0, 0x00, 0x0f, 0x00, 0xa0, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x69, 0x00, 0x00, 0x40, 0xbe, 0x01, 0x00, 0x90, 0xff, 0x2f, 0x00, 0xe4, 0xff, 0x2f, 0x00,
+	0x78, 0xbd, 0x01, 0x00, 0x3c, 0x7c, 0x00, 0x00, 0x3c, 0x3c, 0x00, 0x00, 0x3c, 0x3c, 0x00, 0x00,
+	0x3c, 0x3c, 0x00, 0x00, 0x78, 0x3d, 0x00, 0x00, 0xe4, 0x7f, 0x00, 0x00, 0x90, 0xbf, 0x01, 0x00,
+	0x40, 0xfe, 0x06, 0x00, 0x00, 0xfd, 0x1b, 0x00, 0x00, 0x7c, 0x2d, 0x00, 0x00, 0x3c, 0x3c, 0x00,
+	0x00, 0x3c, 0x3c, 0x00, 0x00, 0x3c, 0x3c, 0x00, 0x00, 0x3d, 0x3c, 0x00, 0x40, 0x7e, 0x2d, 0x00,
+	0xf8, 0xff, 0x1b, 0x00, 0xf8, 0xff, 0x06, 0x00, 0x40, 0xbe, 0x01, 0x00, 0x00, 0x69, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0x1b, 0x40, 0x0a, 0xf9, 0x6f, 0x90, 0x0b,
+	0x6e, 0xb9, 0xe0, 0x06, 0x1f, 0xf4, 0xf0, 0x01, 0x0f, 0xf0, 0xf0, 0x00, 0x0f, 0xf0, 0xb1, 0x00,
+	0x1f, 0xe4, 0x72, 0x00, 0x6e, 0x8d, 0x1b, 0x00, 0xf9, 0x4f, 0x1f, 0x00, 0xe4, 0x5f, 0x6e, 0x00,
+	0x00, 0xb9, 0xf5, 0x1b, 0x00, 0xf4, 0xf1, 0x6f, 0x00, 0xe4, 0x72, 0xb9, 0x00, 0x8d, 0x1b, 0xf4,
+	0x00, 0x4e, 0x0f, 0xf0, 0x00, 0x0f, 0x0f, 0xf0, 0x40, 0x0f, 0x1f, 0xf4, 0x90, 0x0b, 0x6e, 0xb9,
+	0xe0, 0x06, 0xf9, 0x6f, 0xa0, 0x01, 0xe4, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x06, 0x00, 0x40, 0xfe, 0x1b, 0x00,
+	0x80, 0x5b, 0x2e, 0x00, 0xc0, 0x07, 0x3d, 0x00, 0xc0, 0x03, 0x3d, 0x00, 0xc0, 0x43, 0x2e, 0x00,
+	0xc0, 0x83, 0x1b, 0x00, 0x80, 0x96, 0x06, 0x00, 0x00, 0x69, 0x00, 0x29, 0x00, 0x69, 0x40, 0x2e,
+	0x90, 0x96, 0x82, 0x1b, 0xe4, 0xc2, 0xd7, 0x07, 0xb8, 0x81, 0xff, 0x02, 0x7c, 0x40, 0xbf, 0x01,
+	0x3c, 0x00, 0x7e, 0x00, 0x3c, 0x00, 0x7d, 0x00, 0x7c, 0x00, 0xf9, 0x06, 0xb8, 0x41, 0xe3, 0x1b,
+	0xe4, 0xff, 0x5f, 0x2e, 0x90, 0xff, 0x06, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+	0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+	0x3c, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x02, 0x00, 0x00, 0xe4, 0x02, 0x00,
+	0x00, 0xb9, 0x01, 0x00, 0x40, 0x6e, 0x00, 0x00, 0x80, 0x1b, 0x00, 0x00, 0xc0, 0x07, 0x00, 0x00,
+	0xd0, 0x03, 0x00, 0x00, 0xe4, 0x02, 0x00, 0x00, 0xb8, 0x01, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00,
+	0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+	0x7c, 0x00, 0x00, 0x00, 0xb8, 0x01, 0x00, 0x00, 0xe4, 0x02, 0x00, 0x00, 0xd0, 0x03, 0x00, 0x00,
+	0xc0, 0x07, 0x00, 0x00, 0x80, 0x1b, 0x00, 0x00, 0x40, 0x6e, 0x00, 0x00, 0x00, 0xb9, 0x01, 0x00,
+	0x00, 0xe4, 0x02, 0x00, 0x00, 0x90, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0xb8, 0x01, 0x00, 0x00,
+	0xe4, 0x06, 0x00, 0x00, 0x90, 0x1b, 0x00, 0x00, 0x40, 0x2e, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00,
+	0x00, 0x7c, 0x00, 0x00, 0x00, 0xb8, 0x01, 0x00, 0x00, 0xe4, 0x02, 0x00, 0x00, 0xd0, 0x03, 0x00,
+	0x00, 0xc0, 0x03, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x00, 0xc0, 0x03, 0x00,
+	0x00, 0xd0, 0x03, 0x00, 0x00, 0xe4, 0x02, 0x00, 0x00, 0xb8, 0x01, 0x00, 0x00, 0x7c, 0x00, 0x00,
+	0x00, 0x3d, 0x00, 0x00, 0x40, 0x2e, 0x00, 0x00, 0x90, 0x1b, 0x00, 0x00, 0xe4, 0x06, 0x00, 0x00,
+	0xb8, 0x01, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00,
+	0x28, 0x3c, 0x28, 0x00, 0x68, 0x7d, 0x29, 0x00, 0x90, 0xff, 0x06, 0x00, 0x90, 0xff, 0x06, 0x00,
+	0x68, 0x7d, 0x29, 0x00, 0x28, 0x3c, 0x28, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x02, 0x00, 0x00, 0xc0, 0x03, 0x00,
+	0x00, 0xc0, 0x03, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x00, 0xd0, 0x07, 0x00, 0x00, 0xe4, 0x1b, 0x00,
+	0xf8, 0xff, 0xff, 0x2f, 0xf8, 0xff, 0xff, 0x2f, 0x00, 0xe4, 0x1b, 0x00, 0x00, 0xd0, 0x07, 0x00,
+	0x00, 0xc0, 0x03, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x00, 0x80, 0x02, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+	0x3c, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0x02, 0x00, 0xf8, 0xff, 0x02, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+	0x3c, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x3c, 0x00,
+	0x00, 0x00, 0x3d, 0x00, 0x00, 0x40, 0x2e, 0x00, 0x00, 0x80, 0x1b, 0x00, 0x00, 0xc0, 0x07, 0x00,
+	0x00, 0xd0, 0x03, 0x00, 0x00, 0xe4, 0x02, 0x00, 0x00, 0xb8, 0x01, 0x00, 0x00, 0x7c, 0x00, 0x00,
+	0x00, 0x3d, 0x00, 0x00, 0x40, 0x2e, 0x00, 0x00, 0x80, 0x1b, 0x00, 0x00, 0xc0, 0x07, 0x00, 0x00,
+	0xd0, 0x03, 0x00, 0x00, 0xe4, 0x02, 0x00, 0x00, 0xb8, 0x01, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00,
+	0x3c, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0x1b, 0x00, 0x00, 0xf9, 0x6f, 0x00,
+	0x40, 0x6e, 0xb9, 0x01, 0x90, 0x1b, 0xe4, 0x06, 0xe0, 0x06, 0x90, 0x0b, 0xf0, 0x01, 0x40, 0x0f,
+	0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x90, 0x06, 0x0f, 0xf0, 0xe0, 0x0b, 0x0f,
+	0xf0, 0xe0, 0x0b, 0x0f, 0xf0, 0x90, 0x06, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f,
+	0xf0, 0x01, 0x40, 0x0f, 0xe0, 0x06, 0x90, 0x0b, 0x90, 0x1b, 0xe4, 0x06, 0x40, 0x6e, 0xb9, 0x01,
+	0x00, 0xf9, 0x6f, 0x00, 0x00, 0xe4, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x6e, 0x00, 0x00, 0x90, 0xbf, 0x00, 0x00,
+	0xe0, 0xf5, 0x00, 0x00, 0xa0, 0xf0, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00,
+	0x00, 0xf0, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00,
+	0x00, 0xf0, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00,
+	0x00, 0xf0, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0xf4, 0x01, 0x00, 0x00, 0xf9, 0x06, 0x00,
+	0xe0, 0xff, 0xbf, 0x00, 0xe0, 0xff, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xff, 0x1b, 0x00, 0xe0, 0xff, 0x6f, 0x00,
+	0x00, 0x00, 0xb9, 0x00, 0x00, 0x00, 0xf4, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0xf0, 0x00,
+	0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0xf4, 0x00, 0x00, 0x00, 0xb9, 0x00,
+	0x00, 0x40, 0x6e, 0x00, 0x00, 0x90, 0x1b, 0x00, 0x00, 0xe4, 0x06, 0x00, 0x00, 0xb9, 0x01, 0x00,
+	0x40, 0x6e, 0x00, 0x00, 0x90, 0x1b, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00, 0xf0, 0x01, 0x00, 0x00,
+	0xe0, 0xff, 0xbf, 0x00, 0x90, 0xff, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xff, 0x1b, 0x00, 0xe0, 0xff, 0x6f, 0x00,
+	0x00, 0x00, 0xb9, 0x00, 0x00, 0x00, 0xf4, 0x00, 0x00, 0x00, 0xf4, 0x00, 0x00, 0x00, 0xb9, 0x00,
+	0x00, 0x40, 0x6e, 0x00, 0x00, 0x90, 0x1b, 0x00, 0x00, 0xfe, 0x01, 0x00, 0x00, 0xfe, 0x01, 0x00,
+	0x00, 0x90, 0x1b, 0x00, 0x00, 0x40, 0x6e, 0x00, 0x00, 0x00, 0xb9, 0x00, 0x00, 0x00, 0xf4, 0x00,
+	0x00, 0x00, 0xf4, 0x00, 0x00, 0x00, 0xb9, 0x00, 0x00, 0x40, 0x6e, 0x00, 0x00, 0x90, 0x1b, 0x00,
+	0xe0, 0xff, 0x06, 0x00, 0xe0, 0xbf, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0xbe, 0x00,
+	0x00, 0x40, 0xfe, 0x00, 0x00, 0xd0, 0xf8, 0x00, 0x00, 0xe0, 0xf4, 0x00, 0x00, 0xf0, 0xf0, 0x00,
+	0x00, 0xf4, 0xf0, 0x00, 0x00, 0xb9, 0xf0, 0x00, 0x00, 0x6e, 0xf0, 0x00, 0x00, 0x1f, 0xf0, 0x00,
+	0x40, 0x0f, 0xf0, 0x00, 0x90, 0x0b, 0xf0, 0x00, 0xe0, 0x01, 0xf4, 0x01, 0xf0, 0x01, 0xf9, 0x06,
+	0xe0, 0xff, 0xff, 0x0b, 0x90, 0xff, 0xff, 0x0b, 0x00, 0x00, 0xf9, 0x06, 0x00, 0x00, 0xf4, 0x01,
+	0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0xff, 0x0b, 0x00, 0xfe, 0xff, 0x0b,
+	0x00, 0x6f, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00,
+	0x00, 0x1f, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x00, 0x00, 0xfe, 0xbf, 0x01, 0x00, 0xf9, 0xff, 0x06,
+	0x00, 0x00, 0x90, 0x0b, 0x00, 0x00, 0x40, 0x0f, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x0f,
+	0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x40, 0x0f, 0x00, 0x00, 0x90, 0x0b,
+	0x00, 0xfe, 0xff, 0x06, 0x00, 0xfe, 0xbf, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0xbf, 0x00, 0x00, 0xf9, 0xbf, 0x00,
+	0x40, 0x6e, 0x00, 0x00, 0x90, 0x1b, 0x00, 0x00, 0xe0, 0x06, 0x00, 0x00, 0xf0, 0x01, 0x00, 0x00,
+	0xf0, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0xf0, 0xe0, 0xbf, 0x01, 0xf0, 0xf5, 0xff, 0x06,
+	0xf0, 0x6f, 0x90, 0x0b, 0xf0, 0x1b, 0x40, 0x0f, 0xf0, 0x06, 0x00, 0x0f, 0xf0, 0x01, 0x00, 0x0f,
+	0xf0, 0x01, 0x00, 0x0f, 0xe0, 0x06, 0x00, 0x0f, 0x90, 0x1b, 0x40, 0x0f, 0x40, 0x6e, 0x90, 0x0b,
+	0x00, 0xf9, 0xff, 0x06, 0x00, 0xe4, 0xbf, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xff, 0xff, 0x06, 0xe0, 0xff, 0xff, 0x0b,
+	0x00, 0x00, 0x40, 0x0f, 0x00, 0x00, 0x40, 0x0b, 0x00, 0x00, 0xe0, 0x06, 0x00, 0x00, 0xf0, 0x01,
+	0x00, 0x00, 0xf4, 0x00, 0x00, 0x00, 0xb9, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x1f, 0x00,
+	0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x40, 0x0f, 0x00, 0x00, 0x90, 0x0b, 0x00,
+	0x00, 0xe0, 0x06, 0x00, 0x00, 0xf0, 0x01, 0x00, 0x00, 0xf4, 0x00, 0x00, 0x00, 0xb9, 0x00, 0x00,
+	0x00, 0x6e, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xfe, 0xbf, 0x01, 0x90, 0xff, 0xff, 0x06,
+	0xe0, 0x06, 0x90, 0x0b, 0xf0, 0x01, 0x40, 0x0f, 0xf0, 0x01, 0x40, 0x0f, 0xe0, 0x06, 0x90, 0x0b,
+	0x90, 0x1b, 0xe4, 0x06, 0x40, 0x6e, 0xb9, 0x01, 0x00, 0xf4, 0x1f, 0x00, 0x00, 0xf4, 0x1f, 0x00,
+	0x40, 0x6e, 0xb9, 0x01, 0x90, 0x1b, 0xe4, 0x06, 0xe0, 0x06, 0x90, 0x0b, 0xf0, 0x01, 0x40, 0x0f,
+	0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x0f, 0xf0, 0x01, 0x40, 0x0f, 0xe0, 0x06, 0x90, 0x0b,
+	0x90, 0xff, 0xff, 0x06, 0x40, 0xfe, 0xbf, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xfe, 0x1b, 0x00, 0x90, 0xff, 0x6f, 0x00,
+	0xe0, 0x06, 0xb9, 0x01, 0xf0, 0x01, 0xe4, 0x06, 0xf0, 0x00, 0x90, 0x0b, 0xf0, 0x00, 0x40, 0x0f,
+	0xf0, 0x00, 0x40, 0x0f, 0xf0, 0x00, 0x90, 0x0f, 0xf0, 0x01, 0xe4, 0x0f, 0xe0, 0x06, 0xf9, 0x0f,
+	0x90, 0xff, 0x5f, 0x0f, 0x40, 0xfe, 0x0b, 0x0f, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x0f,
+	0x00, 0x00, 0x40, 0x0f, 0x00, 0x00, 0x90, 0x0b, 0x00, 0x00, 0xe4, 0x06, 0x00, 0x00, 0xb9, 0x01,
+	0x00, 0xfe, 0x6f, 0x00, 0x00, 0xfe, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x28, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+	0x3c, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x28, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+	0x3c, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x40, 0x2e, 0x00,
+	0x00, 0x90, 0x1b, 0x00, 0x00, 0xe4, 0x06, 0x00, 0x90, 0xbf, 0x01, 0x00, 0xe4, 0x6f, 0x00, 0x00,
+	0x78, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xe4, 0x6f, 0x00, 0x00, 0x90, 0xbf, 0x01, 0x00,
+	0x00, 0xe4, 0x06, 0x00, 0x00, 0x90, 0x1b, 0x00, 0x00, 0x40, 0x2e, 0x00, 0x00, 0x00, 0x29, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xf8, 0xff, 0xff, 0x02, 0xf8, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xff, 0x02, 0xf8, 0xff, 0xff, 0x02,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0xb8, 0x01, 0x00, 0x00,
+	0xe4, 0x06, 0x00, 0x00, 0x90, 0x1b, 0x00, 0x00, 0x40, 0xfe, 0x06, 0x00, 0x00, 0xf9, 0x1b, 0x00,
+	0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0xf9, 0x1b, 0x00, 0x40, 0xfe, 0x06, 0x00,
+	0x90, 0x1b, 0x00, 0x00, 0xe4, 0x06, 0x00, 0x00, 0xb8, 0x01, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xff, 0x06, 0x00, 0xe4, 0xff, 0x1b, 0x00,
+	0xb8, 0x41, 0x2e, 0x00, 0x68, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00,
+	0x00, 0x00, 0x3d, 0x00, 0x00, 0x40, 0x2e, 0x00, 0x00, 0xf9, 0x1b, 0x00, 0x40, 0xfe, 0x06, 0x00,
+	0x80, 0x1b, 0x00, 0x00, 0xc0, 0x07, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x00, 0x80, 0x02, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x02, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x00,
+	0xc0, 0x03, 0x00, 0x00, 0x80, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xfe, 0x1b, 0x00, 0x90, 0xff, 0x6f, 0x00,
+	0xe4, 0x06, 0xb9, 0x01, 0xb9, 0x01, 0xe4, 0x06, 0x6e, 0x00, 0x90, 0x0b, 0x1f, 0x00, 0x40, 0x0f,
+	0x0f, 0xe4, 0x06, 0x0f, 0x0f, 0xf9, 0x0b, 0x0f, 0x0f, 0x5e, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+	0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x5e, 0x5f, 0x0b,
+	0x0f, 0xf9, 0xff, 0x06, 0x0f, 0xe4, 0xbf, 0x01, 0x1f, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00,
+	0xb9, 0x01, 0x00, 0x00, 0xe4, 0x06, 0x00, 0x00, 0x90, 0xff, 0xbf, 0x00, 0x40, 0xfe, 0xbf, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x01, 0x00, 0x00, 0xf9, 0x06, 0x00,
+	0x00, 0x5e, 0x0b, 0x00, 0x00, 0x0f, 0x0f, 0x00, 0x00, 0x0f, 0x0f, 0x00, 0x00, 0x0f, 0x0f, 0x00,
+	0x00, 0x0f, 0x0f, 0x00, 0x00, 0x0f, 0x0f, 0x00, 0x40, 0x0f, 0x1f, 0x00, 0x90, 0x0b, 0x6e, 0x00,
+	0xe0, 0x01, 0xb4, 0x00, 0xf0, 0x01, 0xf4, 0x00, 0xf0, 0xff, 0xff, 0x00, 0xf0, 0xff, 0xff, 0x00,
+	0xf4, 0x06, 0xf9, 0x01, 0xb9, 0x01, 0xe4, 0x06, 0x6e, 0x00, 0x90, 0x0b, 0x1f, 0x00, 0x40, 0x0f,
+	0x0f, 0x00, 0x00, 0x0f, 0x0a, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0xff, 0x6f, 0x00, 0xf8, 0xff, 0xbf, 0x01,
+	0xbc, 0x01, 0xe4, 0x02, 0x7c, 0x00, 0xd0, 0x03, 0x3c, 0x00, 0xc0, 0x03, 0x3c, 0x00, 0xc0, 0x03,
+	0x7c, 0x00, 0xd0, 0x03, 0xbc, 0x01, 0xe4, 0x02, 0xfc, 0xff, 0x7f, 0x00, 0xfc, 0xff, 0x7f, 0x00,
+	0xbc, 0x01, 0xe4, 0x02, 0x7c, 0x00, 0xd0, 0x03, 0x3c, 0x00, 0xc0, 0x03, 0x3c, 0x00, 0xc0, 0x03,
+	0x3c, 0x00, 0xc0, 0x03, 0x3c, 0x00, 0xc0, 0x03, 0x7c, 0x00, 0xd0, 0x03, 0xbc, 0x01, 0xe4, 0x02,
+	0xf8, 0xff, 0xbf, 0x01, 0xe4, 0xff, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x6f, 0x00, 0x40, 0xfe, 0xbf, 0x01,
+	0x90, 0x1b, 0xe4, 0x02, 0xe4, 0x06, 0x90, 0x02, 0xb8, 0x01, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00,
+	0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+	0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+	0x7c, 0x00, 0x00, 0x00, 0xb8, 0x01, 0x00, 0x00, 0xe4, 0x06, 0x90, 0x02, 0x90, 0x1b, 0xe4, 0x02,
+	0x40, 0xfe, 0xbf, 0x01, 0x00, 0xf9, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0xff, 0x06, 0x00, 0xf8, 0xff, 0x1b, 0x00,
+	0xbc, 0x41, 0x6e, 0x00, 0x7c, 0x00, 0xb9, 0x01, 0x3c, 0x00, 0xe4, 0x02, 0x3c, 0x00, 0xd0, 0x03,
+	0x3c, 0x00, 0xc0, 0x03, 0x3c, 0x00, 0xc0, 0x03, 0x3c, 0x00, 0xc0, 0x03, 0x3c, 0x00, 0xc0, 0x03,
+	0x3c, 0x00, 0xc0, 0x03, 0x3c, 0x00, 0xc0, 0x03, 0x3c, 0x00, 0xc0, 0x03, 0x3c, 0x00, 0xc0, 0x03,
+	0x3c, 0x00, 0xd0, 0x03, 0x3c, 0x00, 0xe4, 0x02, 0x7c, 0x00, 0xb9, 0x01, 0xbc, 0x41, 0x6e, 0x00,
+	0xf8, 0xff, 0x1b, 0x00, 0xe4, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0xff, 0xff, 0x02, 0xf8, 0xff, 0xff, 0x02,
+	0xbc, 0x01, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+	0x7c, 0x00, 0x00, 0x00, 0xbc, 0x01, 0x00, 0x00, 0xfc, 0xff, 0xff, 0x02, 0xfc, 0xff, 0xff, 0x02,
+	0xbc, 0x01, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+	0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0xbc, 0x01, 0x00, 0x00,
+	0xf8, 0xff, 0xff, 0x02, 0xe4, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0xff, 0xff, 0x02, 0xf8, 0xff, 0xff, 0x02,
+	0xbc, 0x01, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+	0x7c, 0x00, 0x00, 0x00, 0xbc, 0x01, 0x00, 0x00, 0xfc, 0xff, 0xff, 0x02, 0xfc, 0xff, 0xff, 0x02,
+	0xbc, 0x01, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+	0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+	0x3c, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x6f, 0x00, 0x40, 0xfe, 0xbf, 0x01,
+	0x90, 0x1b, 0xe4, 0x02, 0xe4, 0x06, 0x90, 0x02, 0xb8, 0x01, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00,
+	0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+	0x3c, 0x80, 0xbf, 0x01, 0x3c, 0x80, 0xff, 0x02, 0x3c, 0x00, 0xe4, 0x03, 0x3c, 0x00, 0xd0, 0x03,
+	0x7c, 0x00, 0xc0, 0x03, 0xb8, 0x01, 0xc0, 0x03, 0xe4, 0x06, 0xd0, 0x03, 0x90, 0x1b, 0xe4, 0x02,
+	0x40, 0xfe, 0xbf, 0x01, 0x00, 0xf9, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x80, 0x02, 0x3c, 0x00, 0xc0, 0x03,
+	0x3c, 0x00, 0xc0, 0x03, 0x3c, 0x00, 0xc0, 0x03, 0x3c, 0x00, 0xc0, 0x03, 0x3c, 0x00, 0xc0, 0x03,
+	0x7c, 0x00, 0xd0, 0x03, 0xbc, 0x01, 0xe4, 0x03, 0xfc, 0xff, 0xff, 0x03, 0xfc, 0xff, 0xff, 0x03,
+	0xbc, 0x01, 0xe4, 0x03, 0x7c, 0x00, 0xd0, 0x03, 0x3c, 0x00, 0xc0, 0x03, 0x3c, 0x00, 0xc0, 0x03,
+	0x3c, 0x00, 0xc0, 0x03, 0x3c, 0x00, 0xc0, 0x03, 0x3c, 0x00, 0xc0, 0x03, 0x3c, 0x00, 0xc0, 0x03,
+	0x3c, 0x00, 0xc0, 0x03, 0x28, 0x00, 0x80, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0x2f, 0x00, 0xf8, 0xff, 0x2f, 0x00,
+	0x40, 0xbe, 0x01, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00,
+	0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00,
+	0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00,
+	0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x40, 0xbe, 0x01, 0x00,
+	0xf8, 0xff, 0x2f, 0x00, 0xf8, 0xff, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x3c, 0x00,
+	0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00,
+	0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00,
+	0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00,
+	0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x40, 0x2e, 0x00,
+	0xf8, 0xff, 0x1b, 0x00, 0xf8, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x29, 0x3c, 0x00, 0x40, 0x2e,
+	0x3c, 0x00, 0x90, 0x1b, 0x3c, 0x00, 0xe4, 0x06, 0x3c, 0x00, 0xb9, 0x01, 0x3c, 0x40, 0x6e, 0x00,
+	0x3c, 0x90, 0x1b, 0x00, 0x3c, 0xe4, 0x06, 0x00, 0x3c, 0xb8, 0x01, 0x00, 0x7c, 0x7d, 0x00, 0x00,
+	0xfc, 0x6f, 0x00, 0x00, 0xfc, 0xcb, 0x01, 0x00, 0xbc, 0xf5, 0x06, 0x00, 0x7c, 0x90, 0x1b, 0x00,
+	0x3c, 0x40, 0x6e, 0x00, 0x3c, 0x00, 0xb9, 0x01, 0x3c, 0x00, 0xe4, 0x06, 0x3c, 0x00, 0x90, 0x1b,
+	0x3c, 0x00, 0x40, 0x2e, 0x28, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+	0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+	0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+	0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+	0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0xbc, 0x01, 0x00, 0x00,
+	0xf8, 0xff, 0xff, 0x02, 0xe4, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x90, 0x02, 0xbc, 0x00, 0xe0, 0x03,
+	0xfc, 0x01, 0xf4, 0x03, 0xfc, 0x02, 0xf8, 0x03, 0xfc, 0x06, 0xf9, 0x03, 0xbc, 0x5c, 0xe3, 0x03,
+	0x7c, 0xa0, 0xd0, 0x03, 0x3c, 0xf8, 0xc2, 0x03, 0x3c, 0xf8, 0xc2, 0x03, 0x3c, 0xa4, 0xc1, 0x03,
+	0x3c, 0x00, 0xc0, 0x03, 0x3c, 0x00, 0xc0, 0x03, 0x3c, 0x00, 0xc0, 0x03, 0x3c, 0x00, 0xc0, 0x03,
+	0x3c, 0x00, 0xc0, 0x03, 0x3c, 0x00, 0xc0, 0x03, 0x3c, 0x00, 0xc0, 0x03, 0x3c, 0x00, 0xc0, 0x03,
+	0x3c, 0x00, 0xc0, 0x03, 0x28, 0x00, 0x80, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x80, 0x02, 0xbc, 0x00, 0xc0, 0x03,
+	0xfc, 0x01, 0xc0, 0x03, 0xfc, 0x02, 0xc0, 0x03, 0xfc, 0x06, 0xc0, 0x03, 0xbc, 0x1c, 0xc0, 0x03,
+	0x7c, 0x2c, 0xc0, 0x03, 0x3c, 0x3c, 0xc0, 0x03, 0x3c, 0x7c, 0xc0, 0x03, 0x3c, 0xb8, 0xc1, 0x03,
+	0x3c, 0xe4, 0xc2, 0x03, 0x3c, 0xd0, 0xc3, 0x03, 0x3c, 0xc0, 0xc3, 0x03, 0x3c, 0x80, 0xd3, 0x03,
+	0x3c, 0x40, 0xe3, 0x03, 0x3c, 0x00, 0xf9, 0x03, 0x3c, 0x00, 0xf8, 0x03, 0x3c, 0x00, 0xf4, 0x03,
+	0x3c, 0x00, 0xe0, 0x03, 0x28, 0x00, 0x90, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x06, 0x00, 0x40, 0xfe, 0x1b, 0x00,
+	0x90, 0x5b, 0x6e, 0x00, 0xe4, 0x06, 0xb9, 0x01, 0xb8, 0x01, 0xe4, 0x02, 0x7c, 0x00, 0xd0, 0x03,
+	0x3c, 0x00, 0xc0, 0x03, 0x3c, 0x00, 0xc0, 0x03, 0x3c, 0x00, 0xc0, 0x03, 0x3c, 0x00, 0xc0, 0x03,
+	0x3c, 0x00, 0xc0, 0x03, 0x3c, 0x00, 0xc0, 0x03, 0x3c, 0x00, 0xc0, 0x03, 0x3c, 0x00, 0xc0, 0x03,
+	0x7c, 0x00, 0xd0, 0x03, 0xb8, 0x01, 0xe4, 0x02, 0xe4, 0x06, 0xb9, 0x01, 0x90, 0x5b, 0x6e, 0x00,
+	0x40, 0xfe, 0x1b, 0x00, 0x00, 0xf9, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0xff, 0x6f, 0x00, 0xf8, 0xff, 0xbf, 0x01,
+	0xbc, 0x01, 0xe4, 0x02, 0x7c, 0x00, 0xd0, 0x03, 0x7c, 0x00, 0xd0, 0x03, 0xbc, 0x01, 0xe4, 0x02,
+	0xfc, 0xff, 0xbf, 0x01, 0xfc, 0xff, 0x6f, 0x00, 0xbc, 0x01, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00,
+	0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+	0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+	0x3c, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x06, 0x00, 0x40, 0xfe, 0x1b, 0x00,
+	0x90, 0x5b, 0x6e, 0x00, 0xe4, 0x06, 0xb9, 0x01, 0xb8, 0x01, 0xe4, 0x02, 0x7c, 0x00, 0xd0, 0x03,
+	0x3c, 0x00, 0xc0, 0x03, 0x3c, 0x00, 0xc0, 0x03, 0x3c, 0x00, 0xc0, 0x03, 0x3c, 0x00, 0xc0, 0x03,
+	0x3c, 0x00, 0xc0, 0x03, 0x3c, 0x00, 0xc0, 0x03, 0x3c, 0x00, 0xc0, 0x03, 0x3c, 0x00, 0xc0, 0x03,
+	0x7c, 0x00, 0xd0, 0x03, 0xb8, 0x01, 0xe4, 0x02, 0xe4, 0x06, 0xb9, 0x01, 0x90, 0x5b, 0x6f, 0x00,
+	0x40, 0xbe, 0x1c, 0x00, 0x00, 0xf9, 0x06, 0x00, 0x00, 0xe4, 0x07, 0x00, 0x00, 0x90, 0x1b, 0x00,
+	0x00, 0x40, 0xfe, 0x02, 0x00, 0x00, 0xf9, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0xff, 0x6f, 0x00, 0xf8, 0xff, 0xbf, 0x01,
+	0xbc, 0x01, 0xe4, 0x02, 0x7c, 0x00, 0xd0, 0x03, 0x3c, 0x00, 0xc0, 0x03, 0x3c, 0x00, 0xc0, 0x03,
+	0x7c, 0x00, 0xd0, 0x03, 0xbc, 0x01, 0xe4, 0x02, 0xfc, 0xff, 0xbf, 0x01, 0xfc, 0xff, 0x6f, 0x00,
+	0xbc, 0xe5, 0x07, 0x00, 0x7c, 0x90, 0x07, 0x00, 0x3c, 0x40, 0x2e, 0x00, 0x3c, 0x00, 0x3d, 0x00,
+	0x3c, 0x00, 0x7c, 0x00, 0x3c, 0x00, 0xb8, 0x01, 0x3c, 0x00, 0xe4, 0x06, 0x3c, 0x00, 0x90, 0x1b,
+	0x3c, 0x00, 0x40, 0x2e, 0x28, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xff, 0x6f, 0x00, 0xe4, 0xff, 0xbf, 0x01,
+	0xb8, 0x01, 0xe4, 0x02, 0x7c, 0x00, 0x90, 0x02, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+	0x7c, 0x00, 0x00, 0x00, 0xb8, 0x01, 0x00, 0x00, 0xe4, 0x6f, 0x00, 0x00, 0x90, 0xbf, 0x01, 0x00,
+	0x00, 0xe4, 0x6f, 0x00, 0x00, 0x90, 0xbf, 0x01, 0x00, 0x00, 0xe4, 0x02, 0x00, 0x00, 0xd0, 0x03,
+	0x00, 0x00, 0xc0, 0x03, 0x00, 0x00, 0xc0, 0x03, 0x68, 0x00, 0xd0, 0x03, 0xb8, 0x01, 0xe4, 0x02,
+	0xe4, 0xff, 0xbf, 0x01, 0x90, 0xff, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xff, 0x0b, 0xfe, 0xff, 0xff, 0x0b,
+	0x00, 0xf9, 0x06, 0x00, 0x00, 0xf4, 0x01, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00,
+	0x00, 0xf0, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00,
+	0x00, 0xf0, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00,
+	0x00, 0xf0, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00,
+	0x00, 0xf0, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x80, 0x02, 0x3c, 0x00, 0xc0, 0x03,
+	0x3c, 0x00, 0xc0, 0x03, 0x3c, 0x00, 0xc0, 0x03, 0x3c, 0x00, 0xc0, 0x03, 0x3c, 0x00, 0xc0, 0x03,
+	0x3c, 0x00, 0xc0, 0x03, 0x3c, 0x00, 0xc0, 0x03, 0x3c, 0x00, 0xc0, 0x03, 0x3c, 0x00, 0xc0, 0x03,
+	0x3c, 0x00, 0xc0, 0x03, 0x3c, 0x00, 0xc0, 0x03, 0x3c, 0x00, 0xc0, 0x03, 0x3c, 0x00, 0xc0, 0x03,
+	0x3c, 0x00, 0xc0, 0x03, 0x3c, 0x00, 0xc0, 0x03, 0x7c, 0x00, 0xd0, 0x03, 0xb8, 0x01, 0xe4, 0x02,
+	0xe4, 0xff, 0xbf, 0x01, 0x90, 0xff, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x0a, 0x0f, 0x00, 0x00, 0x0f,
+	0x1f, 0x00, 0x40, 0x0f, 0x6e, 0x00, 0x90, 0x0b, 0xb9, 0x00, 0xe0, 0x06, 0xf4, 0x00, 0xf0, 0x01,
+	0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x01, 0xf4, 0x00, 0xe0, 0x06, 0xb9, 0x00,
+	0x90, 0x0b, 0x6e, 0x00, 0x40, 0x0f, 0x1f, 0x00, 0x00, 0x0f, 0x0f, 0x00, 0x00, 0x0f, 0x0f, 0x00,
+	0x00, 0x0f, 0x0f, 0x00, 0x00, 0x0f, 0x0f, 0x00, 0x00, 0x0f, 0x0f, 0x00, 0x00, 0x5e, 0x0b, 0x00,
+	0x00, 0xf9, 0x06, 0x00, 0x00, 0xa4, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x0a, 0x0f, 0x00, 0x00, 0x0f,
+	0x0f, 0x00, 0x00, 0x0f, 0x0f, 0x00, 0x00, 0x0f, 0x0f, 0x00, 0x00, 0x0f, 0x0f, 0x00, 0x00, 0x0f,
+	0x0f, 0xa0, 0x00, 0x0f, 0x0f, 0xf0, 0x00, 0x0f, 0x0f, 0xf4, 0x01, 0x0f, 0x0f, 0xf9, 0x06, 0x0f,
+	0x0f, 0x5e, 0x0b, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+	0x0f, 0x0f, 0x0f, 0x0f, 0x5e, 0x0b, 0x5e, 0x0b, 0xf9, 0x06, 0xf9, 0x06, 0xf4, 0x01, 0xf4, 0x01,
+	0xf0, 0x00, 0xf0, 0x00, 0xa0, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x40, 0x0a, 0x6e, 0x00, 0x90, 0x0b,
+	0xb9, 0x00, 0xe0, 0x06, 0xf4, 0x00, 0xf0, 0x01, 0xf0, 0x01, 0xf4, 0x00, 0xe0, 0x06, 0xb9, 0x00,
+	0x90, 0x0b, 0x6e, 0x00, 0x40, 0x5e, 0x1b, 0x00, 0x00, 0xf9, 0x06, 0x00, 0x00, 0xf4, 0x01, 0x00,
+	0x00, 0xf4, 0x01, 0x00, 0x00, 0xf9, 0x06, 0x00, 0x40, 0x5e, 0x1b, 0x00, 0x90, 0x0b, 0x6e, 0x00,
+	0xe0, 0x06, 0xb9, 0x00, 0xf0, 0x01, 0xf4, 0x00, 0xf4, 0x00, 0xf0, 0x01, 0xb9, 0x00, 0xe0, 0x06,
+	0x6e, 0x00, 0x90, 0x0b, 0x1a, 0x00, 0x40, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x40, 0x0a, 0x6e, 0x00, 0x90, 0x0b,
+	0xb9, 0x00, 0xe0, 0x06, 0xf4, 0x00, 0xf0, 0x01, 0xf0, 0x01, 0xf4, 0x00, 0xe0, 0x06, 0xb9, 0x00,
+	0x90, 0x0b, 0x6e, 0x00, 0x40, 0x5e, 0x1b, 0x00, 0x00, 0xf9, 0x06, 0x00, 0x00, 0xf4, 0x01, 0x00,
+	0x00, 0xf0, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00,
+	0x00, 0xf0, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00,
+	0x00, 0xf0, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xbf, 0x01, 0xf8, 0xff, 0xff, 0x02,
+	0x00, 0x00, 0xd0, 0x03, 0x00, 0x00, 0xd0, 0x02, 0x00, 0x00, 0xb9, 0x01, 0x00, 0x40, 0x6e, 0x00,
+	0x00, 0x80, 0x1b, 0x00, 0x00, 0xc0, 0x07, 0x00, 0x00, 0xd0, 0x03, 0x00, 0x00, 0xe4, 0x02, 0x00,
+	0x00, 0xb8, 0x01, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x40, 0x2e, 0x00, 0x00,
+	0x90, 0x1b, 0x00, 0x00, 0xe4, 0x06, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00,
+	0xf8, 0xff, 0xff, 0x02, 0xe4, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0x2f, 0x00, 0x00, 0xf8, 0x2f, 0x00, 0x00,
+	0xbc, 0x01, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+	0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+	0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+	0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+	0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0xbc, 0x01, 0x00, 0x00,
+	0xf8, 0x2f, 0x00, 0x00, 0xe4, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+	0x7c, 0x00, 0x00, 0x00, 0xb8, 0x01, 0x00, 0x00, 0xe4, 0x02, 0x00, 0x00, 0xd0, 0x03, 0x00, 0x00,
+	0xc0, 0x07, 0x00, 0x00, 0x80, 0x1b, 0x00, 0x00, 0x40, 0x2e, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00,
+	0x00, 0x7c, 0x00, 0x00, 0x00, 0xb8, 0x01, 0x00, 0x00, 0xe4, 0x02, 0x00, 0x00, 0xd0, 0x03, 0x00,
+	0x00, 0xc0, 0x07, 0x00, 0x00, 0x80, 0x1b, 0x00, 0x00, 0x40, 0x2e, 0x00, 0x00, 0x00, 0x3d, 0x00,
+	0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x1b, 0x00, 0x00, 0xf8, 0x2f, 0x00, 0x00,
+	0x40, 0x3e, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00,
+	0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00,
+	0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00,
+	0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00,
+	0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x40, 0x3e, 0x00, 0x00,
+	0xf8, 0x2f, 0x00, 0x00, 0xf8, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x06, 0x00, 0x00, 0xe4, 0x1b, 0x00,
+	0x00, 0x79, 0x6d, 0x00, 0x40, 0x2e, 0xb8, 0x01, 0x80, 0x1b, 0xe4, 0x02, 0xc0, 0x07, 0xd0, 0x03,
+	0xd0, 0x03, 0xc0, 0x07, 0xe4, 0x02, 0x80, 0x1b, 0xb8, 0x01, 0x40, 0x2e, 0x68, 0x00, 0x00, 0x29,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xff, 0xbf, 0xfe, 0xff, 0xff, 0xbf,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0xb8, 0x01, 0x00, 0x00,
+	0xe4, 0x02, 0x00, 0x00, 0x90, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x90, 0xff, 0x6f, 0x00, 0xe4, 0xff, 0xbf, 0x01, 0xb8, 0x01, 0xe4, 0x02, 0x68, 0x00, 0xd0, 0x03,
+	0x00, 0x00, 0xd0, 0x03, 0x00, 0x00, 0xe4, 0x03, 0x90, 0xff, 0xff, 0x03, 0xe4, 0xff, 0xff, 0x03,
+	0xb8, 0x01, 0xd0, 0x03, 0x7c, 0x00, 0xd0, 0x03, 0x7c, 0x00, 0xf9, 0x03, 0xb8, 0x41, 0xfe, 0x03,
+	0xe4, 0xff, 0xd7, 0x03, 0x90, 0xff, 0x82, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+	0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+	0x3c, 0xf8, 0x06, 0x00, 0x7c, 0xfd, 0x1b, 0x00, 0xfc, 0x5b, 0x6e, 0x00, 0xfc, 0x06, 0xb9, 0x01,
+	0xbc, 0x01, 0xe4, 0x02, 0x7c, 0x00, 0xd0, 0x03, 0x3c, 0x00, 0xc0, 0x03, 0x3c, 0x00, 0xc0, 0x03,
+	0x7c, 0x00, 0xd0, 0x03, 0xbc, 0x01, 0xe4, 0x02, 0xfc, 0x06, 0xb9, 0x01, 0xfc, 0x5b, 0x6e, 0x00,
+	0x7c, 0xfd, 0x1b, 0x00, 0x28, 0xf8, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xf9, 0xff, 0x02, 0x40, 0xfe, 0xff, 0x02, 0x90, 0x1b, 0x00, 0x00, 0xe4, 0x06, 0x00, 0x00,
+	0xb8, 0x01, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+	0x7c, 0x00, 0x00, 0x00, 0xb8, 0x01, 0x00, 0x00, 0xe4, 0x06, 0x00, 0x00, 0x90, 0x1b, 0x00, 0x00,
+	0x40, 0xfe, 0xff, 0x02, 0x00, 0xf9, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x02, 0x00, 0x00, 0xc0, 0x03,
+	0x00, 0x00, 0xc0, 0x03, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x00, 0xc0, 0x03,
+	0x00, 0xf9, 0xc2, 0x03, 0x40, 0xfe, 0xd7, 0x03, 0x90, 0x5b, 0xfe, 0x03, 0xe4, 0x06, 0xf9, 0x03,
+	0xb8, 0x01, 0xe4, 0x03, 0x7c, 0x00, 0xd0, 0x03, 0x3c, 0x00, 0xc0, 0x03, 0x3c, 0x00, 0xc0, 0x03,
+	0x7c, 0x00, 0xd0, 0x03, 0xb8, 0x01, 0xe4, 0x03, 0xe4, 0x06, 0xf9, 0x03, 0x90, 0x5b, 0xfe, 0x03,
+	0x40, 0xfe, 0xd7, 0x03, 0x00, 0xf9, 0x82, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xf9, 0x06, 0x00, 0x40, 0xfe, 0x1b, 0x00, 0x90, 0x5b, 0x6e, 0x00, 0xe4, 0x06, 0xb9, 0x01,
+	0x78, 0x00, 0xd0, 0x02, 0x7c, 0x00, 0xd0, 0x03, 0xfc, 0xff, 0xff, 0x02, 0xfc, 0xff, 0xbf, 0x01,
+	0x7c, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xe4, 0x06, 0x00, 0x00, 0x90, 0x1b, 0x00, 0x00,
+	0x40, 0xfe, 0xff, 0x02, 0x00, 0xf9, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xff, 0x02, 0x00, 0xe4, 0xff, 0x02,
+	0x00, 0xb8, 0x01, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x40, 0xbe, 0x01, 0x00,
+	0xf8, 0xff, 0xff, 0x02, 0xf8, 0xff, 0xff, 0x02, 0x40, 0xbe, 0x01, 0x00, 0x00, 0x7d, 0x00, 0x00,
+	0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00,
+	0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00,
+	0x00, 0x3c, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x90, 0xff, 0xff, 0x02, 0xe4, 0xff, 0xff, 0x02, 0xb8, 0x41, 0xbe, 0x01, 0x7c, 0x00, 0x7d, 0x00,
+	0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x7c, 0x00, 0x3d, 0x00, 0xb8, 0x41, 0x2e, 0x00,
+	0xd0, 0xff, 0x1b, 0x00, 0x90, 0xff, 0x06, 0x00, 0x68, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00,
+	0xfc, 0xff, 0x6f, 0x00, 0xfc, 0xff, 0xbf, 0x01, 0xbc, 0x01, 0xe4, 0x02, 0x7c, 0x00, 0xd0, 0x03,
+	0x7c, 0x00, 0xd0, 0x03, 0xb8, 0x01, 0xe4, 0x02, 0xe4, 0xff, 0xbf, 0x01, 0x90, 0xff, 0x6f, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+	0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+	0x3c, 0xf8, 0x6f, 0x00, 0x7c, 0xfd, 0xbf, 0x01, 0xfc, 0x1b, 0xe4, 0x02, 0xfc, 0x06, 0xd0, 0x03,
+	0xbc, 0x01, 0xc0, 0x03, 0x7c, 0x00, 0xc0, 0x03, 0x3c, 0x00, 0xc0, 0x03, 0x3c, 0x00, 0xc0, 0x03,
+	0x3c, 0x00, 0xc0, 0x03, 0x3c, 0x00, 0xc0, 0x03, 0x3c, 0x00, 0xc0, 0x03, 0x3c, 0x00, 0xc0, 0x03,
+	0x3c, 0x00, 0xc0, 0x03, 0x28, 0x00, 0x80, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xf8, 0x1b, 0x00, 0x00, 0xf8, 0x2f, 0x00, 0x00, 0x40, 0x3e, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00,
+	0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00,
+	0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00,
+	0x00, 0x3c, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x02, 0x00, 0x00, 0x80, 0x02, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x80, 0xbf, 0x01, 0x00, 0x80, 0xff, 0x02, 0x00, 0x00, 0xe4, 0x03, 0x00, 0x00, 0xd0, 0x03, 0x00,
+	0x00, 0xc0, 0x03, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x00, 0xc0, 0x03, 0x00,
+	0x00, 0xc0, 0x03, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x00, 0xc0, 0x03, 0x00,
+	0x00, 0xc0, 0x03, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x00, 0xc0, 0x03, 0x00,
+	0x00, 0xd0, 0x03, 0x00, 0x00, 0xe4, 0x02, 0x00, 0xf8, 0xbf, 0x01, 0x00, 0xf8, 0x6f, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+	0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+	0x3c, 0x00, 0x29, 0x00, 0x3c, 0x40, 0x2e, 0x00, 0x3c, 0x90, 0x1b, 0x00, 0x3c, 0xe4, 0x06, 0x00,
+	0x3c, 0xb8, 0x01, 0x00, 0x7c, 0x7d, 0x00, 0x00, 0xfc, 0x6f, 0x00, 0x00, 0xfc, 0xcb, 0x01, 0x00,
+	0xbc, 0xf5, 0x06, 0x00, 0x7c, 0x90, 0x1b, 0x00, 0x3c, 0x40, 0x6e, 0x00, 0x3c, 0x00, 0xb9, 0x01,
+	0x3c, 0x00, 0xe4, 0x02, 0x28, 0x00, 0x90, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x1b, 0x00, 0x00, 0xf8, 0x2f, 0x00, 0x00,
+	0x40, 0x3e, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00,
+	0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00,
+	0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00,
+	0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0xbc, 0x01, 0x00,
+	0x00, 0xf8, 0x2f, 0x00, 0x00, 0xe4, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xf9, 0x0b, 0xbe, 0x01, 0xfe, 0x5f, 0xff, 0x06, 0x6f, 0xf9, 0x96, 0x0b, 0x1f, 0xf4, 0x41, 0x0f,
+	0x0f, 0xf0, 0x00, 0x0f, 0x0f, 0xf0, 0x00, 0x0f, 0x0f, 0xf0, 0x00, 0x0f, 0x0f, 0xf0, 0x00, 0x0f,
+	0x0f, 0xf0, 0x00, 0x0f, 0x0f, 0xf0, 0x00, 0x0f, 0x0f, 0xf0, 0x00, 0x0f, 0x0f, 0xf0, 0x00, 0x0f,
+	0x0f, 0xf0, 0x00, 0x0f, 0x0a, 0xa0, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x28, 0xf8, 0x6f, 0x00, 0x7c, 0xfd, 0xbf, 0x01, 0xfc, 0x1b, 0xe4, 0x02, 0xfc, 0x06, 0xd0, 0x03,
+	0xbc, 0x01, 0xc0, 0x03, 0x7c, 0x00, 0xc0, 0x03, 0x3c, 0x00, 0xc0, 0x03, 0x3c, 0x00, 0xc0, 0x03,
+	0x3c, 0x00, 0xc0, 0x03, 0x3c, 0x00, 0xc0, 0x03, 0x3c, 0x00, 0xc0, 0x03, 0x3c, 0x00, 0xc0, 0x03,
+	0x3c, 0x00, 0xc0, 0x03, 0x28, 0x00, 0x80, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x90, 0xff, 0x6f, 0x00, 0xe4, 0xff, 0xbf, 0x01, 0xb8, 0x01, 0xe4, 0x02, 0x7c, 0x00, 0xd0, 0x03,
+	0x3c, 0x00, 0xc0, 0x03, 0x3c, 0x00, 0xc0, 0x03, 0x3c, 0x00, 0xc0, 0x03, 0x3c, 0x00, 0xc0, 0x03,
+	0x3c, 0x00, 0xc0, 0x03, 0x3c, 0x00, 0xc0, 0x03, 0x7c, 0x00, 0xd0, 0x03, 0xb8, 0x01, 0xe4, 0x02,
+	0xe4, 0xff, 0xbf, 0x01, 0x90, 0xff, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x28, 0xf8, 0x06, 0x00, 0x7c, 0xfd, 0x1b, 0x00, 0xfc, 0x5b, 0x6e, 0x00, 0xfc, 0x06, 0xb9, 0x01,
+	0xbc, 0x01, 0xe4, 0x02, 0x7c, 0x00, 0xd0, 0x03, 0x3c, 0x00, 0xc0, 0x03, 0x3c, 0x00, 0xc0, 0x03,
+	0x7c, 0x00, 0xd0, 0x03, 0xbc, 0x01, 0xe4, 0x02, 0xfc, 0x06, 0xb9, 0x01, 0xfc, 0x5b, 0x6e, 0x00,
+	0x7c, 0xfd, 0x1b, 0x00, 0x3c, 0xf8, 0x06, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+	0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xf9, 0x82, 0x02, 0x40, 0xfe, 0xd7, 0x03, 0x90, 0x5b, 0xfe, 0x03, 0xe4, 0x06, 0xf9, 0x03,
+	0xb8, 0x01, 0xe4, 0x03, 0x7c, 0x00, 0xd0, 0x03, 0x3c, 0x00, 0xc0, 0x03, 0x3c, 0x00, 0xc0, 0x03,
+	0x7c, 0x00, 0xd0, 0x03, 0xb8, 0x01, 0xe4, 0x03, 0xe4, 0x06, 0xf9, 0x03, 0x90, 0x5b, 0xfe, 0x03,
+	0x40, 0xfe, 0xd7, 0x03, 0x00, 0xf9, 0xc2, 0x03, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x00, 0xc0, 0x03,
+	0x00, 0x00, 0xc0, 0x03, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x00, 0x80, 0x02,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x28, 0xf8, 0x2f, 0x00, 0x7c, 0xfd, 0x2f, 0x00, 0xfc, 0x1b, 0x00, 0x00, 0xfc, 0x06, 0x00, 0x00,
+	0xbc, 0x01, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+	0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+	0x3c, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x90, 0xff, 0xff, 0x02, 0xe4, 0xff, 0xff, 0x02, 0xb8, 0x01, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00,
+	0x7c, 0x00, 0x00, 0x00, 0xb8, 0x01, 0x00, 0x00, 0xe4, 0xff, 0x6f, 0x00, 0x90, 0xff, 0xbf, 0x01,
+	0x00, 0x00, 0xe4, 0x02, 0x00, 0x00, 0xd0, 0x03, 0x00, 0x00, 0xd0, 0x03, 0x00, 0x00, 0xe4, 0x02,
+	0xf8, 0xff, 0xbf, 0x01, 0xf8, 0xff, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x80, 0x02, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x00, 0xd0, 0x07, 0x00, 0x00, 0xe4, 0x1b, 0x00, 0x00,
+	0xf8, 0xff, 0x02, 0x00, 0xf8, 0xff, 0x02, 0x00, 0xe4, 0x1b, 0x00, 0x00, 0xd0, 0x07, 0x00, 0x00,
+	0xc0, 0x03, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x00,
+	0xc0, 0x03, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x00, 0xc0, 0x07, 0x00, 0x00, 0x80, 0x1b, 0x00, 0x00,
+	0x40, 0xfe, 0x2f, 0x00, 0x00, 0xf9, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x28, 0x00, 0x80, 0x02, 0x3c, 0x00, 0xc0, 0x03, 0x3c, 0x00, 0xc0, 0x03, 0x3c, 0x00, 0xc0, 0x03,
+	0x3c, 0x00, 0xc0, 0x03, 0x3c, 0x00, 0xc0, 0x03, 0x3c, 0x00, 0xc0, 0x03, 0x3c, 0x00, 0xc0, 0x03,
+	0x3c, 0x00, 0xd0, 0x03, 0x3c, 0x00, 0xe4, 0x03, 0x7c, 0x00, 0xf9, 0x03, 0xb8, 0x41, 0xfe, 0x03,
+	0xe4, 0xff, 0xd7, 0x03, 0x90, 0xff, 0x82, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x1a, 0x00, 0x40, 0x0a, 0x6e, 0x00, 0x90, 0x0b, 0xb9, 0x00, 0xe0, 0x06, 0xf4, 0x00, 0xf0, 0x01,
+	0xf0, 0x01, 0xf4, 0x00, 0xf0, 0x02, 0xf8, 0x00, 0xe0, 0x07, 0xbd, 0x00, 0xd0, 0x0b, 0x7e, 0x00,
+	0x80, 0x0f, 0x2f, 0x00, 0x40, 0x0f, 0x1f, 0x00, 0x00, 0x0f, 0x0f, 0x00, 0x00, 0x5e, 0x0b, 0x00,
+	0x00, 0xf9, 0x06, 0x00, 0x00, 0xa4, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0a, 0x00, 0x00, 0x0a, 0x0f, 0x00, 0x00, 0x0f, 0x0f, 0x00, 0x00, 0x0f, 0x0f, 0x00, 0x00, 0x0f,
+	0x0f, 0xa4, 0x01, 0x0f, 0x0f, 0xf9, 0x06, 0x0f, 0x0f, 0x5e, 0x0b, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+	0x0f, 0x0f, 0x0f, 0x0f, 0x5e, 0x0b, 0x5e, 0x0b, 0xf9, 0x06, 0xf9, 0x06, 0xf4, 0x01, 0xf4, 0x01,
+	0xf0, 0x00, 0xf0, 0x00, 0xa0, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x68, 0x00, 0x90, 0x02, 0xb8, 0x01, 0xe4, 0x02, 0xe4, 0x06, 0xb9, 0x01, 0x90, 0x5f, 0x6f, 0x00,
+	0x40, 0xa3, 0x1c, 0x00, 0x00, 0xf9, 0x06, 0x00, 0x00, 0xfc, 0x03, 0x00, 0x00, 0xfc, 0x03, 0x00,
+	0x00, 0xf9, 0x06, 0x00, 0x40, 0xa3, 0x1c, 0x00, 0x90, 0x5f, 0x6f, 0x00, 0xe4, 0x06, 0xb9, 0x01,
+	0xb8, 0x01, 0xe4, 0x02, 0x68, 0x00, 0x90, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x1a, 0x00, 0x40, 0x0a, 0x6e, 0x00, 0x90, 0x0b, 0xb9, 0x00, 0xe0, 0x06, 0xf4, 0x00, 0xf0, 0x01,
+	0xf0, 0x01, 0xf4, 0x00, 0xe0, 0x06, 0xb9, 0x00, 0x90, 0x0b, 0x6e, 0x00, 0x40, 0x0f, 0x1f, 0x00,
+	0x00, 0x0f, 0x0f, 0x00, 0x00, 0x0f, 0x0f, 0x00, 0x00, 0x0f, 0x0f, 0x00, 0x00, 0x5e, 0x0b, 0x00,
+	0x00, 0xf9, 0x06, 0x00, 0x00, 0xf4, 0x01, 0x00, 0x00, 0xf4, 0x00, 0x00, 0x00, 0xb9, 0x00, 0x00,
+	0x40, 0x6e, 0x00, 0x00, 0x90, 0x1b, 0x00, 0x00, 0xfe, 0x06, 0x00, 0x00, 0xbe, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xf8, 0xff, 0xff, 0x02, 0xf8, 0xff, 0xff, 0x02, 0x00, 0x00, 0xbd, 0x01, 0x00, 0x00, 0x6d, 0x00,
+	0x00, 0x90, 0x1b, 0x00, 0x00, 0xe4, 0x06, 0x00, 0x00, 0xb8, 0x01, 0x00, 0x00, 0x7c, 0x00, 0x00,
+	0x00, 0x3d, 0x00, 0x00, 0x40, 0x2e, 0x00, 0x00, 0x90, 0x07, 0x00, 0x00, 0xe4, 0x07, 0x00, 0x00,
+	0xf8, 0xff, 0xff, 0x02, 0xf8, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x40, 0x2e, 0x00, 0x00,
+	0x80, 0x1b, 0x00, 0x00, 0xc0, 0x07, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x00,
+	0xc0, 0x03, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x00, 0xd0, 0x03, 0x00, 0x00, 0xe4, 0x02, 0x00, 0x00,
+	0x78, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xe4, 0x02, 0x00, 0x00, 0xd0, 0x03, 0x00, 0x00,
+	0xc0, 0x03, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x00,
+	0xc0, 0x03, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x00, 0xc0, 0x07, 0x00, 0x00, 0x80, 0x1b, 0x00, 0x00,
+	0x40, 0x2e, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+	0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+	0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+	0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+	0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+	0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
+	0x3c, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0xb8, 0x01, 0x00, 0x00,
+	0xe4, 0x02, 0x00, 0x00, 0xd0, 0x03, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x00,
+	0xc0, 0x03, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x00, 0xc0, 0x07, 0x00, 0x00, 0x80, 0x1b, 0x00, 0x00,
+	0x00, 0x2d, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x80, 0x1b, 0x00, 0x00, 0xc0, 0x07, 0x00, 0x00,
+	0xc0, 0x03, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x00,
+	0xc0, 0x03, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x00, 0xd0, 0x03, 0x00, 0x00, 0xe4, 0x02, 0x00, 0x00,
+	0xb8, 0x01, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xe4, 0xbf, 0x01, 0xa4, 0xf9, 0xff, 0x06, 0xb9, 0x6e, 0x90, 0xff, 0x6f, 0x1a, 0x40, 0xfe, 0x1b,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+const uint8_t aa_16x32_advances[] = {
+	 8,  5, 11, 16, 13, 16, 16,  5, 11, 11, 13, 16,  5, 11,  5, 13,
+	16, 16, 16, 16, 16, 16, 16, 16, 16, 16,  5,  5, 13, 15, 13, 13,
+	16, 16, 15, 15, 15, 15, 15, 15, 15, 13, 13, 16, 15, 15, 15, 15,
+	15, 15, 16, 15, 16, 15, 16, 16, 16, 16, 15,  9, 13,  9, 16, 16,
+	 7, 15, 15, 15, 15, 15, 15, 15, 15,  9, 11, 15, 13, 16, 15, 15,
+	15, 15, 13, 15, 13, 15, 16, 16, 15, 16, 15,  9,  5,  9, 16
+};
+
+}
+
+const ui::Font aa_16x32 {
+	16, 32,
+	aa_16x32_glyph_data,
+	0x20, 95,
+	2, aa_16x32_advances,
+};
+
+} /* namespace font */
+} /* namespace ui */
@@ -0,0 +1,36 @@
+/*
+ * Copyright (C) 2016 Furrtek
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __UI_FONT_AA_16X32_H__
+#define __UI_FONT_AA_16X32_H__
+
+#include "ui_text.hpp"
+
+namespace ui {
+namespace font {
+
+/* 2bpp anti-aliased, proportional (digits are fixed-width). */
+extern const ui::Font aa_16x32;
+
+} /* namespace font */
+} /* namspace ui */
+
+#endif/*__UI_FONT_AA_16X32_H__*/
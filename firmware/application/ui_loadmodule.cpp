@@ -40,6 +40,7 @@
 #include "ui_soundboard.hpp"
 #include "ui_debug.hpp"
 #include "ui_closecall.hpp"
+#include "ui_scanner.hpp"
 #include "ui_audiotx.hpp"
 
 #include <cstring>
@@ -78,53 +79,7 @@ void LoadModuleView::on_show() {
 }
 
 int LoadModuleView::load_image() {
-	const char magic[6] = {'P', 'P', 'M', ' ', 0x02, 0x00};
-	UINT bw;
-	uint8_t i;
-	uint32_t cnt;
-	char md5sum[16];
-	FILINFO modinfo;
-	FIL modfile;
-	DIR rootdir;
-	FRESULT res;
-	
-	// Scan SD card root directory for files with the right MD5 fingerprint at the right location
-	if (f_opendir(&rootdir, "/") == FR_OK) {
-		for (;;) {
-			res = f_readdir(&rootdir, &modinfo);
-			if (res != FR_OK || modinfo.fname[0] == 0) break;	// Reached last file, abort
-			// Only care about files with .bin extension
-			if ((!(modinfo.fattrib & AM_DIR)) && (modinfo.fname[9] == 'B') && (modinfo.fname[10] == 'I') && (modinfo.fname[11] == 'N')) {
-				res = f_open(&modfile, modinfo.fname, FA_OPEN_EXISTING | FA_READ);
-				if (res != FR_OK) return 0;
-				// Magic bytes and version check
-				f_read(&modfile, &md5sum, 6, &bw);
-				for (i = 0; i < 6; i++)
-					if (md5sum[i] != magic[i]) break;
-				if (i == 6) {
-					f_lseek(&modfile, 26);
-					f_read(&modfile, &md5sum, 16, &bw);
-					for (i = 0; i < 16; i++)
-						if (md5sum[i] != _hash[i]) break;
-					// f_read can't read more than 512 bytes at a time ?
-					if (i == 16) {
-						f_lseek(&modfile, 512);
-						for (cnt = 0; cnt < 64; cnt++) {
-							if (f_read(&modfile, reinterpret_cast<void*>(portapack::memory::map::m4_code.base() + (cnt * 512)), 512, &bw)) return 0;
-						}
-						f_close(&modfile);
-						f_closedir(&rootdir);
-						LPC_RGU->RESET_CTRL[0] = (1 << 13);
-						return 1;
-					}
-				}
-				f_close(&modfile);
-			}
-		}
-		f_closedir(&rootdir);
-	}
-	
-	return 0;
+	return m4_load_image();
 }
 
 void LoadModuleView::loadmodule() {
@@ -135,9 +90,13 @@ void LoadModuleView::loadmodule() {
 	/*EventDispatcher::message_map().register_handler(Message::ID::ReadyForSwitch,
 		[this](Message* const p) {
 			(void)p;*/
-			if (load_image()) {
+			const auto result = load_image();
+			if (result > 0) {
 				text_infob.set("Module loaded :)");
 				_mod_loaded = true;
+			} else if (result < 0) {
+				text_info.set("Module needs flash store :(");
+				_mod_loaded = false;
 			} else {
 				text_info.set("Module not found :(");
 				_mod_loaded = false;
@@ -173,6 +132,7 @@ LoadModuleView::LoadModuleView(
 			if (viewid == AnalogAudio) nav.push<AnalogAudioView>();
 			if (viewid == RDS) nav.push<RDSView>();
 			if (viewid == CloseCall) nav.push<CloseCallView>();
+			if (viewid == Scanner) nav.push<ScannerView>();
 			if (viewid == Receiver) nav.push<ReceiverMenuView>();
 		}
 	};
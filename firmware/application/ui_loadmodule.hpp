@@ -40,6 +40,7 @@ enum ViewID {
 	SoundBoard,
 	AnalogAudio,
 	RDS,
+	Scanner,
 };
 
 class LoadModuleView : public View {
@@ -66,6 +66,7 @@ public:
 
 	MenuView() {
 		set_focusable(true);
+		set_composited(true);
 	}
 
 	~MenuView();
@@ -55,6 +55,9 @@ namespace ui {
 SystemStatusView::SystemStatusView() {
 	uint8_t cfg;
 	
+	// Title, buttons and SD card icon overlap the bar background.
+	set_composited(true);
+
 	add_children({ {
 		&button_back,
 		&title,
@@ -188,10 +191,22 @@ void NavigationView::focus() {
 /* TranspondersMenuView **************************************************/
 
 TranspondersMenuView::TranspondersMenuView(NavigationView& nav) {
-	add_items<3>({ {
+	add_items<6>({ {
 		{ "AIS:  Boats", ui::Color::white(),          [&nav](){ nav.push<AISAppView>(); } },
 		{ "ERT:  Utility Meters", ui::Color::white(), [&nav](){ nav.push<ERTAppView>(); } },
 		{ "TPMS: Cars", ui::Color::white(),           [&nav](){ nav.push<TPMSAppView>(); } },
+		{ "AIS:  Replay last log", ui::Color::white(), [&nav](){
+			const auto file_path = find_last_file_matching_pattern("AIS_????.PKT");
+			nav.push<AISAppView>(file_path);
+		} },
+		{ "ERT:  Replay last log", ui::Color::white(), [&nav](){
+			const auto file_path = find_last_file_matching_pattern("ERT_????.PKT");
+			nav.push<ERTAppView>(file_path);
+		} },
+		{ "TPMS: Replay last log", ui::Color::white(), [&nav](){
+			const auto file_path = find_last_file_matching_pattern("TPMS????.PKT");
+			nav.push<TPMSAppView>(file_path);
+		} },
 	} });
 	on_left = [&nav](){ nav.pop(); };
 }
@@ -209,10 +224,11 @@ ReceiverMenuView::ReceiverMenuView(NavigationView& nav) {
 /* SystemMenuView ********************************************************/
 
 SystemMenuView::SystemMenuView(NavigationView& nav) {
-	add_items<11>({ {
+	add_items<12>({ {
 		{ "Play dead",		ui::Color::red(),  		[&nav](){ nav.push<PlayDeadView>(false); } },
 		{ "Receiver                  RX", 	ui::Color::cyan(),		[&nav](){ nav.push<LoadModuleView>(md5_baseband, Receiver); } },
 		{ "Close Call                RX",	ui::Color::cyan(),		[&nav](){ nav.push<LoadModuleView>(md5_baseband, CloseCall); } },
+		{ "Scanner                   RX",	ui::Color::cyan(),		[&nav](){ nav.push<LoadModuleView>(md5_baseband, Scanner); } },
 		{ "Soundboard                TX", 	ui::Color::yellow(),  	[&nav](){ nav.push<LoadModuleView>(md5_baseband_tx, SoundBoard); } },
 		//{ "Audio                     TX", 	ui::Color::yellow(),  	[&nav](){ nav.push<LoadModuleView>(md5_baseband_tx, AudioTX); } },
 		
@@ -342,7 +358,7 @@ BMPView::BMPView(NavigationView& nav) {
 
 void BMPView::paint(Painter& painter) {
 	(void)painter;
-	portapack::display.drawBMP({(240-185)/2, 0}, splash_bmp, false);
+	portapack::display.draw_run_bitmap({ (240 - bitmap_splash.size.w) / 2, 17 }, bitmap_splash);
 }
 
 /* PlayDeadView **********************************************************/
@@ -32,11 +32,80 @@ using namespace portapack;
 
 #include <cstdint>
 
+/* Capture files are reserved ahead of the data in extents of several
+ * seconds at the expected rate, so streaming writes land in mapped,
+ * mostly contiguous clusters instead of growing the FAT chain one cluster
+ * at a time. The next extent is reserved in the background while the
+ * current one fills; a write only waits for allocation if that fell
+ * behind. The unused tail of the last extent is cut off on close.
+ */
+class CaptureFile {
+public:
+	CaptureFile(
+		const std::string& filename,
+		const size_t bytes_per_second
+	) : file { filename, File::openmode::out | File::openmode::binary | File::openmode::trunc, sd_io::Priority::Capture },
+		extent_size { std::max(bytes_per_second * extent_seconds, size_t { extent_min }) },
+		reserved { extent_size },
+		reserving { extent_size }
+	{
+		file.reserve(reserved);
+	}
+
+	~CaptureFile() {
+		file.truncate();
+	}
+
+	bool write(const void* const buffer, const size_t bytes) {
+		if( !file.reserve_pending() ) {
+			reserved = reserving;
+		}
+		if( (position + bytes) > reserved ) {
+			reserved = reserving = position + bytes + extent_size;
+			file.reserve(reserved);
+		}
+
+		const auto success = file.write(buffer, bytes);
+		if( success ) {
+			position += bytes;
+		}
+
+		if( (reserving - position) < extent_size ) {
+			if( file.reserve_later(reserving + extent_size) ) {
+				reserving += extent_size;
+			}
+		}
+		return success;
+	}
+
+	/* Rewrite the start of the file in place, leaving the write position
+	 * where it was, and commit it to the card.
+	 */
+	bool rewrite_header(const void* const header, const size_t bytes) {
+		file.seek(0);
+		const auto success = file.write(header, bytes);
+		file.seek(position);
+		return file.sync() && success;
+	}
+
+private:
+	static constexpr size_t extent_seconds = 8;
+	static constexpr size_t extent_min = 1024 * 1024;
+
+	File file;
+	const size_t extent_size;
+	uint64_t position { 0 };
+	/* Allocated, and asked for in the background. */
+	uint64_t reserved { 0 };
+	uint64_t reserving { 0 };
+};
+
 class RawFileWriter : public Writer {
 public:
 	RawFileWriter(
-		const std::string& filename
-	) : file { filename, File::openmode::out | File::openmode::binary | File::openmode::trunc }
+		const std::string& filename,
+		size_t bytes_per_second
+	) : file { filename, bytes_per_second }
 	{
 	}
 
@@ -45,7 +114,7 @@ public:
 	}
 
 private:
-	File file;
+	CaptureFile file;
 };
 
 class WAVFileWriter : public Writer {
@@ -53,10 +122,11 @@ public:
 	WAVFileWriter(
 		const std::string& filename,
 		size_t sampling_rate
-	) : file { filename, File::openmode::out | File::openmode::binary | File::openmode::trunc },
-		header { sampling_rate }
+	) : file { filename, sampling_rate * sizeof(int16_t) },
+		header { sampling_rate },
+		header_interval { sampling_rate * sizeof(int16_t) }
 	{
-		update_header();
+		file.write(&header, sizeof(header));
 	}
 
 	~WAVFileWriter() {
@@ -64,9 +134,14 @@ public:
 	}
 
 	bool write(const void* const buffer, const size_t bytes) override {
-		const auto success = file.write(buffer, bytes) ;
+		const auto success = file.write(buffer, bytes);
 		if( success ) {
 			bytes_written += bytes;
+			// Keep the RIFF sizes about a second behind the data, so a
+			// recording cut short by power loss still plays.
+			if( (bytes_written - header_bytes_written) >= header_interval ) {
+				update_header();
+			}
 		}
 		return success;
 	}
@@ -121,15 +196,16 @@ private:
 		data_t data;
 	};
 
-	File file;
+	CaptureFile file;
 	header_t header;
+	const size_t header_interval;
 	uint64_t bytes_written { 0 };
+	uint64_t header_bytes_written { 0 };
 
 	void update_header() {
 		header.set_data_size(bytes_written);
-		const auto old_position = file.seek(0);
-		file.write(&header, sizeof(header));
-		file.seek(old_position);
+		file.rewrite_header(&header, sizeof(header));
+		header_bytes_written = bytes_written;
 	}
 };
 
@@ -151,6 +227,7 @@ RecordView::RecordView(
 		&button_record,
 		&text_record_filename,
 		&text_record_dropped,
+		&options_compression,
 	} });
 
 	button_record.on_select = [this](ImageButton&) {
@@ -197,20 +274,45 @@ void RecordView::start() {
 		return;
 	}
 
+	const bool compressed = (options_compression.selected_index_value() != 0);
+	auto compression = CaptureConfig::Compression::None;
+
 	std::unique_ptr<Writer> writer;
 	switch(file_type) {
 	case FileType::WAV:
-		writer = std::make_unique<WAVFileWriter>(
-			filename_stem + ".WAV",
-			sampling_rate
-		);
+		bytes_per_sample = sizeof(int16_t);
+		if( compressed ) {
+			// Typically a bit over half the raw rate; reserve for the worst case.
+			compression = CaptureConfig::Compression::Rice;
+			open_metadata_file(filename_stem + ".TXT", "ri16_le", "rice");
+			writer = std::make_unique<RawFileWriter>(
+				filename_stem + ".RIC",
+				sampling_rate * sizeof(int16_t)
+			);
+		} else {
+			writer = std::make_unique<WAVFileWriter>(
+				filename_stem + ".WAV",
+				sampling_rate
+			);
+		}
 		break;
 
 	case FileType::RawS16:
-		write_metadata_file(filename_stem + ".TXT");
-		writer = std::make_unique<RawFileWriter>(
-			filename_stem + ".C16"
-		);
+		bytes_per_sample = sizeof(complex16_t);
+		if( compressed ) {
+			compression = CaptureConfig::Compression::BlockFloat8;
+			open_metadata_file(filename_stem + ".TXT", "ci16_le", "bfp8");
+			writer = std::make_unique<RawFileWriter>(
+				filename_stem + ".CBF",
+				sampling_rate * sizeof(complex16_t) / 2
+			);
+		} else {
+			open_metadata_file(filename_stem + ".TXT", "ci16_le", "");
+			writer = std::make_unique<RawFileWriter>(
+				filename_stem + ".C16",
+				sampling_rate * sizeof(complex16_t)
+			);
+		}
 		break;
 
 	default:
@@ -222,29 +324,99 @@ void RecordView::start() {
 		button_record.set_bitmap(&bitmap_stop);
 		capture_thread = std::make_unique<CaptureThread>(
 			std::move(writer),
-			buffer_size_k, buffer_count_k
+			buffer_size_k, buffer_count_k,
+			compression
 		);
 	}
 }
 
 void RecordView::stop() {
 	if( is_active() ) {
+		capture_thread->stop();
+		note_length();
 		capture_thread.reset();
 		button_record.set_bitmap(&bitmap_record);
 	}
+	metadata_file.reset();
+}
+
+/* The metadata file starts with the capture settings as key=value lines.
+ * Changes made while recording follow as "@sample key=value" lines, where
+ * sample is the offset into the (decoded) sample file where the change
+ * takes effect.
+ * Lines are appended as the capture runs, so the file stays usable if the
+ * recording is cut short. Among them, "length=bytes" lines keep track of
+ * how much of the sample file has been written: after a power loss the
+ * file runs on into its reserved extent, and the last length says where
+ * the data ends. tools/capture_sigmf.py turns it into SigMF, cutting the
+ * sample file back to that length.
+ */
+void RecordView::open_metadata_file(
+	const std::string& filename,
+	const std::string& datatype,
+	const std::string& compression
+) {
+	metadata_file = std::make_unique<LogFile>(filename);
+	dropped_bytes_annotated = 0;
+	length_noted = 0;
+
+	rtc::RTC datetime;
+	rtcGetTime(&RTCD1, &datetime);
+
+	const std::string header =
+		"sample_rate=" + to_string_dec_uint(sampling_rate) + "\n" +
+		"center_frequency=" + to_string_dec_uint64(receiver_model.tuning_frequency()) + "\n" +
+		"datatype=" + datatype + "\n" +
+		(compression.empty() ? "" : "compression=" + compression + "\n") +
+		"datetime=" + to_string_timestamp(datetime) + "\n" +
+		"rf_amp=" + to_string_dec_uint(receiver_model.rf_amp() ? 1 : 0) + "\n" +
+		"lna=" + to_string_dec_int(receiver_model.lna()) + "\n" +
+		"vga=" + to_string_dec_int(receiver_model.vga()) + "\n";
+	metadata_file->write(header.data(), header.size());
+	metadata_file->commit();
+}
+
+uint64_t RecordView::sample_position() const {
+	if( !is_active() ) {
+		return 0;
+	}
+	const auto& state = capture_thread->state();
+	return (state.baseband_bytes_received - state.baseband_bytes_dropped) / bytes_per_sample;
+}
+
+void RecordView::annotate(const std::string& key, const std::string& value) {
+	if( metadata_file ) {
+		const std::string line =
+			"@" + to_string_dec_uint64(sample_position()) + " " + key + "=" + value + "\n";
+		metadata_file->write(line.data(), line.size());
+	}
 }
 
-void RecordView::write_metadata_file(const std::string& filename) {
-	File file { filename, File::openmode::out | File::openmode::trunc };
-	file.puts("sample_rate=" + to_string_dec_uint(sampling_rate) + "\n");
-	file.puts("center_frequency=" + to_string_dec_uint(receiver_model.tuning_frequency()) + "\n");
+/* Writes are whole sectors, so this much is on the card. */
+void RecordView::note_length() {
+	const auto length = capture_thread->bytes_written();
+	if( metadata_file && (length != length_noted) ) {
+		const std::string line = "length=" + to_string_dec_uint(length) + "\n";
+		metadata_file->write(line.data(), line.size());
+		length_noted = length;
+	}
 }
 
 void RecordView::on_tick_second() {
 	if( is_active() ) {
-		const auto dropped_percent = std::min(99U, capture_thread->state().dropped_percent());
+		const auto& state = capture_thread->state();
+		const auto dropped_percent = std::min(99U, state.dropped_percent());
 		const auto s = to_string_dec_uint(dropped_percent, 2, ' ') + "\%";
 		text_record_dropped.set(s);
+
+		// Gaps are noted at the first second tick after they happen.
+		const uint64_t dropped_bytes = state.baseband_bytes_dropped;
+		if( dropped_bytes > dropped_bytes_annotated ) {
+			annotate("dropped", to_string_dec_uint((dropped_bytes - dropped_bytes_annotated) / bytes_per_sample));
+			dropped_bytes_annotated = dropped_bytes;
+		}
+
+		note_length();
 	}
 }
 
@@ -25,6 +25,7 @@
 #include "ui_widget.hpp"
 
 #include "capture_thread.hpp"
+#include "log_file.hpp"
 #include "signal.hpp"
 
 #include "bitmap.hpp"
@@ -65,10 +66,21 @@ public:
 
 	bool is_active() const;
 
+	/* Record a change to a capture parameter (e.g. "center_frequency") in
+	 * the metadata file, at the sample the recording has reached.
+	 */
+	void annotate(const std::string& key, const std::string& value);
+
 private:
 	void toggle();
-	void write_metadata_file(const std::string& filename);
+	void open_metadata_file(
+		const std::string& filename,
+		const std::string& datatype,
+		const std::string& compression
+	);
+	uint64_t sample_position() const;
 
+	void note_length();
 	void on_tick_second();
 
 	const std::string filename_stem_pattern;
@@ -95,7 +107,23 @@ private:
 		"",
 	};
 
+	/* Compressed recordings are decoded on the host by
+	 * tools/capture_decode.py.
+	 */
+	OptionsField options_compression {
+		{ 21 * 8, 0 * 16 },
+		4,
+		{
+			{ "Raw ", 0 },
+			{ "Pack", 1 },
+		}
+	};
+
 	std::unique_ptr<CaptureThread> capture_thread;
+	std::unique_ptr<LogFile> metadata_file;
+	uint32_t length_noted { 0 };
+	size_t bytes_per_sample { sizeof(complex16_t) };
+	uint64_t dropped_bytes_annotated { 0 };
 };
 
 } /* namespace ui */
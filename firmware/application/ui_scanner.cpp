@@ -0,0 +1,305 @@
+/*
+ * Copyright (C) 2016 Jared Boone, ShareBrained Technology, Inc.
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "ui_scanner.hpp"
+
+#include "event_m0.hpp"
+#include "portapack.hpp"
+#include "audio.hpp"
+#include "string_format.hpp"
+
+#include <utility>
+
+using namespace portapack;
+
+namespace ui {
+
+ScannerView::ScannerView(
+	NavigationView& nav
+) {
+	add_children({ {
+		&text_labels_a,
+		&text_labels_b,
+		&text_labels_c,
+		&options_mode,
+		&options_bank,
+		&field_threshold,
+		&field_hang,
+		&field_lna,
+		&field_vga,
+		&text_plan,
+		&text_status,
+		&text_rate,
+		&text_channel,
+		&text_activity,
+		&text_frequency,
+		&text_bank,
+		&button_skip,
+		&button_exit,
+	} });
+
+	text_labels_a.set_style(&style_grey);
+	text_labels_b.set_style(&style_grey);
+	text_labels_c.set_style(&style_grey);
+	text_frequency.set_style(&style_frequency);
+
+	plan.load_all();
+
+	OptionsField::options_t banks { { "All", -1 } };
+	for(size_t i=0; i<plan.bank_count(); i++) {
+		banks.emplace_back(plan.bank_name(i), i);
+	}
+	options_bank.set_options(std::move(banks));
+	options_bank.on_change = [this](size_t, OptionsField::value_t) {
+		this->restart();
+	};
+
+	options_mode.set_by_value(toUType(ReceiverModel::Mode::NarrowbandFMAudio));
+	options_mode.on_change = [this](size_t, OptionsField::value_t) {
+		this->restart();
+	};
+
+	field_threshold.set_value(10);
+	field_threshold.on_change = [this](int32_t) {
+		this->restart();
+	};
+
+	field_hang.set_value(2);
+	field_hang.on_change = [this](int32_t) {
+		this->restart();
+	};
+
+	field_lna.set_value(receiver_model.lna());
+	field_lna.on_change = [this](int32_t v_db) {
+		receiver_model.set_lna(v_db);
+		if( this->scan_thread ) {
+			this->scan_thread->set_gain_db(this->receiver_gain_db());
+		}
+	};
+
+	field_vga.set_value(receiver_model.vga());
+	field_vga.on_change = [this](int32_t v_db) {
+		receiver_model.set_vga(v_db);
+		if( this->scan_thread ) {
+			this->scan_thread->set_gain_db(this->receiver_gain_db());
+		}
+	};
+
+	scan_rf_amp = receiver_model.rf_amp();
+	scan_am_config = receiver_model.am_configuration();
+	scan_nbfm_config = receiver_model.nbfm_configuration();
+
+	button_skip.on_select = [this](Button&) {
+		if( this->scan_thread ) {
+			this->scan_thread->skip();
+		}
+	};
+
+	button_exit.on_select = [&nav](Button&) {
+		nav.pop();
+	};
+
+	audio::output::start();
+
+	restart();
+}
+
+ScannerView::~ScannerView() {
+	scan_thread.reset();
+
+	audio::output::stop();
+	receiver_model.disable();
+}
+
+void ScannerView::on_show() {
+	View::on_show();
+
+	EventDispatcher::message_map().register_handler(Message::ID::DisplayFrameSync,
+		[this](const Message* const) {
+			this->on_frame_sync();
+		}
+	);
+}
+
+void ScannerView::on_hide() {
+	EventDispatcher::message_map().unregister_handler(Message::ID::DisplayFrameSync);
+
+	View::on_hide();
+}
+
+void ScannerView::focus() {
+	button_skip.focus();
+}
+
+/* Settings take effect by starting over. The processor stays up if the
+ * mode didn't change, and only the list of channels is rebuilt.
+ */
+void ScannerView::restart() {
+	scan_thread.reset();
+	audio::output::mute();
+
+	const auto mode = static_cast<ReceiverModel::Mode>(options_mode.selected_index_value());
+	if( !receiver_enabled || (receiver_model.modulation() != static_cast<uint32_t>(toUType(mode))) ) {
+		receiver_model.set_baseband_configuration({
+			.mode = toUType(mode),
+			.sampling_rate = 3072000,
+			.decimation_factor = 1,
+		});
+		receiver_model.set_baseband_bandwidth(1750000);
+		receiver_model.enable();
+		receiver_enabled = true;
+	}
+	// The scan may have been stopped while dwelling.
+	apply_scan_settings();
+
+	const auto bank = options_bank.selected_index_value();
+	scan_channels.clear();
+	std::vector<radio::TuningPlan> plans;
+	for(size_t i=0; (i<plan.size()) && (plans.size()<channels_max); i++) {
+		const auto& channel = plan[i];
+		const bool bank_match = (static_cast<int32_t>(bank) < 0) || (channel.bank == bank);
+		if( bank_match && (ReceiverModel::receiver_mode(channel.mode) == mode) ) {
+			scan_channels.push_back(i);
+			plans.push_back(receiver_model.plan_tuning(channel.frequency()));
+		}
+	}
+
+	if( plan.truncated() ) {
+		text_plan.set("Plans truncated, memory full");
+	} else if( plans.size() >= channels_max ) {
+		text_plan.set("Scanning first " + to_string_dec_uint(channels_max) + " channels");
+	} else {
+		text_plan.set("");
+	}
+
+	shown_channel = scan_channels.size();
+	shown_dwelling = false;
+	shown_activity = 0;
+	shown_rate = 0;
+	text_rate.set("   0");
+
+	if( plans.empty() ) {
+		text_status.set("No channels");
+		text_channel.set("");
+		text_activity.set("");
+		text_bank.set("");
+		text_frequency.set("");
+		return;
+	}
+
+	text_status.set("SCAN");
+	scan_thread = std::make_unique<ScanThread>(
+		std::move(plans),
+		receiver_gain_db(),
+		S2ST(field_hang.value()),
+		field_threshold.value()
+	);
+
+	audio::output::unmute();
+}
+
+/* Receiver settings belong to this thread, so the scan thread asks for
+ * them to be changed and waits.
+ */
+void ScannerView::apply_scan_settings() {
+	{
+		radio::Transaction transaction;
+		receiver_model.set_rf_amp(scan_rf_amp);
+		receiver_model.set_lna(field_lna.value());
+		receiver_model.set_vga(field_vga.value());
+	}
+
+	if( receiver_model.ctcss_tone() != 0 ) {
+		receiver_model.set_ctcss_tone(0);
+	}
+	if( receiver_model.am_configuration() != scan_am_config ) {
+		receiver_model.set_am_configuration(scan_am_config);
+	}
+	if( receiver_model.nbfm_configuration() != scan_nbfm_config ) {
+		receiver_model.set_nbfm_configuration(scan_nbfm_config);
+	}
+}
+
+int32_t ScannerView::receiver_gain_db() const {
+	return receiver_model.lna() + receiver_model.vga() + (receiver_model.rf_amp() ? rf_amp_gain_db : 0);
+}
+
+/* Polled once a frame: the scan thread may hop many times between two. */
+void ScannerView::on_frame_sync() {
+	if( !scan_thread ) {
+		return;
+	}
+
+	switch(scan_thread->request()) {
+	case ScanThread::Request::Dwell:
+		receiver_model.set_channel(plan[scan_channels[scan_thread->channel()]]);
+		scan_thread->set_gain_db(receiver_gain_db());
+		scan_thread->request_done();
+		break;
+
+	case ScanThread::Request::Resume:
+		apply_scan_settings();
+		scan_thread->set_gain_db(receiver_gain_db());
+		scan_thread->request_done();
+		break;
+
+	default:
+		break;
+	}
+
+	const auto index = scan_thread->channel();
+	const auto activity = scan_thread->activity(index);
+	if( (index != shown_channel) || (activity != shown_activity) ) {
+		show_channel(index);
+		text_activity.set("Hits: " + to_string_dec_uint(activity, 4));
+		shown_activity = activity;
+	}
+
+	const auto dwelling = scan_thread->dwelling();
+	if( dwelling != shown_dwelling ) {
+		text_status.set(dwelling ? "DWELL" : "SCAN");
+		shown_dwelling = dwelling;
+	}
+
+	const auto rate = scan_thread->scan_rate();
+	if( rate != shown_rate ) {
+		text_rate.set(to_string_dec_uint(rate, 4));
+		shown_rate = rate;
+	}
+}
+
+void ScannerView::show_channel(const size_t index) {
+	if( index == shown_channel ) {
+		return;
+	}
+
+	const auto& channel = plan[scan_channels[index]];
+	const auto frequency = channel.frequency();
+	text_frequency.set(
+		to_string_dec_uint(frequency / 1000000, 4) + "." +
+		to_string_dec_uint((frequency % 1000000) / 100, 4, '0') + " MHz"
+	);
+	text_bank.set(plan.bank_name(channel.bank));
+	text_channel.set("Ch " + to_string_dec_uint(index + 1, 4, '0') + "/" + to_string_dec_uint(scan_channels.size(), 4, '0'));
+	shown_channel = index;
+}
+
+} /* namespace ui */
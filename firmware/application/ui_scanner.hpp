@@ -0,0 +1,196 @@
+/*
+ * Copyright (C) 2016 Jared Boone, ShareBrained Technology, Inc.
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __UI_SCANNER_H__
+#define __UI_SCANNER_H__
+
+#include "receiver_model.hpp"
+#include "scan_thread.hpp"
+#include "channel_plan.hpp"
+
+#include "ui_widget.hpp"
+#include "ui_navigation.hpp"
+#include "ui_receiver.hpp"
+
+#include "ui_font_fixed_8x16.hpp"
+#include "ui_font_aa_16x32.hpp"
+
+#include <cstdint>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace ui {
+
+class ScannerView : public View {
+public:
+	ScannerView(NavigationView& nav);
+	~ScannerView();
+
+	void on_show() override;
+	void on_hide() override;
+	void focus() override;
+
+	std::string title() const override { return "Scanner"; };
+
+private:
+	/* Tuning plans take some room, so scan at most this many channels. */
+	static constexpr size_t channels_max = 512;
+	/* Roughly, for comparing levels measured with and without it. */
+	static constexpr int32_t rf_amp_gain_db = 14;
+
+	const Style style_grey {
+		.font = font::fixed_8x16,
+		.background = Color::black(),
+		.foreground = Color::grey(),
+	};
+
+	const Style style_frequency {
+		.font = font::aa_16x32,
+		.background = Color::black(),
+		.foreground = Color::white(),
+	};
+
+	channel_plan::ChannelPlan plan;
+	/* Plan index of each channel being scanned. */
+	std::vector<size_t> scan_channels;
+	std::unique_ptr<ScanThread> scan_thread;
+
+	bool receiver_enabled { false };
+	/* Settings to scan with, put back after dwelling on a channel that
+	 * brought its own.
+	 */
+	bool scan_rf_amp { false };
+	size_t scan_am_config { 0 };
+	size_t scan_nbfm_config { 0 };
+
+	size_t shown_channel { 0 };
+	bool shown_dwelling { false };
+	uint32_t shown_activity { 0 };
+	uint32_t shown_rate { 0 };
+
+	void restart();
+	void apply_scan_settings();
+	int32_t receiver_gain_db() const;
+	void on_frame_sync();
+	void show_channel(const size_t index);
+
+	/* |012345678901234567890123456789|
+	 * |Mode:      Bank:              |
+	 * |Sq:  +  dB  Hang:  s   00  00  |
+	 * |Plans truncated, memory full  |
+	 * |SCAN        Rate:   0 ch/s    |
+	 * |Ch 0000/0000   Hits: 0000     |
+	 */
+
+	Text text_labels_a {
+		{ 0 * 8, 0 * 16, 16 * 8, 16 },
+		"Mode:      Bank:"
+	};
+	Text text_labels_b {
+		{ 0 * 8, 1 * 16, 19 * 8, 16 },
+		"Sq:  +  dB  Hang:  s"
+	};
+	Text text_labels_c {
+		{ 12 * 8, 3 * 16, 17 * 8, 16 },
+		"Rate:     ch/s"
+	};
+
+	OptionsField options_mode {
+		{ 5 * 8, 0 * 16 },
+		4,
+		{
+			{ " AM ", toUType(ReceiverModel::Mode::AMAudio) },
+			{ "NFM ", toUType(ReceiverModel::Mode::NarrowbandFMAudio) },
+		}
+	};
+	OptionsField options_bank {
+		{ 16 * 8, 0 * 16 },
+		8,
+		{ }
+	};
+
+	/* Carrier margin over each channel's noise floor. */
+	NumberField field_threshold {
+		{ 6 * 8, 1 * 16 },
+		2,
+		{ 3, 40 },
+		1,
+		' '
+	};
+	NumberField field_hang {
+		{ 16 * 8, 1 * 16 },
+		2,
+		{ 0, 30 },
+		1,
+		' '
+	};
+
+	LNAGainField field_lna {
+		{ 22 * 8, 1 * 16 }
+	};
+	VGAGainField field_vga {
+		{ 26 * 8, 1 * 16 }
+	};
+
+	Text text_plan {
+		{ 0 * 8, 2 * 16, 30 * 8, 16 },
+		""
+	};
+	Text text_status {
+		{ 0 * 8, 3 * 16, 11 * 8, 16 },
+		""
+	};
+	Text text_rate {
+		{ 17 * 8, 3 * 16, 4 * 8, 16 },
+		""
+	};
+	Text text_channel {
+		{ 0 * 8, 4 * 16, 12 * 8, 16 },
+		""
+	};
+	Text text_activity {
+		{ 15 * 8, 4 * 16, 10 * 8, 16 },
+		""
+	};
+
+	Text text_frequency {
+		{ 1 * 8, 6 * 16, 28 * 8, 32 },
+		""
+	};
+	Text text_bank {
+		{ 1 * 8, 9 * 16, 28 * 8, 16 },
+		""
+	};
+
+	Button button_skip {
+		{ 32, 264, 72, 32 },
+		"Skip"
+	};
+	Button button_exit {
+		{ 136, 264, 72, 32 },
+		"Exit"
+	};
+};
+
+} /* namespace ui */
+
+#endif/*__UI_SCANNER_H__*/
@@ -25,8 +25,10 @@
 
 #include "file.hpp"
 #include "lfsr_random.hpp"
+#include "sd_card_benchmark.hpp"
 
 #include "ff.h"
+#include "fatfs_cache.h"
 
 #include "ch.h"
 #include "hal.h"
@@ -58,6 +60,8 @@ public:
 		halrtcnt_t read_test_duration { 0 };
 		size_t read_bytes { 0 };
 		size_t read_count { 0 };
+
+		fatfs_cache_stats_t cache;
 	};
 
 	SDCardTestThread(
@@ -96,6 +100,8 @@ private:
 	Result run() {
 		const std::string filename { "_PPTEST_.DAT" };
 
+		fatfs_cache_reset_stats();
+
 		const auto write_result = write(filename);
 		if( write_result != Result::OK ) {
 			return write_result;
@@ -116,6 +122,8 @@ private:
 
 		f_unlink(filename.c_str());
 
+		fatfs_cache_get_stats(&_stats.cache);
+
 		if( _stats.read_bytes < bytes_to_read ) {
 			return Result::FailReadIncomplete;
 		}
@@ -249,11 +257,15 @@ SDCardDebugView::SDCardDebugView(NavigationView& nav) {
 		&text_test_read_time_value,
 		&text_test_read_rate_title,
 		&text_test_read_rate_value,
+		&text_test_cache_title,
+		&text_test_cache_value,
 		&button_test,
+		&button_bench,
 		&button_ok,
 	} });
 
 	button_test.on_select = [this](Button&){ this->on_test(); };
+	button_bench.on_select = [&nav](Button&){ nav.push<SDCardBenchmarkView>(); };
 	button_ok.on_select = [&nav](Button&){ nav.pop(); };
 }
 
@@ -283,6 +295,7 @@ void SDCardDebugView::on_status(const sd_card::Status) {
 	text_test_write_rate_value.set("");
 	text_test_read_time_value.set("");
 	text_test_read_rate_value.set("");
+	text_test_cache_value.set("");
 
 	const bool is_inserted = sdcIsCardInserted(&SDCD1);
 	text_detected_value.set(is_inserted ? "Yes" : " No");
@@ -355,6 +368,7 @@ void SDCardDebugView::on_test() {
 	text_test_write_rate_value.set("");
 	text_test_read_time_value.set("");
 	text_test_read_rate_value.set("");
+	text_test_cache_value.set("");
 
 	SDCardTestThread thread;
 
@@ -401,9 +415,92 @@ void SDCardDebugView::on_test() {
 			format_bytes_per_ticks_as_mib(stats.read_bytes, stats.read_duration_min * stats.read_count) + " " +
 			format_bytes_per_ticks_as_mib(stats.read_bytes, stats.read_test_duration)
 		);
+
+		// Cache hits/misses, then multi-block write/read commands.
+		text_test_cache_value.set(
+			to_string_dec_uint(stats.cache.read_hits + stats.cache.write_hits, 5) + "/" +
+			to_string_dec_uint(stats.cache.read_misses, 5) + " " +
+			to_string_dec_uint(stats.cache.multi_block_writes, 5) + "/" +
+			to_string_dec_uint(stats.cache.multi_block_reads, 5)
+		);
 	} else {
 		text_test_write_time_value.set("Fail: " + to_string_dec_int(toUType(thread.result()), 4));
 	}
 }
 
+/* SDCardBenchmarkView **************************************************/
+
+SDCardBenchmarkView::SDCardBenchmarkView(NavigationView& nav) {
+	add_children({ {
+		&text_title,
+		&console,
+		&button_run,
+		&button_ok,
+	} });
+
+	console.set_parent_rect({ 0, 3 * 16, 240, 13 * 16 });
+
+	button_run.on_select = [this](Button&){ this->on_run(); };
+	button_ok.on_select = [&nav](Button&){ nav.pop(); };
+}
+
+void SDCardBenchmarkView::focus() {
+	button_run.focus();
+}
+
+static std::string format_us_as_ms(const uint32_t us) {
+	const uint32_t ms_int = us / 1000U;
+	const uint32_t ms_frac = (us % 1000U) / 100U;
+	if( ms_int < 1000 ) {
+		return to_string_dec_uint(ms_int, 4) + "." + to_string_dec_uint(ms_frac, 1);
+	} else {
+		return "HHHH.H";
+	}
+}
+
+void SDCardBenchmarkView::on_run() {
+	using namespace sd_card_benchmark;
+
+	console.clear();
+	console.writeln("Test   kB/s p50ms  p99ms  max");
+
+	const auto benchmark = std::make_unique<Benchmark>();
+	if( !benchmark ) {
+		console.writeln("Fail: heap");
+		return;
+	}
+
+	// Print each profile as soon as its results are final.
+	size_t shown = 0;
+	while( true ) {
+		const bool done = (benchmark->result() != Benchmark::Result::Incomplete);
+		for(; shown<benchmark->completed(); shown++) {
+			const auto& p = profile(shown);
+			const auto& r = benchmark->profile_result(shown);
+			std::string name { p.name };
+			name.resize(6, ' ');
+			console.writeln(
+				name +
+				to_string_dec_uint(r.kilobytes_per_second(), 5) +
+				format_us_as_ms(r.histogram.percentile(500)) + " " +
+				format_us_as_ms(r.histogram.percentile(990)) +
+				to_string_dec_uint(r.histogram.max() / 1000U, 5)
+			);
+			if( p.kind == Kind::Stream ) {
+				console.writeln("  late " + to_string_dec_uint(r.late) + "/" + to_string_dec_uint(r.ops));
+			}
+		}
+		if( done ) {
+			break;
+		}
+		chThdSleepMilliseconds(100);
+	}
+
+	if( benchmark->result() == Benchmark::Result::OK ) {
+		console.writeln("Report " + benchmark->report_filename());
+	} else {
+		console.writeln("Fail: " + to_string_dec_int(toUType(benchmark->result()), 4));
+	}
+}
+
 } /* namespace ui */
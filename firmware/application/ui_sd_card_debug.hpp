@@ -24,6 +24,7 @@
 
 #include "ui_widget.hpp"
 #include "ui_navigation.hpp"
+#include "ui_console.hpp"
 
 #include "sd_card.hpp"
 
@@ -133,6 +134,18 @@ private:
 		"",
 	};
 
+	static constexpr size_t test_cache_characters = 23;
+
+	Text text_test_cache_title {
+		{ 0, 11 * 16, (5 * 8), 16 },
+		"Cache",
+	};
+
+	Text text_test_cache_value {
+		{ 240 - (test_cache_characters * 8), 11 * 16, (test_cache_characters * 8), 16 },
+		"",
+	};
+
 	///////////////////////////////////////////////////////////////////////
 
 	static constexpr size_t test_write_time_characters = 23;
@@ -188,10 +201,42 @@ private:
 	///////////////////////////////////////////////////////////////////////
 
 	Button button_test {
-		{ 16, 17 * 16, 96, 24 },
+		{ 8, 17 * 16, 64, 24 },
 		"Test"
 	};
 
+	Button button_bench {
+		{ 88, 17 * 16, 64, 24 },
+		"Bench"
+	};
+
+	Button button_ok {
+		{ 240 - 64 - 8, 17 * 16, 64, 24 },
+		"OK"
+	};
+};
+
+class SDCardBenchmarkView : public View {
+public:
+	SDCardBenchmarkView(NavigationView& nav);
+
+	void focus() override;
+
+private:
+	void on_run();
+
+	Text text_title {
+		{ (240 - (12 * 8)) / 2, 1 * 16, (12 * 8), 16 },
+		"SD Benchmark",
+	};
+
+	Console console;
+
+	Button button_run {
+		{ 16, 17 * 16, 96, 24 },
+		"Run"
+	};
+
 	Button button_ok {
 		{ 240 - 96 - 16, 17 * 16, 96, 24 },
 		"OK"
@@ -285,33 +285,33 @@ private:
 	ImageOptionsField options_ra {
 		{ 26, 166, 24, 24 },
 		{
-			{ &bulb_ignore_bmp[0], 0 },
-			{ &bulb_off_bmp[0], 1 },
-			{ &bulb_on_bmp[0], 2 }
+			{ &bitmap_bulb_ignore, 0 },
+			{ &bitmap_bulb_off, 1 },
+			{ &bitmap_bulb_on, 2 }
 		}
 	};
 	ImageOptionsField options_rb {
 		{ 79, 166, 24, 24 },
 		{
-			{ &bulb_ignore_bmp[0], 0 },
-			{ &bulb_off_bmp[0], 1 },
-			{ &bulb_on_bmp[0], 2 }
+			{ &bitmap_bulb_ignore, 0 },
+			{ &bitmap_bulb_off, 1 },
+			{ &bitmap_bulb_on, 2 }
 		}
 	};
 	ImageOptionsField options_rc {
 		{ 133, 166, 24, 24 },
 		{
-			{ &bulb_ignore_bmp[0], 0 },
-			{ &bulb_off_bmp[0], 1 },
-			{ &bulb_on_bmp[0], 2 }
+			{ &bitmap_bulb_ignore, 0 },
+			{ &bitmap_bulb_off, 1 },
+			{ &bitmap_bulb_on, 2 }
 		}
 	};
 	ImageOptionsField options_rd {
 		{ 186, 166, 24, 24 },
 		{
-			{ &bulb_ignore_bmp[0], 0 },
-			{ &bulb_off_bmp[0], 1 },
-			{ &bulb_on_bmp[0], 2 }
+			{ &bitmap_bulb_ignore, 0 },
+			{ &bitmap_bulb_off, 1 },
+			{ &bitmap_bulb_on, 2 }
 		}
 	};
 	
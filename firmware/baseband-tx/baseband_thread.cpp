@@ -39,6 +39,7 @@
 #include "i2s.hpp"
 
 #include "portapack_shared_memory.hpp"
+#include "module_info.hpp"
 
 #include <array>
 
@@ -46,6 +47,17 @@ static baseband::SGPIO baseband_sgpio;
 
 WORKING_AREA(baseband_thread_wa, 4096);
 
+/* Read from the image by make_baseband_file.py. The modes must be the
+ * ones create_processor() handles. Volatile, so the linker keeps it.
+ */
+const volatile ModuleInfo module_info {
+	module_info_magic,
+	module_abi_version,
+	sizeof(ModuleInfo),
+	shared_memory_layout_hash,
+	mode_mask(0, 1, 2, 3, 4, 5),
+};
+
 Thread* BasebandThread::start(const tprio_t priority) {
 	return chThdCreateStatic(baseband_thread_wa, sizeof(baseband_thread_wa),
 		priority, ThreadBase::fn,
@@ -62,7 +74,9 @@ void BasebandThread::set_configuration(const BasebandConfiguration& new_configur
 		baseband_processor = nullptr;
 		delete old_p;
 
-		baseband_processor = create_processor(new_configuration.mode);
+		if( module_info.supports(new_configuration.mode) ) {
+			baseband_processor = create_processor(new_configuration.mode);
+		}
 
 		enable();
 	}
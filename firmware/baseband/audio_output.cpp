@@ -41,6 +41,21 @@ void AudioOutput::configure(
 	squelch.set_threshold(squelch_threshold);
 }
 
+void AudioOutput::configure_ctcss(const uint32_t tone, const size_t sampling_rate) {
+	tone_squelch.configure(tone * 0.1f, sampling_rate);
+}
+
+AudioOutput::SquelchCounts AudioOutput::take_squelch_counts() {
+	const auto counts = squelch_counts;
+	squelch_counts = { 0, 0 };
+	return counts;
+}
+
+void AudioOutput::reset_squelch() {
+	audio_present_history = 0;
+	squelch_counts = { 0, 0 };
+}
+
 void AudioOutput::write(
 	const buffer_s16_t& audio
 ) {
@@ -69,7 +84,11 @@ void AudioOutput::write(
 void AudioOutput::on_block(
 	const buffer_f32_t& audio
 ) {
-	const auto audio_present_now = squelch.execute(audio);
+	const auto noise_squelch_open = squelch.execute(audio);
+	const auto tone_squelch_open = tone_squelch.execute(audio);
+	const auto audio_present_now = noise_squelch_open && tone_squelch_open;
+	squelch_counts.blocks++;
+	squelch_counts.open += audio_present_now ? 1 : 0;
 
 	hpf.execute_in_place(audio);
 	deemph.execute_in_place(audio);
@@ -42,6 +42,9 @@ public:
 		const float squelch_threshold = 0.0f
 	);
 
+	/* Tenths of a hertz, zero for none. */
+	void configure_ctcss(const uint32_t tone, const size_t sampling_rate);
+
 	void write(const buffer_s16_t& audio);
 	void write(const buffer_f32_t& audio);
 
@@ -49,6 +52,21 @@ public:
 		stream = std::move(new_stream);
 	}
 
+	struct SquelchCounts {
+		size_t blocks;
+		size_t open;
+	};
+
+	/* Blocks squelched, and how many of them had audio present, since the
+	 * last call.
+	 */
+	SquelchCounts take_squelch_counts();
+
+	/* Forgets squelch history and counts, so audio from before a retune
+	 * neither holds the squelch open nor gets counted.
+	 */
+	void reset_squelch();
+
 private:
 	static constexpr float k = 32768.0f;
 	static constexpr float ki = 1.0f / k;
@@ -58,12 +76,14 @@ private:
 	IIRBiquadFilter hpf;
 	IIRBiquadFilter deemph;
 	FMSquelch squelch;
+	ToneSquelch tone_squelch;
 
 	std::unique_ptr<StreamInput> stream;
 
 	AudioStatsCollector audio_stats;
 
 	uint64_t audio_present_history = 0;
+	SquelchCounts squelch_counts { 0, 0 };
 
 	void on_block(const buffer_f32_t& audio);
 	void fill_audio_buffer(const buffer_f32_t& audio, const bool send_to_fifo);
@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 2016 Jared Boone, ShareBrained Technology, Inc.
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "baseband_agc.hpp"
+
+#include "lpc43xx_cpp.hpp"
+using namespace lpc43xx;
+
+namespace baseband {
+namespace agc {
+
+namespace {
+
+AGCReport* report = nullptr;
+
+/* Reports clear the saturation flag, so remember it for the statistics. */
+bool saturation_latched = false;
+
+/* Raised by the RSSI thread, reset by the baseband thread. Losing a race
+ * between the two only drops one peak from one report.
+ */
+volatile uint32_t rssi_max = 0;
+
+} /* namespace */
+
+void set_report(AGCReport* const new_report) {
+	report = new_report;
+	rssi_max = 0;
+}
+
+void on_channel_statistics(const ChannelStatistics& statistics) {
+	if( report == nullptr ) {
+		return;
+	}
+
+	const bool saturation = m4::flag_saturation();
+	m4::clear_flag_saturation();
+	saturation_latched |= saturation;
+
+	report->channel_max_db = statistics.max_db;
+	report->rssi_max = rssi_max;
+	report->saturation = saturation;
+	report->sequence = report->sequence + 1;
+	rssi_max = 0;
+
+	creg::m4txevent::assert();
+}
+
+void on_rssi_statistics(const RSSIStatistics& statistics) {
+	if( statistics.max > rssi_max ) {
+		rssi_max = statistics.max;
+	}
+}
+
+bool take_saturation() {
+	const bool saturation = saturation_latched || m4::flag_saturation();
+	m4::clear_flag_saturation();
+	saturation_latched = false;
+	return saturation;
+}
+
+} /* namespace agc */
+} /* namespace baseband */
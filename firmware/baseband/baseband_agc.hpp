@@ -0,0 +1,51 @@
+/*
+ * Copyright (C) 2016 Jared Boone, ShareBrained Technology, Inc.
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __BASEBAND_AGC_H__
+#define __BASEBAND_AGC_H__
+
+#include "message.hpp"
+
+namespace baseband {
+namespace agc {
+
+/* Where to publish measurements for the application's AGC loop, or
+ * nullptr to stop publishing.
+ */
+void set_report(AGCReport* const report);
+
+/* Publishes a report. Call from the baseband thread, whose saturation
+ * flag the report carries.
+ */
+void on_channel_statistics(const ChannelStatistics& statistics);
+
+/* Call from the RSSI thread. Peaks are carried into the next report. */
+void on_rssi_statistics(const RSSIStatistics& statistics);
+
+/* Returns whether the baseband thread saturated since the last call,
+ * including saturation already consumed by a report. Baseband thread only.
+ */
+bool take_saturation();
+
+} /* namespace agc */
+} /* namespace baseband */
+
+#endif/*__BASEBAND_AGC_H__*/
@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2016 Jared Boone, ShareBrained Technology, Inc.
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "baseband_arena.hpp"
+
+#include "chibios_cpp.hpp"
+
+#include <ch.h>
+
+namespace baseband {
+namespace arena {
+
+static MemoryHeap heap;
+static void* base = nullptr;
+static size_t arena_size = 0;
+static size_t arena_peak = 0;
+
+void init() {
+	arena_size = MEM_ALIGN_PREV(chCoreStatus());
+	base = chCoreAlloc(arena_size);
+	if( base ) {
+		chHeapInit(&heap, base, arena_size);
+	} else {
+		arena_size = 0;
+	}
+}
+
+void reset() {
+	if( base ) {
+		chHeapInit(&heap, base, arena_size);
+		chibios::set_allocation_heap(&heap);
+	}
+	arena_peak = used();
+}
+
+void update() {
+	const auto used_now = used();
+	if( used_now > arena_peak ) {
+		arena_peak = used_now;
+	}
+}
+
+size_t size() {
+	return arena_size;
+}
+
+size_t used() {
+	if( base == nullptr ) {
+		return 0;
+	}
+
+	size_t free_size = 0;
+	chHeapStatus(&heap, &free_size);
+	return arena_size - free_size;
+}
+
+size_t peak() {
+	return arena_peak;
+}
+
+} /* namespace arena */
+} /* namespace baseband */
@@ -0,0 +1,53 @@
+/*
+ * Copyright (C) 2016 Jared Boone, ShareBrained Technology, Inc.
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __BASEBAND_ARENA_H__
+#define __BASEBAND_ARENA_H__
+
+#include <cstddef>
+
+namespace baseband {
+namespace arena {
+
+/* Takes all memory the core allocator has left as the processor arena.
+ * Call once, after the fixed boot-time allocations are done.
+ */
+void init();
+
+/* Starts a fresh arena for a new processor: everything allocated with new
+ * from here on comes from the arena, which is emptied in one go. Anything
+ * still allocated from the previous processor is forgotten.
+ */
+void reset();
+
+/* Samples arena usage into the peak. Call wherever processors allocate. */
+void update();
+
+size_t size();
+size_t used();
+
+/* Highest usage seen since the last reset(). */
+size_t peak();
+
+} /* namespace arena */
+} /* namespace baseband */
+
+#endif/*__BASEBAND_ARENA_H__*/
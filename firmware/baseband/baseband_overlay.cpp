@@ -0,0 +1,132 @@
+/*
+ * Copyright (C) 2016 Jared Boone, ShareBrained Technology, Inc.
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "baseband_overlay.hpp"
+
+#include "ch.h"
+
+#include "portapack_shared_memory.hpp"
+#include "utility.hpp"
+
+#include <array>
+#include <cstring>
+
+extern "C" {
+
+extern uint8_t __overlay_start__[];
+extern uint8_t __overlay_size__[];
+
+extern uint8_t __load_start_overlay_am_audio[], __load_stop_overlay_am_audio[];
+extern uint8_t __load_start_overlay_nfm_audio[], __load_stop_overlay_nfm_audio[];
+extern uint8_t __load_start_overlay_wfm_audio[], __load_stop_overlay_wfm_audio[];
+extern uint8_t __load_start_overlay_ais[], __load_stop_overlay_ais[];
+extern uint8_t __load_start_overlay_wideband_spectrum[], __load_stop_overlay_wideband_spectrum[];
+extern uint8_t __load_start_overlay_tpms[], __load_stop_overlay_tpms[];
+extern uint8_t __load_start_overlay_ert[], __load_stop_overlay_ert[];
+extern uint8_t __load_start_overlay_capture[], __load_stop_overlay_capture[];
+extern uint8_t __load_start_overlay_closecall[], __load_stop_overlay_closecall[];
+
+}
+
+namespace baseband {
+namespace overlay {
+
+namespace {
+
+/* Load addresses are offsets into the image, which starts at address
+ * zero like the resident code.
+ */
+struct Extent {
+	const uint8_t* const load_start;
+	const uint8_t* const load_stop;
+
+	size_t offset() const {
+		return reinterpret_cast<uint32_t>(load_start);
+	}
+
+	size_t size() const {
+		return load_stop - load_start;
+	}
+};
+
+/* In the same order as ID. */
+const std::array<Extent, 9> extents { {
+	{ __load_start_overlay_am_audio, __load_stop_overlay_am_audio },
+	{ __load_start_overlay_nfm_audio, __load_stop_overlay_nfm_audio },
+	{ __load_start_overlay_wfm_audio, __load_stop_overlay_wfm_audio },
+	{ __load_start_overlay_ais, __load_stop_overlay_ais },
+	{ __load_start_overlay_wideband_spectrum, __load_stop_overlay_wideband_spectrum },
+	{ __load_start_overlay_tpms, __load_stop_overlay_tpms },
+	{ __load_start_overlay_ert, __load_stop_overlay_ert },
+	{ __load_start_overlay_capture, __load_stop_overlay_capture },
+	{ __load_start_overlay_closecall, __load_stop_overlay_closecall },
+} };
+
+/* Module MD5, stored by make_baseband_file.py at the end of the resident code. */
+constexpr size_t image_hash_offset = 0x7ff0;
+constexpr size_t image_hash_size = 16;
+
+const Extent* loaded = nullptr;
+
+bool image_matches(const uint32_t image_base) {
+	/* Resident code runs from address zero */
+	return std::memcmp(
+		reinterpret_cast<const void*>(image_base + image_hash_offset),
+		reinterpret_cast<const void*>(image_hash_offset),
+		image_hash_size
+	) == 0;
+}
+
+} /* namespace */
+
+bool load(const ID id) {
+	const auto& extent = extents[toUType(id)];
+	if( loaded == &extent ) {
+		return true;
+	}
+
+	const uint32_t image_base = shared_memory.baseband_image_base;
+	if( (image_base == 0) || !image_matches(image_base) ) {
+		return false;
+	}
+
+	const size_t overlay_size = reinterpret_cast<size_t>(__overlay_size__);
+	if( extent.size() > overlay_size ) {
+		return false;
+	}
+
+	loaded = nullptr;
+	std::memcpy(
+		__overlay_start__,
+		reinterpret_cast<const void*>(image_base + extent.offset()),
+		extent.size()
+	);
+
+	/* Don't let the core run ahead into stale instructions */
+	__DSB();
+	__ISB();
+
+	loaded = &extent;
+	return true;
+}
+
+} /* namespace overlay */
+} /* namespace baseband */
@@ -0,0 +1,53 @@
+/*
+ * Copyright (C) 2016 Jared Boone, ShareBrained Technology, Inc.
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __BASEBAND_OVERLAY_H__
+#define __BASEBAND_OVERLAY_H__
+
+#include <cstdint>
+
+namespace baseband {
+namespace overlay {
+
+/* Processor code overlays, see baseband.ld. */
+enum class ID : uint8_t {
+	AMAudio,
+	NFMAudio,
+	WFMAudio,
+	AIS,
+	WidebandSpectrum,
+	TPMS,
+	ERT,
+	Capture,
+	CloseCall,
+};
+
+/* Copies an overlay into the overlay region from the baseband image in
+ * SPI flash, unless it's already there. Must only be called with no
+ * processor object alive, since the previous overlay is overwritten.
+ * Returns false if the image can't be read.
+ */
+bool load(const ID id);
+
+} /* namespace overlay */
+} /* namespace baseband */
+
+#endif/*__BASEBAND_OVERLAY_H__*/
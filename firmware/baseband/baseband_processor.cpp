@@ -22,6 +22,7 @@
 #include "baseband_processor.hpp"
 
 #include "portapack_shared_memory.hpp"
+#include "baseband_agc.hpp"
 
 #include "message.hpp"
 
@@ -29,6 +30,7 @@ void BasebandProcessor::feed_channel_stats(const buffer_c16_t& channel) {
 	channel_stats.feed(
 		channel,
 		[](const ChannelStatistics& statistics) {
+			baseband::agc::on_channel_statistics(statistics);
 			const ChannelStatisticsMessage channel_stats_message { statistics };
 			shared_memory.application_queue.push(channel_stats_message);
 		}
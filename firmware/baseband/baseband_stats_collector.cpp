@@ -21,7 +21,8 @@
 
 #include "baseband_stats_collector.hpp"
 
-#include "lpc43xx_cpp.hpp"
+#include "baseband_arena.hpp"
+#include "baseband_agc.hpp"
 
 bool BasebandStatsCollector::process(const buffer_c8_t& buffer) {
 	samples += buffer.count;
@@ -50,8 +51,11 @@ BasebandStatistics BasebandStatsCollector::capture_statistics() {
 	statistics.baseband_ticks = (baseband_ticks - last_baseband_ticks);
 	last_baseband_ticks = baseband_ticks;
 
-	statistics.saturation = lpc43xx::m4::flag_saturation();
-	lpc43xx::m4::clear_flag_saturation();
+	baseband::arena::update();
+	statistics.arena_size = baseband::arena::size();
+	statistics.arena_peak = baseband::arena::peak();
+
+	statistics.saturation = baseband::agc::take_saturation();
 
 	samples_last_report = samples;
 
@@ -41,15 +41,72 @@
 #include "proc_ert.hpp"
 #include "proc_capture.hpp"
 
+#include "baseband_overlay.hpp"
+#include "baseband_arena.hpp"
+#include "baseband_agc.hpp"
+
 #include "portapack_shared_memory.hpp"
+#include "module_info.hpp"
 
 #include <array>
+#include <new>
+#include <type_traits>
 
 static baseband::SGPIO baseband_sgpio;
 
 WORKING_AREA(baseband_thread_wa, 4096);
 
+/* All processors are constructed in this one slot instead of on the heap,
+ * so switching modes doesn't churn (and fragment) the heap. Only one
+ * processor overlay is loaded at a time, so one slot is all it takes.
+ */
+template<typename T>
+constexpr size_t max_sizeof() {
+	return sizeof(T);
+}
+
+template<typename T, typename U, typename... Rest>
+constexpr size_t max_sizeof() {
+	return (sizeof(T) > max_sizeof<U, Rest...>()) ? sizeof(T) : max_sizeof<U, Rest...>();
+}
+
+template<typename T>
+constexpr size_t max_alignof() {
+	return alignof(T);
+}
+
+template<typename T, typename U, typename... Rest>
+constexpr size_t max_alignof() {
+	return (alignof(T) > max_alignof<U, Rest...>()) ? alignof(T) : max_alignof<U, Rest...>();
+}
+
+template<typename... T>
+using slot_for = typename std::aligned_storage<max_sizeof<T...>(), max_alignof<T...>()>::type;
+
+static slot_for<
+	NarrowbandAMAudio, NarrowbandFMAudio, WidebandFMAudio, AISProcessor,
+	WidebandSpectrum, TPMSProcessor, ERTProcessor, CaptureProcessor,
+	CloseCallProcessor
+> processor_slot;
+
+/* Longest the main thread waits for the baseband thread to pick up a mode
+ * switch. Buffers arrive every few milliseconds while streaming.
+ */
+constexpr systime_t handover_timeout = MS2ST(100);
+
+/* Read from the image by make_baseband_file.py. The modes must be the
+ * ones create_processor() handles. Volatile, so the linker keeps it.
+ */
+const volatile ModuleInfo module_info {
+	module_info_magic,
+	module_abi_version,
+	sizeof(ModuleInfo),
+	shared_memory_layout_hash,
+	mode_mask(0, 1, 2, 3, 4, 5, 6, 7, 10),
+};
+
 Thread* BasebandThread::start(const tprio_t priority) {
+	chBSemInit(&handover_done, TRUE);
 	return chThdCreateStatic(baseband_thread_wa, sizeof(baseband_thread_wa),
 		priority, ThreadBase::fn,
 		this
@@ -58,16 +115,31 @@ Thread* BasebandThread::start(const tprio_t priority) {
 
 void BasebandThread::set_configuration(const BasebandConfiguration& new_configuration) {
 	if( new_configuration.mode != baseband_configuration.mode ) {
-		disable();
+		const bool supported = module_info.supports(new_configuration.mode);
+
+		if( baseband_processor && supported && request_handover(new_configuration.mode) ) {
+			/* Warm switch, streaming kept running. Stop it if the new
+			 * processor couldn't be created, same as a cold switch would.
+			 */
+			if( !baseband_processor ) {
+				disable();
+			}
+		} else {
+			if( baseband_processor ) {
+				disable();
+			}
 
-		// TODO: Timing problem around disabling DMA and nulling and deleting old processor
-		auto old_p = baseband_processor;
-		baseband_processor = nullptr;
-		delete old_p;
+			// TODO: Timing problem around disabling DMA and nulling and deleting old processor
+			destroy_processor();
 
-		baseband_processor = create_processor(new_configuration.mode);
+			if( supported ) {
+				baseband_processor = create_processor(new_configuration.mode);
+			}
 
-		enable();
+			if( baseband_processor ) {
+				enable();
+			}
+		}
 	}
 
 	baseband_configuration = new_configuration;
@@ -76,9 +148,12 @@ void BasebandThread::set_configuration(const BasebandConfiguration& new_configur
 void BasebandThread::on_message(const Message* const message) {
 	if( message->id == Message::ID::BasebandConfiguration ) {
 		set_configuration(reinterpret_cast<const BasebandConfigurationMessage*>(message)->configuration);
+	} else if( message->id == Message::ID::AGCConfig ) {
+		baseband::agc::set_report(reinterpret_cast<const AGCConfigMessage*>(message)->report);
 	} else {
 		if( baseband_processor ) {
 			baseband_processor->on_message(message);
+			baseband::arena::update();
 		}
 	}
 }
@@ -87,11 +162,14 @@ void BasebandThread::run() {
 	baseband_sgpio.init();
 	baseband::dma::init();
 
-	const auto baseband_buffer = std::make_unique<std::array<baseband::sample_t, 8192>>();
+	static std::array<baseband::sample_t, 8192> baseband_buffer;
 	baseband::dma::configure(
-		baseband_buffer->data(),
+		baseband_buffer.data(),
 		direction()
 	);
+
+	/* Whatever is left is for processors to allocate from. */
+	baseband::arena::init();
 	//baseband::dma::allocate(4, 2048);
 
 	BasebandStatsCollector stats {
@@ -105,6 +183,12 @@ void BasebandThread::run() {
 		// TODO: Place correct sampling rate into buffer returned here:
 		const auto buffer_tmp = baseband::dma::wait_for_rx_buffer();
 		if( buffer_tmp ) {
+			if( handover_pending ) {
+				// This buffer straddles the old and new mode, drop it.
+				handover();
+				continue;
+			}
+
 			buffer_c8_t buffer {
 				buffer_tmp.p, buffer_tmp.count, baseband_configuration.sampling_rate
 			};
@@ -123,37 +207,93 @@ void BasebandThread::run() {
 	}
 }
 
+/* Processor code lives in overlays, which must be loaded before the
+ * object is constructed. Each processor starts with an empty arena, since
+ * the previous one has been destroyed.
+ */
+template<typename T>
+static BasebandProcessor* create_overlaid(const baseband::overlay::ID id) {
+	if( !baseband::overlay::load(id) ) {
+		return nullptr;
+	}
+
+	baseband::arena::reset();
+	const auto p = new (&processor_slot) T();
+	baseband::arena::update();
+	return p;
+}
+
 BasebandProcessor* BasebandThread::create_processor(const int32_t mode) {
+	using baseband::overlay::ID;
+
 	switch(mode) {
-	case 0:		return new NarrowbandAMAudio();
-	case 1:		return new NarrowbandFMAudio();
-	case 2:		return new WidebandFMAudio();
-	case 3:		return new AISProcessor();
-	case 4:		return new WidebandSpectrum();
-	case 5:		return new TPMSProcessor();
-	case 6:		return new ERTProcessor();
-	case 7:		return new CaptureProcessor();
-	case 10:	return new CloseCallProcessor();
+	case 0:		return create_overlaid<NarrowbandAMAudio>(ID::AMAudio);
+	case 1:		return create_overlaid<NarrowbandFMAudio>(ID::NFMAudio);
+	case 2:		return create_overlaid<WidebandFMAudio>(ID::WFMAudio);
+	case 3:		return create_overlaid<AISProcessor>(ID::AIS);
+	case 4:		return create_overlaid<WidebandSpectrum>(ID::WidebandSpectrum);
+	case 5:		return create_overlaid<TPMSProcessor>(ID::TPMS);
+	case 6:		return create_overlaid<ERTProcessor>(ID::ERT);
+	case 7:		return create_overlaid<CaptureProcessor>(ID::Capture);
+	case 10:	return create_overlaid<CloseCallProcessor>(ID::CloseCall);
 	default:	return nullptr;
 	}
 }
 
-void BasebandThread::disable() {
-	if( baseband_processor ) {
-		i2s::i2s0::tx_mute();
-		baseband::dma::disable();
-		baseband_sgpio.streaming_disable();
-		rf::rssi::stop();
+void BasebandThread::destroy_processor() {
+	/* The destructor is overlay code too, so this must happen before the
+	 * next processor's overlay is loaded.
+	 */
+	auto old_p = baseband_processor;
+	baseband_processor = nullptr;
+	if( old_p ) {
+		old_p->~BasebandProcessor();
+	}
+}
+
+/* Runs on the main thread. Returns false if the baseband thread didn't take
+ * the switch (streaming stalled), in which case the caller switches cold.
+ */
+bool BasebandThread::request_handover(const int32_t mode) {
+	chBSemReset(&handover_done, TRUE);
+	handover_mode = mode;
+	handover_pending = true;
+
+	if( chBSemWaitTimeout(&handover_done, handover_timeout) == RDY_OK ) {
+		return true;
 	}
+
+	chSysLock();
+	const bool applied = !handover_pending;
+	handover_pending = false;
+	chSysUnlock();
+	return applied;
+}
+
+/* Runs on the baseband thread, between two buffers. The main thread is
+ * blocked in request_handover() meanwhile, so no messages reach the
+ * processor while it is being replaced.
+ */
+void BasebandThread::handover() {
+	destroy_processor();
+	baseband_processor = create_processor(handover_mode);
+
+	handover_pending = false;
+	chBSemSignal(&handover_done);
+}
+
+void BasebandThread::disable() {
+	i2s::i2s0::tx_mute();
+	baseband::dma::disable();
+	baseband_sgpio.streaming_disable();
+	rf::rssi::stop();
 }
 
 void BasebandThread::enable() {
-	if( baseband_processor ) {
-		if( direction() == baseband::Direction::Receive ) {
-			rf::rssi::start();
-		}
-		baseband_sgpio.configure(direction());
-		baseband::dma::enable(direction());
-		baseband_sgpio.streaming_enable();
+	if( direction() == baseband::Direction::Receive ) {
+		rf::rssi::start();
 	}
+	baseband_sgpio.configure(direction());
+	baseband::dma::enable(direction());
+	baseband_sgpio.streaming_enable();
 }
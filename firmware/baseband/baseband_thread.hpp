@@ -50,9 +50,20 @@ private:
 
 	BasebandConfiguration baseband_configuration;
 
+	/* Mode switch handed from the main thread to the baseband thread, which
+	 * swaps processors between two buffers while streaming keeps running.
+	 */
+	volatile bool handover_pending { false };
+	int32_t handover_mode { -1 };
+	BinarySemaphore handover_done;
+
 	void run() override;
 
 	BasebandProcessor* create_processor(const int32_t mode);
+	void destroy_processor();
+
+	bool request_handover(const int32_t mode);
+	void handover();
 
 	void disable();
 	void enable();
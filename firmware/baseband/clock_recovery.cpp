@@ -20,3 +20,8 @@
  */
 
 #include "clock_recovery.hpp"
+
+/* Shared by processors in different overlays, keep it resident
+ * (see baseband.ld).
+ */
+template class clock_recovery::ClockRecovery<clock_recovery::FixedErrorFilter>;
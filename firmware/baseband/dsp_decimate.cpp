@@ -648,9 +648,14 @@ buffer_s16_t FIR64AndDecimateBy2Real::execute(
 void FIRAndDecimateComplex::configure_common(
 	const size_t taps_count, const size_t decimation_factor
 ) {
-	samples_ = std::make_unique<samples_t>(taps_count);
-	taps_reversed_ = std::make_unique<taps_t>(taps_count);
-	taps_count_ = taps_count;
+	/* Reconfiguring with the same length (new taps on a retune or mode
+	 * change) keeps the buffers and the delay line contents.
+	 */
+	if( taps_count != taps_count_ ) {
+		samples_ = std::make_unique<samples_t>(taps_count);
+		taps_reversed_ = std::make_unique<taps_t>(taps_count);
+		taps_count_ = taps_count;
+	}
 	decimation_factor_ = decimation_factor;
 }
 
@@ -22,6 +22,7 @@
 #include "dsp_squelch.hpp"
 
 #include <cstdint>
+#include <cmath>
 #include <array>
 
 bool FMSquelch::execute(const buffer_f32_t& audio) {
@@ -51,3 +52,46 @@ bool FMSquelch::execute(const buffer_f32_t& audio) {
 void FMSquelch::set_threshold(const float new_value) {
 	threshold_squared = new_value * new_value;
 }
+
+bool ToneSquelch::execute(const buffer_f32_t& audio) {
+	if( window_length == 0 ) {
+		return true;
+	}
+
+	for(size_t i=0; i<audio.count; i++) {
+		lpf += lpf_k * (audio.p[i] - lpf);
+		energy += lpf * lpf;
+
+		const float s0 = lpf + coefficient * s1 - s2;
+		s2 = s1;
+		s1 = s0;
+
+		if( --remaining == 0 ) {
+			// A steady tone of amplitude A gives (A*N/2)^2 here, and A^2*N/2 of energy.
+			const float tone_power = s1 * s1 + s2 * s2 - coefficient * s1 * s2;
+			detected = tone_power > (detect_ratio * energy * window_length * 0.5f);
+
+			s1 = s2 = energy = 0.0f;
+			remaining = window_length;
+		}
+	}
+
+	return detected;
+}
+
+void ToneSquelch::configure(const float tone_hz, const size_t sampling_rate) {
+	if( (tone_hz <= 0.0f) || (sampling_rate == 0) ) {
+		window_length = 0;
+		return;
+	}
+
+	constexpr float sub_audio_cutoff = 300.0f;
+	constexpr float two_pi = 6.283185307f;
+
+	coefficient = 2.0f * std::cos(two_pi * tone_hz / sampling_rate);
+	lpf_k = 1.0f - std::exp(-two_pi * sub_audio_cutoff / sampling_rate);
+	window_length = sampling_rate * window_duration;
+	remaining = window_length;
+	lpf = s1 = s2 = energy = 0.0f;
+	detected = false;
+}
@@ -42,4 +42,31 @@ private:
 	IIRBiquadFilter non_audio_hpf { non_audio_hpf_config };
 };
 
+/* Open only while a CTCSS tone is present: a Goertzel filter on the
+ * sub-audio band, over windows long enough to tell neighbouring standard
+ * tones apart. Without a tone configured, always open.
+ */
+class ToneSquelch {
+public:
+	bool execute(const buffer_f32_t& audio);
+
+	void configure(const float tone_hz, const size_t sampling_rate);
+
+private:
+	static constexpr float window_duration = 0.4f;
+	/* Share of sub-audio energy the tone must have. */
+	static constexpr float detect_ratio = 0.25f;
+
+	float coefficient { 0.0f };
+	float lpf_k { 0.0f };
+	size_t window_length { 0 };
+	size_t remaining { 0 };
+
+	float lpf { 0.0f };
+	float s1 { 0.0f };
+	float s2 { 0.0f };
+	float energy { 0.0f };
+	bool detected { false };
+};
+
 #endif/*__DSP_SQUELCH_H__*/
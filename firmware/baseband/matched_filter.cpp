@@ -34,9 +34,11 @@ void MatchedFilter::configure(
 	const size_t taps_count,
 	const size_t decimation_factor
 ) {
-	samples_ = std::make_unique<samples_t>(taps_count);
-	taps_reversed_ = std::make_unique<taps_t>(taps_count);
-	taps_count_ = taps_count;
+	if( taps_count != taps_count_ ) {
+		samples_ = std::make_unique<samples_t>(taps_count);
+		taps_reversed_ = std::make_unique<taps_t>(taps_count);
+		taps_count_ = taps_count;
+	}
 	decimation_factor_ = decimation_factor;
 	output = 0;
 	std::reverse_copy(&taps[0], &taps[taps_count], &taps_reversed_[0]);
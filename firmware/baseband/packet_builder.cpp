@@ -20,3 +20,9 @@
  */
 
 #include "packet_builder.hpp"
+
+/* Processors in different overlays share these, so the copies they call
+ * must live in resident code (see baseband.ld).
+ */
+template class PacketBuilder<BitPattern, NeverMatch, FixedLength>;
+template class PacketBuilder<BitPattern, BitPattern, BitPattern>;
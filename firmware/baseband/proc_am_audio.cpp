@@ -41,7 +41,9 @@ void NarrowbandAMAudio::execute(const buffer_c8_t& buffer) {
 
 	auto audio = demodulate(channel_out);
 	audio_compressor.execute_in_place(audio);
+	scan_monitor.settle(audio, audio_output);
 	audio_output.write(audio);
+	scan_monitor.monitor(channel_out, audio_output);
 }
 
 buffer_f32_t NarrowbandAMAudio::demodulate(const buffer_c16_t& channel) {
@@ -66,6 +68,10 @@ void NarrowbandAMAudio::on_message(const Message* const message) {
 	case Message::ID::CaptureConfig:
 		capture_config(*reinterpret_cast<const CaptureConfigMessage*>(message));
 		break;
+
+	case Message::ID::ScanConfig:
+		scan_monitor.set_config(reinterpret_cast<const ScanConfigMessage*>(message)->config);
+		break;
 		
 	default:
 		break;
@@ -29,6 +29,7 @@
 #include "audio_compressor.hpp"
 
 #include "audio_output.hpp"
+#include "scan_monitor.hpp"
 #include "spectrum_collector.hpp"
 
 #include <cstdint>
@@ -67,6 +68,7 @@ private:
 	dsp::demodulate::SSB demod_ssb;
 	FeedForwardCompressor audio_compressor;
 	AudioOutput audio_output;
+	ScanMonitor scan_monitor;
 
 	SpectrumCollector channel_spectrum;
 
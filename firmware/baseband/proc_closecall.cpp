@@ -23,12 +23,34 @@
 
 #include "event_m4.hpp"
 
+#include "dsp_fft.hpp"
+#include "utility.hpp"
+
+#include "lpc43xx_cpp.hpp"
+using namespace lpc43xx;
+
 #include <cstdint>
 #include <cstddef>
 
 #include <array>
 
+CloseCallProcessor::CloseCallProcessor(
+) : sweep_fifo { sweep_fifo_data, SweepConfig::fifo_k }
+{
+}
+
+CloseCallProcessor::~CloseCallProcessor() {
+	if( sweep_config ) {
+		sweep_config->fifo = nullptr;
+	}
+}
+
 void CloseCallProcessor::execute(const buffer_c8_t& buffer) {
+	if( sweep_config ) {
+		sweep(buffer);
+		return;
+	}
+
 	if( phase == 0 ) {
 		std::fill(spectrum.begin(), spectrum.end(), 0);
 	}
@@ -60,8 +82,94 @@ void CloseCallProcessor::on_message(const Message* const message) {
 	case Message::ID::SpectrumStreamingConfig:
 		channel_spectrum.on_message(message);
 		break;
+
+	case Message::ID::SweepConfig:
+		sweep_config_changed(*reinterpret_cast<const SweepConfigMessage*>(message));
+		break;
 		
 	default:
 		break;
 	}
 }
+
+void CloseCallProcessor::sweep_config_changed(const SweepConfigMessage& message) {
+	if( sweep_config ) {
+		sweep_config->fifo = nullptr;
+	}
+
+	sweep_config = message.config;
+	sweep_fifo.reset_in();
+	sweep_captured = true;
+
+	if( sweep_config ) {
+		sweep_sequence = sweep_config->tuned_sequence;
+		sweep_config->fifo = &sweep_fifo;
+	}
+}
+
+void CloseCallProcessor::sweep(const buffer_c8_t& buffer) {
+	const uint32_t sequence = sweep_config->tuned_sequence;
+	if( sequence != sweep_sequence ) {
+		/* Retuned. Anything still in flight belongs to the previous slice. */
+		sweep_sequence = sequence;
+		sweep_slice = sweep_config->tuned_slice;
+		sweep_blocks = 0;
+		sweep_captured = false;
+		std::fill(sweep_power.begin(), sweep_power.end(), 0.0f);
+	}
+
+	if( sweep_captured ) {
+		return;
+	}
+
+	sweep_blocks++;
+	if( sweep_blocks <= sweep_config->settle_blocks ) {
+		return;
+	}
+
+	sweep_accumulate(buffer);
+
+	if( sweep_blocks >= (sweep_config->settle_blocks + sweep_config->capture_blocks) ) {
+		sweep_captured = true;
+
+		/* Let the application retune now, the next slice settles while
+		 * this one's spectrum is worked out.
+		 */
+		sweep_config->captured_sequence = sweep_sequence;
+		creg::m4txevent::assert();
+
+		sweep_publish();
+	}
+}
+
+void CloseCallProcessor::sweep_accumulate(const buffer_c8_t& buffer) {
+	for(size_t i=0; i<sweep_frame.size(); i++) {
+		const size_t i_rev = __RBIT(i) >> (32 - log_2(sweep_frame.size()));
+		const auto s = buffer.p[i];
+		sweep_frame[i_rev] = { static_cast<float>(s.real()), static_cast<float>(s.imag()) };
+	}
+	fft_c_preswapped(sweep_frame);
+
+	for(size_t i=0; i<sweep_power.size(); i++) {
+		// Three point Hamming window, as SpectrumCollector does.
+		const auto corrected_sample = sweep_frame[i] * 0.54f
+			+ (sweep_frame[(i-1) & 0xff] + sweep_frame[(i+1) & 0xff]) * -0.23f;
+		sweep_power[i] += magnitude_squared(corrected_sample * (1.0f / 128.0f));
+	}
+}
+
+void CloseCallProcessor::sweep_publish() {
+	SweepSlice slice;
+	slice.index = sweep_slice;
+
+	const float power_scale = 1.0f / sweep_config->capture_blocks;
+	for(size_t i=0; i<slice.db.size(); i++) {
+		const float db = mag2_to_dbv_norm(sweep_power[i] * power_scale);
+		constexpr float mag_scale = 5.0f;
+		const unsigned int v = (db * mag_scale) + 255.0f;
+		slice.db[i] = std::max(0U, std::min(255U, v));
+	}
+
+	sweep_fifo.in(slice);
+	creg::m4txevent::assert();
+}
@@ -33,6 +33,9 @@
 
 class CloseCallProcessor : public BasebandProcessor {
 public:
+	CloseCallProcessor();
+	~CloseCallProcessor();
+
 	void execute(const buffer_c8_t& buffer) override;
 
 	void on_message(const Message* const message) override;
@@ -43,6 +46,21 @@ private:
 	std::array<complex16_t, 256> spectrum;
 
 	size_t phase = 0;
+
+	SweepConfig* sweep_config { nullptr };
+	SweepSliceFIFO sweep_fifo;
+	SweepSlice sweep_fifo_data[1 << SweepConfig::fifo_k];
+	std::array<std::complex<float>, 256> sweep_frame;
+	std::array<float, 256> sweep_power;
+	uint32_t sweep_sequence { 0 };
+	uint32_t sweep_slice { 0 };
+	size_t sweep_blocks { 0 };
+	bool sweep_captured { true };
+
+	void sweep(const buffer_c8_t& buffer);
+	void sweep_accumulate(const buffer_c8_t& buffer);
+	void sweep_publish();
+	void sweep_config_changed(const SweepConfigMessage& message);
 };
 
 #endif/*__PROC_CLOSECALLPROCESSOR_H__*/
@@ -39,7 +39,9 @@ void NarrowbandFMAudio::execute(const buffer_c8_t& buffer) {
 	channel_spectrum.feed(channel_out, channel_filter_pass_f, channel_filter_stop_f);
 
 	auto audio = demod.execute(channel_out, audio_buffer);
+	scan_monitor.settle(audio, audio_output);
 	audio_output.write(audio);
+	scan_monitor.monitor(channel_out, audio_output);
 }
 
 void NarrowbandFMAudio::on_message(const Message* const message) {
@@ -56,6 +58,10 @@ void NarrowbandFMAudio::on_message(const Message* const message) {
 	case Message::ID::CaptureConfig:
 		capture_config(*reinterpret_cast<const CaptureConfigMessage*>(message));
 		break;
+
+	case Message::ID::ScanConfig:
+		scan_monitor.set_config(reinterpret_cast<const ScanConfigMessage*>(message)->config);
+		break;
 		
 	default:
 		break;
@@ -82,6 +88,7 @@ void NarrowbandFMAudio::configure(const NBFMConfigureMessage& message) {
 	channel_filter_stop_f = message.channel_filter.stop_frequency_normalized * channel_filter_input_fs;
 	channel_spectrum.set_decimation_factor(std::floor(channel_filter_output_fs / (channel_filter_pass_f + channel_filter_stop_f)));
 	audio_output.configure(message.audio_hpf_config, message.audio_deemph_config, 0.8f);
+	audio_output.configure_ctcss(message.ctcss_tone, demod_input_fs);
 
 	configured = true;
 }
@@ -28,6 +28,7 @@
 #include "dsp_demodulate.hpp"
 
 #include "audio_output.hpp"
+#include "scan_monitor.hpp"
 #include "spectrum_collector.hpp"
 
 #include <cstdint>
@@ -61,6 +62,7 @@ private:
 	dsp::demodulate::FM demod;
 
 	AudioOutput audio_output;
+	ScanMonitor scan_monitor;
 
 	SpectrumCollector channel_spectrum;
 
@@ -24,6 +24,7 @@
 #include "rssi.hpp"
 #include "rssi_dma.hpp"
 #include "rssi_stats_collector.hpp"
+#include "baseband_agc.hpp"
 
 #include "message.hpp"
 #include "portapack_shared_memory.hpp"
@@ -53,6 +54,7 @@ void RSSIThread::run() {
 		stats.process(
 			buffer,
 			[](const RSSIStatistics& statistics) {
+				baseband::agc::on_rssi_statistics(statistics);
 				const RSSIStatisticsMessage message { statistics };
 				shared_memory.application_queue.push(message);
 			}
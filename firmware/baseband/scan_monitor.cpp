@@ -0,0 +1,111 @@
+/*
+ * Copyright (C) 2016 Jared Boone, ShareBrained Technology, Inc.
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "scan_monitor.hpp"
+
+#include "utility.hpp"
+
+#include "lpc43xx_cpp.hpp"
+using namespace lpc43xx;
+
+#include <hal.h>
+
+#include <algorithm>
+
+void ScanMonitor::set_config(ScanConfig* const new_config) {
+	config = new_config;
+	sequence = config ? config->tuned_sequence : 0;
+	settle_remaining = 0;
+}
+
+void ScanMonitor::settle(const buffer_f32_t& audio, AudioOutput& audio_output) {
+	if( config == nullptr ) {
+		return;
+	}
+
+	if( config->tuned_sequence != sequence ) {
+		sequence = config->tuned_sequence;
+		settle_remaining = config->settle_blocks + 1;
+	}
+
+	if( settle_remaining > 0 ) {
+		if( --settle_remaining > 0 ) {
+			// Filters are still full of the previous channel.
+			for(size_t i=0; i<audio.count; i++) {
+				audio.p[i] = 0;
+			}
+		} else {
+			restart(audio_output);
+		}
+	}
+}
+
+void ScanMonitor::monitor(const buffer_c16_t& channel, AudioOutput& audio_output) {
+	if( (config == nullptr) || (settle_remaining > 0) ) {
+		return;
+	}
+
+	uint64_t sum = 0;
+	auto src_p = channel.p;
+	while(src_p < &channel.p[channel.count]) {
+		const uint32_t sample = *__SIMD32(src_p)++;
+		sum += __SMUAD(sample, sample);
+	}
+	power_sum += sum;
+	power_samples += channel.count;
+
+	const auto counts = audio_output.take_squelch_counts();
+	blocks += counts.blocks;
+	open_blocks += counts.open;
+
+	if( blocks >= config->detect_blocks ) {
+		config->channel_db = channel_db();
+		config->squelch_open = (open_blocks > 0);
+		config->report_sequence = sequence;
+		config->report_count = config->report_count + 1;
+		creg::m4txevent::assert();
+
+		blocks = 0;
+		open_blocks = 0;
+		power_sum = 0;
+		power_samples = 0;
+	}
+}
+
+/* Silence would be log(0); report it at the floor of the scale. */
+int32_t ScanMonitor::channel_db() const {
+	constexpr int32_t db_min = ScanConfig::channel_db_min;
+	if( (power_sum == 0) || (power_samples == 0) ) {
+		return db_min;
+	}
+	const float mean_squared = static_cast<float>(power_sum) / power_samples;
+	const int32_t db = mag2_to_dbv_norm(mean_squared * (1.0f / (32768.0f * 32768.0f)));
+	return std::max(db, db_min);
+}
+
+/* Nothing from before the retune counts towards the first decision. */
+void ScanMonitor::restart(AudioOutput& audio_output) {
+	audio_output.reset_squelch();
+	blocks = 0;
+	open_blocks = 0;
+	power_sum = 0;
+	power_samples = 0;
+}
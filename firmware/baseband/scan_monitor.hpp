@@ -0,0 +1,62 @@
+/*
+ * Copyright (C) 2016 Jared Boone, ShareBrained Technology, Inc.
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __SCAN_MONITOR_H__
+#define __SCAN_MONITOR_H__
+
+#include "dsp_types.hpp"
+#include "message.hpp"
+
+#include "audio_output.hpp"
+
+#include <cstdint>
+#include <cstddef>
+
+/* Channel scanning support for the audio processors, which keep running
+ * while the application retunes them. After each retune the audio is
+ * silenced for a few buffers, then every few audio blocks the channel's
+ * mean power and the squelch state are reported. The application judges
+ * the power against the channel's noise floor, as AM has no squelch.
+ */
+class ScanMonitor {
+public:
+	void set_config(ScanConfig* const new_config);
+
+	/* Call with each buffer's audio before it is written. */
+	void settle(const buffer_f32_t& audio, AudioOutput& audio_output);
+
+	/* Call with the buffer's channel after its audio was written. */
+	void monitor(const buffer_c16_t& channel, AudioOutput& audio_output);
+
+private:
+	ScanConfig* config { nullptr };
+	uint32_t sequence { 0 };
+	size_t settle_remaining { 0 };
+	size_t blocks { 0 };
+	size_t open_blocks { 0 };
+	uint64_t power_sum { 0 };
+	size_t power_samples { 0 };
+
+	int32_t channel_db() const;
+	void restart(AudioOutput& audio_output);
+};
+
+#endif/*__SCAN_MONITOR_H__*/
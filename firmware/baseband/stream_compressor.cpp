@@ -0,0 +1,177 @@
+/*
+ * Copyright (C) 2016 Jared Boone, ShareBrained Technology, Inc.
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "stream_compressor.hpp"
+
+#include <hal.h>
+
+/* BlockFloatIQCompressor ************************************************/
+
+void BlockFloatIQCompressor::encode() {
+	int32_t peak = 0;
+	for(const auto& s : samples) {
+		// Fold negative values so -128 and 127 both need 7 magnitude bits.
+		peak = std::max(peak, std::max(s.real() ^ (s.real() >> 15), s.imag() ^ (s.imag() >> 15)));
+	}
+
+	const size_t magnitude_bits = peak ? (32 - __builtin_clz(peak)) : 0;
+	const size_t shift = (magnitude_bits > 7) ? (magnitude_bits - 7) : 0;
+	const int32_t round = shift ? (1 << (shift - 1)) : 0;
+
+	auto p = block.data();
+	*(p++) = shift;
+	for(const auto& s : samples) {
+		*(p++) = __SSAT((s.real() + round) >> shift, 8);
+		*(p++) = __SSAT((s.imag() + round) >> shift, 8);
+	}
+}
+
+/* RiceAudioCompressor ***************************************************/
+
+namespace {
+
+class BitWriter {
+public:
+	constexpr BitWriter(
+		uint8_t* const p,
+		uint8_t* const end
+	) : p { p },
+		end { end }
+	{
+	}
+
+	/* Append the low n bits of value, n <= 24. */
+	void put(const uint32_t value, const size_t n) {
+		acc = (acc << n) | value;
+		bits += n;
+		while( bits >= 8 ) {
+			bits -= 8;
+			put_byte(acc >> bits);
+		}
+	}
+
+	void flush() {
+		if( bits ) {
+			put_byte(acc << (8 - bits));
+			bits = 0;
+		}
+	}
+
+	bool overflow() const {
+		return overflowed;
+	}
+
+	uint8_t* position() const {
+		return p;
+	}
+
+private:
+	uint8_t* p;
+	uint8_t* const end;
+	uint32_t acc { 0 };
+	size_t bits { 0 };
+	bool overflowed { false };
+
+	void put_byte(const uint32_t value) {
+		if( p < end ) {
+			*(p++) = value;
+		} else {
+			overflowed = true;
+		}
+	}
+};
+
+inline int32_t residual(const int16_t* const x, const size_t i, const size_t order) {
+	switch(order) {
+	case 0:  return x[i];
+	case 1:  return x[i] - x[i - 1];
+	default: return x[i] - 2 * x[i - 1] + x[i - 2];
+	}
+}
+
+inline uint32_t zigzag(const int32_t r) {
+	return (r << 1) ^ (r >> 31);
+}
+
+} /* namespace */
+
+size_t RiceAudioCompressor::encode() {
+	constexpr size_t order_count = 3;
+	const int16_t* const x = samples.data();
+
+	std::array<uint32_t, order_count> sums { };
+	for(size_t i=order_count-1; i<frame_samples; i++) {
+		for(size_t order=0; order<order_count; order++) {
+			sums[order] += zigzag(residual(x, i, order));
+		}
+	}
+	const size_t order = std::min_element(sums.begin(), sums.end()) - sums.begin();
+
+	size_t k = 0;
+	while( (k < 15) && ((frame_samples << k) < sums[order]) ) {
+		k++;
+	}
+
+	frame[2] = (order << 5) | k;
+	auto warm_up = &frame[3];
+	for(size_t i=0; i<order; i++) {
+		*(warm_up++) = x[i] & 0xff;
+		*(warm_up++) = (x[i] >> 8) & 0xff;
+	}
+
+	BitWriter writer { warm_up, frame.data() + frame.size() };
+	for(size_t i=order; i<frame_samples; i++) {
+		const uint32_t u = zigzag(residual(x, i, order));
+		const uint32_t q = u >> k;
+		if( q < escape_quotient ) {
+			writer.put(((1U << q) - 1) << 1, q + 1);
+			writer.put(u & ((1U << k) - 1), k);
+		} else {
+			writer.put((1U << escape_quotient) - 1, escape_quotient);
+			writer.put(u, escape_bits);
+		}
+		if( writer.overflow() ) {
+			return encode_verbatim();
+		}
+	}
+	writer.flush();
+
+	const size_t frame_bytes = writer.position() - frame.data();
+	if( writer.overflow() || (frame_bytes >= verbatim_bytes) ) {
+		return encode_verbatim();
+	}
+
+	frame[0] = frame_bytes & 0xff;
+	frame[1] = frame_bytes >> 8;
+	return frame_bytes;
+}
+
+size_t RiceAudioCompressor::encode_verbatim() {
+	frame[0] = verbatim_bytes & 0xff;
+	frame[1] = verbatim_bytes >> 8;
+	frame[2] = 0xff;
+	auto p = &frame[3];
+	for(const auto v : samples) {
+		*(p++) = v & 0xff;
+		*(p++) = (v >> 8) & 0xff;
+	}
+	return verbatim_bytes;
+}
@@ -0,0 +1,120 @@
+/*
+ * Copyright (C) 2016 Jared Boone, ShareBrained Technology, Inc.
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __STREAM_COMPRESSOR_H__
+#define __STREAM_COMPRESSOR_H__
+
+#include "complex.hpp"
+
+#include <cstdint>
+#include <cstddef>
+#include <array>
+#include <algorithm>
+
+/* Compressors used by StreamInput to shrink sample streams before they
+ * reach the capture FIFO. Each emits self-contained blocks, so a block
+ * dropped because the FIFO was full costs only its own samples. Host
+ * decoder: tools/capture_decode.py.
+ */
+
+/* Block floating point for complex16: every block_samples samples share
+ * one shift, chosen so the largest component fits in 8 bits.
+ *
+ * Block: u8 shift, then block_samples x (s8 I, s8 Q).
+ * Decode: I = s8 << shift.
+ */
+class BlockFloatIQCompressor {
+public:
+	static constexpr size_t block_samples = 64;
+	static constexpr size_t block_bytes = 1 + block_samples * 2;
+
+	template<typename BlockCallback>
+	void feed(const complex16_t* p, size_t count, BlockCallback callback) {
+		while( count > 0 ) {
+			const size_t n = std::min(count, block_samples - samples_used);
+			std::copy(p, p + n, &samples[samples_used]);
+			samples_used += n;
+			p += n;
+			count -= n;
+
+			if( samples_used == block_samples ) {
+				encode();
+				callback(block.data(), block.size(), block_samples * sizeof(complex16_t));
+				samples_used = 0;
+			}
+		}
+	}
+
+private:
+	std::array<complex16_t, block_samples> samples;
+	size_t samples_used { 0 };
+	std::array<uint8_t, block_bytes> block;
+
+	void encode();
+};
+
+/* Lossless audio in the manner of FLAC's fixed predictors: each frame of
+ * frame_samples int16 samples uses the order 0, 1 or 2 predictor with the
+ * smallest residual, and codes residuals as zigzag Rice codes with one
+ * parameter for the frame. Frames that would not shrink are stored as-is.
+ *
+ * Frame: u16 frame length in bytes (little-endian, including itself),
+ *        u8 (order << 5) | k, or 0xff for a verbatim frame,
+ *        order x s16 warm-up samples (frame_samples for verbatim),
+ *        residuals, MSB first, padded to a byte.
+ * Residual: quotient (u >> k) in unary as ones ended by a zero, then the
+ *           low k bits. A run of escape_quotient ones is instead followed
+ *           by u in escape_bits bits.
+ */
+class RiceAudioCompressor {
+public:
+	static constexpr size_t frame_samples = 256;
+	static constexpr size_t verbatim_bytes = 3 + frame_samples * sizeof(int16_t);
+	static constexpr uint32_t escape_quotient = 24;
+	static constexpr uint32_t escape_bits = 18;
+
+	template<typename BlockCallback>
+	void feed(const int16_t* p, size_t count, BlockCallback callback) {
+		while( count > 0 ) {
+			const size_t n = std::min(count, frame_samples - samples_used);
+			std::copy(p, p + n, &samples[samples_used]);
+			samples_used += n;
+			p += n;
+			count -= n;
+
+			if( samples_used == frame_samples ) {
+				const size_t frame_bytes = encode();
+				callback(frame.data(), frame_bytes, frame_samples * sizeof(int16_t));
+				samples_used = 0;
+			}
+		}
+	}
+
+private:
+	std::array<int16_t, frame_samples> samples;
+	size_t samples_used { 0 };
+	std::array<uint8_t, verbatim_bytes> frame;
+
+	size_t encode();
+	size_t encode_verbatim();
+};
+
+#endif/*__STREAM_COMPRESSOR_H__*/
@@ -24,6 +24,7 @@
 
 #include "message.hpp"
 #include "fifo.hpp"
+#include "stream_compressor.hpp"
 
 #include "lpc43xx_cpp.hpp"
 using namespace lpc43xx;
@@ -41,20 +42,36 @@ public:
 		data { std::make_unique<uint8_t[]>(1UL << K) },
 		fifo { data.get(), K }
 	{
+		switch(config->compression) {
+		case CaptureConfig::Compression::BlockFloat8:
+			iq_compressor = std::make_unique<BlockFloatIQCompressor>();
+			break;
+
+		case CaptureConfig::Compression::Rice:
+			audio_compressor = std::make_unique<RiceAudioCompressor>();
+			break;
+
+		default:
+			break;
+		}
+
 		config->fifo = &fifo;
 	}
 
+	/* Samples are complex16 for BlockFloat8 and int16 for Rice. With
+	 * compression, the return value is the number of compressed bytes
+	 * that entered the FIFO.
+	 */
 	size_t write(const void* const data, const size_t length) {
-		const auto written = fifo.in(reinterpret_cast<const uint8_t*>(data), length);
-
-		const auto last_bytes_written = bytes_written;
-		bytes_written += written;
-		if( (bytes_written & event_bytes_mask) < (last_bytes_written & event_bytes_mask) ) {
-			creg::m4txevent::assert();
+		if( iq_compressor ) {
+			return compress(*iq_compressor, reinterpret_cast<const complex16_t*>(data), length / sizeof(complex16_t));
+		}
+		if( audio_compressor ) {
+			return compress(*audio_compressor, reinterpret_cast<const int16_t*>(data), length / sizeof(int16_t));
 		}
-		config->baseband_bytes_received += length;
-		config->baseband_bytes_dropped = config->baseband_bytes_received - bytes_written;
 
+		const auto written = fifo.in(reinterpret_cast<const uint8_t*>(data), length);
+		count(written, length, written);
 		return written;
 	}
 
@@ -63,8 +80,41 @@ private:
 	const size_t K;
 	const uint64_t event_bytes_mask;
 	uint64_t bytes_written = 0;
+	uint64_t source_bytes_written = 0;
 	std::unique_ptr<uint8_t[]> data;
 	FIFO<uint8_t> fifo;
+	std::unique_ptr<BlockFloatIQCompressor> iq_compressor;
+	std::unique_ptr<RiceAudioCompressor> audio_compressor;
+
+	/* A compressed block goes into the FIFO whole or not at all, so the
+	 * host decoder never sees a partial block.
+	 */
+	template<typename Compressor, typename T>
+	size_t compress(Compressor& compressor, const T* const samples, const size_t sample_count) {
+		size_t written = 0;
+		compressor.feed(samples, sample_count,
+			[this, &written](const uint8_t* const block, const size_t block_bytes, const size_t source_bytes) {
+				const bool fits = (fifo.unused() >= block_bytes);
+				if( fits ) {
+					fifo.in(block, block_bytes);
+					written += block_bytes;
+				}
+				this->count(fits ? block_bytes : 0, source_bytes, fits ? source_bytes : 0);
+			}
+		);
+		return written;
+	}
+
+	void count(const size_t written, const size_t source_length, const size_t source_written) {
+		const auto last_bytes_written = bytes_written;
+		bytes_written += written;
+		if( (bytes_written & event_bytes_mask) < (last_bytes_written & event_bytes_mask) ) {
+			creg::m4txevent::assert();
+		}
+		source_bytes_written += source_written;
+		config->baseband_bytes_received += source_length;
+		config->baseband_bytes_dropped = config->baseband_bytes_received - source_bytes_written;
+	}
 };
 
 #endif/*__STREAM_INPUT_H__*/
@@ -0,0 +1,286 @@
+/*
+    ChibiOS/RT - Copyright (C) 2006-2013 Giovanni Di Sirio
+                 Copyright (C) 2016 Jared Boone, ShareBrained Technology
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+/**
+ * @file    fatfs_cache.c
+ * @brief   Block device layer between FatFs diskio and the SDC driver.
+ */
+
+#include <string.h>
+
+#include "fatfs_cache.h"
+
+/*-----------------------------------------------------------------------*/
+/* Local variables and types.                                            */
+/*-----------------------------------------------------------------------*/
+
+typedef struct {
+  uint32_t data[MMCSD_BLOCK_SIZE / sizeof(uint32_t)];
+  DWORD sector;
+  uint32_t last_used;
+  bool_t valid;
+  bool_t dirty;
+} cache_entry_t;
+
+static cache_entry_t entries[FATFS_CACHE_ENTRIES];
+static uint32_t use_counter;
+
+static uint32_t gather_data[FATFS_CACHE_GATHER_BLOCKS * MMCSD_BLOCK_SIZE / sizeof(uint32_t)];
+static DWORD gather_sector;
+static UINT gather_count;
+
+static fatfs_cache_stats_t stats;
+
+/*-----------------------------------------------------------------------*/
+/* Local functions.                                                      */
+/*-----------------------------------------------------------------------*/
+
+static bool_t overlaps(DWORD a, UINT a_count, DWORD b, UINT b_count) {
+
+  return (a < (b + b_count)) && (b < (a + a_count));
+}
+
+static DRESULT card_read(SDCDriver *sdcp, BYTE *buff, DWORD sector, UINT count) {
+
+  while (count > 0) {
+    const UINT n = (count > FATFS_CACHE_MAX_TRANSFER) ? FATFS_CACHE_MAX_TRANSFER : count;
+    if (sdcRead(sdcp, sector, buff, n))
+      return RES_ERROR;
+    stats.card_reads++;
+    stats.blocks_read += n;
+    if (n > 1)
+      stats.multi_block_reads++;
+    buff += n * MMCSD_BLOCK_SIZE;
+    sector += n;
+    count -= n;
+  }
+  return RES_OK;
+}
+
+static DRESULT card_write(SDCDriver *sdcp, const BYTE *buff, DWORD sector, UINT count) {
+
+  while (count > 0) {
+    const UINT n = (count > FATFS_CACHE_MAX_TRANSFER) ? FATFS_CACHE_MAX_TRANSFER : count;
+    if (sdcWrite(sdcp, sector, buff, n))
+      return RES_ERROR;
+    stats.card_writes++;
+    stats.blocks_written += n;
+    if (n > 1)
+      stats.multi_block_writes++;
+    buff += n * MMCSD_BLOCK_SIZE;
+    sector += n;
+    count -= n;
+  }
+  return RES_OK;
+}
+
+static DRESULT gather_flush(SDCDriver *sdcp) {
+  DRESULT result = RES_OK;
+
+  if (gather_count > 0) {
+    result = card_write(sdcp, (const BYTE *)gather_data, gather_sector, gather_count);
+    gather_count = 0;
+  }
+  return result;
+}
+
+static BYTE *gather_block(UINT index) {
+
+  return (BYTE *)gather_data + index * MMCSD_BLOCK_SIZE;
+}
+
+static DRESULT entry_flush(SDCDriver *sdcp, cache_entry_t *e) {
+
+  if (e->valid && e->dirty) {
+    e->dirty = FALSE;
+    stats.write_backs++;
+    return card_write(sdcp, (const BYTE *)e->data, e->sector, 1);
+  }
+  return RES_OK;
+}
+
+static cache_entry_t *entry_find(DWORD sector) {
+  unsigned i;
+
+  for (i = 0; i < FATFS_CACHE_ENTRIES; i++) {
+    if (entries[i].valid && (entries[i].sector == sector))
+      return &entries[i];
+  }
+  return NULL;
+}
+
+static void entry_touch(cache_entry_t *e) {
+
+  e->last_used = ++use_counter;
+}
+
+static cache_entry_t *entry_victim(SDCDriver *sdcp) {
+  cache_entry_t *victim = &entries[0];
+  unsigned i;
+
+  for (i = 0; i < FATFS_CACHE_ENTRIES; i++) {
+    if (!entries[i].valid)
+      return &entries[i];
+    if (entries[i].last_used < victim->last_used)
+      victim = &entries[i];
+  }
+  if (entry_flush(sdcp, victim) != RES_OK)
+    return NULL;
+  victim->valid = FALSE;
+  return victim;
+}
+
+/*-----------------------------------------------------------------------*/
+/* Exported functions.                                                   */
+/*-----------------------------------------------------------------------*/
+
+DRESULT fatfs_cache_read(SDCDriver *sdcp, BYTE *buff, DWORD sector, UINT count) {
+  cache_entry_t *e;
+  unsigned i;
+
+  if (count == 1) {
+    if ((gather_count > 0) && overlaps(sector, 1, gather_sector, gather_count)) {
+      memcpy(buff, gather_block(sector - gather_sector), MMCSD_BLOCK_SIZE);
+      stats.read_hits++;
+      return RES_OK;
+    }
+
+    e = entry_find(sector);
+    if (e != NULL) {
+      memcpy(buff, e->data, MMCSD_BLOCK_SIZE);
+      entry_touch(e);
+      stats.read_hits++;
+      return RES_OK;
+    }
+
+    stats.read_misses++;
+    e = entry_victim(sdcp);
+    if (e == NULL)
+      return RES_ERROR;
+    if (card_read(sdcp, (BYTE *)e->data, sector, 1) != RES_OK)
+      return RES_ERROR;
+    e->sector = sector;
+    e->valid = TRUE;
+    e->dirty = FALSE;
+    entry_touch(e);
+    memcpy(buff, e->data, MMCSD_BLOCK_SIZE);
+    return RES_OK;
+  }
+
+  /* Anything newer than the card within the span goes out first.*/
+  if ((gather_count > 0) && overlaps(sector, count, gather_sector, gather_count)) {
+    if (gather_flush(sdcp) != RES_OK)
+      return RES_ERROR;
+  }
+  for (i = 0; i < FATFS_CACHE_ENTRIES; i++) {
+    if (entries[i].valid && overlaps(sector, count, entries[i].sector, 1)) {
+      if (entry_flush(sdcp, &entries[i]) != RES_OK)
+        return RES_ERROR;
+    }
+  }
+  return card_read(sdcp, buff, sector, count);
+}
+
+DRESULT fatfs_cache_write(SDCDriver *sdcp, const BYTE *buff, DWORD sector, UINT count) {
+  cache_entry_t *e;
+  unsigned i;
+
+  if (count == 1) {
+    e = entry_find(sector);
+    if (e != NULL) {
+      memcpy(e->data, buff, MMCSD_BLOCK_SIZE);
+      e->dirty = TRUE;
+      entry_touch(e);
+      stats.write_hits++;
+      return RES_OK;
+    }
+
+    if ((gather_count > 0) && overlaps(sector, 1, gather_sector, gather_count)) {
+      memcpy(gather_block(sector - gather_sector), buff, MMCSD_BLOCK_SIZE);
+      stats.write_hits++;
+      return RES_OK;
+    }
+
+    if ((gather_count > 0) &&
+        ((sector != (gather_sector + gather_count)) ||
+         (gather_count == FATFS_CACHE_GATHER_BLOCKS))) {
+      if (gather_flush(sdcp) != RES_OK)
+        return RES_ERROR;
+    }
+    if (gather_count == 0)
+      gather_sector = sector;
+    memcpy(gather_block(gather_count), buff, MMCSD_BLOCK_SIZE);
+    gather_count++;
+    stats.write_gathered++;
+    return RES_OK;
+  }
+
+  /* The span supersedes any pending copies of its sectors.*/
+  if ((gather_count > 0) && overlaps(sector, count, gather_sector, gather_count)) {
+    if (gather_flush(sdcp) != RES_OK)
+      return RES_ERROR;
+  }
+  for (i = 0; i < FATFS_CACHE_ENTRIES; i++) {
+    if (entries[i].valid && overlaps(sector, count, entries[i].sector, 1))
+      entries[i].valid = FALSE;
+  }
+  return card_write(sdcp, buff, sector, count);
+}
+
+DRESULT fatfs_cache_sync(SDCDriver *sdcp) {
+  DRESULT result = gather_flush(sdcp);
+  unsigned i;
+
+  /* Write back in ascending sector order.*/
+  for (;;) {
+    cache_entry_t *next = NULL;
+    for (i = 0; i < FATFS_CACHE_ENTRIES; i++) {
+      if (entries[i].valid && entries[i].dirty &&
+          ((next == NULL) || (entries[i].sector < next->sector)))
+        next = &entries[i];
+    }
+    if (next == NULL)
+      break;
+    if (entry_flush(sdcp, next) != RES_OK) {
+      next->valid = FALSE;
+      result = RES_ERROR;
+    }
+  }
+  return result;
+}
+
+void fatfs_cache_invalidate(void) {
+  unsigned i;
+
+  for (i = 0; i < FATFS_CACHE_ENTRIES; i++)
+    entries[i].valid = FALSE;
+  gather_count = 0;
+}
+
+void fatfs_cache_get_stats(fatfs_cache_stats_t *s) {
+
+  chSysLock();
+  *s = stats;
+  chSysUnlock();
+}
+
+void fatfs_cache_reset_stats(void) {
+
+  chSysLock();
+  memset(&stats, 0, sizeof(stats));
+  chSysUnlock();
+}
@@ -0,0 +1,87 @@
+/*
+    ChibiOS/RT - Copyright (C) 2006-2013 Giovanni Di Sirio
+                 Copyright (C) 2016 Jared Boone, ShareBrained Technology
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+    You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+*/
+
+/**
+ * @file    fatfs_cache.h
+ * @brief   Block device layer between FatFs diskio and the SDC driver.
+ *
+ * @details Single-sector reads (FAT, directory and partial file sectors)
+ *          are kept in a small LRU cache; writes to cached sectors are
+ *          held back until the next CTRL_SYNC or eviction. Single-sector
+ *          writes that miss the cache and follow each other on the card
+ *          are gathered and written with one multi-block command. Large
+ *          transfers go straight to the card, split to the driver's
+ *          maximum transaction size.
+ */
+
+#ifndef _FATFS_CACHE_H_
+#define _FATFS_CACHE_H_
+
+#include "ch.h"
+#include "hal.h"
+
+#include "diskio.h"
+
+/**
+ * @brief   Number of sectors held in the LRU cache.
+ */
+#if !defined(FATFS_CACHE_ENTRIES) || defined(__DOXYGEN__)
+#define FATFS_CACHE_ENTRIES         4
+#endif
+
+/**
+ * @brief   Number of consecutive sectors gathered into one write.
+ */
+#if !defined(FATFS_CACHE_GATHER_BLOCKS) || defined(__DOXYGEN__)
+#define FATFS_CACHE_GATHER_BLOCKS   4
+#endif
+
+/**
+ * @brief   Largest number of blocks the SDC driver moves in one command.
+ */
+#if !defined(FATFS_CACHE_MAX_TRANSFER) || defined(__DOXYGEN__)
+#define FATFS_CACHE_MAX_TRANSFER    (LPC_SDC_SDIO_DESCRIPTOR_COUNT * LPC_SDC_SDIO_MAX_DESCRIPTOR_BYTES / MMCSD_BLOCK_SIZE)
+#endif
+
+typedef struct {
+  uint32_t read_hits;
+  uint32_t read_misses;
+  uint32_t write_hits;
+  uint32_t write_gathered;
+  uint32_t write_backs;
+  uint32_t card_reads;
+  uint32_t card_writes;
+  uint32_t multi_block_reads;
+  uint32_t multi_block_writes;
+  uint32_t blocks_read;
+  uint32_t blocks_written;
+} fatfs_cache_stats_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+  DRESULT fatfs_cache_read(SDCDriver *sdcp, BYTE *buff, DWORD sector, UINT count);
+  DRESULT fatfs_cache_write(SDCDriver *sdcp, const BYTE *buff, DWORD sector, UINT count);
+  DRESULT fatfs_cache_sync(SDCDriver *sdcp);
+  void fatfs_cache_invalidate(void);
+  void fatfs_cache_get_stats(fatfs_cache_stats_t *stats);
+  void fatfs_cache_reset_stats(void);
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _FATFS_CACHE_H_ */
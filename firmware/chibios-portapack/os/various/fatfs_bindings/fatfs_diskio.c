@@ -12,6 +12,10 @@
 
 #include "diskio.h"
 
+#if HAL_USE_SDC
+#include "fatfs_cache.h"
+#endif
+
 #if HAL_USE_MMC_SPI && HAL_USE_SDC
 #error "cannot specify both MMC_SPI and SDC drivers"
 #endif
@@ -137,9 +141,7 @@ DRESULT disk_read (
   case SDC:
     if (blkGetDriverState(&SDCD1) != BLK_READY)
       return RES_NOTRDY;
-    if (sdcRead(&SDCD1, sector, buff, count))
-      return RES_ERROR;
-    return RES_OK;
+    return fatfs_cache_read(&SDCD1, buff, sector, count);
 #endif
   }
   return RES_PARERR;
@@ -181,9 +183,7 @@ DRESULT disk_write (
   case SDC:
     if (blkGetDriverState(&SDCD1) != BLK_READY)
       return RES_NOTRDY;
-    if (sdcWrite(&SDCD1, sector, buff, count))
-      return RES_ERROR;
-    return RES_OK;
+    return fatfs_cache_write(&SDCD1, buff, sector, count);
 #endif
   }
   return RES_PARERR;
@@ -224,7 +224,7 @@ DRESULT disk_ioctl (
   case SDC:
     switch (cmd) {
     case CTRL_SYNC:
-        return RES_OK;
+        return fatfs_cache_sync(&SDCD1);
     case GET_SECTOR_COUNT:
         *((DWORD *)buff) = mmcsdGetCardCapacity(&SDCD1);
         return RES_OK;
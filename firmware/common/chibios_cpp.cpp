@@ -25,12 +25,17 @@
 
 #include <ch.h>
 
+/* Heap that new allocates from, nullptr for the default heap. delete needs
+ * no such thing, chHeapFree() finds the heap from the block header.
+ */
+static MemoryHeap* allocation_heap = nullptr;
+
 void* operator new(size_t size) {
-	return chHeapAlloc(0x0, size);
+	return chHeapAlloc(allocation_heap, size);
 }
 
 void* operator new[](size_t size) {
-	return chHeapAlloc(0x0, size);
+	return chHeapAlloc(allocation_heap, size);
 }
 
 void operator delete(void* p) noexcept {
@@ -46,6 +51,10 @@ extern uint8_t __heap_end__[];
 
 namespace chibios {
 
+void set_allocation_heap(MemoryHeap* const heap) {
+	allocation_heap = heap;
+}
+
 size_t heap_size() {
 	return __heap_end__ - __heap_base__;
 }
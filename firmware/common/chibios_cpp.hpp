@@ -24,6 +24,8 @@
 
 #include <cstddef>
 
+#include <ch.h>
+
 /* Override new/delete to use Chibi/OS heap functions */
 /* NOTE: Do not inline these, it doesn't work. ;-) */
 void* operator new(size_t size);
@@ -33,6 +35,9 @@ void operator delete[](void* p);
 
 namespace chibios {
 
+/* Redirects new/new[] to another heap, nullptr restores the default. */
+void set_allocation_heap(MemoryHeap* const heap);
+
 size_t heap_size();
 size_t heap_used();
 
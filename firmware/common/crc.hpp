@@ -149,6 +149,36 @@ private:
 	}
 };
 
+/* Reflected CRC-32 as computed by zlib's crc32(), four bits at a time
+ * from a 16-entry table. Much faster than CRC<32, true, true> for bulk
+ * data, without the 1KiB table of a byte-wise implementation.
+ */
+class CRC32 {
+public:
+	void process_bytes(const void* const data, const size_t length) {
+		static constexpr uint32_t table[16] {
+			0x00000000, 0x1db71064, 0x3b6e20c8, 0x26d930ac,
+			0x76dc4190, 0x6b6b51f4, 0x4db26158, 0x5005713c,
+			0xedb88320, 0xf00f9344, 0xd6d6a3e8, 0xcb61b38c,
+			0x9b64c2b0, 0x86d3d2d4, 0xa00ae278, 0xbdbdf21c,
+		};
+
+		const uint8_t* const p = reinterpret_cast<const uint8_t*>(data);
+		for(size_t i=0; i<length; i++) {
+			remainder ^= p[i];
+			remainder = (remainder >> 4) ^ table[remainder & 0xf];
+			remainder = (remainder >> 4) ^ table[remainder & 0xf];
+		}
+	}
+
+	uint32_t checksum() const {
+		return ~remainder;
+	}
+
+private:
+	uint32_t remainder { 0xffffffff };
+};
+
 class Adler32 {
 public:
 	void feed(const uint8_t v) {
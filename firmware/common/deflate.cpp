@@ -0,0 +1,208 @@
+/*
+ * Copyright (C) 2016 Jared Boone, ShareBrained Technology, Inc.
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "deflate.hpp"
+
+#include <cstring>
+
+namespace {
+
+constexpr uint16_t length_base[29] {
+	3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+	35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258
+};
+
+constexpr uint8_t length_extra[29] {
+	0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+	3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0
+};
+
+constexpr uint16_t distance_base[30] {
+	1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+	257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577
+};
+
+constexpr uint8_t distance_extra[30] {
+	0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+	7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13
+};
+
+constexpr uint32_t end_of_block = 256;
+
+uint32_t hash(const uint8_t* const p) {
+	return ((p[0] << 6) ^ (p[1] << 3) ^ p[2]) & ((1U << 10) - 1);
+}
+
+uint32_t reverse_bits(uint32_t code, size_t length) {
+	uint32_t result = 0;
+	while(length--) {
+		result = (result << 1) | (code & 1);
+		code >>= 1;
+	}
+	return result;
+}
+
+} /* namespace */
+
+Deflate::Deflate(
+	output_t output
+) : output { output },
+	buffer { std::make_unique<uint8_t[]>(window_size * 2) },
+	head { std::make_unique<uint16_t[]>(hash_size) }
+{
+	// BFINAL=1, BTYPE=01 (fixed Huffman): one block for the whole stream.
+	write_bits(0b011, 3);
+}
+
+void Deflate::feed(const uint8_t* const data, size_t count) {
+	size_t offset = 0;
+	while(count) {
+		if( position == window_size * 2 ) {
+			slide();
+		}
+		const size_t chunk = std::min(count, window_size * 2 - position);
+		memcpy(&buffer[position], &data[offset], chunk);
+		compress(position, position + chunk);
+		position += chunk;
+		offset += chunk;
+		count -= chunk;
+	}
+}
+
+void Deflate::finish() {
+	write_symbol(end_of_block);
+	if( bit_count ) {
+		write_byte(bit_buffer & 0xff);
+		bit_buffer = 0;
+		bit_count = 0;
+	}
+	flush_output();
+}
+
+void Deflate::slide() {
+	memcpy(&buffer[0], &buffer[window_size], window_size);
+	position -= window_size;
+	for(size_t i=0; i<hash_size; i++) {
+		head[i] = (head[i] > window_size) ? (head[i] - window_size) : 0;
+	}
+}
+
+void Deflate::compress(const size_t start, const size_t end) {
+	size_t i = start;
+	while(i < end) {
+		size_t match_length = 0;
+		size_t match_distance = 0;
+
+		if( (end - i) >= match_min ) {
+			const auto h = hash(&buffer[i]);
+			const size_t candidate = head[h];
+			head[h] = i + 1;
+
+			if( candidate && ((i + 1 - candidate) <= window_size) ) {
+				const size_t limit = std::min(end - i, size_t { match_max });
+				const auto a = &buffer[candidate - 1];
+				const auto b = &buffer[i];
+				size_t length = 0;
+				while( (length < limit) && (a[length] == b[length]) ) {
+					length++;
+				}
+				if( length >= match_min ) {
+					match_length = length;
+					match_distance = i + 1 - candidate;
+				}
+			}
+		}
+
+		if( match_length ) {
+			write_match(match_length, match_distance);
+			// Index the positions covered by the match so later data can refer to them.
+			for(size_t j=i+1; (j<i+match_length) && ((end - j) >= match_min); j++) {
+				head[hash(&buffer[j])] = j + 1;
+			}
+			i += match_length;
+		} else {
+			write_literal(buffer[i]);
+			i++;
+		}
+	}
+}
+
+void Deflate::write_literal(const uint8_t value) {
+	write_symbol(value);
+}
+
+void Deflate::write_match(const size_t length, const size_t distance) {
+	size_t length_code = 28;
+	while( length_base[length_code] > length ) {
+		length_code--;
+	}
+	write_symbol(257 + length_code);
+	write_bits(length - length_base[length_code], length_extra[length_code]);
+
+	size_t distance_code = 29;
+	while( distance_base[distance_code] > distance ) {
+		distance_code--;
+	}
+	write_code(distance_code, 5);
+	write_bits(distance - distance_base[distance_code], distance_extra[distance_code]);
+}
+
+void Deflate::write_symbol(const uint32_t symbol) {
+	// Fixed literal/length code, RFC 1951 section 3.2.6.
+	if( symbol < 144 ) {
+		write_code(0x30 + symbol, 8);
+	} else if( symbol < 256 ) {
+		write_code(0x190 + (symbol - 144), 9);
+	} else if( symbol < 280 ) {
+		write_code(symbol - 256, 7);
+	} else {
+		write_code(0xc0 + (symbol - 280), 8);
+	}
+}
+
+void Deflate::write_code(const uint32_t code, const size_t length) {
+	// Huffman codes are packed starting from their most significant bit.
+	write_bits(reverse_bits(code, length), length);
+}
+
+void Deflate::write_bits(uint32_t value, const size_t count) {
+	bit_buffer |= value << bit_count;
+	bit_count += count;
+	while( bit_count >= 8 ) {
+		write_byte(bit_buffer & 0xff);
+		bit_buffer >>= 8;
+		bit_count -= 8;
+	}
+}
+
+void Deflate::write_byte(const uint8_t value) {
+	output_buffer[output_count++] = value;
+	if( output_count == output_buffer.size() ) {
+		flush_output();
+	}
+}
+
+void Deflate::flush_output() {
+	if( output_count ) {
+		output(output_buffer.data(), output_count);
+		output_count = 0;
+	}
+}
@@ -0,0 +1,78 @@
+/*
+ * Copyright (C) 2016 Jared Boone, ShareBrained Technology, Inc.
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __DEFLATE_H__
+#define __DEFLATE_H__
+
+#include <cstdint>
+#include <cstddef>
+#include <memory>
+#include <functional>
+#include <array>
+
+#include "utility.hpp"
+
+/* Streaming DEFLATE (RFC 1951) compressor sized for the M0: a single
+ * fixed-Huffman block, LZ77 over a 2 KiB window with a one-probe hash
+ * table. Input is matched only within data already fed, so matches
+ * never straddle feed() calls.
+ */
+class Deflate {
+public:
+	using output_t = std::function<void(const uint8_t* const data, const size_t count)>;
+
+	explicit Deflate(output_t output);
+
+	void feed(const uint8_t* const data, size_t count);
+	void finish();
+
+private:
+	static constexpr size_t window_size = 2048;
+	static constexpr size_t hash_bits = 10;
+	static constexpr size_t hash_size = 1 << hash_bits;
+	static constexpr size_t match_min = 3;
+	static constexpr size_t match_max = 258;
+	static constexpr size_t output_size = 64;
+
+	output_t output;
+
+	std::unique_ptr<uint8_t[]> buffer;		// 2 * window_size, slides down by window_size
+	std::unique_ptr<uint16_t[]> head;		// Position + 1 of last occurrence, 0 = none
+	size_t position { 0 };
+
+	uint32_t bit_buffer { 0 };
+	size_t bit_count { 0 };
+	std::array<uint8_t, output_size> output_buffer;
+	size_t output_count { 0 };
+
+	void slide();
+	void compress(const size_t start, const size_t end);
+
+	void write_literal(const uint8_t value);
+	void write_match(const size_t length, const size_t distance);
+	void write_symbol(const uint32_t symbol);
+	void write_bits(uint32_t value, const size_t count);
+	void write_code(const uint32_t code, const size_t length);
+	void write_byte(const uint8_t value);
+	void flush_output();
+};
+
+#endif/*__DEFLATE_H__*/
@@ -29,6 +29,7 @@ using namespace portapack;
 #include "ch.h"
 
 #include <complex>
+#include <algorithm>
 
 namespace lcd {
 
@@ -401,6 +402,54 @@ void ILI9341::drawBMP(const ui::Point p, const uint8_t * bitmap, const bool tran
 	}
 }
 
+void ILI9341::draw_run_bitmap(const ui::Point p, const ui::RunBitmap& bitmap) {
+	const ui::Dim width = bitmap.size.w;
+	const size_t count = width * bitmap.size.h;
+	const uint8_t* run = bitmap.runs;
+
+	if( bitmap.transparent_index < 0 ) {
+		// Opaque: one window for the whole image, runs wrap rows on their own.
+		lcd_start_ram_write(p, bitmap.size);
+		size_t remaining = count;
+		while(remaining) {
+			const auto code = *(run++);
+			const size_t length = ((code >> 4) == 15) ? (16 + *(run++)) : ((code >> 4) + 1);
+			io.lcd_write_pixels(bitmap.palette[code & 15], length);
+			remaining -= length;
+		}
+	} else {
+		// Transparent: open a window on each opaque span, keep it open
+		// across adjacent runs until a transparent run or the end of the row.
+		ui::Coord x = 0;
+		ui::Coord y = 0;
+		bool window_open = false;
+		while(y < bitmap.size.h) {
+			const auto code = *(run++);
+			const auto index = code & 15;
+			size_t length = ((code >> 4) == 15) ? (16 + *(run++)) : ((code >> 4) + 1);
+			while(length) {
+				const size_t span = std::min<size_t>(length, width - x);
+				if( index == bitmap.transparent_index ) {
+					window_open = false;
+				} else {
+					if( !window_open ) {
+						lcd_start_ram_write({ p.x + x, p.y + y }, { width - x, 1 });
+						window_open = true;
+					}
+					io.lcd_write_pixels(bitmap.palette[index], span);
+				}
+				x += span;
+				length -= span;
+				if( x == width ) {
+					x = 0;
+					y++;
+					window_open = false;
+				}
+			}
+		}
+	}
+}
+
 void ILI9341::draw_line(const ui::Point start, const ui::Point end, const ui::Color color) {
 	int x0 = start.x;
 	int y0 = start.y;
@@ -497,7 +546,38 @@ void ILI9341::draw_glyph(
 	const ui::Color foreground,
 	const ui::Color background
 ) {
-	draw_bitmap(p, glyph.size(), glyph.pixels(), foreground, background);
+	const ui::Dim width = glyph.advance().x;
+	if( (glyph.bpp() == 1) && (width == glyph.w()) ) {
+		draw_bitmap(p, glyph.size(), glyph.pixels(), foreground, background);
+		return;
+	}
+
+	// Coverage levels map through a ramp, only recomputed when colors change.
+	const uint32_t level_max = (1U << glyph.bpp()) - 1;
+	if( (foreground.v != glyph_ramp_foreground.v) ||
+	    (background.v != glyph_ramp_background.v) ||
+	    (level_max != glyph_ramp_levels) ) {
+		for(size_t i=0; i<=level_max; i++) {
+			glyph_ramp[i] = ui::blend(background, foreground, i, level_max);
+		}
+		glyph_ramp_foreground = foreground;
+		glyph_ramp_background = background;
+		glyph_ramp_levels = level_max;
+	}
+
+	// Glyphs narrower than their cell (proportional fonts) are cropped on the right.
+	lcd_start_ram_write(p, { width, glyph.h() });
+
+	const auto pixels = glyph.pixels();
+	const size_t row_bits = glyph.w() * glyph.bpp();
+	for(size_t y=0; y<static_cast<size_t>(glyph.h()); y++) {
+		size_t bit = y * row_bits;
+		for(size_t x=0; x<static_cast<size_t>(width); x++) {
+			const auto level = (pixels[bit >> 3] >> (bit & 7)) & level_max;
+			io.lcd_write_pixel(glyph_ramp[level]);
+			bit += glyph.bpp();
+		}
+	}
 }
 
 void ILI9341::scroll_set_area(
@@ -58,6 +58,7 @@ public:
 
 	void draw_pixel(const ui::Point p, const ui::Color color);
 	void drawBMP(const ui::Point p, const uint8_t * bitmap, const bool transparency);
+	void draw_run_bitmap(const ui::Point p, const ui::RunBitmap& bitmap);
 	void render_line(const ui::Point p, const uint8_t count, const ui::Color* line_buffer);
 	void render_box(const ui::Point p, const ui::Size s, const ui::Color* line_buffer);
 	
@@ -112,6 +113,11 @@ private:
 
 	scroll_t scroll_state;
 
+	ui::Color glyph_ramp[4] { };
+	ui::Color glyph_ramp_foreground { };
+	ui::Color glyph_ramp_background { };
+	uint32_t glyph_ramp_levels { 0 };
+
 	void draw_pixels(const ui::Rect r, const ui::Color* const colors, const size_t count);
 	void read_pixels(const ui::Rect r, ui::ColorRGB888* const colors, const size_t count);
 };
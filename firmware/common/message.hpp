@@ -71,6 +71,9 @@ public:
 		ModuleID = 24,
 		FIFOSignal = 25,
 		FIFOData = 26,
+		SweepConfig = 27,
+		AGCConfig = 28,
+		ScanConfig = 29,
 		MAX
 	};
 
@@ -107,6 +110,8 @@ struct BasebandStatistics {
 	uint32_t main_ticks { 0 };
 	uint32_t rssi_ticks { 0 };
 	uint32_t baseband_ticks { 0 };
+	uint32_t arena_size { 0 };
+	uint32_t arena_peak { 0 };
 	bool saturation { false };
 };
 
@@ -282,6 +287,119 @@ public:
 	ChannelSpectrumFIFO* fifo { nullptr };
 };
 
+/* The application retunes through a list of slices. After each retune the
+ * baseband drops settle_blocks buffers, then averages capture_blocks FFT
+ * frames into one SweepSlice, tagged with the slice index.
+ */
+struct SweepSlice {
+	uint32_t index { 0 };
+	std::array<uint8_t, 256> db { { 0 } };
+};
+
+using SweepSliceFIFO = FIFO<SweepSlice>;
+
+struct SweepConfig {
+	static constexpr size_t fifo_k = 3;
+
+	const size_t settle_blocks;
+	const size_t capture_blocks;
+	/* Application: written after each retune, slice before sequence. */
+	volatile uint32_t tuned_slice;
+	volatile uint32_t tuned_sequence;
+	/* Baseband: written when the tuned sequence has been captured, before
+	 * its spectrum is computed, so the next retune can settle meanwhile.
+	 */
+	volatile uint32_t captured_sequence;
+	SweepSliceFIFO* fifo;
+
+	SweepConfig(
+		const size_t settle_blocks,
+		const size_t capture_blocks
+	) : settle_blocks { settle_blocks },
+		capture_blocks { capture_blocks },
+		tuned_slice { 0 },
+		tuned_sequence { 0 },
+		captured_sequence { 0 },
+		fifo { nullptr }
+	{
+	}
+};
+
+class SweepConfigMessage : public Message {
+public:
+	constexpr SweepConfigMessage(
+		SweepConfig* const config
+	) : Message { ID::SweepConfig },
+		config { config }
+	{
+	}
+
+	SweepConfig* const config;
+};
+
+struct ScanConfig {
+	static constexpr int32_t channel_db_min = -120;
+
+	const size_t settle_blocks;			/* Baseband buffers not played after a retune */
+	const size_t detect_blocks;			/* Audio blocks per report */
+	/* Application: bumped after each retune. */
+	volatile uint32_t tuned_sequence;
+	/* Baseband: a report every detect_blocks, on the tuned sequence it was
+	 * measured on. report_count is bumped last.
+	 */
+	volatile uint32_t report_sequence;
+	volatile uint32_t report_count;
+	volatile int32_t channel_db;		/* Mean channel power, dBFS */
+	volatile bool squelch_open;			/* In any of the blocks */
+
+	ScanConfig(
+		const size_t settle_blocks,
+		const size_t detect_blocks
+	) : settle_blocks { settle_blocks },
+		detect_blocks { detect_blocks },
+		tuned_sequence { 0 },
+		report_sequence { 0 },
+		report_count { 0 },
+		channel_db { channel_db_min },
+		squelch_open { false }
+	{
+	}
+};
+
+class ScanConfigMessage : public Message {
+public:
+	constexpr ScanConfigMessage(
+		ScanConfig* const config
+	) : Message { ID::ScanConfig },
+		config { config }
+	{
+	}
+
+	ScanConfig* const config;
+};
+
+/* Filled in by the baseband at the channel statistics rate, read by the
+ * application's AGC loop. sequence is bumped last, once the rest is valid.
+ */
+struct AGCReport {
+	volatile uint32_t sequence { 0 };
+	volatile int32_t channel_max_db { -120 };
+	volatile uint32_t rssi_max { 0 };
+	volatile bool saturation { false };
+};
+
+class AGCConfigMessage : public Message {
+public:
+	constexpr AGCConfigMessage(
+		AGCReport* const report
+	) : Message { ID::AGCConfig },
+		report { report }
+	{
+	}
+
+	AGCReport* const report;
+};
+
 class AISPacketMessage : public Message {
 public:
 	constexpr AISPacketMessage(
@@ -350,7 +468,8 @@ public:
 		const size_t channel_decimation,
 		const size_t deviation,
 		const iir_biquad_config_t audio_hpf_config,
-		const iir_biquad_config_t audio_deemph_config
+		const iir_biquad_config_t audio_deemph_config,
+		const uint32_t ctcss_tone = 0
 	) : Message { ID::NBFMConfigure },
 		decim_0_filter(decim_0_filter),
 		decim_1_filter(decim_1_filter),
@@ -358,7 +477,8 @@ public:
 		channel_decimation { channel_decimation },
 		deviation { deviation },
 		audio_hpf_config(audio_hpf_config),
-		audio_deemph_config(audio_deemph_config)
+		audio_deemph_config(audio_deemph_config),
+		ctcss_tone { ctcss_tone }
 	{
 	}
 
@@ -369,6 +489,7 @@ public:
 	const size_t deviation;
 	const iir_biquad_config_t audio_hpf_config;
 	const iir_biquad_config_t audio_deemph_config;
+	const uint32_t ctcss_tone;	/* Tenths of a hertz, zero for none */
 };
 
 class WFMConfigureMessage : public Message {
@@ -431,17 +552,29 @@ public:
 };
 
 struct CaptureConfig {
+	/* Applied by the baseband before samples enter the FIFO. Received and
+	 * dropped byte counts always refer to the uncompressed samples.
+	 */
+	enum class Compression : uint32_t {
+		None = 0,
+		BlockFloat8 = 1,	// complex16 as 8-bit mantissas, shared exponent
+		Rice = 2,			// int16 audio, fixed predictor + Rice codes
+	};
+
 	const size_t write_size_log2;
 	const size_t buffer_count_log2;
+	const Compression compression;
 	uint64_t baseband_bytes_received;
 	uint64_t baseband_bytes_dropped;
 	FIFO<uint8_t>* fifo;
 
 	constexpr CaptureConfig(
 		const size_t write_size_log2,
-		const size_t buffer_count_log2
+		const size_t buffer_count_log2,
+		const Compression compression = Compression::None
 	) : write_size_log2 { write_size_log2 },
 		buffer_count_log2 { buffer_count_log2 },
+		compression { compression },
 		baseband_bytes_received { 0 },
 		baseband_bytes_dropped { 0 },
 		fifo { nullptr }
@@ -0,0 +1,117 @@
+/*
+ * Copyright (C) 2016 Jared Boone, ShareBrained Technology, Inc.
+ *
+ * This file is part of PortaPack.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2, or (at your option)
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; see the file COPYING.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __MODULE_INFO_H__
+#define __MODULE_INFO_H__
+
+#include <cstdint>
+#include <cstddef>
+
+#include "portapack_shared_memory.hpp"
+
+/* Describes what a baseband image expects of the application. Each image
+ * carries one; tools/make_baseband_file.py finds it by its magic and
+ * copies it into the module file header and the SPI flash module table,
+ * so the application can refuse an incompatible module before loading it.
+ */
+
+/* Bump when a change to messages or baseband behaviour makes modules
+ * and applications built before it incompatible with those built after.
+ */
+constexpr uint16_t module_abi_version = 2;
+
+constexpr uint32_t module_info_magic = 0x494d5050;	/* "PPMI" */
+
+constexpr uint32_t layout_hash(const uint32_t hash) {
+	return hash;
+}
+
+/* FNV-1a, one value at a time */
+template<typename... Values>
+constexpr uint32_t layout_hash(const uint32_t hash, const size_t value, const Values... values) {
+	return layout_hash((hash ^ static_cast<uint32_t>(value)) * 16777619U, values...);
+}
+
+/* Changes whenever the size or placement of anything in SharedMemory does. */
+constexpr uint32_t shared_memory_layout_hash = layout_hash(2166136261U,
+	sizeof(SharedMemory),
+	sizeof(MessageQueue),
+	offsetof(SharedMemory, baseband_queue),
+	offsetof(SharedMemory, baseband_queue_data),
+	offsetof(SharedMemory, application_queue),
+	offsetof(SharedMemory, application_queue_data),
+	offsetof(SharedMemory, touch_adc_frame),
+	offsetof(SharedMemory, test),
+	offsetof(SharedMemory, radio_data),
+	offsetof(SharedMemory, bit_length),
+	offsetof(SharedMemory, afsk_samples_per_bit),
+	offsetof(SharedMemory, afsk_phase_inc_mark),
+	offsetof(SharedMemory, afsk_phase_inc_space),
+	offsetof(SharedMemory, afsk_repeat),
+	offsetof(SharedMemory, afsk_fmmod),
+	offsetof(SharedMemory, afsk_transmit_done),
+	offsetof(SharedMemory, jammer_ranges),
+	offsetof(SharedMemory, xylosdata),
+	offsetof(SharedMemory, epardata),
+	offsetof(SharedMemory, excursion),
+	offsetof(SharedMemory, transmit_done),
+	offsetof(SharedMemory, baseband_image_base)
+);
+
+/* Bit mask of BasebandConfiguration::mode values. */
+constexpr uint32_t mode_mask() {
+	return 0;
+}
+
+template<typename... Modes>
+constexpr uint32_t mode_mask(const uint32_t mode, const Modes... modes) {
+	return (1U << mode) | mode_mask(modes...);
+}
+
+struct ModuleInfo {
+	uint32_t magic;
+	uint16_t abi_version;
+	uint16_t size;
+	uint32_t shared_memory_layout;
+	uint32_t modes;
+
+	bool is_compatible() const {
+		return (magic == module_info_magic)
+			&& (abi_version == module_abi_version)
+			&& (size == sizeof(ModuleInfo))
+			&& (shared_memory_layout == shared_memory_layout_hash);
+	}
+
+	bool supports(const int32_t mode) const volatile {
+		return (mode >= 0) && (mode < 32) && ((modes >> mode) & 1);
+	}
+};
+
+static_assert(sizeof(ModuleInfo) == 16, "ModuleInfo size wrong");
+
+/* Module file layout after the original 256-byte header: ModuleInfo,
+ * then the CRC-32 of the 32KiB resident image.
+ */
+constexpr size_t module_file_info_offset = 256;
+constexpr size_t module_file_crc_offset = module_file_info_offset + sizeof(ModuleInfo);
+constexpr size_t module_file_image_offset = 512;
+
+#endif/*__MODULE_INFO_H__*/
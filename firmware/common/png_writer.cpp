@@ -21,6 +21,9 @@
 
 #include "png_writer.hpp"
 
+#include <algorithm>
+#include <cstdlib>
+
 static constexpr std::array<uint8_t, 8> png_file_header { {
 	0x89, 0x50, 0x4e, 0x47,
 	0x0d, 0x0a, 0x1a, 0x0a,
@@ -51,51 +54,124 @@ static constexpr std::array<uint8_t, 12> png_iend { {
 
 PNGWriter::PNGWriter(
 	const std::string& filename
-) : file { filename, File::openmode::out | File::openmode::binary | File::openmode::trunc }
+) : file { filename, File::openmode::out | File::openmode::binary | File::openmode::trunc },
+	deflate { [this](const uint8_t* const data, const size_t count) { this->emit(data, count); } },
+	prior_row { std::make_unique<uint8_t[]>(row_bytes) },
+	filtered_row { std::make_unique<uint8_t[]>(1 + row_bytes) },
+	chunk_buffers { std::make_unique<uint8_t[]>(chunk_size * chunk_count) }
 {
+	// The buffer being filled is implicitly owned by the caller.
+	chSemInit(&chunks_empty, chunk_count - 1);
+
 	file.write(png_file_header);
 	file.write(png_ihdr_screen_capture);
-	
-	write_chunk_header(
-		2 + height * (5 + 1 + width * 3) + 4,
-		png_idat_chunk_type
-	);
 
 	constexpr std::array<uint8_t, 2> zlib_header { 0x78, 0x01 };	// Zlib CM, CINFO, FLG.
-	write_chunk_content(zlib_header);
+	emit(zlib_header.data(), zlib_header.size());
 }
 
 PNGWriter::~PNGWriter() {
-	write_chunk_content(adler_32.bytes());
-	write_chunk_crc();
+	deflate.finish();
+	const auto adler_32_bytes = adler_32.bytes();
+	emit(adler_32_bytes.data(), adler_32_bytes.size());
+
+	submit_chunk();
+
+	// Wait for the remaining chunks to reach the card.
+	for(size_t i=1; i<chunk_count; i++) {
+		chSemWait(&chunks_empty);
+	}
 
 	file.write(png_iend);
 }
 
 void PNGWriter::write_scanline(const std::array<ui::ColorRGB888, 240>& scanline) {
-	constexpr uint8_t scanline_filter_type = 0;
-	constexpr uint32_t deflate_block_length = 1 + sizeof(scanline);
-
-	const std::array<uint8_t, 6> deflate_and_scanline_header {
-		static_cast<uint8_t>((scanline_count == (height - 1)) ? 0x01 : 0x00),	// DEFLATE header bits, bfinal=0, btype=00
-		static_cast<uint8_t>((deflate_block_length >> 0) & 0xff),			// Length LSB
-		static_cast<uint8_t>((deflate_block_length >> 8) & 0xff),			// Length MSB
-		static_cast<uint8_t>((deflate_block_length >> 0) & 0xff) ^ 0xff,	// ~Length LSB
-		static_cast<uint8_t>((deflate_block_length >> 8) & 0xff) ^ 0xff,	// ~Length MSB
-		scanline_filter_type,
-	};
-	write_chunk_content(deflate_and_scanline_header);
+	static_assert(sizeof(scanline) == row_bytes, "Scanline size does not match image width");
+
+	const auto row = reinterpret_cast<const uint8_t*>(scanline.data());
+	const auto prior = prior_row.get();
+
+	/* Pick the filter with the smallest sum of absolute (signed) residuals,
+	 * the heuristic recommended by the PNG specification. Only None, Sub and
+	 * Up are tried; Average and Paeth cost more than they save here.
+	 */
+	uint32_t sum_none = 0;
+	uint32_t sum_sub = 0;
+	uint32_t sum_up = 0;
+	for(size_t i=0; i<row_bytes; i++) {
+		const uint8_t left = (i >= bytes_per_pixel) ? row[i - bytes_per_pixel] : 0;
+		sum_none += std::abs(static_cast<int8_t>(row[i]));
+		sum_sub += std::abs(static_cast<int8_t>(row[i] - left));
+		sum_up += std::abs(static_cast<int8_t>(row[i] - prior[i]));
+	}
+
+	uint8_t filter_type = 0;
+	if( (sum_sub < sum_none) && (sum_sub <= sum_up) ) {
+		filter_type = 1;
+	} else if( sum_up < sum_none ) {
+		filter_type = 2;
+	}
+
+	auto filtered = filtered_row.get();
+	filtered[0] = filter_type;
+	for(size_t i=0; i<row_bytes; i++) {
+		const uint8_t left = (i >= bytes_per_pixel) ? row[i - bytes_per_pixel] : 0;
+		switch(filter_type) {
+		case 1:  filtered[1 + i] = row[i] - left;		break;
+		case 2:  filtered[1 + i] = row[i] - prior[i];	break;
+		default: filtered[1 + i] = row[i];			break;
+		}
+	}
+
+	compress(filtered, 1 + row_bytes);
+
+	std::copy(&row[0], &row[row_bytes], prior);
+}
+
+void PNGWriter::compress(const void* const data, const size_t count) {
+	adler_32.feed(data, count);
+	deflate.feed(reinterpret_cast<const uint8_t*>(data), count);
+}
+
+void PNGWriter::emit(const uint8_t* data, size_t count) {
+	while( count ) {
+		if( fill_length == chunk_size ) {
+			submit_chunk();
+		}
+		const auto chunk = &chunk_buffers[fill_index * chunk_size];
+		const auto n = std::min(count, chunk_size - fill_length);
+		std::copy(&data[0], &data[n], &chunk[fill_length]);
+		fill_length += n;
+		data += n;
+		count -= n;
+	}
+}
+
+void PNGWriter::submit_chunk() {
+	// Queue the filled buffer for the SD I/O thread and wait for the other to drain.
+	const auto index = fill_index;
+	const auto length = fill_length;
 
-	adler_32.feed(scanline_filter_type);
-	adler_32.feed(scanline);
+	auto& request = requests[index];
+	request.priority = sd_io::Priority::Interactive;
+	request.step = [this, index, length]() {
+		this->write_chunk(&this->chunk_buffers[index * chunk_size], length);
+		return true;
+	};
+	request.on_complete = [this]() {
+		chSemSignal(&this->chunks_empty);
+	};
+	sd_io::submit(request);
 
-	// Small writes to avoid some sort of large-transfer plus block
-	// boundary FatFs or SDC driver bug?
-	write_chunk_content(&scanline[  0], 80 * sizeof(ui::ColorRGB888));
-	write_chunk_content(&scanline[ 80], 80 * sizeof(ui::ColorRGB888));
-	write_chunk_content(&scanline[160], 80 * sizeof(ui::ColorRGB888));
+	fill_index = (fill_index + 1) % chunk_count;
+	fill_length = 0;
+	chSemWait(&chunks_empty);
+}
 
-	scanline_count++;
+void PNGWriter::write_chunk(const uint8_t* const data, const size_t length) {
+	write_chunk_header(length, png_idat_chunk_type);
+	write_chunk_content(data, length);
+	write_chunk_crc();
 }
 
 void PNGWriter::write_chunk_header(
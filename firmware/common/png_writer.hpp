@@ -26,10 +26,15 @@
 #include <cstddef>
 #include <string>
 #include <array>
+#include <memory>
+
+#include "ch.h"
 
 #include "ui.hpp"
 #include "file.hpp"
 #include "crc.hpp"
+#include "deflate.hpp"
+#include "sd_io.hpp"
 
 class PNGWriter {
 public:
@@ -42,12 +47,35 @@ private:
 	// TODO: These constants are baked in a few places, do not change blithely.
 	static constexpr int width { 240 };
 	static constexpr int height { 320 };
+	static constexpr size_t bytes_per_pixel { 3 };
+	static constexpr size_t row_bytes { width * bytes_per_pixel };
+
+	/* Compressed data is emitted as a series of IDAT chunks of this size. Two
+	 * chunk buffers alternate: the caller keeps reading back and compressing
+	 * scanlines into one while the SD I/O thread puts the other on the card.
+	 */
+	static constexpr size_t chunk_size { 2048 };
+	static constexpr size_t chunk_count { 2 };
 
 	File file;
-	int scanline_count { 0 };
 	CRC<32, true, true> crc { 0x04c11db7, 0xffffffff, 0xffffffff };
 	Adler32 adler_32;
+	Deflate deflate;
+
+	std::unique_ptr<uint8_t[]> prior_row;
+	std::unique_ptr<uint8_t[]> filtered_row;
+
+	std::unique_ptr<uint8_t[]> chunk_buffers;
+	std::array<sd_io::Request, chunk_count> requests;
+	size_t fill_index { 0 };
+	size_t fill_length { 0 };
+	Semaphore chunks_empty;
+
+	void compress(const void* const data, const size_t count);
+	void emit(const uint8_t* data, size_t count);
+	void submit_chunk();
 
+	void write_chunk(const uint8_t* const data, const size_t length);
 	void write_chunk_header(const size_t length, const std::array<uint8_t, 4>& type);
 	void write_chunk_content(const void* const p, const size_t count);
 
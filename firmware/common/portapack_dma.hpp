@@ -42,6 +42,7 @@ constexpr size_t i2s0_tx_gpdma_channel_number = 2;
 constexpr size_t i2s0_rx_gpdma_channel_number = 3;
 constexpr size_t adc1_gpdma_channel_number = 4;
 constexpr size_t adc0_gpdma_channel_number = 5;
+constexpr size_t module_load_gpdma_channel_number = 7;
 
 constexpr gpdma::mux::MUX gpdma_mux {
 	.peripheral_0  = gpdma::mux::Peripheral0::SGPIO14,
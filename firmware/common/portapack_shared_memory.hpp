@@ -71,6 +71,11 @@ struct SharedMemory {
 	int32_t excursion;
 	
 	bool transmit_done;
+
+	// Memory-mapped SPI flash address of the running baseband image, from
+	// which the M4 loads processor overlays. Zero if the image was loaded
+	// from somewhere the M4 can't read, such as the SD card.
+	uint32_t baseband_image_base;
 };
 
 extern SharedMemory& shared_memory;
@@ -59,6 +59,14 @@ constexpr region_t application {
 	.size = 0x40000,
 };
 
+/* Baseband module store: a module table followed by 4KiB-aligned images,
+ * see application/module_store.hpp.
+ */
+constexpr region_t modules {
+	.offset = 0x80000,
+	.size = 0x80000,
+};
+
 } /* namespace spi_flash */
 } /* namespace portapack */
 
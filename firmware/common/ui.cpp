@@ -25,6 +25,14 @@
 
 namespace ui {
 
+Color blend(const Color background, const Color foreground, const uint32_t level, const uint32_t level_max) {
+	const uint32_t inverse = level_max - level;
+	const uint32_t r = (((background.v >> 11) & 0x1f) * inverse + ((foreground.v >> 11) & 0x1f) * level) / level_max;
+	const uint32_t g = (((background.v >>  5) & 0x3f) * inverse + ((foreground.v >>  5) & 0x3f) * level) / level_max;
+	const uint32_t b = (((background.v >>  0) & 0x1f) * inverse + ((foreground.v >>  0) & 0x1f) * level) / level_max;
+	return { static_cast<uint16_t>((r << 11) | (g << 5) | b) };
+}
+
 bool Rect::contains(const Point p) const {
 	return (p.x >= left()) && (p.y >= top()) &&
 	       (p.x < right()) && (p.y < bottom());
@@ -101,6 +101,9 @@ struct Color {
 	}
 };
 
+/* Linear mix of two colors, level in [0, level_max]. */
+Color blend(const Color background, const Color foreground, const uint32_t level, const uint32_t level_max);
+
 struct ColorRGB888 {
 	uint8_t r;
 	uint8_t g;
@@ -245,6 +248,17 @@ struct Bitmap {
 	const uint8_t* const data;
 };
 
+/* Palette-indexed bitmap, pre-packed by tools/make_bitmap_runs.py into
+ * row-major runs: [7:4] length code, [3:0] palette index. Codes 0..14
+ * are runs of (code + 1) pixels, code 15 is a run of (16 + next byte).
+ */
+struct RunBitmap {
+	const Size size;
+	const Color* const palette;
+	const uint8_t* const runs;
+	const int8_t transparent_index;		// -1 if opaque
+};
+
 enum class KeyEvent {
 	/* Ordinals map to bit positions reported by CPLD */
 	Right = 0,
@@ -26,8 +26,17 @@
 #include "portapack.hpp"
 using namespace portapack;
 
+#include <array>
+#include <algorithm>
+
 namespace ui {
 
+namespace {
+
+std::array<Color, Painter::tile_width * Painter::tile_height> tile_buffer;
+
+} /* namespace */
+
 Style Style::invert() const {
 	return {
 		.font = font,
@@ -38,15 +47,15 @@ Style Style::invert() const {
 
 int Painter::draw_char(const Point p, const Style& style, const char c) {
 	const auto glyph = style.font.glyph(c);
-	display.draw_glyph(p, glyph, style.foreground, style.background);
+	draw_glyph(p, glyph, style.foreground, style.background);
 	return glyph.advance().x;
 }
 
-int Painter::draw_string(Point p, const Style& style, const std::string text) {
+int Painter::draw_string(Point p, const Style& style, const std::string& text) {
 	size_t width = 0;
 	for(const auto c : text) {
 		const auto glyph = style.font.glyph(c);
-		display.draw_glyph(p, glyph, style.foreground, style.background);
+		draw_glyph(p, glyph, style.foreground, style.background);
 		const auto advance = glyph.advance();
 		p += advance;
 		width += advance.x;
@@ -55,15 +64,57 @@ int Painter::draw_string(Point p, const Style& style, const std::string text) {
 }
 
 void Painter::draw_bitmap(const Point p, const Bitmap& bitmap, const Color foreground, const Color background) {
-	display.draw_bitmap(p, bitmap.size, bitmap.data, foreground, background);
+	if( tile_rect.is_empty() ) {
+		display.draw_bitmap(p, bitmap.size, bitmap.data, foreground, background);
+	} else {
+		const Color ramp[2] { background, foreground };
+		draw_tile_bits(p, bitmap.size, bitmap.size.w, bitmap.data, 1, ramp);
+	}
+}
+
+void Painter::draw_glyph(const Point p, const Glyph& glyph, const Color foreground, const Color background) {
+	if( tile_rect.is_empty() ) {
+		display.draw_glyph(p, glyph, foreground, background);
+	} else {
+		const uint32_t level_max = (1U << glyph.bpp()) - 1;
+		Color ramp[4];
+		for(size_t i=0; i<=level_max; i++) {
+			ramp[i] = blend(background, foreground, i, level_max);
+		}
+		draw_tile_bits(p, { glyph.advance().x, glyph.h() }, glyph.w(), glyph.pixels(), glyph.bpp(), ramp);
+	}
+}
+
+void Painter::draw_tile_bits(
+	const Point p,
+	const Size size,
+	const size_t row_pixels,
+	const uint8_t* const data,
+	const size_t bpp,
+	const Color* const ramp
+) {
+	const auto clipped = Rect { p, size }.intersect(tile_rect);
+	if( clipped.is_empty() ) {
+		return;
+	}
+
+	const uint32_t mask = (1U << bpp) - 1;
+	for(int y=clipped.top(); y<clipped.bottom(); y++) {
+		auto target = &tile_buffer[(y - tile_rect.top()) * tile_rect.width() + (clipped.left() - tile_rect.left())];
+		size_t bit = ((y - p.y) * row_pixels + (clipped.left() - p.x)) * bpp;
+		for(int x=clipped.left(); x<clipped.right(); x++) {
+			*(target++) = ramp[(data[bit >> 3] >> (bit & 7)) & mask];
+			bit += bpp;
+		}
+	}
 }
 
 void Painter::draw_hline(Point p, int width, const Color c) {
-	display.fill_rectangle({ p, { width, 1 } }, c);
+	fill_rectangle({ p, { width, 1 } }, c);
 }
 
 void Painter::draw_vline(Point p, int height, const Color c) {
-	display.fill_rectangle({ p, { 1, height } }, c);
+	fill_rectangle({ p, { 1, height } }, c);
 }
 
 void Painter::draw_rectangle(const Rect r, const Color c) {
@@ -74,17 +125,31 @@ void Painter::draw_rectangle(const Rect r, const Color c) {
 }
 
 void Painter::fill_rectangle(const Rect r, const Color c) {
-	display.fill_rectangle(r, c);
+	if( tile_rect.is_empty() ) {
+		display.fill_rectangle(r, c);
+	} else {
+		const auto clipped = r.intersect(tile_rect);
+		if( clipped.is_empty() ) {
+			return;
+		}
+		for(int y=clipped.top(); y<clipped.bottom(); y++) {
+			const auto row = &tile_buffer[(y - tile_rect.top()) * tile_rect.width() + (clipped.left() - tile_rect.left())];
+			std::fill(row, row + clipped.width(), c);
+		}
+	}
 }
 
-void Painter::paint_widget_tree(Widget* const w) {
+bool Painter::paint_widget_tree(Widget* const w, const systime_t deadline) {
 	if( ui::is_dirty() ) {
-		paint_widget(w);
+		if( !paint_widget(w, deadline) ) {
+			return false;
+		}
 		ui::dirty_clear();
 	}
+	return true;
 }
 
-void Painter::paint_widget(Widget* const w) {
+bool Painter::paint_widget(Widget* const w, const systime_t deadline) {
 	if( w->hidden() ) {
 		// Mark widget (and all children) as invisible.
 		w->visible(false);
@@ -92,21 +157,103 @@ void Painter::paint_widget(Widget* const w) {
 		// Mark this widget as visible and recurse.
 		w->visible(true);
 
-		if( w->dirty() ) {
+		// A composite pass cut short is resumed even though the widget
+		// is clean, so a dirty one can be told apart as invalidated again.
+		if( w->dirty() || (w == composited_pending) ) {
+			// Out of time: leave this widget (and its subtree) for the next frame.
+			if( static_cast<int32_t>(chTimeNow() - deadline) >= 0 ) {
+				return false;
+			}
+
+			if( w->composited() ) {
+				return paint_composited(w, deadline);
+			}
+
 			w->paint(*this);
-			// Force-paint all children.
+			// Force-paint all children. The widget is marked clean before
+			// descending, so a deferred child doesn't repaint its parent.
 			for(const auto child : w->children()) {
 				child->set_dirty();
-				paint_widget(child);
 			}
 			w->set_clean();
-		} else {
-			// Selectively paint all children.
-			for(const auto child : w->children()) {
-				paint_widget(child);
+		}
+
+		for(const auto child : w->children()) {
+			if( !paint_widget(child, deadline) ) {
+				return false;
 			}
 		}
 	}
+	return true;
+}
+
+/* At least one strip goes out per call. If the deadline passes after
+ * that, the next frame carries on from the strip after the last one sent.
+ * Anything below it that changed in the meantime may be in strips already
+ * sent, so another full pass follows. If the widget itself is dirtied
+ * again first (e.g. its parent repainted over it), start over instead.
+ */
+bool Painter::paint_composited(Widget* const w, const systime_t deadline) {
+	// The composited widget must cover its own rectangle (e.g. a View
+	// filling its background), or stale strip contents will show through.
+	const auto r = w->screen_rect().intersect(display.screen_rect());
+
+	int y = r.top();
+	if( (w == composited_pending) && !w->dirty() ) {
+		y = composited_next_y;
+		composited_repaint |= children_dirty(w);
+	} else {
+		composited_repaint = false;
+	}
+	composited_pending = nullptr;
+
+	for(bool first=true; y<r.bottom(); y+=tile_height, first=false) {
+		if( !first && (static_cast<int32_t>(chTimeNow() - deadline) >= 0) ) {
+			composited_pending = w;
+			composited_next_y = y;
+			return false;
+		}
+
+		tile_rect = { r.left(), y, r.width(), std::min<int>(tile_height, r.bottom() - y) };
+		paint_tile(w);
+		display.render_box(tile_rect.pos, tile_rect.size, tile_buffer.data());
+		tile_rect = { };
+	}
+
+	if( composited_repaint ) {
+		composited_repaint = false;
+		w->set_dirty();
+		return false;
+	}
+	return true;
+}
+
+bool Painter::children_dirty(const Widget* const w) {
+	for(const auto child : w->children()) {
+		if( child->hidden() ) {
+			continue;
+		}
+		if( child->dirty() || children_dirty(child) ) {
+			return true;
+		}
+	}
+	return false;
+}
+
+void Painter::paint_tile(Widget* const w) {
+	if( w->hidden() ) {
+		w->visible(false);
+		return;
+	}
+
+	w->visible(true);
+	if( !w->screen_rect().intersect(tile_rect).is_empty() ) {
+		w->paint(*this);
+	}
+	for(const auto child : w->children()) {
+		paint_tile(child);
+	}
+	w->set_clean();
 }
 
 } /* namespace ui */
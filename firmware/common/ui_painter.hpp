@@ -25,6 +25,8 @@
 #include "ui.hpp"
 #include "ui_text.hpp"
 
+#include "ch.h"
+
 #include <string>
 
 namespace ui {
@@ -48,19 +50,47 @@ public:
 
 	int draw_char(const Point p, const Style& style, const char c);
 
-	int draw_string(Point p, const Style& style, const std::string text);
+	int draw_string(Point p, const Style& style, const std::string& text);
 
 	void draw_bitmap(const Point p, const Bitmap& bitmap, const Color background, const Color foreground);
 
 	void draw_rectangle(const Rect r, const Color c);
 	void fill_rectangle(const Rect r, const Color c);
 
-	void paint_widget_tree(Widget* const w);
+	/* Paint dirty widgets until the deadline passes. Returns false if
+	 * painting was cut short; unpainted widgets stay dirty for next time.
+	 */
+	bool paint_widget_tree(Widget* const w, const systime_t deadline);
+
+	/* Offscreen strip used to composite widgets marked set_composited().
+	 * The whole subtree is drawn into RAM one strip at a time, then each
+	 * strip goes to the display in a single window write.
+	 */
+	static constexpr Dim tile_width = 240;
+	static constexpr Dim tile_height = 16;
 	
 private:
+	Rect tile_rect { };		// Empty when drawing straight to the display.
+	/* Composited widget cut short by the deadline, and where to resume. */
+	const Widget* composited_pending { nullptr };
+	int composited_next_y { 0 };
+	bool composited_repaint { false };
+
 	void draw_hline(Point p, int width, const Color c);
 	void draw_vline(Point p, int height, const Color c);
-	void paint_widget(Widget* const w);
+	void draw_glyph(const Point p, const Glyph& glyph, const Color foreground, const Color background);
+	void draw_tile_bits(
+		const Point p,
+		const Size size,
+		const size_t row_pixels,
+		const uint8_t* const data,
+		const size_t bpp,
+		const Color* const ramp
+	);
+	bool paint_widget(Widget* const w, const systime_t deadline);
+	bool paint_composited(Widget* const w, const systime_t deadline);
+	static bool children_dirty(const Widget* const w);
+	void paint_tile(Widget* const w);
 };
 
 } /* namespace ui */
@@ -23,31 +23,37 @@
 
 namespace ui {
 
-Glyph Font::glyph(const char c) const {
+size_t Font::index_of(const char c) const {
+	// Characters outside the font map to the first glyph.
 	if( c < c_start ) {
-		return { w, h, data };
+		return 0;
 	}
 	const size_t index = c - c_start;
-	if( index >= c_count ) {
-		return { w, h, data };
-	} else {
-		return { w, h, &data[index * data_stride] };
-	}
+	return (index >= c_count) ? 0 : index;
+}
+
+Glyph Font::glyph(const char c) const {
+	const auto index = index_of(c);
+	return { w, h, &data[index * data_stride], bpp, char_width(c) };
+}
+
+Dim Font::char_width(const char c) const {
+	return advances ? advances[index_of(c)] : w;
 }
 
 Dim Font::line_height() const {
 	return h;
 }
 
-Size Font::size_of(const std::string s) const {
-	Size size;
+Size Font::size_of(const std::string& s) const {
+	if( !advances ) {
+		return { static_cast<int>(s.size()) * w, s.empty() ? 0 : h };
+	}
 
+	Size size { 0, s.empty() ? 0 : h };
 	for(const auto c : s) {
-		const auto glyph_data = glyph(c);
-		size.w += glyph_data.w();
-		size.h = std::max(size.h, glyph_data.h());
+		size.w += advances[index_of(c)];
 	}
-
 	return size;
 }
 
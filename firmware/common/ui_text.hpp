@@ -36,8 +36,20 @@ public:
 		Dim w,
 		Dim h,
 		const uint8_t* const pixels
+	) : Glyph { w, h, pixels, 1, w }
+	{
+	}
+
+	constexpr Glyph(
+		Dim w,
+		Dim h,
+		const uint8_t* const pixels,
+		uint8_t bpp,
+		Dim advance
 	) : w_ { static_cast<uint8_t>(w) },
 		h_ { static_cast<uint8_t>(h) },
+		bpp_ { bpp },
+		advance_ { static_cast<uint8_t>(advance) },
 		pixels_ { pixels }
 	{
 	}
@@ -55,9 +67,15 @@ public:
 	}
 
 	Point advance() const {
-		return { w_, 0 };
+		return { advance_, 0 };
+	}
+
+	/* 1: on/off bitmap, 2: four coverage levels, blended fg-over-bg. */
+	uint8_t bpp() const {
+		return bpp_;
 	}
 
+	/* Pixels are row-major, w() pixels per row, LSB first. */
 	const uint8_t* pixels() const {
 		return pixels_;
 	}
@@ -65,6 +83,8 @@ public:
 private:
 	const uint8_t w_;
 	const uint8_t h_;
+	const uint8_t bpp_;
+	const uint8_t advance_;
 	const uint8_t* const pixels_;
 };
 
@@ -75,20 +95,27 @@ public:
 		Dim h,
 		const uint8_t* data,
 		char c_start,
-		size_t c_count
+		size_t c_count,
+		uint8_t bpp = 1,
+		const uint8_t* advances = nullptr
 	) : w { w },
 		h { h },
 		data { data },
 		c_start { c_start },
 		c_count { c_count },
-		data_stride { (w * h + 7U) >> 3 }
+		bpp { bpp },
+		advances { advances },
+		data_stride { (w * h * bpp + 7U) >> 3 }
 	{
 	}
 
 	Glyph glyph(const char c) const;
 
+	/* Width from the advance table (or fixed cell), without touching glyph data. */
+	Dim char_width(const char c) const;
+
 	Dim line_height() const;
-	Size size_of(const std::string s) const;
+	Size size_of(const std::string& s) const;
 
 private:
 	const Dim w;
@@ -96,7 +123,11 @@ private:
 	const uint8_t* const data;
 	const char c_start;
 	const size_t c_count;
+	const uint8_t bpp;
+	const uint8_t* const advances;
 	const size_t data_stride;
+
+	size_t index_of(const char c) const;
 };
 
 } /* namespace ui */
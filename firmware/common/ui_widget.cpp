@@ -187,6 +187,14 @@ void Widget::set_highlighted(const bool value) {
 	flags.highlighted = value;
 }
 
+bool Widget::composited() const {
+	return flags.composited;
+}
+
+void Widget::set_composited(const bool value) {
+	flags.composited = value;
+}
+
 void Widget::dirty_overlapping_children_in_rect(const Rect& child_rect) {
 	for(auto child : children()) {
 		if( !child_rect.intersect(child->parent_rect).is_empty() ) {
@@ -763,10 +771,10 @@ void ImageOptionsField::paint(Painter& painter) {
 	const auto paint_style = has_focus() ? style().invert() : style();
 
 	if( selected_index() < options.size() ) {
-		const auto bmp_ptr = options[selected_index()].first;
+		const auto bitmap = options[selected_index()].first;
 		painter.fill_rectangle({screen_rect().pos, {screen_rect().size.w + 4, screen_rect().size.h + 4}}, ui::Color::black());
 		painter.draw_rectangle({screen_rect().pos, {screen_rect().size.w + 4, screen_rect().size.h + 4}}, paint_style.background);
-		portapack::display.drawBMP({screen_pos().x + 2, screen_pos().y + 1}, bmp_ptr, true);
+		portapack::display.draw_run_bitmap({ screen_pos().x + 2, screen_pos().y + 2 }, *bitmap);
 	}
 }
 
@@ -112,6 +112,14 @@ public:
 
 	bool highlighted() const;
 	void set_highlighted(const bool value);
+
+	/* Paint this widget and its children offscreen in strips, then
+	 * flush each strip to the display in one write. The widget must
+	 * paint its whole rectangle, and the subtree must only draw through
+	 * the Painter (not portapack::display directly).
+	 */
+	bool composited() const;
+	void set_composited(const bool value);
 	
 	uint16_t id = 0;
 
@@ -130,6 +138,7 @@ private:
 		bool focusable : 1;		// Widget can receive focus.
 		bool highlighted : 1;	// Show in a highlighted style.
 		bool visible : 1;		// Object was visible during last paint.
+		bool composited : 1;	// Paint subtree offscreen, flush in strips.
 	};
 
 	flags_t flags {
@@ -138,6 +147,7 @@ private:
 		.focusable = false,
 		.highlighted = false,
 		.visible = false,
+		.composited = false,
 	};
 
 	static const std::vector<Widget*> no_children;
@@ -307,7 +317,7 @@ public:
 
 class ImageOptionsField : public Widget {
 public:
-	using image_t = const unsigned char *;
+	using image_t = const RunBitmap*;
 	using value_t = int32_t;
 	using option_t = std::pair<image_t, value_t>;
 	using options_t = std::vector<option_t>;
@@ -0,0 +1,171 @@
+#!/usr/bin/env python
+
+#
+# Copyright (C) 2016 Jared Boone, ShareBrained Technology, Inc.
+#
+# This file is part of PortaPack.
+#
+# This program is free software; you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation; either version 2, or (at your option)
+# any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program; see the file COPYING.  If not, write to
+# the Free Software Foundation, Inc., 51 Franklin Street,
+# Boston, MA 02110-1301, USA.
+#
+
+import sys
+import os
+import struct
+import wave
+
+usage_message = """
+PortaPack compressed capture decoder
+
+Usage: <command> <BBD_nnnn.CBF> [<output.C16>]
+       <command> [--rate <Hz>] <AUD_nnnn.RIC> [<output.WAV>]
+
+Decodes recordings made with "Pack" selected in the record controls.
+.CBF (block floating point IQ) becomes complex int16 .C16, the same
+format as an uncompressed capture. .RIC (Rice coded audio) becomes a
+16-bit mono WAV; the sample rate is read from the .TXT metadata file
+next to the recording unless --rate is given.
+"""
+
+# Keep in sync with baseband/stream_compressor.hpp.
+BFP_BLOCK_SAMPLES = 64
+RICE_FRAME_SAMPLES = 256
+RICE_VERBATIM = 0xff
+RICE_ESCAPE_QUOTIENT = 24
+RICE_ESCAPE_BITS = 18
+
+def decode_bfp(data):
+	block_bytes = 1 + BFP_BLOCK_SAMPLES * 2
+	out = bytearray()
+	for offset in range(0, len(data) - block_bytes + 1, block_bytes):
+		shift = data[offset]
+		values = struct.unpack_from('<%db' % (BFP_BLOCK_SAMPLES * 2), data, offset + 1)
+		out += struct.pack('<%dh' % len(values), *[v << shift for v in values])
+	return out
+
+class BitReader(object):
+	def __init__(self, data):
+		self.bits = ''.join(format(b, '08b') for b in data)
+		self.position = 0
+
+	def bit(self):
+		value = self.bits[self.position] == '1'
+		self.position += 1
+		return value
+
+	def read(self, n):
+		if n == 0:
+			return 0
+		value = int(self.bits[self.position:self.position + n], 2)
+		self.position += n
+		return value
+
+def to_int16(value):
+	value &= 0xffff
+	return value - 0x10000 if value & 0x8000 else value
+
+def decode_rice_frame(frame):
+	header = frame[2]
+	if header == RICE_VERBATIM:
+		return list(struct.unpack_from('<%dh' % RICE_FRAME_SAMPLES, frame, 3))
+
+	order = header >> 5
+	k = header & 0x1f
+	x = list(struct.unpack_from('<%dh' % order, frame, 3))
+	reader = BitReader(frame[3 + order * 2:])
+	while len(x) < RICE_FRAME_SAMPLES:
+		q = 0
+		while q < RICE_ESCAPE_QUOTIENT and reader.bit():
+			q += 1
+		if q == RICE_ESCAPE_QUOTIENT:
+			u = reader.read(RICE_ESCAPE_BITS)
+		else:
+			u = (q << k) | reader.read(k)
+		r = (u >> 1) ^ -(u & 1)
+		if order == 0:
+			prediction = 0
+		elif order == 1:
+			prediction = x[-1]
+		else:
+			prediction = 2 * x[-1] - x[-2]
+		x.append(to_int16(prediction + r))
+	return x
+
+def decode_rice(data):
+	out = bytearray()
+	offset = 0
+	while offset + 3 <= len(data):
+		frame_bytes = struct.unpack_from('<H', data, offset)[0]
+		if frame_bytes < 3 or offset + frame_bytes > len(data):
+			break
+		samples = decode_rice_frame(bytearray(data[offset:offset + frame_bytes]))
+		out += struct.pack('<%dh' % len(samples), *samples)
+		offset += frame_bytes
+	return out
+
+def read_sample_rate(stem):
+	try:
+		f = open(stem + '.TXT', 'r')
+	except IOError:
+		return None
+	for line in f:
+		key, _, value = line.strip().partition('=')
+		if key == 'sample_rate':
+			f.close()
+			return int(value)
+	f.close()
+	return None
+
+args = sys.argv[1:]
+rate = None
+if len(args) >= 2 and args[0] == '--rate':
+	rate = int(args[1])
+	args = args[2:]
+
+if len(args) not in (1, 2):
+	print(usage_message)
+	sys.exit(-1)
+
+input_path = args[0]
+stem, extension = os.path.splitext(input_path)
+
+f = open(input_path, 'rb')
+data = bytearray(f.read())
+f.close()
+
+if extension.upper() == '.CBF':
+	output_path = args[1] if len(args) == 2 else stem + '.C16'
+	samples = decode_bfp(data)
+	f = open(output_path, 'wb')
+	f.write(samples)
+	f.close()
+	count = len(samples) // 4
+elif extension.upper() == '.RIC':
+	output_path = args[1] if len(args) == 2 else stem + '.WAV'
+	rate = rate or read_sample_rate(stem)
+	if not rate:
+		raise Exception('%s: no sample rate, use --rate' % input_path)
+	samples = decode_rice(data)
+	w = wave.open(output_path, 'wb')
+	w.setnchannels(1)
+	w.setsampwidth(2)
+	w.setframerate(rate)
+	w.writeframes(bytes(samples))
+	w.close()
+	count = len(samples) // 2
+else:
+	raise Exception('%s: unknown file type' % input_path)
+
+print('%s: %d samples, %.2f:1' % (output_path, count, float(len(samples)) / max(len(data), 1)))
@@ -0,0 +1,186 @@
+#!/usr/bin/env python
+
+#
+# Copyright (C) 2016 Jared Boone, ShareBrained Technology, Inc.
+#
+# This file is part of PortaPack.
+#
+# This program is free software; you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation; either version 2, or (at your option)
+# any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program; see the file COPYING.  If not, write to
+# the Free Software Foundation, Inc., 51 Franklin Street,
+# Boston, MA 02110-1301, USA.
+#
+
+import sys
+import os
+import json
+
+usage_message = """
+PortaPack capture metadata to SigMF converter
+
+Usage: <command> [--trim] <BBD_nnnn.TXT> [<output.sigmf-meta>]
+
+Reads the metadata file the Capture app writes next to each .C16, .CBF
+or .RIC recording and writes a SigMF metadata file describing it. The
+sample file is referenced through core:dataset, so it can stay where it
+is. Retunes and gain changes made while recording become capture
+segments and annotations. Samples dropped by the card become
+core:global_index gaps.
+
+If the recording was cut short by power loss, the sample file runs on
+past the data into space reserved for it. The data up to the last length
+noted in the metadata is then copied to <output>.sigmf-data, which the
+metadata references instead. With --trim, the sample file itself is cut
+back to that length.
+
+The PortaPack clock has no time zone; its time is written as UTC.
+"""
+
+def parse_metadata(path):
+	settings = {}
+	events = []
+	f = open(path, 'r')
+	for line in f:
+		line = line.strip()
+		if not line:
+			continue
+		if line.startswith('@'):
+			position, _, setting = line[1:].partition(' ')
+			key, _, value = setting.partition('=')
+			events.append((int(position), key, value))
+		else:
+			key, _, value = line.partition('=')
+			settings[key] = value
+	f.close()
+	return settings, events
+
+def find_sample_file(stem):
+	for extension in ('.C16', '.CBF', '.RIC'):
+		path = stem + extension
+		if os.path.exists(path):
+			return path
+	raise Exception('no .C16, .CBF or .RIC file next to %s' % stem)
+
+def trim_sample_file(path, length):
+	f = open(path, 'r+b')
+	f.truncate(length)
+	f.close()
+	print('%s: cut back to %d bytes' % (path, length))
+
+def copy_sample_file(path, length, copy_path):
+	src = open(path, 'rb')
+	dst = open(copy_path, 'wb')
+	remaining = length
+	while remaining > 0:
+		data = src.read(min(remaining, 1 << 20))
+		if not data:
+			break
+		dst.write(data)
+		remaining -= len(data)
+	dst.close()
+	src.close()
+	print('%s: first %d bytes of %s' % (copy_path, length, path))
+
+def format_datetime(timestamp):
+	return '%s-%s-%sT%s:%s:%sZ' % (
+		timestamp[0:4], timestamp[4:6], timestamp[6:8],
+		timestamp[8:10], timestamp[10:12], timestamp[12:14]
+	)
+
+def capture_segment(position, dropped, state):
+	segment = {
+		'core:sample_start': position,
+		'core:global_index': position + dropped,
+		'core:frequency': int(state['center_frequency']),
+	}
+	for key in ('rf_amp', 'lna', 'vga'):
+		if key in state:
+			segment['portapack:%s' % key] = int(state[key])
+	return segment
+
+def to_sigmf(settings, events, dataset):
+	state = dict(settings)
+	dropped = 0
+
+	first = capture_segment(0, 0, state)
+	if 'datetime' in settings:
+		first['core:datetime'] = format_datetime(settings['datetime'])
+	captures = [first]
+	annotations = []
+
+	for position, key, value in sorted(events, key=lambda e: e[0]):
+		if key == 'dropped':
+			dropped += int(value)
+			comment = 'dropped %s samples' % value
+		else:
+			state[key] = value
+			comment = '%s=%s' % (key, value)
+
+		segment = capture_segment(position, dropped, state)
+		if captures[-1]['core:sample_start'] == position:
+			if 'core:datetime' in captures[-1]:
+				segment['core:datetime'] = captures[-1]['core:datetime']
+			captures[-1] = segment
+		else:
+			captures.append(segment)
+
+		annotations.append({
+			'core:sample_start': position,
+			'core:comment': comment,
+		})
+
+	return {
+		'global': {
+			'core:datatype': settings.get('datatype', 'ci16_le'),
+			'core:sample_rate': int(settings['sample_rate']),
+			'core:version': '1.0.0',
+			'core:recorder': 'PortaPack',
+			'core:dataset': dataset,
+			'core:extensions': [
+				{ 'name': 'portapack', 'version': '1.0.0', 'optional': True },
+			],
+		},
+		'captures': captures,
+		'annotations': annotations,
+	}
+
+args = sys.argv[1:]
+trim = '--trim' in args
+if trim:
+	args.remove('--trim')
+if len(args) not in (1, 2):
+	print(usage_message)
+	sys.exit(-1)
+
+input_path = args[0]
+stem = os.path.splitext(input_path)[0]
+output_path = args[1] if len(args) == 2 else stem + '.sigmf-meta'
+
+settings, events = parse_metadata(input_path)
+sample_path = find_sample_file(stem)
+if 'length' in settings and os.path.getsize(sample_path) > int(settings['length']):
+	if trim:
+		trim_sample_file(sample_path, int(settings['length']))
+	else:
+		copy_path = os.path.splitext(output_path)[0] + '.sigmf-data'
+		copy_sample_file(sample_path, int(settings['length']), copy_path)
+		sample_path = copy_path
+dataset = os.path.relpath(sample_path, os.path.dirname(os.path.abspath(output_path)))
+metadata = to_sigmf(settings, events, dataset)
+
+f = open(output_path, 'w')
+f.write(json.dumps(metadata, indent=2, sort_keys=True))
+f.write('\n')
+f.close()
+
+print('%s: %d capture segments, %d annotations' % (output_path, len(metadata['captures']), len(metadata['annotations'])))
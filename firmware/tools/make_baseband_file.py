@@ -21,6 +21,7 @@
 import sys
 import struct
 import md5
+import zlib
 
 usage_message = """
 Baseband module package file generator
@@ -39,6 +40,16 @@ def write_file(data, path):
 	f.write(data)
 	f.close()
 
+def find_module_info(data):
+	# ModuleInfo (see common/module_info.hpp) is word aligned in the
+	# resident code, and its size field follows the magic and ABI version
+	offset = data.find('PPMI')
+	while offset >= 0:
+		if (offset & 3) == 0 and struct.unpack_from('<H', data, offset + 6)[0] == 16:
+			return data[offset:offset + 16]
+		offset = data.find('PPMI', offset + 1)
+	raise RuntimeError('no ModuleInfo found in module image')
+
 if len(sys.argv) == 1:
 	print(usage_message)
 	sys.exit(-1)
@@ -54,9 +65,12 @@ sys.argv = sys.argv[1:]
 
 # Format for module file:
 # Magic (4), Version (2), Length (4), Name (16), MD5 (16), Description (214)
-# 0x00 pad bytes (256)
+# ModuleInfo (16) copied from the image, CRC-32 of the resident image (4)
+# 0x00 pad bytes (236)
 # Module binary (padded to 32768-16)
 # MD5 (16) again, so that module code can read it (dirty...)
+# Processor overlays, if the module has any (linked to load at 32768)
+# The resident image is the binary padding and MD5, 32768 bytes.
 
 for args in sys.argv:
 	m = md5.new()
@@ -67,7 +81,7 @@ for args in sys.argv:
 	info = 'PPM '
 	
 	# Version
-	info += struct.pack('H', 2)
+	info += struct.pack('H', 3)
 	
 	# Length
 	info += struct.pack('I', len(data))
@@ -95,14 +109,21 @@ for args in sys.argv:
 	description += (data_default_byte * pad_size)
 	info += description
 	
+	# Binary padding
+	resident = data[0:32768 - 16]
+	overlays = data[32768:]
+	pad_size = (32768 - 16) - len(resident)
+	resident += (data_default_byte * pad_size)
+	resident += digest
+	
+	# Compatibility information and resident image CRC
+	info += find_module_info(resident)
+	info += struct.pack('<I', zlib.crc32(bytes(resident)) & 0xffffffff)
+	
 	# Header padding to fit in SD card sector
-	info += (data_default_byte * 256)
+	info += (data_default_byte * (512 - len(info)))
 	
-	# Binary padding
-	data = info + data
-	pad_size = (32768 + 512 - 16) - len(data)
-	data += (data_default_byte * pad_size)
-	data += digest
+	data = info + resident + overlays
 	write_file(data, args + '.bin')
 	
 	# Add to modules.h
@@ -112,6 +133,6 @@ for args in sys.argv:
 	h_data += 'const char md5_' + args.replace('-','_') + '[16] = {' + md5sum + '};\n'
 	
 	# Update original binary with MD5 footprint
-	write_file(data[512:(32768+512)], args + '/build/' + args + '_inc.bin')
+	write_file(data[512:], args + '/build/' + args + '_inc.bin')
 
 write_file(h_data, 'common/modules.h')
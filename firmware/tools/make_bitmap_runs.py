@@ -0,0 +1,206 @@
+#!/usr/bin/env python
+
+# Copyright (C) 2016 Furrtek
+#
+# This program is free software; you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation; either version 2, or (at your option)
+# any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program; see the file COPYING.  If not, write to
+# the Free Software Foundation, Inc., 51 Franklin Street,
+# Boston, MA 02110-1301, USA.
+#
+
+import sys
+import struct
+
+usage_message = """
+Run-length bitmap header generator
+
+Usage: <command> <bitmap.bmp> <symbol_name> <output.hpp>
+
+Converts a 4-bit (RLE4 or uncompressed) BMP into a ui::RunBitmap:
+an RGB565 palette plus a top-down stream of palette runs, which
+lcd::ILI9341::draw_run_bitmap() streams straight to the display.
+Palette entries of pure magenta (FF00FF) are treated as transparent.
+"""
+
+# Run format, one or two bytes per run:
+# [7:4] length code, [3:0] palette index
+# Length code 0..14: run of (code + 1) pixels
+# Length code 15: run of (16 + next byte) pixels
+# Runs are row-major and may span rows.
+
+def read_file(path):
+	f = open(path, 'rb')
+	data = bytearray(f.read())
+	f.close()
+	return data
+
+def write_file(data, path):
+	f = open(path, 'w')
+	f.write(data)
+	f.close()
+
+def u16(data, offset):
+	return struct.unpack_from('<H', bytes(data), offset)[0]
+
+def u32(data, offset):
+	return struct.unpack_from('<I', bytes(data), offset)[0]
+
+def s32(data, offset):
+	return struct.unpack_from('<i', bytes(data), offset)[0]
+
+def decode_rle4(data, offset, width, height):
+	rows = [[0] * width for _ in range(height)]
+	x = 0
+	y = 0
+	while offset < len(data):
+		count = data[offset]
+		value = data[offset + 1]
+		offset += 2
+		if count:
+			for i in range(count):
+				if (x < width) and (y < height):
+					rows[y][x] = (value >> 4) if (i & 1) == 0 else (value & 15)
+				x += 1
+		elif value == 0:
+			x = 0
+			y += 1
+		elif value == 1:
+			break
+		elif value == 2:
+			x += data[offset]
+			y += data[offset + 1]
+			offset += 2
+		else:
+			for i in range(value):
+				byte = data[offset + (i >> 1)]
+				if (x < width) and (y < height):
+					rows[y][x] = (byte >> 4) if (i & 1) == 0 else (byte & 15)
+				x += 1
+			offset += (value + 1) >> 1
+			offset += offset & 1
+	return rows
+
+def decode_raw4(data, offset, width, height):
+	stride = ((width + 7) // 8) * 4
+	rows = []
+	for y in range(height):
+		row = []
+		for x in range(width):
+			byte = data[offset + y * stride + (x >> 1)]
+			row.append((byte >> 4) if (x & 1) == 0 else (byte & 15))
+		rows.append(row)
+	return rows
+
+def read_bmp(path):
+	data = read_file(path)
+	if data[0:2] != bytearray(b'BM'):
+		raise Exception('%s: not a BMP file' % path)
+
+	pixel_offset = u32(data, 0x0a)
+	header_size = u32(data, 0x0e)
+	width = s32(data, 0x12)
+	height = s32(data, 0x16)
+	bpp = u16(data, 0x1c)
+	compression = u32(data, 0x1e)
+	colors_used = u32(data, 0x2e) or 16
+
+	if bpp != 4:
+		raise Exception('%s: only 4-bit bitmaps are supported' % path)
+
+	palette = []
+	palette_offset = 0x0e + header_size
+	for i in range(colors_used):
+		b, g, r = data[palette_offset + i * 4:palette_offset + i * 4 + 3]
+		palette.append((r, g, b))
+
+	top_down = height < 0
+	height = abs(height)
+
+	if compression == 2:
+		rows = decode_rle4(data, pixel_offset, width, height)
+	elif compression == 0:
+		rows = decode_raw4(data, pixel_offset, width, height)
+	else:
+		raise Exception('%s: unsupported compression type %d' % (path, compression))
+
+	if not top_down:
+		rows.reverse()
+
+	return width, height, palette, rows
+
+def rgb565(color):
+	r, g, b = color
+	return ((r & 0xf8) << 8) | ((g & 0xfc) << 3) | ((b & 0xf8) >> 3)
+
+def encode_runs(rows):
+	pixels = [p for row in rows for p in row]
+	runs = bytearray()
+	i = 0
+	while i < len(pixels):
+		index = pixels[i]
+		length = 1
+		while (i + length < len(pixels)) and (pixels[i + length] == index) and (length < 16 + 255):
+			length += 1
+		if length < 16:
+			runs.append(((length - 1) << 4) | index)
+		else:
+			runs.append(0xf0 | index)
+			runs.append(length - 16)
+		i += length
+	return runs
+
+def format_array(values, per_line, fmt):
+	lines = []
+	for i in range(0, len(values), per_line):
+		lines.append('\t' + ', '.join(fmt % v for v in values[i:i + per_line]) + ',')
+	return '\n'.join(lines)
+
+if len(sys.argv) != 4:
+	print(usage_message)
+	sys.exit(-1)
+
+path, symbol, output_path = sys.argv[1:]
+
+width, height, palette, rows = read_bmp(path)
+
+transparent_index = -1
+for i, color in enumerate(palette):
+	if color == (0xff, 0x00, 0xff):
+		transparent_index = i
+
+runs = encode_runs(rows)
+
+guard = '__' + symbol.upper() + '_H__'
+
+out = '/*\n'
+out += ' * Generated by tools/make_bitmap_runs.py from %s, do not edit.\n' % path.split('/')[-1]
+out += ' */\n\n'
+out += '#ifndef %s\n' % guard
+out += '#define %s\n\n' % guard
+out += '#include "ui.hpp"\n\n'
+out += 'namespace ui {\n\n'
+out += 'static constexpr Color %s_palette[] = {\n' % symbol
+out += format_array([rgb565(c) for c in palette], 8, '0x%04x') + '\n'
+out += '};\n\n'
+out += 'static constexpr uint8_t %s_runs[] = {\n' % symbol
+out += format_array(list(runs), 12, '0x%02x') + '\n'
+out += '};\n\n'
+out += 'static constexpr RunBitmap %s {\n' % symbol
+out += '\t{ %d, %d }, %s_palette, %s_runs, %d\n' % (width, height, symbol, symbol, transparent_index)
+out += '};\n\n'
+out += '} /* namespace ui */\n\n'
+out += '#endif/*%s*/\n' % guard
+
+write_file(out, output_path)
+
+print('%s: %dx%d, %d colors, %d run bytes' % (path, width, height, len(palette), len(runs)))
@@ -0,0 +1,158 @@
+#!/usr/bin/env python
+
+# Copyright (C) 2016 Furrtek
+#
+# This program is free software; you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation; either version 2, or (at your option)
+# any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program; see the file COPYING.  If not, write to
+# the Free Software Foundation, Inc., 51 Franklin Street,
+# Boston, MA 02110-1301, USA.
+#
+
+import sys
+import re
+
+usage_message = """
+Anti-aliased 2x font generator
+
+Usage: <command> <ui_font_fixed_8x16.cpp> <font_name> <output.cpp>
+
+Scales the 1bpp 8x16 font up to 16x32 (Scale2x twice, then a 2x2 box
+filter), quantizes coverage to 2 bits per pixel and emits a ui::Font
+with a per-glyph advance table. Digits keep the full cell width so
+numbers stay aligned; other glyphs are left-trimmed to a 1 pixel
+bearing and advance by their ink width.
+"""
+
+SRC_W = 8
+SRC_H = 16
+SCALE = 2
+DST_W = SRC_W * SCALE
+DST_H = SRC_H * SCALE
+BPP = 2
+C_START = 0x20
+
+def read_glyphs(path):
+	f = open(path, 'r')
+	source = f.read()
+	f.close()
+	body = source[source.index('fixed_8x16_glyph_data'):]
+	body = body[body.index('{') + 1:body.index('};')]
+	data = [int(v, 16) for v in re.findall(r'0x([0-9a-fA-F]{2})', body)]
+	glyphs = []
+	for i in range(0, len(data), SRC_H):
+		rows = data[i:i + SRC_H]
+		glyphs.append([[(row >> x) & 1 for x in range(SRC_W)] for row in rows])
+	return glyphs
+
+def scale2x(src):
+	h = len(src)
+	w = len(src[0])
+	def px(x, y):
+		if (0 <= x < w) and (0 <= y < h):
+			return src[y][x]
+		return 0
+	dst = [[0] * (w * 2) for _ in range(h * 2)]
+	for y in range(h):
+		for x in range(w):
+			p = px(x, y)
+			a = px(x, y - 1)
+			b = px(x + 1, y)
+			c = px(x - 1, y)
+			d = px(x, y + 1)
+			dst[y * 2 + 0][x * 2 + 0] = a if (c == a and c != d and a != b) else p
+			dst[y * 2 + 0][x * 2 + 1] = b if (a == b and a != c and b != d) else p
+			dst[y * 2 + 1][x * 2 + 0] = c if (d == c and d != b and c != a) else p
+			dst[y * 2 + 1][x * 2 + 1] = d if (b == d and b != a and d != c) else p
+	return dst
+
+def downsample(src):
+	levels = (1 << BPP) - 1
+	dst = []
+	for y in range(0, len(src), 2):
+		row = []
+		for x in range(0, len(src[0]), 2):
+			coverage = src[y][x] + src[y][x + 1] + src[y + 1][x] + src[y + 1][x + 1]
+			row.append((coverage * levels + 2) // 4)
+		dst.append(row)
+	return dst
+
+def trim(glyph, c):
+	if c.isdigit():
+		return glyph, DST_W
+	columns = [x for x in range(DST_W) if any(row[x] for row in glyph)]
+	if not columns:
+		return glyph, DST_W // 2
+	shift = max(columns[0] - 1, 0)
+	shifted = [row[shift:] + [0] * shift for row in glyph]
+	advance = min(columns[-1] - columns[0] + 1 + 3, DST_W)
+	return shifted, advance
+
+def pack(glyph):
+	packed = bytearray((DST_W * DST_H * BPP + 7) // 8)
+	bit = 0
+	for row in glyph:
+		for level in row:
+			packed[bit >> 3] |= level << (bit & 7)
+			bit += BPP
+	return packed
+
+if len(sys.argv) != 4:
+	print(usage_message)
+	sys.exit(-1)
+
+source_path, name, output_path = sys.argv[1:]
+
+glyph_data = bytearray()
+advances = []
+for index, glyph in enumerate(read_glyphs(source_path)):
+	c = chr(C_START + index)
+	aa = downsample(scale2x(scale2x(glyph)))
+	aa, advance = trim(aa, c)
+	glyph_data += pack(aa)
+	advances.append(advance)
+
+stride = (DST_W * DST_H * BPP + 7) // 8
+
+out = '/*\n'
+out += ' * Generated by tools/make_font_aa.py from ui_font_fixed_8x16.cpp, do not edit.\n'
+out += ' */\n\n'
+out += '#include "ui_font_%s.hpp"\n\n' % name
+out += '#include <cstdint>\n\n'
+out += 'namespace ui {\n'
+out += 'namespace font {\n\n'
+out += 'namespace {\n\n'
+out += 'const uint8_t %s_glyph_data[] = {\n' % name
+for i in range(0, len(glyph_data), stride):
+	glyph = glyph_data[i:i + stride]
+	for j in range(0, stride, 16):
+		out += '\t' + ', '.join('0x%02x' % v for v in glyph[j:j + 16]) + ',\n'
+out = out[:-2] + '\n'
+out += '};\n\n'
+out += 'const uint8_t %s_advances[] = {\n' % name
+for i in range(0, len(advances), 16):
+	out += '\t' + ', '.join('%2d' % v for v in advances[i:i + 16]) + ',\n'
+out = out[:-2] + '\n'
+out += '};\n\n'
+out += '}\n\n'
+out += 'const ui::Font %s {\n' % name
+out += '\t%d, %d,\n' % (DST_W, DST_H)
+out += '\t%s_glyph_data,\n' % name
+out += '\t0x%02x, %d,\n' % (C_START, len(advances))
+out += '\t%d, %s_advances,\n' % (BPP, name)
+out += '};\n\n'
+out += '} /* namespace font */\n'
+out += '} /* namespace ui */\n'
+
+f = open(output_path, 'w')
+f.write(out)
+f.close()
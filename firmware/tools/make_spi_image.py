@@ -22,14 +22,31 @@
 #
 
 import sys
+import struct
 
 usage_message = """
 PortaPack SPI flash image generator
 
-Usage: <command> <bootstrap_path> <hackrf_path> <baseband_path> <application_path> <output_path>
-       Where paths refer to the .bin files for each component project.
+Usage: <command> <bootstrap_path> <hackrf_path> <baseband_path> <application_path> <output_path> [<module_path>...]
+       Where paths refer to the .bin files for each component project,
+       and module paths refer to baseband module files (as copied to the
+       SD card), which are placed in the module store.
 """
 
+# Module store, see application/module_store.hpp:
+# Table header: magic "PPMT" (4), version (2), count (2)
+# Table entry: MD5 (16), name (16), offset (4), size (4), entry point (4),
+#              ModuleInfo (16), resident image CRC-32 (4), both from the module file
+# Module images (resident code and overlays) at 4KiB-aligned offsets from
+# the start of the store
+
+modules_offset = 0x80000
+modules_size = 0x80000
+modules_max = 32
+module_align = 0x1000
+module_image_offset = 512
+module_image_size = 32768
+
 def read_image(path):
 	f = open(path, 'rb')
 	data = f.read()
@@ -46,7 +63,41 @@ def write_image(data, path):
 	f.write(data)
 	f.close()
 
-if len(sys.argv) != 6:
+def read_module(path):
+	data = read_image(path)
+	if data[0:4] != b'PPM ':
+		raise RuntimeError('%s is not a baseband module file' % path)
+	if struct.unpack_from('<H', data, 4)[0] < 3:
+		raise RuntimeError('%s predates module compatibility information' % path)
+	image = data[module_image_offset:]
+	if len(image) < module_image_size:
+		raise RuntimeError('%s is truncated' % path)
+	return {
+		'name': data[10:26],
+		'md5': data[26:42],
+		'info': data[256:272],
+		'crc': struct.unpack_from('<I', data, 272)[0],
+		'data': image,
+		'entry': struct.unpack_from('<I', image, 4)[0],
+	}
+
+def make_module_store(modules):
+	if len(modules) > modules_max:
+		raise RuntimeError('too many modules (%d, max %d)' % (len(modules), modules_max))
+	table = struct.pack('<4sHH', b'PPMT', 2, len(modules))
+	images = bytearray()
+	offset = module_align
+	for module in modules:
+		table += struct.pack('<16s16sIII16sI', module['md5'], module['name'], offset, len(module['data']), module['entry'], module['info'], module['crc'])
+		pad_size = (-len(module['data'])) % module_align
+		images += module['data'] + (spi_image_default_byte * pad_size)
+		offset += len(module['data']) + pad_size
+	store = table + (spi_image_default_byte * (module_align - len(table))) + images
+	if len(store) > modules_size:
+		raise RuntimeError('module store size of %d exceeds %d bytes' % (len(store), modules_size))
+	return store
+
+if len(sys.argv) < 6:
 	print(usage_message)
 	sys.exit(-1)
 
@@ -55,6 +106,7 @@ hackrf_image = read_image_from_dfu(sys.argv[2])
 baseband_image = read_image(sys.argv[3])
 application_image = read_image(sys.argv[4])
 output_path = sys.argv[5]
+module_paths = sys.argv[6:]
 
 spi_size = 1048576
 
@@ -77,13 +129,22 @@ images = (
 	{
 		'name': 'application',
 		'data': application_image,
-		'size': len(application_image),
+		'size': modules_offset - 0x40000 if module_paths else len(application_image),
 	}
 )
 
 spi_image = bytearray()
 spi_image_default_byte = bytearray((255,))
 
+if module_paths:
+	images += (
+		{
+			'name': 'modules',
+			'data': make_module_store([read_module(path) for path in module_paths]),
+			'size': modules_size,
+		},
+	)
+
 for image in images:
 	if len(image['data']) > image['size']:
 		raise RuntimeError('data for image "%(name)s" is longer than 0x%(size)x bytes' % image)
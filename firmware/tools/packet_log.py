@@ -0,0 +1,179 @@
+#!/usr/bin/env python
+
+#
+# Copyright (C) 2016 Jared Boone, ShareBrained Technology, Inc.
+#
+# This file is part of PortaPack.
+#
+# This program is free software; you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation; either version 2, or (at your option)
+# any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program; see the file COPYING.  If not, write to
+# the Free Software Foundation, Inc., 51 Franklin Street,
+# Boston, MA 02110-1301, USA.
+#
+
+import sys
+import struct
+
+usage_message = """
+PortaPack binary packet log converter
+
+Usage: <command> [--csv] [--since YYYYMMDDhhmmss] <log.PKT> [<output>]
+
+Converts a packet log written by the AIS, ERT and TPMS apps to text
+(one "timestamp hex-bits" line per packet, like the old text logs) or
+to CSV. --since uses the log's index records to skip straight to the
+last group that starts before the given time.
+"""
+
+MAGIC = 0x4c505050
+VERSION = 2
+
+HEADER_FORMAT = '<IHHH'
+RECORD_FORMAT = '<IIIHBB'
+INDEX_FORMAT = '<IIIHBB'
+
+PROTOCOL_INDEX = 0
+PROTOCOLS = {
+	1: 'AIS',
+	2: 'TPMS',
+	3: 'ERT',
+}
+SUBTYPES = {
+	2: { 1: 'FLM', 2: 'Subaru', 3: 'GMC' },
+	3: { 0: 'Unknown', 1: 'IDM', 2: 'SCM' },
+}
+
+def date_time_key(date, time):
+	return (date << 32) | time
+
+def format_timestamp(date, time):
+	return '%04d%02d%02d%02d%02d%02d' % (
+		(date >> 16) & 0xfff, (date >> 8) & 0x0f, date & 0x1f,
+		(time >> 16) & 0x1f, (time >> 8) & 0x3f, time & 0x3f,
+	)
+
+def parse_timestamp(s):
+	if len(s) != 14 or not s.isdigit():
+		raise Exception('timestamp must be YYYYMMDDhhmmss: %s' % s)
+	date = (int(s[0:4]) << 16) | (int(s[4:6]) << 8) | int(s[6:8])
+	time = (int(s[8:10]) << 16) | (int(s[10:12]) << 8) | int(s[12:14])
+	return date_time_key(date, time)
+
+def bits_to_hex(bits, bit_length):
+	value = bytearray(bits)
+	digits = []
+	for i in range(0, bit_length, 4):
+		nibble = 0
+		for j in range(4):
+			n = i + j
+			bit = (value[n >> 3] >> (7 - (n & 7))) & 1 if n < bit_length else 0
+			nibble = (nibble << 1) | bit
+		digits.append('%x' % nibble)
+	return ''.join(digits)
+
+def record_slots(bit_length, slot_size):
+	return 1 + (bit_length + slot_size * 8 - 1) // (slot_size * 8)
+
+class PacketLog(object):
+	def __init__(self, data):
+		self.data = data
+		magic, version, self.slot_size, self.slots_per_group = struct.unpack_from(HEADER_FORMAT, data, 0)
+		if magic != MAGIC:
+			raise Exception('not a packet log')
+		if version != VERSION:
+			raise Exception('unsupported packet log version %d' % version)
+		self.slot_count = len(data) // self.slot_size
+
+	def slot(self, n):
+		return n * self.slot_size
+
+	def seek(self, since):
+		# Last group whose preceding records are all before since.
+		low = 0
+		high = (self.slot_count + self.slots_per_group - 1) // self.slots_per_group
+		while high - low > 1:
+			middle = (low + high) // 2
+			fields = struct.unpack_from(INDEX_FORMAT, self.data, self.slot(middle * self.slots_per_group))
+			if (fields[4] >> 4) == PROTOCOL_INDEX and date_time_key(fields[0], fields[1]) < since:
+				low = middle
+			else:
+				high = middle
+		return max(low * self.slots_per_group, 1)
+
+	def records(self, since=None):
+		n = 1 if since is None else self.seek(since)
+		while n < self.slot_count:
+			date, time, frequency, bit_length, type_, status = struct.unpack_from(RECORD_FORMAT, self.data, self.slot(n))
+			protocol = type_ >> 4
+			if protocol == PROTOCOL_INDEX:
+				n += 1
+				continue
+			slots = record_slots(bit_length, self.slot_size)
+			if n + slots > self.slot_count:
+				break
+			bits = self.data[self.slot(n + 1):self.slot(n + slots)]
+			n += slots
+			if since is not None and date_time_key(date, time) < since:
+				continue
+			yield {
+				'timestamp': format_timestamp(date, time),
+				'protocol': PROTOCOLS.get(protocol, str(protocol)),
+				'type': SUBTYPES.get(protocol, {}).get(type_ & 0x0f, str(type_ & 0x0f)),
+				'frequency': frequency,
+				'valid': (status & 1) != 0,
+				'bit_length': bit_length,
+				'bits': bits_to_hex(bits, bit_length),
+			}
+
+def main(args):
+	csv = False
+	since = None
+	paths = []
+	while args:
+		arg = args.pop(0)
+		if arg == '--csv':
+			csv = True
+		elif arg == '--since' and args:
+			since = parse_timestamp(args.pop(0))
+		else:
+			paths.append(arg)
+
+	if len(paths) not in (1, 2):
+		print(usage_message)
+		sys.exit(-1)
+
+	f = open(paths[0], 'rb')
+	log = PacketLog(f.read())
+	f.close()
+
+	lines = []
+	if csv:
+		lines.append('timestamp,protocol,type,frequency,valid,bit_length,bits')
+	for r in log.records(since):
+		if csv:
+			lines.append('%s,%s,%s,%d,%d,%d,%s' % (
+				r['timestamp'], r['protocol'], r['type'], r['frequency'],
+				1 if r['valid'] else 0, r['bit_length'], r['bits']
+			))
+		else:
+			lines.append('%s %s' % (r['timestamp'], r['bits']))
+
+	out = '\n'.join(lines) + '\n'
+	if len(paths) == 2:
+		f = open(paths[1], 'w')
+		f.write(out)
+		f.close()
+	else:
+		sys.stdout.write(out)
+
+main(sys.argv[1:])